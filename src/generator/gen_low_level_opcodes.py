@@ -281,6 +281,64 @@ def gen_short_instruction_cases(low_level_opcodes, interpreter_cpp_path):
     #lines = [line for line in lines if line.strip() != '']
     return '\n'.join(lines)
 
+# Element type suffix of the ElemMD opcodes -> (element type, eval stack type)
+MDARRAY_ELEMENT_TYPES = {
+    "I1": ("int8_t", "int32_t"),
+    "U1": ("uint8_t", "int32_t"),
+    "I2": ("int16_t", "int32_t"),
+    "U2": ("uint16_t", "int32_t"),
+    "I4": ("int32_t", "int32_t"),
+    "I8": ("int64_t", "int64_t"),
+    "I": ("intptr_t", "intptr_t"),
+}
+
+def gen_mdarray_element_cases(low_level_opcodes):
+    # The ElemMD opcodes only differ in rank, element type and access, all given by their names:
+    # (Ldelem|Stelem)MD<rank><element type> and LdelemaMD<rank>.
+    lines = []
+    padding = "                    "
+    for opcode in low_level_opcodes:
+        if opcode.base != "ElemMD":
+            continue
+        m = re.fullmatch(r'(Ldelema|Ldelem|Stelem)MD([1-9])(\w*)', opcode.name)
+        if m is None:
+            raise ValueError(f"ElemMD opcode {opcode.name!r} is not named (Ldelem|Stelem)MD<rank><type> or LdelemaMD<rank>")
+        access, rank, element_suffix = m.group(1), int(m.group(2)), m.group(3)
+        lines.append(f"{padding}LEANCLR_CASE_BEGIN{opcode.prefix}({opcode.name})")
+        lines.append(f"{padding}{{")
+        lines.append(f"{padding}    RtStackObject* frame_base = eval_stack_base + ir->frame_base;")
+        lines.append(f"{padding}    vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);")
+        lines.append(f"{padding}    if (!array)")
+        lines.append(f"{padding}    {{")
+        lines.append(f"{padding}        RAISE_RUNTIME_ERROR(RtErr::NullReference);")
+        lines.append(f"{padding}    }}")
+        lines.append(f"{padding}    int32_t index = vm::Array::get_mdarray_global_index<{rank}>(array, frame_base + 1);")
+        lines.append(f"{padding}    if (index < 0)")
+        lines.append(f"{padding}    {{")
+        lines.append(f"{padding}        RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);")
+        lines.append(f"{padding}    }}")
+        if access == "Ldelema":
+            if element_suffix:
+                raise ValueError(f"ElemMD opcode {opcode.name!r} takes no element type")
+            lines.append(f"{padding}    const void* element_addr = vm::Array::get_array_element_address_as_ptr_void(array, index);")
+            lines.append(f"{padding}    set_stack_value_at(frame_base, 0, element_addr);")
+        else:
+            if element_suffix not in MDARRAY_ELEMENT_TYPES:
+                raise ValueError(f"ElemMD opcode {opcode.name!r} has an unknown element type {element_suffix!r}")
+            element_type, stack_type = MDARRAY_ELEMENT_TYPES[element_suffix]
+            if access == "Ldelem":
+                lines.append(f"{padding}    {element_type} value = vm::Array::get_array_data_at<{element_type}>(array, index);")
+                if element_type == stack_type:
+                    lines.append(f"{padding}    set_stack_value_at<{stack_type}>(frame_base, 0, value);")
+                else:
+                    lines.append(f"{padding}    set_stack_value_at<{stack_type}>(frame_base, 0, static_cast<{stack_type}>(value));")
+            else:
+                lines.append(f"{padding}    {element_type} value = get_stack_value_at<{element_type}>(frame_base, {rank + 1});")
+                lines.append(f"{padding}    vm::Array::set_array_data_at<{element_type}>(array, index, value);")
+        lines.append(f"{padding}}}")
+        lines.append(f"{padding}LEANCLR_CASE_END{opcode.prefix}()")
+    return "\n".join(lines)
+
 if __name__ == "__main__":
     import sys
     if len(sys.argv) != 6:
@@ -316,7 +374,11 @@ if __name__ == "__main__":
     # 替换 SHORT_INSTRUCTION_CASES 区域
     short_cases = gen_short_instruction_cases(low_level_opcodes, interpreter_cpp_path)
     frr_interp.replace_region("SHORT_INSTRUCTION_CASES", short_cases)
+
+    # 替换 MDARRAY_ELEMENT_CASES 区域
+    frr_interp.replace_region("MDARRAY_ELEMENT_CASES", gen_mdarray_element_cases(low_level_opcodes))
     frr_interp.save()
     print(f"Updated COMPUTED_GOTO_LABELS in {interpreter_cpp_path}")
 
     print(f"Updated SHORT_INSTRUCTION_CASES in {interpreter_cpp_path}")
+    print(f"Updated MDARRAY_ELEMENT_CASES in {interpreter_cpp_path}")
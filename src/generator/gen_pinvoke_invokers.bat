@@ -0,0 +1 @@
+python gen_pinvoke_invokers.py ../runtime/vm/pinvoke_invokers.cpp
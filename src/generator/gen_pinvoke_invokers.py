@@ -0,0 +1,118 @@
+import itertools
+import sys
+
+import file_region_replacer
+
+# Signature classes of dynamically bound P/Invokes. Every managed parameter and return type reduces to one of
+# these, e.g. "i4(ptr,i4,ptr)" for int f(IntPtr, bool, ref int).
+NATIVE_TYPES = {
+    "v": "void",
+    "i4": "int32_t",
+    "i8": "int64_t",
+    "ptr": "void*",
+    "r4": "float",
+    "r8": "double",
+}
+
+STACK_OBJECT_MEMBERS = {
+    "i4": "i32",
+    "i8": "i64",
+    "ptr": "ptr",
+    "r4": "f32",
+    "r8": "f64",
+}
+
+VALUE_CLASSES = ["i4", "i8", "ptr", "r4", "r8"]
+RETURN_CLASSES = ["v"] + VALUE_CLASSES
+
+# Every signature of up to this many parameters of any class.
+MAX_FULL_PARAMS = 2
+# Longer signatures of handles and integers, as most C APIs take, returning nothing, an integer or a handle.
+MAX_HANDLE_PARAMS = 5
+HANDLE_PARAM_CLASSES = ["i4", "ptr"]
+HANDLE_RETURN_CLASSES = ["v", "i4", "ptr"]
+# Anything else worth binding without a hand-written invoker.
+EXTRA_SIGNATURES = [
+    "r8(r8,r8,r8)",
+    "r4(r4,r4,r4)",
+    "i4(ptr,ptr,ptr,i8)",
+    "i8(ptr,ptr,ptr,i8)",
+    "ptr(ptr,ptr,ptr,i8)",
+    "i4(ptr,i8,ptr,i8)",
+    "i8(ptr,i8,ptr,i8)",
+]
+
+
+def format_signature(ret, params):
+    return f"{ret}({','.join(params)})"
+
+
+def parse_signature(signature):
+    ret, params = signature[:-1].split("(")
+    return ret, [p for p in params.split(",") if p]
+
+
+def collect_signatures():
+    signatures = set()
+    for count in range(MAX_FULL_PARAMS + 1):
+        for params in itertools.product(VALUE_CLASSES, repeat=count):
+            for ret in RETURN_CLASSES:
+                signatures.add(format_signature(ret, params))
+    for count in range(MAX_FULL_PARAMS + 1, MAX_HANDLE_PARAMS + 1):
+        for params in itertools.product(HANDLE_PARAM_CLASSES, repeat=count):
+            for ret in HANDLE_RETURN_CLASSES:
+                signatures.add(format_signature(ret, params))
+    signatures.update(EXTRA_SIGNATURES)
+    # The runtime binary searches the table with strcmp.
+    return sorted(signatures, key=lambda s: s.encode("utf-8"))
+
+
+def get_invoker_name(signature):
+    ret, params = parse_signature(signature)
+    return "_".join(["invoke", ret] + params)
+
+
+def gen_invoker(signature):
+    ret, params = parse_signature(signature)
+    fn_type = f"{NATIVE_TYPES[ret]} (*)({', '.join(NATIVE_TYPES[p] for p in params)})"
+    args = ", ".join(f"params[{i}].{STACK_OBJECT_MEMBERS[p]}" for i, p in enumerate(params))
+    call = f"reinterpret_cast<{fn_type}>(method_pointer)({args})"
+    lines = [
+        f"// {signature}",
+        f"static RtResultVoid {get_invoker_name(signature)}(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,",
+        f"{' ' * (len(get_invoker_name(signature)) + 21)}const interp::RtStackObject* params, interp::RtStackObject* ret)",
+        "{",
+    ]
+    if ret == "v":
+        lines.append(f"    {call};")
+    elif ret == "i4":
+        lines.append(f"    int32_t result = {call};")
+        lines.append("    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));")
+    else:
+        lines.append(f"    {NATIVE_TYPES[ret]} result = {call};")
+        lines.append("    interp::EvalStackOp::set_return(ret, result);")
+    lines.append("    RET_VOID_OK();")
+    lines.append("}")
+    return "\n".join(lines)
+
+
+def gen_invokers(signatures):
+    return "\n\n".join(gen_invoker(s) for s in signatures)
+
+
+def gen_invoker_table(signatures):
+    return "\n".join(f'    {{"{s}", {get_invoker_name(s)}}},' for s in signatures)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print("Usage: python gen_pinvoke_invokers.py <pinvoke_invokers.cpp>")
+        sys.exit(1)
+    output_file_cpp = sys.argv[1]
+    signatures = collect_signatures()
+
+    frr_cpp = file_region_replacer.FileRegionReplacer(output_file_cpp)
+    frr_cpp.replace_region("PINVOKE_INVOKERS", gen_invokers(signatures))
+    frr_cpp.replace_region("PINVOKE_INVOKER_TABLE", gen_invoker_table(signatures))
+    frr_cpp.save()
+    print(f"Generated {len(signatures)} P/Invoke invokers in {output_file_cpp}")
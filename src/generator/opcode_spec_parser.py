@@ -114,10 +114,12 @@ def get_type_size(type_str):
             raise NotImplementedError(f"type {type_str!r} is not supported")
 
 class LowLevelOpcode:
-    def __init__(self, name, hlopcode, prefix,  params, variant, addr_mode):
+    def __init__(self, name, hlopcode, prefix,  params, variant, addr_mode, base=None):
         self.name = name
         self.hlopcode = hlopcode
         self.prefix = prefix
+        # name of the tplopcode the opcode is based on, if any
+        self.base = base
         # self.code = code
         self.params = params
         self.variant = variant
@@ -210,8 +212,8 @@ def parse_low_level_opcodes(xml_root, hlopcode_dic):
             addr_mode = AddressMode.LARGE
         else:
             addr_mode = None
-        if opcode_elem.get('base') is not None:
-            tpl_name = opcode_elem.get('base')
+        tpl_name = opcode_elem.get('base')
+        if tpl_name is not None:
             tpl = low_level_templates.get(tpl_name)
             if tpl is None:
                 raise ValueError(f"Template '{tpl_name}' not found for opcode '{name}'")
@@ -232,7 +234,7 @@ def parse_low_level_opcodes(xml_root, hlopcode_dic):
         param_size_type_str = opcode_elem.get('size_param')
         if param_size_type_str is not None and param_size_type_str == '1':
             params.append(OpcodeParam("size", None, "size", "size"))
-        opcode = LowLevelOpcode(name, hlopcode, prefix, params, variant, addr_mode)
+        opcode = LowLevelOpcode(name, hlopcode, prefix, params, variant, addr_mode, tpl_name)
         low_level_opcodes.append(opcode)
     return compile_low_level_opcodes(low_level_opcodes)
 
@@ -4,51 +4,72 @@
 #include <cstring>
 
 #include "rt_base.h"
+#include "memory_stats.h"
+
+#if LEANCLR_ENABLE_MEMORY_STATS
+#if defined(LEANCLR_PLATFORM_MAC) || defined(LEANCLR_PLATFORM_IOS)
+#include <malloc/malloc.h>
+#elif defined(LEANCLR_PLATFORM_WIN) || defined(LEANCLR_PLATFORM_POSIX) || defined(LEANCLR_PLATFORM_WASM)
+#include <malloc.h>
+#endif
+#endif
 
 namespace leanclr::alloc
 {
 class GeneralAllocation
 {
   public:
-    static void* malloc(size_t size)
+    // Allocations are counted in MemoryStats under the given category; free and realloc must be passed the
+    // category the block was allocated with.
+    static void* malloc(size_t size, MemoryCategory category = MemoryCategory::Other)
     {
-        return std::malloc(size);
+        return track_alloc(std::malloc(size), category);
     }
 
     template <typename T>
-    static T* malloc_any()
+    static T* malloc_any(MemoryCategory category = MemoryCategory::Other)
     {
-        void* ptr = malloc(sizeof(T));
+        void* ptr = malloc(sizeof(T), category);
         return static_cast<T*>(ptr);
     }
 
-    static void* malloc_zeroed(size_t size)
+    static void* malloc_zeroed(size_t size, MemoryCategory category = MemoryCategory::Other)
     {
-        return std::calloc(1, size);
+        return track_alloc(std::calloc(1, size), category);
     }
 
     template <typename T>
-    static T* malloc_any_zeroed()
+    static T* malloc_any_zeroed(MemoryCategory category = MemoryCategory::Other)
     {
-        void* ptr = malloc_zeroed(sizeof(T));
+        void* ptr = malloc_zeroed(sizeof(T), category);
         return static_cast<T*>(ptr);
     }
 
-    static void* calloc(size_t count, size_t size)
+    static void* calloc(size_t count, size_t size, MemoryCategory category = MemoryCategory::Other)
     {
-        return std::calloc(count, size);
+        return track_alloc(std::calloc(count, size), category);
     }
 
     template <typename T>
-    static T* calloc_any(size_t count)
+    static T* calloc_any(size_t count, MemoryCategory category = MemoryCategory::Other)
     {
-        void* ptr = calloc(count, sizeof(T));
+        void* ptr = calloc(count, sizeof(T), category);
         return static_cast<T*>(ptr);
     }
 
-    static void* realloc(void* ptr, size_t size)
+    static void* realloc(void* ptr, size_t size, MemoryCategory category = MemoryCategory::Other)
     {
-        return std::realloc(ptr, size);
+        size_t old_size = ptr ? get_allocation_size(ptr) : 0;
+        void* new_ptr = std::realloc(ptr, size);
+        if (new_ptr)
+        {
+            if (ptr)
+            {
+                MemoryStats::on_free(category, old_size);
+            }
+            track_alloc(new_ptr, category);
+        }
+        return new_ptr;
     }
 
     template <typename T, typename... Args>
@@ -72,10 +93,11 @@ class GeneralAllocation
         }
     }
 
-    static void free(void* ptr)
+    static void free(void* ptr, MemoryCategory category = MemoryCategory::Other)
     {
         if (ptr)
         {
+            MemoryStats::on_free(category, get_allocation_size(ptr));
             std::free(ptr);
         }
     }
@@ -84,9 +106,40 @@ class GeneralAllocation
     {
         if (ptr_location)
         {
-            std::free(ptr_location);
+            free(ptr_location);
             ptr_location = nullptr;
         }
     }
+
+    // Usable size of a block returned by the C allocator, which is what MemoryStats counts. 0 on platforms
+    // that cannot query it, which then only count allocations.
+    static size_t get_allocation_size(void* ptr)
+    {
+#if !LEANCLR_ENABLE_MEMORY_STATS
+        (void)ptr;
+        return 0;
+#elif defined(LEANCLR_PLATFORM_MAC) || defined(LEANCLR_PLATFORM_IOS)
+        return malloc_size(ptr);
+#elif defined(LEANCLR_PLATFORM_WIN)
+        return _msize(ptr);
+#elif defined(LEANCLR_PLATFORM_POSIX) || defined(LEANCLR_PLATFORM_WASM)
+        return malloc_usable_size(ptr);
+#else
+        (void)ptr;
+        return 0;
+#endif
+    }
+
+  private:
+    static void* track_alloc(void* ptr, MemoryCategory category)
+    {
+#if LEANCLR_ENABLE_MEMORY_STATS
+        if (ptr)
+        {
+            MemoryStats::on_alloc(category, get_allocation_size(ptr));
+        }
+#endif
+        return ptr;
+    }
 };
 } // namespace leanclr::alloc
@@ -29,26 +29,36 @@ class MemPool
     Region* region_{nullptr};
     std::size_t page_size_{DEFAULT_PAGE_SIZE};
     std::size_t region_size_{DEFAULT_REGION_SIZE};
+    // Regions are counted in MemoryStats under this category.
+    MemoryCategory category_{MemoryCategory::Other};
 
     static std::size_t align_up(std::size_t value, std::size_t alignment)
     {
         return utils::MemOp::align_up(value, alignment);
     }
 
+    // Offset of the first address at or past reg->cur aligned to alignment. Region data only has the
+    // alignment of GeneralAllocation, so alignments wider than that are applied to the address.
+    static std::size_t aligned_pos(const Region* reg, std::size_t alignment)
+    {
+        const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(reg->data);
+        return static_cast<std::size_t>(utils::MemOp::align_up(base + reg->cur, alignment) - base);
+    }
+
     Region* create_region(std::size_t capacity)
     {
         const std::size_t aligned_capacity = std::max(align_up(capacity, page_size_), region_size_);
 
-        auto* data = static_cast<std::uint8_t*>(alloc::GeneralAllocation::malloc_zeroed(aligned_capacity));
+        auto* data = static_cast<std::uint8_t*>(alloc::GeneralAllocation::malloc_zeroed(aligned_capacity, category_));
         if (!data)
         {
             return nullptr;
         }
 
-        auto* reg = static_cast<Region*>(alloc::GeneralAllocation::malloc_zeroed(sizeof(Region)));
+        auto* reg = static_cast<Region*>(alloc::GeneralAllocation::malloc_zeroed(sizeof(Region), category_));
         if (!reg)
         {
-            alloc::GeneralAllocation::free(data);
+            alloc::GeneralAllocation::free(data, category_);
             return nullptr;
         }
 
@@ -82,7 +92,14 @@ class MemPool
         add_region(capacity);
     }
 
-    MemPool(std::size_t capacity, std::size_t page_size, std::size_t region_size) : region_(nullptr), page_size_(page_size), region_size_(region_size)
+    explicit MemPool(MemoryCategory category)
+        : region_(nullptr), page_size_(DEFAULT_PAGE_SIZE), region_size_(DEFAULT_REGION_SIZE), category_(category)
+    {
+        add_region(region_size_);
+    }
+
+    MemPool(std::size_t capacity, std::size_t page_size, std::size_t region_size, MemoryCategory category = MemoryCategory::Other)
+        : region_(nullptr), page_size_(page_size), region_size_(region_size), category_(category)
     {
         add_region(capacity);
     }
@@ -102,11 +119,11 @@ class MemPool
 #ifndef NDEBUG
             std::memset(reg->data, 0xDD, reg->size);
 #endif
-            alloc::GeneralAllocation::free(reg->data);
+            alloc::GeneralAllocation::free(reg->data, category_);
 #ifndef NDEBUG
             std::memset(reg, 0xDD, sizeof(Region));
 #endif
-            alloc::GeneralAllocation::free(reg);
+            alloc::GeneralAllocation::free(reg, category_);
             reg = next;
         }
     }
@@ -118,18 +135,18 @@ class MemPool
 
         assert(region_ && "No region available in MemPool");
 
-        size_t start_pos = align_up(region_->cur, alignment);
+        size_t start_pos = aligned_pos(region_, alignment);
 
         if (start_pos + size > region_->size)
         {
-            if (!add_region(size))
+            if (!add_region(size + alignment))
             {
                 return nullptr;
             }
         }
 
         Region* reg = region_;
-        start_pos = align_up(region_->cur, alignment);
+        start_pos = aligned_pos(region_, alignment);
         std::uint8_t* ptr = reg->data + start_pos;
         reg->cur = start_pos + size;
         return ptr;
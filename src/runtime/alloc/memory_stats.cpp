@@ -0,0 +1,41 @@
+#include "memory_stats.h"
+
+namespace leanclr::alloc
+{
+
+MemoryStats::Counters MemoryStats::s_counters[static_cast<size_t>(MemoryCategory::Count)];
+
+MemoryCategoryStats MemoryStats::get_stats(MemoryCategory category)
+{
+    const Counters& counters = s_counters[static_cast<size_t>(category)];
+    return {counters.bytes.load(std::memory_order_relaxed), counters.count.load(std::memory_order_relaxed)};
+}
+
+const char* MemoryStats::get_category_name(MemoryCategory category)
+{
+    switch (category)
+    {
+    case MemoryCategory::Other:
+        return "Other";
+    case MemoryCategory::GCHeap:
+        return "GCHeap";
+    case MemoryCategory::Metadata:
+        return "Metadata";
+    case MemoryCategory::Code:
+        return "Code";
+    case MemoryCategory::GenericInstances:
+        return "GenericInstances";
+    case MemoryCategory::InternedStrings:
+        return "InternedStrings";
+    case MemoryCategory::Reflection:
+        return "Reflection";
+    case MemoryCategory::Handles:
+        return "Handles";
+    case MemoryCategory::MachineStacks:
+        return "MachineStacks";
+    default:
+        return nullptr;
+    }
+}
+
+} // namespace leanclr::alloc
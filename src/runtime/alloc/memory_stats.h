@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+
+#include "rt_base.h"
+
+namespace leanclr::alloc
+{
+
+// What an allocation is for. Keep in sync with LeanclrMemoryCategory in public/leanclr.h.
+enum class MemoryCategory : uint8_t
+{
+    Other,
+    GCHeap,
+    Metadata,
+    // Transformed interpreter code and its side tables, plus the transient pools of the transformers.
+    Code,
+    GenericInstances,
+    InternedStrings,
+    Reflection,
+    Handles,
+    // Segments of the interpreter eval and frame stacks.
+    MachineStacks,
+    Count,
+};
+
+struct MemoryCategoryStats
+{
+    uint64_t bytes;
+    uint64_t count;
+};
+
+// Live bytes and allocation counts per MemoryCategory. Memory pools are counted by the regions they reserve
+// rather than by the blocks handed out of them.
+class MemoryStats
+{
+  public:
+    static void on_alloc(MemoryCategory category, size_t bytes)
+    {
+#if LEANCLR_ENABLE_MEMORY_STATS
+        Counters& counters = s_counters[static_cast<size_t>(category)];
+        counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+        counters.count.fetch_add(1, std::memory_order_relaxed);
+#endif
+    }
+
+    static void on_free(MemoryCategory category, size_t bytes)
+    {
+#if LEANCLR_ENABLE_MEMORY_STATS
+        Counters& counters = s_counters[static_cast<size_t>(category)];
+        counters.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        counters.count.fetch_sub(1, std::memory_order_relaxed);
+#endif
+    }
+
+    // Moves one allocation already counted in from over to to, e.g. a GC heap object that turns out to be a
+    // reflection object.
+    static void reclassify(MemoryCategory from, MemoryCategory to, size_t bytes)
+    {
+        on_free(from, bytes);
+        on_alloc(to, bytes);
+    }
+
+    static MemoryCategoryStats get_stats(MemoryCategory category);
+    static const char* get_category_name(MemoryCategory category);
+
+  private:
+    struct Counters
+    {
+        std::atomic<uint64_t> bytes;
+        std::atomic<uint64_t> count;
+    };
+
+    static Counters s_counters[static_cast<size_t>(MemoryCategory::Count)];
+};
+
+} // namespace leanclr::alloc
@@ -2,5 +2,6 @@
 
 namespace leanclr::alloc
 {
-MemPool MetadataAllocation::s_memPool;
+MemPool MetadataAllocation::s_memPool(MemoryCategory::Metadata);
+MemPool MetadataAllocation::s_genericMemPool(MemoryCategory::GenericInstances);
 } // namespace leanclr::alloc
\ No newline at end of file
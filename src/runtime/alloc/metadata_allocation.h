@@ -5,43 +5,52 @@
 
 namespace leanclr::alloc
 {
+// Runtime-wide metadata that outlives any single module. Generic instances get a pool of their own so that
+// MemoryStats can report them apart.
 class MetadataAllocation
 {
   public:
-    static void* malloc(size_t size)
+    static void* malloc(size_t size, MemoryCategory category = MemoryCategory::Metadata)
     {
-        return s_memPool.malloc_zeroed(size);
+        return get_pool(category).malloc_zeroed(size);
     }
 
-    static void* malloc_zeroed(size_t size)
+    static void* malloc_zeroed(size_t size, MemoryCategory category = MemoryCategory::Metadata)
     {
-        return s_memPool.malloc_zeroed(size);
+        return get_pool(category).malloc_zeroed(size);
     }
 
     template <typename T>
-    static T* malloc_any()
+    static T* malloc_any(MemoryCategory category = MemoryCategory::Metadata)
     {
-        return s_memPool.malloc_any_zeroed<T>();
+        return get_pool(category).malloc_any_zeroed<T>();
     }
 
     template <typename T>
-    static T* malloc_any_zeroed()
+    static T* malloc_any_zeroed(MemoryCategory category = MemoryCategory::Metadata)
     {
-        return s_memPool.malloc_any_zeroed<T>();
+        return get_pool(category).malloc_any_zeroed<T>();
     }
 
-    static void* calloc(size_t count, size_t size)
+    static void* calloc(size_t count, size_t size, MemoryCategory category = MemoryCategory::Metadata)
     {
-        return s_memPool.calloc(count, size);
+        return get_pool(category).calloc(count, size);
     }
 
     template <typename T>
-    static T* calloc_any(size_t count)
+    static T* calloc_any(size_t count, MemoryCategory category = MemoryCategory::Metadata)
     {
-        return s_memPool.calloc_any<T>(count);
+        return get_pool(category).calloc_any<T>(count);
+    }
+
+    static MemPool& get_pool(MemoryCategory category = MemoryCategory::Metadata)
+    {
+        return category == MemoryCategory::GenericInstances ? s_genericMemPool : s_memPool;
     }
 
   private:
+
     static MemPool s_memPool;
+    static MemPool s_genericMemPool;
 };
 } // namespace leanclr::alloc
@@ -23,6 +23,16 @@
 #define LEANCLR_ENABLE_TEST_INTERNAL_CALLS 1
 #endif
 
+// DllImport entry points without a registered binding are loaded with dlopen or LoadLibrary and called through
+// the generated signature class invokers. Wasm has no dynamic loading.
+#ifndef LEANCLR_ENABLE_DYNAMIC_PINVOKE
+#if defined(LEANCLR_PLATFORM_WIN) || defined(LEANCLR_PLATFORM_POSIX)
+#define LEANCLR_ENABLE_DYNAMIC_PINVOKE 1
+#else
+#define LEANCLR_ENABLE_DYNAMIC_PINVOKE 0
+#endif
+#endif
+
 #if !NDEBUG
 #ifndef LEANCLR_ENABLE_FRAME_TRACE
 #define LEANCLR_ENABLE_FRAME_TRACE 1
@@ -30,3 +40,29 @@
 #endif
 
 #define LEANCLR_NO_EXCEPTION noexcept
+
+// Native threads back the thread pool. Single-threaded wasm builds run queued work inline instead.
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+#define LEANCLR_ENABLE_THREADS 0
+#else
+#define LEANCLR_ENABLE_THREADS 1
+#endif
+
+// Per-category allocation counters behind leanclr_get_memory_stats. Costs an allocation size lookup on every
+// GeneralAllocation malloc and free.
+#ifndef LEANCLR_ENABLE_MEMORY_STATS
+#define LEANCLR_ENABLE_MEMORY_STATS 1
+#endif
+
+// Thunks per native signature behind Marshal.GetFunctionPointerForDelegate, and the most parameters they take.
+// Every signature up to that many parameters gets a pool, so raising either grows the code size.
+#ifndef LEANCLR_REVERSE_PINVOKE_THUNKS_PER_SIGNATURE
+#define LEANCLR_REVERSE_PINVOKE_THUNKS_PER_SIGNATURE 8
+#endif
+#ifndef LEANCLR_REVERSE_PINVOKE_MAX_PARAMS
+#if LEANCLR_ARCH_64BIT
+#define LEANCLR_REVERSE_PINVOKE_MAX_PARAMS 4
+#else
+#define LEANCLR_REVERSE_PINVOKE_MAX_PARAMS 3
+#endif
+#endif
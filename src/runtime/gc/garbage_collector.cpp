@@ -1,10 +1,24 @@
 #include "garbage_collector.h"
 #include "alloc/general_allocation.h"
 #include "metadata/rt_metadata.h"
+#include "metadata/metadata_cache.h"
+#include "utils/hashmap.h"
+#include "utils/rt_vector.h"
 #include "vm/rt_managed_types.h"
 
+#include <algorithm>
+
 namespace leanclr::gc
 {
+struct ClassHistogramCounters
+{
+    uint64_t instance_count;
+    uint64_t bytes;
+};
+
+static bool g_class_histogram_enabled = false;
+static utils::HashMap<const metadata::RtClass*, ClassHistogramCounters> g_class_histogram;
+
 void GarbageCollector::initialize()
 {
     // Initialization logic for the garbage collector goes here
@@ -13,20 +27,31 @@ void GarbageCollector::initialize()
 void* GarbageCollector::allocate_fixed(size_t size)
 {
     // TODO: Implement fixed-size allocation logic
-    return alloc::GeneralAllocation::malloc_zeroed(size);
+    return alloc::GeneralAllocation::malloc_zeroed(size, alloc::MemoryCategory::GCHeap);
 }
 
 vm::RtObject** GarbageCollector::allocate_fixed_reference_array(size_t length)
 {
-    return alloc::GeneralAllocation::calloc_any<vm::RtObject*>(length);
+    return alloc::GeneralAllocation::calloc_any<vm::RtObject*>(length, alloc::MemoryCategory::GCHeap);
+}
+
+void GarbageCollector::free_fixed(void* ptr)
+{
+    alloc::GeneralAllocation::free(ptr, alloc::MemoryCategory::GCHeap);
 }
 
 vm::RtObject* GarbageCollector::allocate_object(metadata::RtClass* klass, size_t size)
 {
     // TODO: Implement object allocation logic
     assert(size >= sizeof(vm::RtObject));
-    auto obj = (vm::RtObject*)alloc::GeneralAllocation::malloc_zeroed(size);
+    auto obj = (vm::RtObject*)alloc::GeneralAllocation::malloc_zeroed(size, alloc::MemoryCategory::GCHeap);
     obj->klass = klass;
+    if (g_class_histogram_enabled)
+    {
+        ClassHistogramCounters& counters = g_class_histogram[klass];
+        ++counters.instance_count;
+        counters.bytes += size;
+    }
     return obj;
 }
 
@@ -39,4 +64,40 @@ vm::RtObject* GarbageCollector::allocate_array(metadata::RtClass* arrClass, size
 {
     return allocate_object(arrClass, totalBytes);
 }
+
+void GarbageCollector::set_class_histogram_enabled(bool enabled)
+{
+    g_class_histogram_enabled = enabled;
+    if (!enabled)
+    {
+        g_class_histogram.clear();
+    }
+}
+
+bool GarbageCollector::is_class_histogram_enabled()
+{
+    return g_class_histogram_enabled;
+}
+
+size_t GarbageCollector::get_class_histogram(ClassHistogramEntry* entries, size_t capacity)
+{
+    utils::Vector<ClassHistogramEntry> sorted;
+    sorted.reserve(g_class_histogram.size());
+    for (const auto& [klass, counters] : g_class_histogram)
+    {
+        sorted.push_back({klass, counters.instance_count, counters.bytes});
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const ClassHistogramEntry& a, const ClassHistogramEntry& b) { return a.bytes > b.bytes; });
+    size_t count = std::min(capacity, sorted.size());
+    if (entries)
+    {
+        std::copy(sorted.begin(), sorted.begin() + count, entries);
+    }
+    return sorted.size();
+}
+
+void GarbageCollector::purge_unloading_modules()
+{
+    utils::erase_if(g_class_histogram, [](const auto& entry) { return metadata::MetadataCache::refers_to_unloading_module(entry.first); });
+}
 } // namespace leanclr::gc
@@ -15,6 +15,13 @@ struct RtObject;
 namespace leanclr::gc
 {
 
+struct ClassHistogramEntry
+{
+    const metadata::RtClass* klass;
+    uint64_t instance_count;
+    uint64_t bytes;
+};
+
 class GarbageCollector
 {
   public:
@@ -22,9 +29,21 @@ class GarbageCollector
 
     static void* allocate_fixed(size_t size);
     static vm::RtObject** allocate_fixed_reference_array(size_t length);
+    // Releases a fixed allocation, e.g. the static fields of an unloaded class.
+    static void free_fixed(void* ptr);
     static vm::RtObject* allocate_object(metadata::RtClass* klass, size_t size);
     static vm::RtObject* allocate_object_not_contains_references(metadata::RtClass* klass, size_t size);
     static vm::RtObject* allocate_array(metadata::RtClass* arrClass, size_t totalBytes);
+
+    // Per-class instance counts and bytes, off by default. Nothing is collected yet, so every instance
+    // allocated since the histogram was enabled counts as live.
+    static void set_class_histogram_enabled(bool enabled);
+    static bool is_class_histogram_enabled();
+    // Copies up to capacity entries, largest first, and returns the total number of classes.
+    static size_t get_class_histogram(ClassHistogramEntry* entries, size_t capacity);
+    // Forgets the histogram entries of classes of unloading modules.
+    static void purge_unloading_modules();
+
     static void write_barrier(vm::RtObject** obj_ref_location, vm::RtObject* new_obj)
     {
         // TODO: implement write barrier
@@ -39,6 +39,7 @@
 #include "system_reflection_runtimeeventinfo.h"
 #include "system_reflection_runtimeparameterinfo.h"
 #include "system_threading_monitor.h"
+#include "system_threading_threadpool.h"
 #include "system_threading_timer.h"
 #include "system_threading_volatile.h"
 #include "system_appdomain.h"
@@ -116,6 +117,7 @@ void InternalCallStubs::get_internal_call_entries(utils::Vector<vm::InternalCall
     Append(entries, SystemReflectionRuntimeEventInfo::get_internal_call_entries());
     Append(entries, SystemReflectionRuntimeParameterInfo::get_internal_call_entries());
     Append(entries, SystemThreadingMonitor::get_internal_call_entries());
+    Append(entries, SystemThreadingThreadPool::get_internal_call_entries());
     Append(entries, SystemThreadingTimer::get_internal_call_entries());
     Append(entries, SystemThreadingVolatile::get_internal_call_entries());
     Append(entries, SystemAppDomain::get_internal_call_entries());
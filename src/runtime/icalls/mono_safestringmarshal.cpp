@@ -3,7 +3,6 @@
 #include "vm/rt_string.h"
 #include "alloc/general_allocation.h"
 #include "utils/string_util.h"
-#include "utils/string_builder.h"
 
 namespace leanclr::icalls
 {
@@ -19,9 +18,7 @@ RtResult<const char*> MonoSafeStringMarshal::string_to_utf8_bytes(RtString* s)
     {
         RET_ERR(RtErr::NullReference);
     }
-    utils::StringBuilder sb;
-    utils::StringUtil::utf16_to_utf8(String::get_chars_ptr(s), String::get_length(s), sb);
-    RET_OK(sb.dup_to_zero_end_cstr());
+    RET_OK(utils::StringUtil::strdup_utf16_to_utf8(String::get_chars_ptr(s), String::get_length(s)));
 }
 
 RtResultVoid MonoSafeStringMarshal::gfree(void* ptr)
@@ -1,5 +1,6 @@
 #include "system_globalization_compareinfo.h"
 #include "icall_base.h"
+#include "utils/string_kernels.h"
 
 #include <algorithm>
 #include <cassert>
@@ -52,12 +53,18 @@ RtResult<int32_t> SystemGlobalizationCompareInfo::internal_compare_icall(const c
                                                                          int32_t options)
 {
     assert(length1 >= 0 && length2 >= 0);
-    int32_t min_len = std::min(length1, length2);
-    for (int32_t i = 0; i < min_len; i++)
+    const Utf16Char* chars1 = reinterpret_cast<const Utf16Char*>(str1);
+    const Utf16Char* chars2 = reinterpret_cast<const Utf16Char*>(str2);
+    size_t min_len = static_cast<size_t>(std::min(length1, length2));
+    // Skip identical runs with the vector kernel; only chars that differ bitwise need case folding.
+    for (size_t i = 0; i < min_len; i++)
     {
-        char16_t c1 = str1[i];
-        char16_t c2 = str2[i];
-        int32_t ord = compare_char(c1, c2, options);
+        i += utils::StringKernels::mismatch(chars1 + i, chars2 + i, min_len - i);
+        if (i == min_len)
+        {
+            break;
+        }
+        int32_t ord = compare_char(str1[i], str2[i], options);
         if (ord != 0)
         {
             RET_OK(ord);
@@ -100,27 +107,12 @@ RtResult<int32_t> SystemGlobalizationCompareInfo::internal_index_icall(const cha
         RET_OK(-1);
     }
 
-    if (first)
-    {
-        for (int32_t i = 0; i <= source_count - value_length; i++)
-        {
-            if (std::memcmp(source + source_start_index + i, value, value_length * sizeof(char16_t)) == 0)
-            {
-                RET_OK(source_start_index + i);
-            }
-        }
-    }
-    else
-    {
-        for (int32_t i = source_count - value_length; i >= 0; i--)
-        {
-            if (std::memcmp(source + source_start_index + i, value, value_length * sizeof(char16_t)) == 0)
-            {
-                RET_OK(source_start_index + i);
-            }
-        }
-    }
-    RET_OK(-1);
+    const Utf16Char* chars = reinterpret_cast<const Utf16Char*>(source + source_start_index);
+    const Utf16Char* value_chars = reinterpret_cast<const Utf16Char*>(value);
+    int32_t index = first ? utils::StringKernels::index_of_string(chars, static_cast<size_t>(source_count), value_chars, static_cast<size_t>(value_length))
+                          : utils::StringKernels::last_index_of_string(chars, static_cast<size_t>(source_count), value_chars,
+                                                                       static_cast<size_t>(value_length));
+    RET_OK(index < 0 ? -1 : source_start_index + index);
 }
 
 /// @icall: System.Globalization.CompareInfo::internal_index_icall(System.Char*,System.Int32,System.Int32,System.Char*,System.Int32,System.Boolean)
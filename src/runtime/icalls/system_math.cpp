@@ -5,9 +5,10 @@
 namespace leanclr::icalls
 {
 
+// Math.Round(Double) rounds midpoints to even, which is the default floating-point rounding mode.
 RtResult<double> SystemMath::round(double value)
 {
-    RET_OK(std::round(value));
+    RET_OK(std::nearbyint(value));
 }
 
 /// @icall: System.Math::Round(System.Double)
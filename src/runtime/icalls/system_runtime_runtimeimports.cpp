@@ -1,6 +1,8 @@
 #include "system_runtime_runtimeimports.h"
 #include <cstring>
 
+#include "utils/float_format.h"
+
 namespace leanclr::icalls
 {
 
@@ -58,39 +60,12 @@ static RtResultVoid memmove_wbarrier_invoker(RtManagedMethodPointer method_point
 // @icall: System.Runtime.RuntimeImports::_ecvt_s
 RtResultVoid SystemRuntimeRuntimeImports::ecvt_s(uint8_t* buffer, int32_t size, double value, int32_t digits, int32_t* decpt, int32_t* sign)
 {
-#ifdef LEANCLR_PLATFORM_WIN
-    // Windows/MSVC: _ecvt_s
-    int err = _ecvt_s(reinterpret_cast<char*>(buffer), size, value, digits, decpt, sign);
-    if (err != 0)
-    {
-        RET_ERR(RtErr::Argument);
-    }
-#elif defined(LEANCLR_PLATFORM_POSIX)
-    // POSIX: ecvt
-    char* str = ecvt(value, digits, decpt, sign);
-    if (!str)
+    bool negative;
+    if (size <= 0 || !utils::FloatFormat::ecvt(value, digits, reinterpret_cast<char*>(buffer), static_cast<size_t>(size), decpt, &negative))
     {
         RET_ERR(RtErr::Argument);
     }
-    std::strncpy(reinterpret_cast<char*>(buffer), str, size - 1);
-    buffer[size - 1] = 0;
-#else
-    int written = snprintf(reinterpret_cast<char*>(buffer), size, "%.*e", digits, value);
-    if (written < 0 || written >= size) {
-        RET_ERR(RtErr::Argument);
-    }
-    // 解析小数点和符号
-    const char* buf = reinterpret_cast<const char*>(buffer);
-    *sign = (buf[0] == '-') ? 1 : 0;
-    const char* e_ptr = strchr(buf, 'e');
-    if (!e_ptr) e_ptr = strchr(buf, 'E');
-    if (!e_ptr) {
-        *decpt = 0;
-    } else {
-        int exp = atoi(e_ptr + 1);
-        *decpt = exp + 1;
-    }
-#endif
+    *sign = negative ? 1 : 0;
     RET_VOID_OK();
 }
 
@@ -3,6 +3,8 @@
 #include "icall_base.h"
 #include "vm/rt_string.h"
 #include "vm/rt_array.h"
+#include "interp/machine_state.h"
+#include "metadata/module_def.h"
 #include "utils/string_util.h"
 #include "utils/string_builder.h"
 
@@ -198,12 +200,25 @@ static RtResultVoid fast_allocate_string_invoker(metadata::RtManagedMethodPointe
     RET_VOID_OK();
 }
 
+// The module of the innermost frame outside corlib, whose code asked for the string to be interned.
+static metadata::RtModuleDef* get_interning_module()
+{
+    const interp::MachineState& ms = interp::MachineState::get_global_machine_state();
+    for (size_t i = ms.get_active_frame_count(); i > 0; --i)
+    {
+        const metadata::RtMethodInfo* method = ms.get_active_frame(i - 1)->method;
+        if (method && !method->parent->image->is_corlib())
+            return method->parent->image;
+    }
+    return nullptr;
+}
+
 /// @icall: System.String::InternalIntern
 RtResult<vm::RtString*> SystemString::internal_intern(vm::RtString* s)
 {
     if (s == nullptr)
         RET_OK(s);
-    vm::RtString* interned = vm::String::intern_string(s);
+    vm::RtString* interned = vm::String::intern_string(s, get_interning_module());
     RET_OK(interned);
 }
 
@@ -1,6 +1,7 @@
 #include "system_threading_monitor.h"
 #include "icall_base.h"
 #include "vm/monitor.h"
+#include "vm/timer_scheduler.h"
 
 namespace leanclr::icalls
 {
@@ -76,6 +77,20 @@ static RtResultVoid monitor_pulse_all_invoker(metadata::RtManagedMethodPointer,
 
 RtResult<bool> SystemThreadingMonitor::monitor_wait(vm::RtObject* monitor, int32_t milliseconds_timeout)
 {
+    // Whatever is being waited for can only be signalled by work items or timers running on this thread.
+    // The monitor is released for the wait, so they may take it, but not any other monitor held here:
+    // while one is, nothing is dispatched. A monitor entered recursively is only released once.
+    bool release = vm::Monitor::get_held_count() > 0;
+    if (release)
+    {
+        vm::Monitor::exit(monitor);
+    }
+    auto ret = vm::TimerScheduler::wait_for_progress(milliseconds_timeout);
+    if (release)
+    {
+        vm::Monitor::enter(monitor);
+    }
+    RET_ERR_ON_FAIL(ret);
     RET_OK(vm::Monitor::monitor_wait(monitor, milliseconds_timeout));
 }
 
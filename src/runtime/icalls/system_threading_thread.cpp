@@ -5,6 +5,9 @@
 #include "vm/rt_array.h"
 #include "vm/rt_string.h"
 #include "vm/appdomain.h"
+#include "vm/monitor.h"
+#include "vm/thread_pool.h"
+#include "vm/timer_scheduler.h"
 #include "utils/string_util.h"
 
 #include <cstring>
@@ -57,12 +60,18 @@ RtResult<bool> SystemThreadingThread::join_internal(vm::RtThread* this_thread, i
 
 RtResultVoid SystemThreadingThread::sleep_internal(int32_t milliseconds)
 {
-    vm::Thread::sleep(milliseconds);
-    RET_VOID_OK();
+    // Managed work items and timers only run on this thread, so keep dispatching them while sleeping.
+    return vm::TimerScheduler::sleep(milliseconds);
 }
 
 RtResult<bool> SystemThreadingThread::yield_internal()
 {
+    // Work items are not dispatched while a monitor is held.
+    if (vm::ThreadPool::has_managed_work_requests() && vm::Monitor::get_held_count() == 0)
+    {
+        RET_ERR_ON_FAIL(vm::ThreadPool::run_managed_work_items());
+        RET_OK(true);
+    }
     RET_OK(vm::Thread::yield_internal());
 }
 
@@ -0,0 +1,231 @@
+#include "system_threading_threadpool.h"
+#include "icall_base.h"
+#include "vm/thread_pool.h"
+
+namespace leanclr::icalls
+{
+
+RtResultVoid SystemThreadingThreadPool::initialize_vm_tp(bool* enable_worker_tracking)
+{
+    *enable_worker_tracking = false;
+    RET_VOID_OK();
+}
+
+/// @icall: System.Threading.ThreadPool::InitializeVMTp(System.Boolean&)
+static RtResultVoid initialize_vm_tp_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                             interp::RtStackObject*)
+{
+    auto enable_worker_tracking = EvalStackOp::get_param<bool*>(params, 0);
+    return SystemThreadingThreadPool::initialize_vm_tp(enable_worker_tracking);
+}
+
+RtResult<bool> SystemThreadingThreadPool::is_thread_pool_hosted()
+{
+    RET_OK(false);
+}
+
+/// @icall: System.Threading.ThreadPool::IsThreadPoolHosted
+static RtResultVoid is_thread_pool_hosted_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject*,
+                                                  interp::RtStackObject* ret)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, result, SystemThreadingThreadPool::is_thread_pool_hosted());
+    EvalStackOp::set_return(ret, (int32_t)result);
+    RET_VOID_OK();
+}
+
+RtResult<bool> SystemThreadingThreadPool::request_worker_thread()
+{
+    vm::ThreadPool::request_managed_worker();
+    RET_OK(true);
+}
+
+/// @icall: System.Threading.ThreadPool::RequestWorkerThread
+static RtResultVoid request_worker_thread_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject*,
+                                                  interp::RtStackObject* ret)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, result, SystemThreadingThreadPool::request_worker_thread());
+    EvalStackOp::set_return(ret, (int32_t)result);
+    RET_VOID_OK();
+}
+
+RtResult<bool> SystemThreadingThreadPool::notify_work_item_complete()
+{
+    // Keep dispatching; the corlib's quantum decides when to hand the thread back.
+    RET_OK(true);
+}
+
+/// @icall: System.Threading.ThreadPool::NotifyWorkItemComplete
+static RtResultVoid notify_work_item_complete_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject*,
+                                                      interp::RtStackObject* ret)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, result, SystemThreadingThreadPool::notify_work_item_complete());
+    EvalStackOp::set_return(ret, (int32_t)result);
+    RET_VOID_OK();
+}
+
+RtResultVoid SystemThreadingThreadPool::notify_work_item_progress_native()
+{
+    RET_VOID_OK();
+}
+
+/// @icall: System.Threading.ThreadPool::NotifyWorkItemProgressNative
+static RtResultVoid notify_work_item_progress_native_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject*,
+                                                             interp::RtStackObject*)
+{
+    return SystemThreadingThreadPool::notify_work_item_progress_native();
+}
+
+RtResultVoid SystemThreadingThreadPool::notify_work_item_queued()
+{
+    RET_VOID_OK();
+}
+
+/// @icall: System.Threading.ThreadPool::NotifyWorkItemQueued
+static RtResultVoid notify_work_item_queued_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject*,
+                                                    interp::RtStackObject*)
+{
+    return SystemThreadingThreadPool::notify_work_item_queued();
+}
+
+RtResultVoid SystemThreadingThreadPool::report_thread_status(bool is_working)
+{
+    vm::ThreadPool::report_managed_thread_status(is_working);
+    RET_VOID_OK();
+}
+
+/// @icall: System.Threading.ThreadPool::ReportThreadStatus(System.Boolean)
+static RtResultVoid report_thread_status_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                                 interp::RtStackObject*)
+{
+    auto is_working = EvalStackOp::get_param<bool>(params, 0);
+    return SystemThreadingThreadPool::report_thread_status(is_working);
+}
+
+RtResult<bool> SystemThreadingThreadPool::post_queued_completion_status(void* native_overlapped)
+{
+    // There are no I/O completion ports.
+    RET_OK(false);
+}
+
+/// @icall: System.Threading.ThreadPool::PostQueuedCompletionStatus(System.Threading.NativeOverlapped*)
+static RtResultVoid post_queued_completion_status_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*,
+                                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto native_overlapped = EvalStackOp::get_param<void*>(params, 0);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, result, SystemThreadingThreadPool::post_queued_completion_status(native_overlapped));
+    EvalStackOp::set_return(ret, (int32_t)result);
+    RET_VOID_OK();
+}
+
+RtResultVoid SystemThreadingThreadPool::get_available_threads_native(int32_t* worker_threads, int32_t* completion_port_threads)
+{
+    vm::ThreadPool::get_managed_available_threads(*worker_threads, *completion_port_threads);
+    RET_VOID_OK();
+}
+
+/// @icall: System.Threading.ThreadPool::GetAvailableThreadsNative(System.Int32&,System.Int32&)
+static RtResultVoid get_available_threads_native_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*,
+                                                         const interp::RtStackObject* params, interp::RtStackObject*)
+{
+    auto worker_threads = EvalStackOp::get_param<int32_t*>(params, 0);
+    auto completion_port_threads = EvalStackOp::get_param<int32_t*>(params, 1);
+    return SystemThreadingThreadPool::get_available_threads_native(worker_threads, completion_port_threads);
+}
+
+RtResultVoid SystemThreadingThreadPool::get_min_threads_native(int32_t* worker_threads, int32_t* completion_port_threads)
+{
+    vm::ThreadPool::get_managed_min_threads(*worker_threads, *completion_port_threads);
+    RET_VOID_OK();
+}
+
+/// @icall: System.Threading.ThreadPool::GetMinThreadsNative(System.Int32&,System.Int32&)
+static RtResultVoid get_min_threads_native_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                                   interp::RtStackObject*)
+{
+    auto worker_threads = EvalStackOp::get_param<int32_t*>(params, 0);
+    auto completion_port_threads = EvalStackOp::get_param<int32_t*>(params, 1);
+    return SystemThreadingThreadPool::get_min_threads_native(worker_threads, completion_port_threads);
+}
+
+RtResultVoid SystemThreadingThreadPool::get_max_threads_native(int32_t* worker_threads, int32_t* completion_port_threads)
+{
+    vm::ThreadPool::get_managed_max_threads(*worker_threads, *completion_port_threads);
+    RET_VOID_OK();
+}
+
+/// @icall: System.Threading.ThreadPool::GetMaxThreadsNative(System.Int32&,System.Int32&)
+static RtResultVoid get_max_threads_native_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                                   interp::RtStackObject*)
+{
+    auto worker_threads = EvalStackOp::get_param<int32_t*>(params, 0);
+    auto completion_port_threads = EvalStackOp::get_param<int32_t*>(params, 1);
+    return SystemThreadingThreadPool::get_max_threads_native(worker_threads, completion_port_threads);
+}
+
+RtResult<bool> SystemThreadingThreadPool::set_min_threads_native(int32_t worker_threads, int32_t completion_port_threads)
+{
+    RET_OK(vm::ThreadPool::set_managed_min_threads(worker_threads, completion_port_threads));
+}
+
+/// @icall: System.Threading.ThreadPool::SetMinThreadsNative(System.Int32,System.Int32)
+static RtResultVoid set_min_threads_native_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                                   interp::RtStackObject* ret)
+{
+    auto worker_threads = EvalStackOp::get_param<int32_t>(params, 0);
+    auto completion_port_threads = EvalStackOp::get_param<int32_t>(params, 1);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, result, SystemThreadingThreadPool::set_min_threads_native(worker_threads, completion_port_threads));
+    EvalStackOp::set_return(ret, (int32_t)result);
+    RET_VOID_OK();
+}
+
+RtResult<bool> SystemThreadingThreadPool::set_max_threads_native(int32_t worker_threads, int32_t completion_port_threads)
+{
+    RET_OK(vm::ThreadPool::set_managed_max_threads(worker_threads, completion_port_threads));
+}
+
+/// @icall: System.Threading.ThreadPool::SetMaxThreadsNative(System.Int32,System.Int32)
+static RtResultVoid set_max_threads_native_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                                   interp::RtStackObject* ret)
+{
+    auto worker_threads = EvalStackOp::get_param<int32_t>(params, 0);
+    auto completion_port_threads = EvalStackOp::get_param<int32_t>(params, 1);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, result, SystemThreadingThreadPool::set_max_threads_native(worker_threads, completion_port_threads));
+    EvalStackOp::set_return(ret, (int32_t)result);
+    RET_VOID_OK();
+}
+
+static vm::InternalCallEntry s_internal_call_entries[] = {
+    {"System.Threading.ThreadPool::InitializeVMTp(System.Boolean&)", (vm::InternalCallFunction)&SystemThreadingThreadPool::initialize_vm_tp,
+     initialize_vm_tp_invoker},
+    {"System.Threading.ThreadPool::IsThreadPoolHosted", (vm::InternalCallFunction)&SystemThreadingThreadPool::is_thread_pool_hosted,
+     is_thread_pool_hosted_invoker},
+    {"System.Threading.ThreadPool::RequestWorkerThread", (vm::InternalCallFunction)&SystemThreadingThreadPool::request_worker_thread,
+     request_worker_thread_invoker},
+    {"System.Threading.ThreadPool::NotifyWorkItemComplete", (vm::InternalCallFunction)&SystemThreadingThreadPool::notify_work_item_complete,
+     notify_work_item_complete_invoker},
+    {"System.Threading.ThreadPool::NotifyWorkItemProgressNative", (vm::InternalCallFunction)&SystemThreadingThreadPool::notify_work_item_progress_native,
+     notify_work_item_progress_native_invoker},
+    {"System.Threading.ThreadPool::NotifyWorkItemQueued", (vm::InternalCallFunction)&SystemThreadingThreadPool::notify_work_item_queued,
+     notify_work_item_queued_invoker},
+    {"System.Threading.ThreadPool::ReportThreadStatus(System.Boolean)", (vm::InternalCallFunction)&SystemThreadingThreadPool::report_thread_status,
+     report_thread_status_invoker},
+    {"System.Threading.ThreadPool::PostQueuedCompletionStatus(System.Threading.NativeOverlapped*)",
+     (vm::InternalCallFunction)&SystemThreadingThreadPool::post_queued_completion_status, post_queued_completion_status_invoker},
+    {"System.Threading.ThreadPool::GetAvailableThreadsNative(System.Int32&,System.Int32&)",
+     (vm::InternalCallFunction)&SystemThreadingThreadPool::get_available_threads_native, get_available_threads_native_invoker},
+    {"System.Threading.ThreadPool::GetMinThreadsNative(System.Int32&,System.Int32&)", (vm::InternalCallFunction)&SystemThreadingThreadPool::get_min_threads_native,
+     get_min_threads_native_invoker},
+    {"System.Threading.ThreadPool::GetMaxThreadsNative(System.Int32&,System.Int32&)", (vm::InternalCallFunction)&SystemThreadingThreadPool::get_max_threads_native,
+     get_max_threads_native_invoker},
+    {"System.Threading.ThreadPool::SetMinThreadsNative(System.Int32,System.Int32)", (vm::InternalCallFunction)&SystemThreadingThreadPool::set_min_threads_native,
+     set_min_threads_native_invoker},
+    {"System.Threading.ThreadPool::SetMaxThreadsNative(System.Int32,System.Int32)", (vm::InternalCallFunction)&SystemThreadingThreadPool::set_max_threads_native,
+     set_max_threads_native_invoker},
+};
+
+utils::Span<vm::InternalCallEntry> SystemThreadingThreadPool::get_internal_call_entries()
+{
+    return utils::Span<vm::InternalCallEntry>(s_internal_call_entries, sizeof(s_internal_call_entries) / sizeof(vm::InternalCallEntry));
+}
+
+} // namespace leanclr::icalls
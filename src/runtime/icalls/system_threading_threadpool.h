@@ -0,0 +1,29 @@
+#pragma once
+
+#include "icall_base.h"
+
+namespace leanclr::icalls
+{
+
+class SystemThreadingThreadPool
+{
+  public:
+    static utils::Span<vm::InternalCallEntry> get_internal_call_entries();
+
+    static RtResultVoid initialize_vm_tp(bool* enable_worker_tracking);
+    static RtResult<bool> is_thread_pool_hosted();
+    static RtResult<bool> request_worker_thread();
+    static RtResult<bool> notify_work_item_complete();
+    static RtResultVoid notify_work_item_progress_native();
+    static RtResultVoid notify_work_item_queued();
+    static RtResultVoid report_thread_status(bool is_working);
+    static RtResult<bool> post_queued_completion_status(void* native_overlapped);
+
+    static RtResultVoid get_available_threads_native(int32_t* worker_threads, int32_t* completion_port_threads);
+    static RtResultVoid get_min_threads_native(int32_t* worker_threads, int32_t* completion_port_threads);
+    static RtResultVoid get_max_threads_native(int32_t* worker_threads, int32_t* completion_port_threads);
+    static RtResult<bool> set_min_threads_native(int32_t worker_threads, int32_t completion_port_threads);
+    static RtResult<bool> set_max_threads_native(int32_t worker_threads, int32_t completion_port_threads);
+};
+
+} // namespace leanclr::icalls
@@ -1,6 +1,7 @@
 #include "system_threading_timer.h"
 
 #include "platform/rt_time.h"
+#include "vm/timer_scheduler.h"
 
 namespace leanclr::icalls
 {
@@ -22,10 +23,74 @@ static RtResultVoid get_time_monotonic_invoker(metadata::RtManagedMethodPointer
     RET_VOID_OK();
 }
 
+RtResultVoid SystemThreadingTimer::scheduler_init_scheduler(vm::RtObject* scheduler)
+{
+    RET_VOID_OK();
+}
+
+/// @icall: System.Threading.Timer/Scheduler::InitScheduler()
+static RtResultVoid scheduler_init_scheduler_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                                     interp::RtStackObject*)
+{
+    auto scheduler = EvalStackOp::get_param<vm::RtObject*>(params, 0);
+    return SystemThreadingTimer::scheduler_init_scheduler(scheduler);
+}
+
+RtResultVoid SystemThreadingTimer::scheduler_wakeup_scheduler(vm::RtObject* scheduler)
+{
+    RET_VOID_OK();
+}
+
+/// @icall: System.Threading.Timer/Scheduler::WakeupScheduler()
+static RtResultVoid scheduler_wakeup_scheduler_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                                       interp::RtStackObject*)
+{
+    auto scheduler = EvalStackOp::get_param<vm::RtObject*>(params, 0);
+    return SystemThreadingTimer::scheduler_wakeup_scheduler(scheduler);
+}
+
+RtResultVoid SystemThreadingTimer::scheduler_change(vm::RtObject* scheduler, vm::RtObject* timer, int64_t new_next_run)
+{
+    return vm::TimerScheduler::change_managed_timer(timer, new_next_run);
+}
+
+/// @icall: System.Threading.Timer/Scheduler::Change(System.Threading.Timer,System.Int64)
+static RtResultVoid scheduler_change_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                             interp::RtStackObject*)
+{
+    auto scheduler = EvalStackOp::get_param<vm::RtObject*>(params, 0);
+    auto timer = EvalStackOp::get_param<vm::RtObject*>(params, 1);
+    auto new_next_run = EvalStackOp::get_param<int64_t>(params, 2);
+    return SystemThreadingTimer::scheduler_change(scheduler, timer, new_next_run);
+}
+
+RtResultVoid SystemThreadingTimer::scheduler_remove(vm::RtObject* scheduler, vm::RtObject* timer)
+{
+    vm::TimerScheduler::remove_managed_timer(timer);
+    RET_VOID_OK();
+}
+
+/// @icall: System.Threading.Timer/Scheduler::Remove(System.Threading.Timer)
+static RtResultVoid scheduler_remove_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                             interp::RtStackObject*)
+{
+    auto scheduler = EvalStackOp::get_param<vm::RtObject*>(params, 0);
+    auto timer = EvalStackOp::get_param<vm::RtObject*>(params, 1);
+    return SystemThreadingTimer::scheduler_remove(scheduler, timer);
+}
+
 utils::Span<vm::InternalCallEntry> SystemThreadingTimer::get_internal_call_entries()
 {
     static vm::InternalCallEntry s_entries[] = {
         {"System.Threading.Timer::GetTimeMonotonic()", (vm::InternalCallFunction)&SystemThreadingTimer::get_time_monotonic, get_time_monotonic_invoker},
+        {"System.Threading.Timer/Scheduler::InitScheduler()", (vm::InternalCallFunction)&SystemThreadingTimer::scheduler_init_scheduler,
+         scheduler_init_scheduler_invoker},
+        {"System.Threading.Timer/Scheduler::WakeupScheduler()", (vm::InternalCallFunction)&SystemThreadingTimer::scheduler_wakeup_scheduler,
+         scheduler_wakeup_scheduler_invoker},
+        {"System.Threading.Timer/Scheduler::Change(System.Threading.Timer,System.Int64)", (vm::InternalCallFunction)&SystemThreadingTimer::scheduler_change,
+         scheduler_change_invoker},
+        {"System.Threading.Timer/Scheduler::Remove(System.Threading.Timer)", (vm::InternalCallFunction)&SystemThreadingTimer::scheduler_remove,
+         scheduler_remove_invoker},
     };
     return utils::Span<vm::InternalCallEntry>(s_entries, sizeof(s_entries) / sizeof(s_entries[0]));
 }
@@ -11,6 +11,12 @@ class SystemThreadingTimer
     static utils::Span<vm::InternalCallEntry> get_internal_call_entries();
 
     static RtResult<int64_t> get_time_monotonic();
+
+    // Timer.Scheduler runs its own scheduler thread; these replace it with the runtime's timer wheel.
+    static RtResultVoid scheduler_init_scheduler(vm::RtObject* scheduler);
+    static RtResultVoid scheduler_wakeup_scheduler(vm::RtObject* scheduler);
+    static RtResultVoid scheduler_change(vm::RtObject* scheduler, vm::RtObject* timer, int64_t new_next_run);
+    static RtResultVoid scheduler_remove(vm::RtObject* scheduler, vm::RtObject* timer);
 };
 
 } // namespace leanclr::icalls
@@ -0,0 +1,448 @@
+#include "array_bounds_analysis.h"
+
+#include "hl_transformer.h"
+
+#include <algorithm>
+
+namespace leanclr::interp
+{
+
+// An eval stack variable defined in the block being scanned, by an instruction the analysis understands.
+struct EvalVarDef
+{
+    enum class Kind
+    {
+        Load,
+        Const,
+        Length,
+        Increment,
+    };
+
+    Kind kind;
+    // The local or argument loaded, whose length is taken or which is incremented.
+    const Variable* var;
+    int32_t value;
+    // Position of the load of var in the block, to tell whether var was stored to since.
+    size_t load_position;
+};
+
+void ArrayBoundsAnalysis::analyze()
+{
+    _basic_blocks = _hl_transformer.get_basic_blocks();
+    _basic_block_count = _hl_transformer.get_basic_block_count();
+    if (_basic_block_count == 0)
+    {
+        return;
+    }
+    collect_address_taken_vars();
+
+    _entry_facts[0];
+    mark_unknown_entries();
+
+    // Facts only ever shrink once a block is reached, so this terminates.
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (size_t i = 0; i < _basic_block_count; ++i)
+        {
+            changed |= scan_block(i, false);
+        }
+    }
+    for (size_t i = 0; i < _basic_block_count; ++i)
+    {
+        scan_block(i, true);
+    }
+}
+
+size_t ArrayBoundsAnalysis::get_block_index(const hl::BasicBlock* bb) const
+{
+    return static_cast<size_t>(bb - _basic_blocks);
+}
+
+void ArrayBoundsAnalysis::collect_address_taken_vars()
+{
+    for (size_t i = 0; i < _basic_block_count; ++i)
+    {
+        for (const hl::GeneralInst* inst : _basic_blocks[i].insts)
+        {
+            hl::OpCodeEnum code = inst->get_opcode();
+            if (code == hl::OpCodeEnum::LdLoca || code == hl::OpCodeEnum::LdArga)
+            {
+                _address_taken_vars.insert(inst->get_var_src());
+            }
+        }
+    }
+}
+
+void ArrayBoundsAnalysis::mark_unknown_entries()
+{
+    // Handlers and filters are entered from anywhere in their try block, and leave targets after finally
+    // blocks that may store to any local.
+    utils::HashMap<size_t, size_t> il_offset_to_block;
+    for (size_t i = 0; i < _basic_block_count; ++i)
+    {
+        il_offset_to_block.insert({_basic_blocks[i].il_begin_offset, i});
+    }
+    auto mark = [&](size_t il_offset) {
+        auto it = il_offset_to_block.find(il_offset);
+        if (it != il_offset_to_block.end())
+        {
+            _entry_facts[it->second].clear();
+        }
+    };
+    for (const metadata::RtExceptionClause& clause : _hl_transformer.get_method_body()->exception_clauses)
+    {
+        mark(clause.handler_offset);
+        if (clause.flags == metadata::RtILExceptionClauseType::Filter)
+        {
+            mark(clause.class_token_or_filter_offset);
+        }
+    }
+    for (size_t i = 0; i < _basic_block_count; ++i)
+    {
+        for (const hl::GeneralInst* inst : _basic_blocks[i].insts)
+        {
+            if (inst->get_opcode() == hl::OpCodeEnum::Leave)
+            {
+                _entry_facts[get_block_index(inst->get_leave_target())].clear();
+            }
+        }
+    }
+}
+
+bool ArrayBoundsAnalysis::merge_into(size_t block_index, const utils::Vector<IndexFact>& facts)
+{
+    auto it = _entry_facts.find(block_index);
+    if (it == _entry_facts.end())
+    {
+        _entry_facts.insert({block_index, facts});
+        return true;
+    }
+    utils::Vector<IndexFact>& entry_facts = it->second;
+    utils::Vector<IndexFact> merged;
+    for (const IndexFact& fact : entry_facts)
+    {
+        if (contains(facts, fact))
+        {
+            add_fact(merged, fact);
+        }
+        else if (is_non_negative(facts, fact.index))
+        {
+            add_fact(merged, IndexFact{fact.index, nullptr});
+        }
+    }
+    // The merged facts are never stronger than the entry ones, so they are the same if they are as many.
+    if (merged.size() == entry_facts.size() &&
+        std::all_of(merged.begin(), merged.end(), [&](const IndexFact& fact) { return contains(entry_facts, fact); }))
+    {
+        return false;
+    }
+    entry_facts = merged;
+    return true;
+}
+
+static bool is_primitive_array_access(hl::OpCodeEnum code)
+{
+    switch (code)
+    {
+    case hl::OpCodeEnum::LdelemI1:
+    case hl::OpCodeEnum::LdelemU1:
+    case hl::OpCodeEnum::LdelemI2:
+    case hl::OpCodeEnum::LdelemU2:
+    case hl::OpCodeEnum::LdelemI4:
+    case hl::OpCodeEnum::LdelemI8:
+    case hl::OpCodeEnum::LdelemI:
+    case hl::OpCodeEnum::LdelemR4:
+    case hl::OpCodeEnum::LdelemR8:
+    case hl::OpCodeEnum::LdelemRef:
+    case hl::OpCodeEnum::StelemI1:
+    case hl::OpCodeEnum::StelemI2:
+    case hl::OpCodeEnum::StelemI4:
+    case hl::OpCodeEnum::StelemI8:
+    case hl::OpCodeEnum::StelemI:
+    case hl::OpCodeEnum::StelemR4:
+    case hl::OpCodeEnum::StelemR8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool ArrayBoundsAnalysis::scan_block(size_t block_index, bool mark_in_bounds_insts)
+{
+    const hl::BasicBlock& bb = _basic_blocks[block_index];
+    auto entry_it = _entry_facts.find(block_index);
+    if (entry_it == _entry_facts.end())
+    {
+        return false;
+    }
+
+    utils::Vector<IndexFact> facts = entry_it->second;
+    utils::HashMap<const Variable*, EvalVarDef> defs;
+    utils::HashMap<const Variable*, size_t> last_store_positions;
+
+    auto find_def = [&](const Variable* eval_var, EvalVarDef::Kind kind) -> const EvalVarDef* {
+        auto it = defs.find(eval_var);
+        return it != defs.end() && it->second.kind == kind ? &it->second : nullptr;
+    };
+    // Whether the local read by def still holds the value loaded.
+    auto is_unchanged = [&](const EvalVarDef* def) {
+        auto it = last_store_positions.find(def->var);
+        return it == last_store_positions.end() || it->second < def->load_position;
+    };
+    auto find_index_load = [&](const Variable* eval_var) -> const EvalVarDef* {
+        const EvalVarDef* def = find_def(eval_var, EvalVarDef::Kind::Load);
+        return def && def->var->reduce_type == metadata::RtArgOrLocOrFieldReduceType::I4 && is_unchanged(def) ? def : nullptr;
+    };
+
+    size_t position = 0;
+    for (const hl::GeneralInst* inst : bb.insts)
+    {
+        hl::OpCodeEnum code = inst->get_opcode();
+        switch (code)
+        {
+        case hl::OpCodeEnum::LdLoc:
+        case hl::OpCodeEnum::LdArg:
+            if (_address_taken_vars.find(inst->get_var_src()) == _address_taken_vars.end())
+            {
+                defs[inst->get_var_dst()] = EvalVarDef{EvalVarDef::Kind::Load, inst->get_var_src(), 0, position};
+            }
+            break;
+        case hl::OpCodeEnum::LdcI4:
+            defs[inst->get_var_dst()] = EvalVarDef{EvalVarDef::Kind::Const, nullptr, inst->get_i4(), position};
+            break;
+        case hl::OpCodeEnum::LdLen:
+            if (const EvalVarDef* array_def = find_def(inst->get_var_src(), EvalVarDef::Kind::Load))
+            {
+                defs[inst->get_var_dst()] = EvalVarDef{EvalVarDef::Kind::Length, array_def->var, 0, array_def->load_position};
+            }
+            break;
+        case hl::OpCodeEnum::Add:
+        {
+            const EvalVarDef* load = find_index_load(inst->get_var_arg1());
+            const EvalVarDef* constant = find_def(inst->get_var_arg2(), EvalVarDef::Kind::Const);
+            if (!load)
+            {
+                load = find_index_load(inst->get_var_arg2());
+                constant = find_def(inst->get_var_arg1(), EvalVarDef::Kind::Const);
+            }
+            // An index below an array length is at most INT32_MAX - 1, so adding one cannot overflow.
+            if (load && constant && constant->value >= 0 && constant->value <= 1)
+            {
+                defs[inst->get_var_dst()] = EvalVarDef{EvalVarDef::Kind::Increment, load->var, constant->value, load->load_position};
+            }
+            break;
+        }
+        case hl::OpCodeEnum::StLoc:
+        case hl::OpCodeEnum::StArg:
+        {
+            const Variable* target = inst->get_var_dst();
+            bool non_negative = false;
+            auto it = defs.find(inst->get_var_src());
+            if (it != defs.end() && target->reduce_type == metadata::RtArgOrLocOrFieldReduceType::I4)
+            {
+                const EvalVarDef& def = it->second;
+                switch (def.kind)
+                {
+                case EvalVarDef::Kind::Const:
+                    non_negative = def.value >= 0;
+                    break;
+                case EvalVarDef::Kind::Load:
+                    non_negative = is_unchanged(&def) && is_non_negative(facts, def.var);
+                    break;
+                case EvalVarDef::Kind::Increment:
+                    non_negative = is_unchanged(&def) && is_bounded(facts, def.var, nullptr);
+                    break;
+                default:
+                    break;
+                }
+            }
+            kill_facts(facts, target);
+            if (non_negative && _address_taken_vars.find(target) == _address_taken_vars.end())
+            {
+                add_fact(facts, IndexFact{target, nullptr});
+            }
+            last_store_positions[target] = position;
+            break;
+        }
+        default:
+            if (is_primitive_array_access(code))
+            {
+                const EvalVarDef* array_def = find_def(inst->get_var_arg1(), EvalVarDef::Kind::Load);
+                const EvalVarDef* index_def = find_index_load(inst->get_var_arg2());
+                if (mark_in_bounds_insts && array_def && index_def && is_unchanged(array_def) && is_bounded(facts, index_def->var, array_def->var))
+                {
+                    _in_bounds_insts.insert(inst);
+                }
+            }
+            break;
+        }
+        ++position;
+    }
+    if (mark_in_bounds_insts)
+    {
+        return false;
+    }
+
+    utils::Vector<IndexFact> fallthrough_facts = facts;
+    utils::Vector<IndexFact> taken_facts = facts;
+    const hl::GeneralInst* last = bb.insts.empty() ? nullptr : bb.insts[bb.insts.size() - 1];
+    hl::OpCodeEnum last_code = last ? last->get_opcode() : hl::OpCodeEnum::Nop;
+
+    // index < length on the taken edge of blt and bgt with swapped operands, on the fall-through edge of bge
+    // and ble. Signed compares only bound indices already known to be non-negative.
+    const Variable* index_var = nullptr;
+    const Variable* length_var = nullptr;
+    utils::Vector<IndexFact>* bounded_facts = nullptr;
+    bool is_unsigned = false;
+    switch (last_code)
+    {
+    case hl::OpCodeEnum::BltUn:
+    case hl::OpCodeEnum::BgeUn:
+    case hl::OpCodeEnum::BgtUn:
+    case hl::OpCodeEnum::BleUn:
+        is_unsigned = true;
+        break;
+    default:
+        break;
+    }
+    switch (last_code)
+    {
+    case hl::OpCodeEnum::Blt:
+    case hl::OpCodeEnum::BltUn:
+        index_var = last->get_var_arg1();
+        length_var = last->get_var_arg2();
+        bounded_facts = &taken_facts;
+        break;
+    case hl::OpCodeEnum::Bge:
+    case hl::OpCodeEnum::BgeUn:
+        index_var = last->get_var_arg1();
+        length_var = last->get_var_arg2();
+        bounded_facts = &fallthrough_facts;
+        break;
+    case hl::OpCodeEnum::Bgt:
+    case hl::OpCodeEnum::BgtUn:
+        index_var = last->get_var_arg2();
+        length_var = last->get_var_arg1();
+        bounded_facts = &taken_facts;
+        break;
+    case hl::OpCodeEnum::Ble:
+    case hl::OpCodeEnum::BleUn:
+        index_var = last->get_var_arg2();
+        length_var = last->get_var_arg1();
+        bounded_facts = &fallthrough_facts;
+        break;
+    default:
+        break;
+    }
+    if (bounded_facts)
+    {
+        const EvalVarDef* index_def = find_index_load(index_var);
+        const EvalVarDef* length_def = find_def(length_var, EvalVarDef::Kind::Length);
+        if (index_def && length_def && is_unchanged(length_def) && (is_unsigned || is_non_negative(facts, index_def->var)))
+        {
+            add_fact(*bounded_facts, IndexFact{index_def->var, length_def->var});
+        }
+    }
+
+    bool changed = false;
+    bool falls_through = true;
+    switch (last_code)
+    {
+    case hl::OpCodeEnum::Br:
+        changed |= merge_into(get_block_index(last->get_branch_target()), taken_facts);
+        falls_through = false;
+        break;
+    case hl::OpCodeEnum::BrTrue:
+    case hl::OpCodeEnum::BrFalse:
+    case hl::OpCodeEnum::Beq:
+    case hl::OpCodeEnum::Bge:
+    case hl::OpCodeEnum::Bgt:
+    case hl::OpCodeEnum::Ble:
+    case hl::OpCodeEnum::Blt:
+    case hl::OpCodeEnum::BneUn:
+    case hl::OpCodeEnum::BgeUn:
+    case hl::OpCodeEnum::BgtUn:
+    case hl::OpCodeEnum::BleUn:
+    case hl::OpCodeEnum::BltUn:
+        changed |= merge_into(get_block_index(last->get_branch_target()), taken_facts);
+        break;
+    case hl::OpCodeEnum::Switch:
+    {
+        auto [targets, count] = last->get_switch_targets();
+        for (size_t i = 0; i < count; ++i)
+        {
+            changed |= merge_into(get_block_index(targets[i]), taken_facts);
+        }
+        break;
+    }
+    case hl::OpCodeEnum::Ret:
+    case hl::OpCodeEnum::Throw:
+    case hl::OpCodeEnum::Rethrow:
+    case hl::OpCodeEnum::Leave:
+    case hl::OpCodeEnum::EndFilter:
+    case hl::OpCodeEnum::EndFinallyOrFault:
+        falls_through = false;
+        break;
+    default:
+        break;
+    }
+    if (falls_through && bb.next_bb)
+    {
+        changed |= merge_into(get_block_index(bb.next_bb), fallthrough_facts);
+    }
+    return changed;
+}
+
+bool ArrayBoundsAnalysis::contains(const utils::Vector<IndexFact>& facts, const IndexFact& fact)
+{
+    for (const IndexFact& f : facts)
+    {
+        if (f == fact)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ArrayBoundsAnalysis::is_non_negative(const utils::Vector<IndexFact>& facts, const Variable* index)
+{
+    for (const IndexFact& f : facts)
+    {
+        if (f.index == index)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ArrayBoundsAnalysis::is_bounded(const utils::Vector<IndexFact>& facts, const Variable* index, const Variable* array)
+{
+    for (const IndexFact& f : facts)
+    {
+        if (f.index == index && f.array && (!array || f.array == array))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ArrayBoundsAnalysis::add_fact(utils::Vector<IndexFact>& facts, const IndexFact& fact)
+{
+    if (!contains(facts, fact))
+    {
+        facts.push_back(fact);
+    }
+}
+
+void ArrayBoundsAnalysis::kill_facts(utils::Vector<IndexFact>& facts, const Variable* var)
+{
+    auto end = std::remove_if(facts.begin(), facts.end(), [var](const IndexFact& f) { return f.index == var || f.array == var; });
+    facts.resize(static_cast<size_t>(end - facts.begin()));
+}
+
+} // namespace leanclr::interp
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "rt_base.h"
+#include "transform_defs.h"
+#include "utils/hashmap.h"
+#include "utils/hashset.h"
+#include "utils/rt_vector.h"
+
+namespace leanclr::interp::hl
+{
+struct GeneralInst;
+struct BasicBlock;
+class Transformer;
+} // namespace leanclr::interp::hl
+
+namespace leanclr::interp
+{
+
+// Finds the ldelem/stelem of primitive elements whose index is known to lie in [0, length) of a non-null
+// array, so that the low level transformer can emit them without null and bounds checks.
+//
+// A forward dataflow over the high level basic blocks tracks, for int32 locals and arguments whose address
+// is never taken, which are non-negative and which are below the length of an array local. The latter comes
+// from branches comparing the index with ldlen of the array, as emitted for `for (i = 0; i < a.Length; i++)`
+// and `if ((uint)i < (uint)a.Length)`; the ldlen also proves the array non-null. Stores kill the facts of
+// their target, and `i = i + 1` keeps an index bounded by a length non-negative.
+class ArrayBoundsAnalysis
+{
+  public:
+    ArrayBoundsAnalysis(const hl::Transformer& hl_transformer) : _hl_transformer(hl_transformer)
+    {
+    }
+
+    void analyze();
+
+    bool is_in_bounds(const hl::GeneralInst* inst) const
+    {
+        return _in_bounds_insts.find(inst) != _in_bounds_insts.end();
+    }
+
+  private:
+    struct IndexFact
+    {
+        const Variable* index;
+        // nullptr when only the index being non-negative is known.
+        const Variable* array;
+
+        bool operator==(const IndexFact& other) const
+        {
+            return index == other.index && array == other.array;
+        }
+    };
+
+    size_t get_block_index(const hl::BasicBlock* bb) const;
+    void collect_address_taken_vars();
+    void mark_unknown_entries();
+    bool merge_into(size_t block_index, const utils::Vector<IndexFact>& facts);
+    bool scan_block(size_t block_index, bool mark_in_bounds_insts);
+
+    static bool contains(const utils::Vector<IndexFact>& facts, const IndexFact& fact);
+    static bool is_non_negative(const utils::Vector<IndexFact>& facts, const Variable* index);
+    static bool is_bounded(const utils::Vector<IndexFact>& facts, const Variable* index, const Variable* array);
+    static void add_fact(utils::Vector<IndexFact>& facts, const IndexFact& fact);
+    static void kill_facts(utils::Vector<IndexFact>& facts, const Variable* var);
+
+    const hl::Transformer& _hl_transformer;
+    const hl::BasicBlock* _basic_blocks{nullptr};
+    size_t _basic_block_count{0};
+    // Facts on entry of the blocks reached so far, by block index.
+    utils::HashMap<size_t, utils::Vector<IndexFact>> _entry_facts;
+    utils::HashSet<const Variable*> _address_taken_vars;
+    utils::HashSet<const hl::GeneralInst*> _in_bounds_insts;
+};
+
+} // namespace leanclr::interp
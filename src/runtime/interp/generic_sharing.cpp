@@ -0,0 +1,294 @@
+#include "generic_sharing.h"
+
+#include "hl_transformer.h"
+#include "interpreter.h"
+#include "vm/class.h"
+#include "vm/array_class.h"
+#include "vm/generic_method.h"
+#include "vm/method.h"
+#include "vm/settings.h"
+#include "vm/type.h"
+#include "metadata/metadata_cache.h"
+#include "metadata/module_def.h"
+#include "utils/hashmap.h"
+
+namespace leanclr::interp
+{
+
+static RtResult<bool> is_shareable_generic_arg(const metadata::RtTypeSig* arg)
+{
+    if (arg->by_ref || vm::Type::contains_generic_param(arg))
+    {
+        RET_OK(false);
+    }
+    switch (arg->ele_type)
+    {
+    case metadata::RtElementType::Object:
+    case metadata::RtElementType::String:
+    case metadata::RtElementType::Class:
+    case metadata::RtElementType::SZArray:
+    case metadata::RtElementType::Array:
+        RET_OK(true);
+    case metadata::RtElementType::GenericInst:
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, is_value_type, vm::Type::is_value_type(arg));
+        RET_OK(!is_value_type);
+    }
+    default:
+        RET_OK(false);
+    }
+}
+
+// Replaces every argument of inst by System.Object. Sets all_object when inst already is canonical.
+static RtResult<const metadata::RtGenericInst*> get_canonical_generic_inst(const metadata::RtGenericInst* inst, bool& shareable, bool& all_object)
+{
+    if (!inst)
+    {
+        RET_OK(inst);
+    }
+    const metadata::RtTypeSig* object_sig = vm::Class::get_corlib_types().cls_object->by_val;
+    const metadata::RtTypeSig* canonical_args[UINT8_MAX];
+    for (uint8_t i = 0; i < inst->generic_arg_count; ++i)
+    {
+        const metadata::RtTypeSig* arg = inst->generic_args[i];
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, shareable_arg, is_shareable_generic_arg(arg));
+        if (!shareable_arg)
+        {
+            shareable = false;
+            RET_OK(inst);
+        }
+        all_object = all_object && arg->ele_type == metadata::RtElementType::Object;
+        canonical_args[i] = object_sig;
+    }
+    return metadata::MetadataCache::get_pooled_generic_inst(canonical_args, inst->generic_arg_count);
+}
+
+RtResult<const metadata::RtMethodInfo*> GenericSharing::get_canonical_method(const metadata::RtMethodInfo* method)
+{
+    const metadata::RtGenericMethod* generic_method = method->generic_method;
+    if (!vm::Settings::is_generic_sharing_enabled() || !generic_method || vm::Class::is_array_or_szarray(method->parent))
+    {
+        RET_OK((const metadata::RtMethodInfo*)nullptr);
+    }
+
+    bool shareable = true;
+    bool all_object = true;
+    const metadata::RtGenericContext& generic_context = generic_method->generic_context;
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtGenericInst*, class_inst,
+                                            get_canonical_generic_inst(generic_context.class_inst, shareable, all_object));
+    if (!shareable)
+    {
+        RET_OK((const metadata::RtMethodInfo*)nullptr);
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtGenericInst*, method_inst,
+                                            get_canonical_generic_inst(generic_context.method_inst, shareable, all_object));
+    if (!shareable)
+    {
+        RET_OK((const metadata::RtMethodInfo*)nullptr);
+    }
+    if (all_object)
+    {
+        RET_OK(method);
+    }
+
+    const metadata::RtGenericMethod* canonical_generic_method =
+        metadata::MetadataCache::get_pooled_generic_method(generic_method->base_method_gid, class_inst, method_inst);
+    return vm::GenericMethod::get_method_from_pooled_generic_method(canonical_generic_method);
+}
+
+namespace
+{
+// Maps what the canonical body resolved to what the instantiation resolves for the same tokens.
+class SharedBodyBinder
+{
+  public:
+    // Returns false when from is already bound to something else, i.e. the canonical body cannot tell
+    // two of the instantiation's entities apart.
+    bool bind(RtResolvedDataKind kind, const void* from, const void* to)
+    {
+        auto& map = _maps[static_cast<size_t>(kind)];
+        auto it = map.find(from);
+        if (it != map.end())
+        {
+            return it->second == to;
+        }
+        map.insert({from, to});
+        return true;
+    }
+
+    RtResult<bool> bind_handle(const metadata::RtRuntimeHandle& from, const metadata::RtRuntimeHandle& to)
+    {
+        if (from.type != to.type)
+        {
+            RET_OK(false);
+        }
+        switch (from.type)
+        {
+        case metadata::RtRuntimeHandleType::Type:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, from_klass, vm::Class::get_class_from_typesig(from.typeSig));
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, to_klass, vm::Class::get_class_from_typesig(to.typeSig));
+            RET_OK(bind(RtResolvedDataKind::TypeSig, from.typeSig, to.typeSig) && bind(RtResolvedDataKind::Class, from_klass, to_klass));
+        }
+        case metadata::RtRuntimeHandleType::Method:
+            RET_OK(bind(RtResolvedDataKind::Method, from.method, to.method));
+        case metadata::RtRuntimeHandleType::Field:
+            RET_OK(bind(RtResolvedDataKind::Field, from.field, to.field));
+        default:
+            RET_OK(false);
+        }
+    }
+
+    const void* find(RtResolvedDataKind kind, const void* from) const
+    {
+        const auto& map = _maps[static_cast<size_t>(kind)];
+        auto it = map.find(from);
+        return it != map.end() ? it->second : nullptr;
+    }
+
+    // Slots that were not produced by a token directly. Entities that cannot depend on the type arguments
+    // are kept, arrays of a bound element type are rebuilt, anything else makes the body unshareable.
+    RtResult<const void*> rebind(RtResolvedDataKind kind, const void* from) const
+    {
+        if (kind == RtResolvedDataKind::Literal)
+        {
+            RET_OK(from);
+        }
+        if (const void* to = find(kind, from))
+        {
+            RET_OK(to);
+        }
+        switch (kind)
+        {
+        case RtResolvedDataKind::Class:
+        {
+            metadata::RtClass* klass = const_cast<metadata::RtClass*>(static_cast<const metadata::RtClass*>(from));
+            if (vm::Class::is_szarray_class(klass))
+            {
+                const void* ele_klass = find(RtResolvedDataKind::Class, klass->element_class);
+                if (ele_klass)
+                {
+                    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(
+                        metadata::RtClass*, arr_klass,
+                        vm::ArrayClass::get_szarray_class_from_element_class(const_cast<metadata::RtClass*>(static_cast<const metadata::RtClass*>(ele_klass))));
+                    RET_OK(arr_klass);
+                }
+            }
+            if (vm::Class::is_generic_inst(klass) || vm::Class::is_array_or_szarray(klass))
+            {
+                RET_OK((const void*)nullptr);
+            }
+            RET_OK(from);
+        }
+        case RtResolvedDataKind::Method:
+        {
+            const metadata::RtMethodInfo* method = static_cast<const metadata::RtMethodInfo*>(from);
+            RET_OK(method->generic_method ? nullptr : from);
+        }
+        case RtResolvedDataKind::Field:
+        {
+            const metadata::RtFieldInfo* field = static_cast<const metadata::RtFieldInfo*>(from);
+            RET_OK(vm::Class::is_generic_inst(field->parent) ? nullptr : from);
+        }
+        default:
+            RET_OK((const void*)nullptr);
+        }
+    }
+
+  private:
+    utils::HashMap<const void*, const void*> _maps[static_cast<size_t>(RtResolvedDataKind::TypeSig) + 1];
+};
+
+struct ResolutionContext
+{
+    metadata::RtGenericContainerContext generic_container_context;
+    const metadata::RtGenericContext* generic_context;
+
+    explicit ResolutionContext(const metadata::RtMethodInfo* method)
+    {
+        generic_container_context.klass = method->parent->generic_container;
+        generic_container_context.method = method->generic_container;
+        generic_context = method->generic_method ? &method->generic_method->generic_context : nullptr;
+    }
+};
+} // namespace
+
+RtResult<const RtInterpMethodInfo*> GenericSharing::instantiate_shared_body(const metadata::RtMethodInfo* method, const metadata::RtMethodInfo* canonical_method,
+                                                                            const RtInterpMethodInfo* canonical_imi)
+{
+    const RtInterpSharedBody* shared_body = canonical_imi->shared_body;
+    if (!shared_body)
+    {
+        RET_OK((const RtInterpMethodInfo*)nullptr);
+    }
+
+    metadata::RtModuleDef* mod = method->parent->image;
+    ResolutionContext canonical_ctx(canonical_method);
+    ResolutionContext ctx(method);
+    SharedBodyBinder binder;
+    for (uint32_t i = 0; i < shared_body->token_count; ++i)
+    {
+        uint32_t token = shared_body->tokens[i];
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(
+            metadata::RtRuntimeHandle, from,
+            hl::Transformer::resolve_runtime_handle(mod, token, canonical_ctx.generic_container_context, canonical_ctx.generic_context));
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(metadata::RtRuntimeHandle, to,
+                                                 hl::Transformer::resolve_runtime_handle(mod, token, ctx.generic_container_context, ctx.generic_context));
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, bound, binder.bind_handle(from, to));
+        if (!bound)
+        {
+            RET_OK((const RtInterpMethodInfo*)nullptr);
+        }
+    }
+
+    alloc::MemPool& pool = vm::Method::get_code_mem_pool(method);
+    const void** resolved_datas = nullptr;
+    if (shared_body->resolved_data_count > 0)
+    {
+        resolved_datas = pool.calloc_any<const void*>(shared_body->resolved_data_count);
+        for (uint32_t i = 0; i < shared_body->resolved_data_count; ++i)
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const void*, data,
+                                                    binder.rebind(shared_body->resolved_data_kinds[i], canonical_imi->resolved_datas[i]));
+            if (!data)
+            {
+                RET_OK((const RtInterpMethodInfo*)nullptr);
+            }
+            resolved_datas[i] = data;
+        }
+    }
+
+    const RtInterpExceptionClause* exception_clauses = canonical_imi->exception_clauses;
+    if (canonical_imi->exception_clause_count > 0)
+    {
+        RtInterpExceptionClause* rebound_clauses = pool.calloc_any<RtInterpExceptionClause>(canonical_imi->exception_clause_count);
+        for (uint8_t i = 0; i < canonical_imi->exception_clause_count; ++i)
+        {
+            rebound_clauses[i] = exception_clauses[i];
+            if (exception_clauses[i].ex_klass)
+            {
+                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const void*, ex_klass, binder.rebind(RtResolvedDataKind::Class, exception_clauses[i].ex_klass));
+                if (!ex_klass)
+                {
+                    RET_OK((const RtInterpMethodInfo*)nullptr);
+                }
+                rebound_clauses[i].ex_klass = const_cast<metadata::RtClass*>(static_cast<const metadata::RtClass*>(ex_klass));
+            }
+        }
+        exception_clauses = rebound_clauses;
+    }
+
+    RtInterpMethodInfo* imi = pool.malloc_any_zeroed<RtInterpMethodInfo>();
+    *imi = *canonical_imi;
+    imi->resolved_datas = resolved_datas;
+    imi->exception_clauses = exception_clauses;
+    // Try ranges are offsets into the shared codes, but the memoized handlers depend on the exception classes.
+    if (canonical_imi->exception_clause_count > 0)
+    {
+        imi->handler_cache = pool.calloc_any<RtInterpHandlerCacheEntry>(INTERP_HANDLER_CACHE_SIZE);
+        Interpreter::register_handler_cache(method, imi->handler_cache);
+    }
+    RET_OK(imi);
+}
+
+} // namespace leanclr::interp
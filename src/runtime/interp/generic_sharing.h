@@ -0,0 +1,27 @@
+#pragma once
+
+#include "interp_defs.h"
+
+namespace leanclr::interp
+{
+
+// Instantiations of a generic method whose type arguments are all reference types have the same layout
+// and, apart from the types, methods and fields they resolve, the same interpreter code. They share the
+// body transformed for the canonical instantiation, in which every type argument is System.Object. Each
+// instantiation still gets its own resolved data slots, rebound by resolving the canonical body's tokens
+// in its own generic context.
+class GenericSharing
+{
+  public:
+    // Returns the canonical instantiation whose body the method may share, which can be the method itself,
+    // or nullptr when the method is not an instantiation over reference types only.
+    static RtResult<const metadata::RtMethodInfo*> get_canonical_method(const metadata::RtMethodInfo* method);
+
+    // Builds the method info of an instantiation on top of the shared body of its canonical instantiation.
+    // Returns nullptr when a slot cannot be rebound unambiguously, e.g. when the body refers to both T and
+    // System.Object; the caller then transforms the method on its own.
+    static RtResult<const RtInterpMethodInfo*> instantiate_shared_body(const metadata::RtMethodInfo* method, const metadata::RtMethodInfo* canonical_method,
+                                                                       const RtInterpMethodInfo* canonical_imi);
+};
+
+} // namespace leanclr::interp
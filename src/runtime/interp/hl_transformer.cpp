@@ -52,6 +52,21 @@ const metadata::RtGenericContext* Transformer::get_generic_context() const
     return _generic_context;
 }
 
+const utils::HashMap<uint32_t, metadata::RtRuntimeHandle>& Transformer::get_resolved_runtime_handles() const
+{
+    return _runtime_handle_cache;
+}
+
+void Transformer::set_shared_generic_body(bool shared)
+{
+    _shared_generic_body = shared;
+}
+
+bool Transformer::is_shared_generic_body() const
+{
+    return _shared_generic_body;
+}
+
 size_t Transformer::get_total_arg_and_local_stack_object_size() const
 {
     return _total_arg_and_local_stack_object_size;
@@ -225,7 +240,13 @@ RtResult<const metadata::RtFieldInfo*> Transformer::get_field_from_token(uint32_
 
 RtResult<metadata::RtRuntimeHandle> Transformer::get_raw_runtime_handle_from_token(uint32_t raw_token)
 {
-    metadata::RtModuleDef* mod = get_module();
+    return resolve_runtime_handle(get_module(), raw_token, _generic_container_context, _generic_context);
+}
+
+RtResult<metadata::RtRuntimeHandle> Transformer::resolve_runtime_handle(metadata::RtModuleDef* mod, uint32_t raw_token,
+                                                                        const metadata::RtGenericContainerContext& generic_container_context,
+                                                                        const metadata::RtGenericContext* generic_context)
+{
     metadata::RtToken token = metadata::RtToken::decode(raw_token);
 
     // Decode and resolve the handle based on token type
@@ -236,7 +257,7 @@ RtResult<metadata::RtRuntimeHandle> Transformer::get_raw_runtime_handle_from_tok
     case metadata::TableType::TypeSpec:
     {
         DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(const metadata::RtTypeSig*, type,
-                                                 mod->get_typesig_by_type_def_ref_spec_token(token, _generic_container_context, _generic_context));
+                                                 mod->get_typesig_by_type_def_ref_spec_token(token, generic_container_context, generic_context));
         DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(metadata::RtClass*, klass, vm::Class::get_class_from_typesig(type));
         RET_ERR_ON_FAIL(vm::Class::initialize_all(klass));
         RET_OK(metadata::RtRuntimeHandle(type));
@@ -245,18 +266,18 @@ RtResult<metadata::RtRuntimeHandle> Transformer::get_raw_runtime_handle_from_tok
     case metadata::TableType::MethodSpec:
     {
         DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(const metadata::RtMethodInfo*, method,
-                                                 mod->get_method_by_token(token, _generic_container_context, _generic_context));
+                                                 mod->get_method_by_token(token, generic_container_context, generic_context));
         RET_ERR_ON_FAIL(vm::Class::initialize_all(method->parent));
         RET_OK(metadata::RtRuntimeHandle(method));
     }
     case metadata::TableType::MemberRef:
     {
-        return mod->get_member_ref_by_rid(token.rid, _generic_container_context, _generic_context);
+        return mod->get_member_ref_by_rid(token.rid, generic_container_context, generic_context);
     }
     case metadata::TableType::Field:
     {
         DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(const metadata::RtFieldInfo*, field,
-                                                 mod->get_field_by_token(token, _generic_container_context, _generic_context));
+                                                 mod->get_field_by_token(token, generic_container_context, generic_context));
         RET_ERR_ON_FAIL(vm::Class::initialize_all(field->parent));
         RET_OK(metadata::RtRuntimeHandle(field));
     }
@@ -1123,6 +1144,7 @@ RtResultVoid Transformer::add_call_common(const metadata::RtMethodInfo* method,
         opcode = OpCodeEnum::CallIntrinsic;
         break;
     case metadata::RtInvokerType::PInvoke:
+    case metadata::RtInvokerType::DynamicPInvoke:
         opcode = OpCodeEnum::CallPInvoke;
         break;
     case metadata::RtInvokerType::RuntimeImpl:
@@ -1680,6 +1702,140 @@ RtResultVoid Transformer::add_box(metadata::RtClass* klass)
     RET_VOID_OK();
 }
 
+// A conditional branch whose outcome is known at transform time: becomes a Br or falls through,
+// while both successors still receive the current eval stack.
+RtResultVoid Transformer::add_folded_branch(size_t next_offset, int32_t target_offset, bool taken)
+{
+    if (taken)
+    {
+        RET_ERR_ON_FAIL(add_br(static_cast<uint32_t>(next_offset), target_offset));
+    }
+    else if (target_offset != 0)
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(BasicBlock*, target_bb, get_branch_target_bb(next_offset + target_offset));
+        RET_ERR_ON_FAIL(setup_target_branch_eval_stack(target_bb));
+    }
+    if (_cur_bb->next_bb)
+    {
+        RET_ERR_ON_FAIL(setup_target_branch_eval_stack(_cur_bb->next_bb));
+    }
+    RET_VOID_OK();
+}
+
+struct ILConditionalBranch
+{
+    size_t size;
+    int32_t target_offset;
+    bool is_true;
+};
+
+static bool decode_il_conditional_branch(const uint8_t* code, size_t available, ILConditionalBranch& branch)
+{
+    if (available < 2)
+        return false;
+    switch (static_cast<il::OpCodeValue>(code[0]))
+    {
+    case il::OpCodeValue::BrtrueS:
+    case il::OpCodeValue::BrfalseS:
+        branch.size = 2;
+        branch.target_offset = static_cast<int8_t>(code[1]);
+        branch.is_true = static_cast<il::OpCodeValue>(code[0]) == il::OpCodeValue::BrtrueS;
+        return true;
+    case il::OpCodeValue::Brtrue:
+    case il::OpCodeValue::Brfalse:
+        if (available < 5)
+            return false;
+        branch.size = 5;
+        branch.target_offset = static_cast<int32_t>(utils::MemOp::read_u32_may_unaligned(code + 1));
+        branch.is_true = static_cast<il::OpCodeValue>(code[0]) == il::OpCodeValue::Brtrue;
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Folds the IL idioms that box a value type only to inspect the box, which the C# compiler emits
+// for generic code instantiated over structs:
+//   box T; unbox.any T                  -> the value itself
+//   box T; brtrue/brfalse               -> unconditional branch or fall-through (a box is never null)
+//   box T; ldnull; ceq/cgt.un           -> constant
+//   box T; isinst I; brtrue/brfalse     -> branch resolved from whether T is assignable to I
+//   box T; isinst I; ldnull; cgt.un     -> constant
+// Returns the number of IL bytes consumed after the box, or 0 if nothing was folded. Only
+// instructions inside the current basic block are considered, so no branch can land between them.
+RtResult<size_t> Transformer::try_fold_box(metadata::RtClass* klass, size_t next_il_offset, size_t il_offset_end)
+{
+    if (!vm::Class::is_value_type(klass))
+    {
+        RET_OK(0);
+    }
+    const uint8_t* code = _method_body->code + next_il_offset;
+    size_t available = il_offset_end - next_il_offset;
+    if (available == 0)
+    {
+        RET_OK(0);
+    }
+
+    il::OpCodeValue next = static_cast<il::OpCodeValue>(code[0]);
+    if (next == il::OpCodeValue::UnboxAny && available >= 5)
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, unbox_klass, get_class_from_token(utils::MemOp::read_u32_may_unaligned(code + 1)));
+        RET_OK(unbox_klass == klass ? 5 : 0);
+    }
+
+    // Boxing a Nullable<T> may produce null, so only the unbox.any round trip is folded for it.
+    if (vm::Class::is_nullable_type(klass))
+    {
+        RET_OK(0);
+    }
+
+    // The boxed object is known to be non-null; is_instance tells whether it survives an isinst.
+    bool is_instance = true;
+    size_t consumed = 0;
+    if (next == il::OpCodeValue::Isinst)
+    {
+        // Whether a generic struct implements an interface can depend on the type arguments, which a
+        // shared body does not know.
+        if (_shared_generic_body || available < 5)
+        {
+            RET_OK(0);
+        }
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, isinst_klass, get_class_from_token(utils::MemOp::read_u32_may_unaligned(code + 1)));
+        if (vm::Class::is_nullable_type(isinst_klass))
+        {
+            isinst_klass = vm::Class::get_nullable_underlying_class(isinst_klass);
+        }
+        // The super-type and interface tables the check reads are only set up by initialize_all.
+        RET_ERR_ON_FAIL(vm::Class::initialize_all(klass));
+        RET_ERR_ON_FAIL(vm::Class::initialize_all(isinst_klass));
+        is_instance = vm::Class::is_assignable_from(klass, isinst_klass);
+        consumed = 5;
+    }
+
+    ILConditionalBranch branch;
+    if (decode_il_conditional_branch(code + consumed, available - consumed, branch))
+    {
+        RET_ERR_ON_FAIL(pop_eval_stack());
+        size_t branch_next_offset = next_il_offset + consumed + branch.size;
+        RET_ERR_ON_FAIL(add_folded_branch(branch_next_offset, branch.target_offset, branch.is_true == is_instance));
+        RET_OK(consumed + branch.size);
+    }
+
+    // ldnull; ceq (== null) or ldnull; cgt.un (!= null)
+    if (available - consumed >= 3 && static_cast<il::OpCodeValue>(code[consumed]) == il::OpCodeValue::LdNull &&
+        static_cast<il::OpCodeValue>(code[consumed + 1]) == il::OpCodeValue::Prefix1)
+    {
+        il::OpCodeValueExt cmp = static_cast<il::OpCodeValueExt>(code[consumed + 2]);
+        if (cmp == il::OpCodeValueExt::Ceq || cmp == il::OpCodeValueExt::CgtUn)
+        {
+            RET_ERR_ON_FAIL(pop_eval_stack());
+            RET_ERR_ON_FAIL(add_ldci4((cmp == il::OpCodeValueExt::CgtUn) == is_instance ? 1 : 0));
+            RET_OK(consumed + 3);
+        }
+    }
+    RET_OK(0);
+}
+
 RtResultVoid Transformer::add_unbox(metadata::RtClass* klass)
 {
     if (vm::Class::is_nullable_type(klass))
@@ -3274,8 +3430,13 @@ RtResultVoid Transformer::transform_body()
             {
                 uint32_t type_token = utils::MemOp::read_u32_may_unaligned(codes_begin + il_offset_cur + 1);
                 DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, klass, get_class_from_token(type_token));
-                RET_ERR_ON_FAIL(add_box(klass));
                 il_offset_cur += 5;
+                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(size_t, folded_il_size, try_fold_box(klass, il_offset_cur, il_offset_end));
+                if (folded_il_size == 0)
+                {
+                    RET_ERR_ON_FAIL(add_box(klass));
+                }
+                il_offset_cur += folded_il_size;
                 break;
             }
             case il::OpCodeValue::Newarr:
@@ -398,6 +398,11 @@ struct GeneralInst
         extra_data.method_sig = method_sig;
     }
 
+    const metadata::RtMethodSig* get_method_sig() const
+    {
+        return extra_data.method_sig;
+    }
+
     void set_user_string(const vm::RtString* user_string)
     {
         extra_data.user_string = user_string;
@@ -431,6 +436,15 @@ class Transformer
     metadata::RtModuleDef* get_module() const;
     const metadata::RtGenericContainerContext& get_generic_container_context() const;
     const metadata::RtGenericContext* get_generic_context() const;
+    const utils::HashMap<uint32_t, metadata::RtRuntimeHandle>& get_resolved_runtime_handles() const;
+    RtResult<metadata::RtClass*> get_class_from_token(uint32_t raw_token);
+    static RtResult<metadata::RtRuntimeHandle> resolve_runtime_handle(metadata::RtModuleDef* mod, uint32_t raw_token,
+                                                                      const metadata::RtGenericContainerContext& generic_container_context,
+                                                                      const metadata::RtGenericContext* generic_context);
+    // Marks the body as the canonical one of a generic method, shared by its reference type instantiations.
+    // Transform-time decisions that depend on the identity of a type argument are then skipped.
+    void set_shared_generic_body(bool shared);
+    bool is_shared_generic_body() const;
     size_t get_total_arg_and_local_stack_object_size() const;
     size_t get_max_stack_size() const;
     bool need_init_locals() const;
@@ -462,7 +476,6 @@ class Transformer
     RtResult<const metadata::RtMethodInfo*> get_method_from_token(uint32_t raw_token);
     RtResult<metadata::RtMethodSig> get_standalone_method_sig_from_token(uint32_t token);
     RtResult<const metadata::RtTypeSig*> get_type_from_token(uint32_t raw_token);
-    RtResult<metadata::RtClass*> get_class_from_token(uint32_t raw_token);
     RtResult<const metadata::RtFieldInfo*> get_field_from_token(uint32_t raw_token);
     RtResult<metadata::RtRuntimeHandle> get_raw_runtime_handle_from_token(uint32_t raw_token);
 
@@ -544,6 +557,8 @@ class Transformer
     RtResultVoid add_castclass(metadata::RtClass* klass);
     RtResultVoid add_isinst(metadata::RtClass* klass);
     RtResultVoid add_box(metadata::RtClass* klass);
+    RtResult<size_t> try_fold_box(metadata::RtClass* klass, size_t next_il_offset, size_t il_offset_end);
+    RtResultVoid add_folded_branch(size_t next_offset, int32_t target_offset, bool taken);
     RtResultVoid add_unbox(metadata::RtClass* klass);
     RtResultVoid add_unbox_any(metadata::RtClass* klass);
     RtResultVoid add_ldfld(const metadata::RtFieldInfo* field);
@@ -605,5 +620,6 @@ class Transformer
     metadata::RtClass* _constrained_class{nullptr};
     bool _not_retset_prefix_after_cur_il{false};
     utils::HashMap<uint32_t, metadata::RtRuntimeHandle> _runtime_handle_cache;
+    bool _shared_generic_body{false};
 };
 } // namespace leanclr::interp::hl
@@ -3,6 +3,8 @@
 #include "vm/class.h"
 #include "vm/generic_class.h"
 
+#include <algorithm>
+
 namespace leanclr::interp
 {
 RtEvalStackDataType InterpDefs::get_eval_stack_data_type_by_reduce_type(metadata::RtArgOrLocOrFieldReduceType reduce_type)
@@ -178,4 +180,34 @@ size_t InterpDefs::get_stack_object_size_by_byte_size(size_t byte_size)
     assert(byte_size <= UINT16_MAX * sizeof(RtStackObject) && "byte_size too large for stack object");
     return (byte_size + 7) / 8;
 }
+
+int32_t InterpDefs::get_il_offset(const RtInterpMethodInfo* imi, const void* ip)
+{
+    const uint8_t* pos = static_cast<const uint8_t*>(ip);
+    if (!imi || imi->il_map_count == 0 || pos < imi->codes || pos >= imi->codes + imi->code_size)
+    {
+        return -1;
+    }
+    uint32_t ir_offset = static_cast<uint32_t>(pos - imi->codes);
+    // Last entry starting at or before ir_offset. Empty blocks share their offset with the next one, which
+    // sorts after them and wins.
+    const RtInterpIlMapEntry* begin = imi->il_map;
+    const RtInterpIlMapEntry* end = imi->il_map + imi->il_map_count;
+    const RtInterpIlMapEntry* it =
+        std::upper_bound(begin, end, ir_offset, [](uint32_t offset, const RtInterpIlMapEntry& entry) { return offset < entry.ir_offset; });
+    return it == begin ? -1 : static_cast<int32_t>((it - 1)->il_offset);
+}
+
+const RtInterpTryRange* InterpDefs::find_try_range(const RtInterpMethodInfo* imi, uint32_t ir_offset)
+{
+    const RtInterpTryRange* begin = imi->try_ranges;
+    const RtInterpTryRange* end = imi->try_ranges + imi->try_range_count;
+    const RtInterpTryRange* it =
+        std::upper_bound(begin, end, ir_offset, [](uint32_t offset, const RtInterpTryRange& range) { return offset < range.begin_offset; });
+    if (it == begin || ir_offset >= (it - 1)->end_offset)
+    {
+        return nullptr;
+    }
+    return it - 1;
+}
 } // namespace leanclr::interp
@@ -66,17 +66,81 @@ struct RtInterpExceptionClause
     }
 };
 
+// Maximal IR range covered by the same try blocks. The ranges of a method are disjoint and sorted by
+// begin_offset; code outside every try block has none.
+struct RtInterpTryRange
+{
+    uint32_t begin_offset;
+    uint32_t end_offset;
+    // The covering clauses are try_range_clauses[first_clause .. first_clause + clause_count), as indices
+    // into exception_clauses in clause order, so innermost first.
+    uint32_t first_clause;
+    uint32_t clause_count;
+};
+
+// Memoized handler search: the first clause from first_search_clause on that handles exceptions of
+// ex_klass thrown at ip_offset, or exception_clause_count if none does.
+struct RtInterpHandlerCacheEntry
+{
+    const metadata::RtClass* ex_klass;
+    uint32_t ip_offset;
+    uint8_t first_search_clause;
+    uint8_t clause;
+};
+
+// Entries of the direct mapped handler cache of a method with exception clauses.
+const size_t INTERP_HANDLER_CACHE_SIZE = 8;
+
+// What a resolved data slot holds, so that a shared generic body can rebind it for another instantiation
+enum class RtResolvedDataKind : uint8_t
+{
+    Literal, // user strings, RVA data, call site signatures: the same for every instantiation
+    Class,
+    Method,
+    Field,
+    TypeSig,
+};
+
+// Attached to bodies transformed for the canonical instantiation of a generic method, in which every
+// reference type argument is System.Object. Records the tokens the transformer resolved and the kind
+// of every resolved data slot; see GenericSharing.
+struct RtInterpSharedBody
+{
+    const uint32_t* tokens;
+    const RtResolvedDataKind* resolved_data_kinds;
+    uint32_t token_count;
+    uint32_t resolved_data_count;
+};
+
+// Maps the IR offset a basic block starts at to the IL offset of the block it was transformed from.
+struct RtInterpIlMapEntry
+{
+    uint32_t ir_offset;
+    uint32_t il_offset;
+};
+
 // Interpreter method info
 struct RtInterpMethodInfo
 {
     uint8_t* codes;
     const RtInterpExceptionClause* exception_clauses;
+    const RtInterpTryRange* try_ranges;
+    const uint8_t* try_range_clauses;
+    // Written by the interpreter while dispatching exceptions; null if there are no exception clauses.
+    RtInterpHandlerCacheEntry* handler_cache;
     const void** resolved_datas;
+    // Non-null when codes are shared between the instantiations of a generic method. Each instantiation
+    // still owns its resolved_datas, which act as its generic dictionary.
+    const RtInterpSharedBody* shared_body;
+    // One entry per basic block, sorted by ir_offset.
+    const RtInterpIlMapEntry* il_map;
     uint16_t total_arg_and_local_stack_object_size;
     uint16_t max_stack_object_size;
     uint8_t exception_clause_count;
     bool init_locals;
     uint32_t code_size;
+    uint32_t il_map_count;
+    uint32_t try_range_count;
 };
 
 // Constants
@@ -95,6 +159,11 @@ class InterpDefs
     static RtEvalStackDataType get_eval_stack_data_type_by_reduce_type(metadata::RtArgOrLocOrFieldReduceType reduce_type);
     static RtResult<ReduceTypeAndSize> get_reduce_type_and_size_by_typesig(const metadata::RtTypeSig* typeSig);
     static size_t get_stack_object_size_by_byte_size(size_t byte_size);
+    // IL offset of the basic block containing ip, or -1 if ip is not within the method's codes. Frames
+    // only save ip at call sites, so for callers this is the block of the call instruction.
+    static int32_t get_il_offset(const RtInterpMethodInfo* imi, const void* ip);
+    // Try range containing the IR offset, or nullptr if it is not within any try block.
+    static const RtInterpTryRange* find_try_range(const RtInterpMethodInfo* imi, uint32_t ir_offset);
 };
 
 } // namespace leanclr::interp
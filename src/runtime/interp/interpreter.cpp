@@ -1,22 +1,29 @@
+#include <atomic>
+#include <cstring>
 #include "interpreter.h"
 #include "vm/class.h"
+#include "metadata/metadata_cache.h"
 #include "metadata/module_def.h"
+#include "utils/rt_vector.h"
 #include "hl_transformer.h"
 #include "ll_transformer.h"
+#include "generic_sharing.h"
 #include "machine_state.h"
 #include "vm/object.h"
 #include "vm/rt_array.h"
 #include "vm/method.h"
+#include "vm/pinvoke.h"
 #include "vm/runtime.h"
 #include "vm/internal_calls.h"
 #include "vm/intrinsics.h"
 #include "vm/rt_exception.h"
 #include "vm/enum.h"
+#include "vm/numerics_vector.h"
 
 namespace leanclr::interp
 {
 
-static RtResult<const RtInterpMethodInfo*> transform(const metadata::RtMethodInfo* method)
+static RtResult<const RtInterpMethodInfo*> transform(const metadata::RtMethodInfo* method, bool shared_generic_body)
 {
     metadata::RtClass* klass = method->parent;
     metadata::RtModuleDef* mod = !vm::Class::is_array_or_szarray(klass) ? klass->image : klass->parent->image;
@@ -31,8 +38,9 @@ static RtResult<const RtInterpMethodInfo*> transform(const metadata::RtMethodInf
     metadata::RtMethodBody& methodBody = optMethodBody.value();
     size_t guessSize = methodBody.code_size * 32;
     size_t pageSize = 1024;
-    alloc::MemPool pool(guessSize, pageSize, utils::MemOp::align_up(guessSize, pageSize));
+    alloc::MemPool pool(guessSize, pageSize, utils::MemOp::align_up(guessSize, pageSize), alloc::MemoryCategory::Code);
     hl::Transformer hl_transformer(mod, method, methodBody, pool);
+    hl_transformer.set_shared_generic_body(shared_generic_body);
     RET_ERR_ON_FAIL(hl_transformer.transform());
     ll::Transformer ll_transformer(hl_transformer, pool);
     RET_ERR_ON_FAIL(ll_transformer.transform());
@@ -43,7 +51,21 @@ RtResult<const RtInterpMethodInfo*> Interpreter::init_interpreter_method(const m
 {
     assert(!method->interp_data);
     RET_ERR_ON_FAIL(vm::Class::initialize_all(method->parent));
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const RtInterpMethodInfo*, interp_method, transform(method));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, canonical_method, GenericSharing::get_canonical_method(method));
+    const RtInterpMethodInfo* interp_method = nullptr;
+    if (canonical_method && canonical_method != method)
+    {
+        const RtInterpMethodInfo* canonical_imi = canonical_method->interp_data;
+        if (!canonical_imi)
+        {
+            UNWRAP_OR_RET_ERR_ON_FAIL(canonical_imi, init_interpreter_method(canonical_method));
+        }
+        UNWRAP_OR_RET_ERR_ON_FAIL(interp_method, GenericSharing::instantiate_shared_body(method, canonical_method, canonical_imi));
+    }
+    if (!interp_method)
+    {
+        UNWRAP_OR_RET_ERR_ON_FAIL(interp_method, transform(method, canonical_method == method));
+    }
     const_cast<metadata::RtMethodInfo*>(method)->interp_data = interp_method;
     RET_OK(interp_method);
 }
@@ -507,6 +529,83 @@ vm::RtException* get_exception_in_last_throw_flow(InterpFrame* frame, uint32_t i
     return data.ex;
 }
 
+struct HandlerCacheOwner
+{
+    const metadata::RtMethodInfo* method;
+    RtInterpHandlerCacheEntry* cache;
+};
+
+static utils::Vector<HandlerCacheOwner> g_handler_caches;
+
+void Interpreter::register_handler_cache(const metadata::RtMethodInfo* method, RtInterpHandlerCacheEntry* cache)
+{
+    g_handler_caches.push_back({method, cache});
+}
+
+void Interpreter::purge_unloading_modules()
+{
+    size_t kept = 0;
+    for (const HandlerCacheOwner& owner : g_handler_caches)
+    {
+        // The caches of unloading methods are freed with their code pool.
+        if (metadata::MetadataCache::refers_to_unloading_module(owner.method))
+        {
+            continue;
+        }
+        for (size_t i = 0; i < INTERP_HANDLER_CACHE_SIZE; ++i)
+        {
+            RtInterpHandlerCacheEntry& entry = owner.cache[i];
+            if (entry.ex_klass && metadata::MetadataCache::refers_to_unloading_module(entry.ex_klass))
+            {
+                entry = {};
+            }
+        }
+        g_handler_caches[kept++] = owner;
+    }
+    g_handler_caches.resize(kept);
+}
+
+// Index of the first clause from first_search_clause on that handles exceptions of ex_klass thrown at ip_offset:
+// a catch of a base class of ex_klass, or any filter, finally or fault clause whose try block covers ip_offset.
+// exception_clause_count if there is none.
+size_t find_handler_clause(const RtInterpMethodInfo* imi, metadata::RtClass* ex_klass, uint32_t ip_offset, size_t first_search_clause)
+{
+    size_t clause_count = imi->exception_clause_count;
+    if (first_search_clause >= clause_count)
+    {
+        return clause_count;
+    }
+    size_t hash = (static_cast<size_t>(ip_offset) * 31 + first_search_clause) ^ (reinterpret_cast<uintptr_t>(ex_klass) >> 4);
+    RtInterpHandlerCacheEntry& entry = imi->handler_cache[hash % INTERP_HANDLER_CACHE_SIZE];
+    if (entry.ex_klass == ex_klass && entry.ip_offset == ip_offset && entry.first_search_clause == first_search_clause)
+    {
+        return entry.clause;
+    }
+
+    size_t handler_clause = clause_count;
+    const RtInterpTryRange* range = InterpDefs::find_try_range(imi, ip_offset);
+    for (uint32_t i = 0; range && i < range->clause_count; ++i)
+    {
+        size_t clause_idx = imi->try_range_clauses[range->first_clause + i];
+        if (clause_idx < first_search_clause)
+        {
+            continue;
+        }
+        const RtInterpExceptionClause* clause = &imi->exception_clauses[clause_idx];
+        if (clause->flags != metadata::RtILExceptionClauseType::Exception || !clause->ex_klass ||
+            vm::Class::is_assignable_from(ex_klass, clause->ex_klass))
+        {
+            handler_clause = clause_idx;
+            break;
+        }
+    }
+    entry.ex_klass = ex_klass;
+    entry.ip_offset = ip_offset;
+    entry.first_search_clause = static_cast<uint8_t>(first_search_clause);
+    entry.clause = static_cast<uint8_t>(handler_clause);
+    return handler_clause;
+}
+
 #define RAISE_RUNTIME_ERROR(err)                                                       \
     if (is_in_filter_check_flow(frame))                                                \
     {                                                                                  \
@@ -566,6 +665,21 @@ vm::RtException* get_exception_in_last_throw_flow(InterpFrame* frame, uint32_t i
         }                                                                                      \
     }
 
+// The direct P/Invoke opcodes are chosen from the signature alone, so the first execution binds the method and
+// runs the static constructor of its class, as CallPInvoke does.
+#if LEANCLR_ENABLE_DYNAMIC_PINVOKE
+#define PREPARE_BLITTABLE_PINVOKE(method)                                                \
+    {                                                                                    \
+        TRY_RUN_CLASS_STATIC_CCTOR((method)->parent);                                    \
+        if ((method)->invoke_method_ptr == vm::PInvokes::dynamic_pinvoke_invoker)        \
+        {                                                                                \
+            HANDLE_RAISE_RUNTIME_ERROR_VOID(vm::PInvokes::bind_dynamic_pinvoke(method)); \
+        }                                                                                \
+    }
+#else
+#define PREPARE_BLITTABLE_PINVOKE(method) TRY_RUN_CLASS_STATIC_CCTOR((method)->parent)
+#endif
+
 #define ENTER_INTERP_FRAME(_method, _frame_base_idx, _next_ip)                                                    \
     frame->save(_next_ip);                                                                                        \
     HANDLE_RAISE_RUNTIME_ERROR2(frame, ms.enter_frame_from_interp(_method, eval_stack_base + (_frame_base_idx))); \
@@ -588,6 +702,79 @@ T* get_static_field_address(const metadata::RtFieldInfo* field)
     return reinterpret_cast<T*>(klass->static_fields_data + field->offset);
 }
 
+template <typename Inst, typename = void>
+struct HasOpCodePrefix : std::false_type
+{
+};
+
+template <typename Inst>
+struct HasOpCodePrefix<Inst, std::void_t<decltype(Inst::__prefix)>> : std::true_type
+{
+};
+
+#define LEANCLR_ASSERT_PRE_INIT_LAYOUT(code)                                                                        \
+    static_assert(sizeof(ll::code) == sizeof(ll::code##PreInit) && offsetof(ll::code, field_idx) == offsetof(ll::code##PreInit, field_idx), \
+                  #code "PreInit must have the layout of " #code)
+
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(LdsfldI1);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(LdsfldU1);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(LdsfldI2);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(LdsfldU2);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(LdsfldI4);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(LdsfldI8);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(LdsfldAny);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(Ldsflda);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(StsfldI1);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(StsfldI2);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(StsfldI4);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(StsfldI8);
+LEANCLR_ASSERT_PRE_INIT_LAYOUT(StsfldAny);
+
+#undef LEANCLR_ASSERT_PRE_INIT_LAYOUT
+
+// Stores the prefix and code of a rewritten instruction as one release store, so that a reader of the
+// codes sees either the old instruction or the new one with the operands written before it, never the
+// new prefix with the old code.
+static void publish_prefixed_code(void* inst, uint8_t prefix, uint8_t code)
+{
+    assert(reinterpret_cast<uintptr_t>(inst) % sizeof(uint16_t) == 0);
+    const uint8_t bytes[2] = {prefix, code};
+    uint16_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+#if defined(_MSC_VER) && !defined(__clang__)
+    std::atomic_thread_fence(std::memory_order_release);
+    *static_cast<volatile uint16_t*>(inst) = value;
+#else
+    __atomic_store_n(static_cast<uint16_t*>(inst), value, __ATOMIC_RELEASE);
+#endif
+}
+
+// Once the declaring class's cctor has finished, rewrites a static field access in place to its
+// pre-initialized variant. The transformer gives every static field access a resolved data slot of
+// its own, so the slot is reused for the field address. Short encodings have no room for a prefix
+// byte and keep the checked path.
+//
+// Managed code only runs on the runtime thread, so the rewrite never races with another thread running
+// the same method. The field address is still written before the opcode is published with release
+// semantics, so the rewrite stays well ordered for anything else reading the codes.
+template <typename Inst>
+void try_quicken_static_field_access(const RtInterpMethodInfo* imi, Inst* ir, const metadata::RtFieldInfo* field, ll::OpCodeValue2 pre_init_code,
+                                     const void* field_addr)
+{
+    if constexpr (HasOpCodePrefix<Inst>::value)
+    {
+        // Shared generic code serves instantiations whose static fields live elsewhere.
+        if (imi->shared_body || vm::Class::is_cctor_not_finished(field->parent))
+        {
+            return;
+        }
+        static_assert(offsetof(Inst, __prefix) == 0 && offsetof(Inst, __code) == 1 && alignof(Inst) >= sizeof(uint16_t),
+                      "prefix and code must form an aligned uint16_t");
+        imi->resolved_datas[ir->field_idx] = field_addr;
+        publish_prefixed_code(ir, static_cast<uint8_t>(ll::OpCodeValue0::Prefix2), static_cast<uint8_t>(pre_init_code));
+    }
+}
+
 #if LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
 #define LEANCLR_SWITCH_N(n, op_offset) goto* in_labels##n[ip[op_offset]];
 #define LEANCLR_CONTINUE_N(n, op_offset) goto* in_labels##n[ip[op_offset]];
@@ -1207,6 +1394,60 @@ RtResult<const RtStackObject*> Interpreter::execute(const metadata::RtMethodInfo
         &&LABEL2_ConvR4I8, &&LABEL2_ConvR4R8,  &&LABEL2_ConvR8I4,
         &&LABEL2_ConvR8I8, &&LABEL2_ConvR8R4,  &&LABEL2_LdelemaReadOnly,
         &&LABEL2_InitBlk,  &&LABEL2_CpBlk,     &&LABEL2_GetEnumLongHashCode,
+        &&LABEL2_VecAddR4x2, &&LABEL2_VecAddR4x3, &&LABEL2_VecAddR4x4,
+        &&LABEL2_VecSubR4x2, &&LABEL2_VecSubR4x3, &&LABEL2_VecSubR4x4,
+        &&LABEL2_VecMulR4x2, &&LABEL2_VecMulR4x3, &&LABEL2_VecMulR4x4,
+        &&LABEL2_VecDivR4x2, &&LABEL2_VecDivR4x3, &&LABEL2_VecDivR4x4,
+        &&LABEL2_VecMinR4x2, &&LABEL2_VecMinR4x3, &&LABEL2_VecMinR4x4,
+        &&LABEL2_VecMaxR4x2, &&LABEL2_VecMaxR4x3, &&LABEL2_VecMaxR4x4,
+        &&LABEL2_VecMulScalarR4x2, &&LABEL2_VecMulScalarR4x3, &&LABEL2_VecMulScalarR4x4,
+        &&LABEL2_VecDivScalarR4x2, &&LABEL2_VecDivScalarR4x3, &&LABEL2_VecDivScalarR4x4,
+        &&LABEL2_VecDotR4x2, &&LABEL2_VecDotR4x3, &&LABEL2_VecDotR4x4,
+        &&LABEL2_VecDistanceR4x2, &&LABEL2_VecDistanceR4x3, &&LABEL2_VecDistanceR4x4,
+        &&LABEL2_VecDistanceSquaredR4x2, &&LABEL2_VecDistanceSquaredR4x3, &&LABEL2_VecDistanceSquaredR4x4,
+        &&LABEL2_VecCrossR4x3, &&LABEL2_VecNegR4x2, &&LABEL2_VecNegR4x3,
+        &&LABEL2_VecNegR4x4, &&LABEL2_VecAbsR4x2, &&LABEL2_VecAbsR4x3,
+        &&LABEL2_VecAbsR4x4, &&LABEL2_VecSqrtR4x2, &&LABEL2_VecSqrtR4x3,
+        &&LABEL2_VecSqrtR4x4, &&LABEL2_VecNormalizeR4x2, &&LABEL2_VecNormalizeR4x3,
+        &&LABEL2_VecNormalizeR4x4, &&LABEL2_VecLengthR4x2, &&LABEL2_VecLengthR4x3,
+        &&LABEL2_VecLengthR4x4, &&LABEL2_VecLengthSquaredR4x2, &&LABEL2_VecLengthSquaredR4x3,
+        &&LABEL2_VecLengthSquaredR4x4, &&LABEL2_VecLerpR4x2, &&LABEL2_VecLerpR4x3,
+        &&LABEL2_VecLerpR4x4, &&LABEL2_VecClampR4x2, &&LABEL2_VecClampR4x3,
+        &&LABEL2_VecClampR4x4, &&LABEL2_VecAddI4x4, &&LABEL2_VecSubI4x4,
+        &&LABEL2_VecMulI4x4, &&LABEL2_VecAddI8x2, &&LABEL2_VecSubI8x2,
+        &&LABEL2_VecAddR8x2, &&LABEL2_VecSubR8x2, &&LABEL2_VecMulR8x2,
+        &&LABEL2_VecDivR8x2, &&LABEL2_VecAndX128, &&LABEL2_VecOrX128,
+        &&LABEL2_VecXorX128, &&LABEL2_AbsI4, &&LABEL2_AbsI8,
+        &&LABEL2_AbsR4, &&LABEL2_AbsR8, &&LABEL2_SqrtR4,
+        &&LABEL2_SqrtR8, &&LABEL2_FloorR4, &&LABEL2_FloorR8,
+        &&LABEL2_CeilR4, &&LABEL2_CeilR8, &&LABEL2_RoundR4,
+        &&LABEL2_RoundR8, &&LABEL2_MinI4, &&LABEL2_MinU4,
+        &&LABEL2_MinI8, &&LABEL2_MinU8, &&LABEL2_MinR4,
+        &&LABEL2_MinR8, &&LABEL2_MaxI4, &&LABEL2_MaxU4,
+        &&LABEL2_MaxI8, &&LABEL2_MaxU8, &&LABEL2_MaxR4,
+        &&LABEL2_MaxR8, &&LABEL2_FmaR4, &&LABEL2_FmaR8,
+        &&LABEL2_LdsfldI1PreInit, &&LABEL2_LdsfldU1PreInit, &&LABEL2_LdsfldI2PreInit,
+        &&LABEL2_LdsfldU2PreInit, &&LABEL2_LdsfldI4PreInit, &&LABEL2_LdsfldI8PreInit,
+        &&LABEL2_LdsfldAnyPreInit, &&LABEL2_LdsfldaPreInit, &&LABEL2_StsfldI1PreInit,
+        &&LABEL2_StsfldI2PreInit, &&LABEL2_StsfldI4PreInit, &&LABEL2_StsfldI8PreInit,
+        &&LABEL2_StsfldAnyPreInit, &&LABEL2_LdelemI1Unchecked, &&LABEL2_LdelemU1Unchecked,
+        &&LABEL2_LdelemI2Unchecked, &&LABEL2_LdelemU2Unchecked, &&LABEL2_LdelemI4Unchecked,
+        &&LABEL2_LdelemI8Unchecked, &&LABEL2_LdelemIUnchecked, &&LABEL2_StelemI1Unchecked,
+        &&LABEL2_StelemI2Unchecked, &&LABEL2_StelemI4Unchecked, &&LABEL2_StelemI8Unchecked,
+        &&LABEL2_StelemIUnchecked, &&LABEL2_CallPInvokeBlittableV0, &&LABEL2_CallPInvokeBlittableV1,
+        &&LABEL2_CallPInvokeBlittableV2, &&LABEL2_CallPInvokeBlittableV3, &&LABEL2_CallPInvokeBlittableV4,
+        &&LABEL2_CallPInvokeBlittableW0, &&LABEL2_CallPInvokeBlittableW1, &&LABEL2_CallPInvokeBlittableW2,
+        &&LABEL2_CallPInvokeBlittableW3, &&LABEL2_CallPInvokeBlittableW4, &&LABEL2_CallPInvokeBlittableR4R4,
+        &&LABEL2_CallPInvokeBlittableR4R4R4, &&LABEL2_CallPInvokeBlittableR8R8, &&LABEL2_CallPInvokeBlittableR8R8R8,
+        &&LABEL2_LdelemMD2I1, &&LABEL2_LdelemMD2U1, &&LABEL2_LdelemMD2I2,
+        &&LABEL2_LdelemMD2U2, &&LABEL2_LdelemMD2I4, &&LABEL2_LdelemMD2I8,
+        &&LABEL2_LdelemMD2I, &&LABEL2_StelemMD2I1, &&LABEL2_StelemMD2I2,
+        &&LABEL2_StelemMD2I4, &&LABEL2_StelemMD2I8, &&LABEL2_StelemMD2I,
+        &&LABEL2_LdelemaMD2, &&LABEL2_LdelemMD3I1, &&LABEL2_LdelemMD3U1,
+        &&LABEL2_LdelemMD3I2, &&LABEL2_LdelemMD3U2, &&LABEL2_LdelemMD3I4,
+        &&LABEL2_LdelemMD3I8, &&LABEL2_LdelemMD3I, &&LABEL2_StelemMD3I1,
+        &&LABEL2_StelemMD3I2, &&LABEL2_StelemMD3I4, &&LABEL2_StelemMD3I8,
+        &&LABEL2_StelemMD3I, &&LABEL2_LdelemaMD3,
     };
     static void* const in_labels3[] = {
         &&LABEL3_LdIndI2Unaligned,   &&LABEL3_LdIndU2Unaligned,  &&LABEL3_LdIndI4Unaligned,   &&LABEL3_LdIndI8Unaligned,   &&LABEL3_StIndI2Unaligned,
@@ -3297,6 +3538,7 @@ method_start:
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                 const int8_t* field_addr = get_static_field_address<int8_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldI1PreInit, field_addr);
                 int8_t value = *field_addr;
                 set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
             }
@@ -3306,6 +3548,7 @@ method_start:
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                 const uint8_t* field_addr = get_static_field_address<uint8_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldU1PreInit, field_addr);
                 uint8_t value = *field_addr;
                 set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
             }
@@ -3315,6 +3558,7 @@ method_start:
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                 const int16_t* field_addr = get_static_field_address<int16_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldI2PreInit, field_addr);
                 int16_t value = *field_addr;
                 set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
             }
@@ -3324,6 +3568,7 @@ method_start:
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                 const uint16_t* field_addr = get_static_field_address<uint16_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldU2PreInit, field_addr);
                 uint16_t value = *field_addr;
                 set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
             }
@@ -3333,6 +3578,7 @@ method_start:
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                 const int32_t* field_addr = get_static_field_address<int32_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldI4PreInit, field_addr);
                 int32_t value = *field_addr;
                 set_stack_value_at<int32_t>(eval_stack_base, ir->dst, value);
             }
@@ -3342,6 +3588,7 @@ method_start:
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                 const int64_t* field_addr = get_static_field_address<int64_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldI8PreInit, field_addr);
                 int64_t value = *field_addr;
                 set_stack_value_at<int64_t>(eval_stack_base, ir->dst, value);
             }
@@ -3351,6 +3598,7 @@ method_start:
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                 const uint8_t* field_addr = get_static_field_address<uint8_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldAnyPreInit, field_addr);
                 RtStackObject* dst = eval_stack_base + ir->dst;
                 std::memcpy(dst, field_addr, ir->size);
             }
@@ -3361,6 +3609,7 @@ method_start:
                 metadata::RtClass* klass = field->parent;
                 TRY_RUN_CLASS_STATIC_CCTOR(klass);
                 const void* field_addr = get_static_field_address<void>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldaPreInit, field_addr);
                 set_stack_value_at(eval_stack_base, ir->dst, field_addr);
             }
             LEANCLR_CASE_END0()
@@ -3377,6 +3626,7 @@ method_start:
                 metadata::RtClass* klass = field->parent;
                 TRY_RUN_CLASS_STATIC_CCTOR(klass);
                 int8_t* field_addr = get_static_field_address<int8_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::StsfldI1PreInit, field_addr);
                 *field_addr = static_cast<int8_t>(value);
             }
             LEANCLR_CASE_END0()
@@ -3384,7 +3634,10 @@ method_start:
             {
                 int32_t value = get_stack_value_at<int32_t>(eval_stack_base, ir->value);
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                metadata::RtClass* klass = field->parent;
+                TRY_RUN_CLASS_STATIC_CCTOR(klass);
                 int16_t* field_addr = get_static_field_address<int16_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::StsfldI2PreInit, field_addr);
                 *field_addr = static_cast<int16_t>(value);
             }
             LEANCLR_CASE_END0()
@@ -3395,6 +3648,7 @@ method_start:
                 metadata::RtClass* klass = field->parent;
                 TRY_RUN_CLASS_STATIC_CCTOR(klass);
                 int32_t* field_addr = get_static_field_address<int32_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::StsfldI4PreInit, field_addr);
                 *field_addr = value;
             }
             LEANCLR_CASE_END0()
@@ -3405,6 +3659,7 @@ method_start:
                 metadata::RtClass* klass = field->parent;
                 TRY_RUN_CLASS_STATIC_CCTOR(klass);
                 int64_t* field_addr = get_static_field_address<int64_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::StsfldI8PreInit, field_addr);
                 *field_addr = value;
             }
             LEANCLR_CASE_END0()
@@ -3415,6 +3670,7 @@ method_start:
                 metadata::RtClass* klass = field->parent;
                 TRY_RUN_CLASS_STATIC_CCTOR(klass);
                 uint8_t* field_addr = get_static_field_address<uint8_t>(field);
+                try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::StsfldAnyPreInit, field_addr);
                 std::memcpy(field_addr, src, ir->size);
             }
             LEANCLR_CASE_END0()
@@ -6112,6 +6368,7 @@ method_start:
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                         const int8_t* field_addr = get_static_field_address<int8_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldI1PreInit, field_addr);
                         int8_t value = *field_addr;
                         set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
                     }
@@ -6121,6 +6378,7 @@ method_start:
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                         const uint8_t* field_addr = get_static_field_address<uint8_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldU1PreInit, field_addr);
                         uint8_t value = *field_addr;
                         set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
                     }
@@ -6130,6 +6388,7 @@ method_start:
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                         const int16_t* field_addr = get_static_field_address<int16_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldI2PreInit, field_addr);
                         int16_t value = *field_addr;
                         set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
                     }
@@ -6139,6 +6398,7 @@ method_start:
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                         const uint16_t* field_addr = get_static_field_address<uint16_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldU2PreInit, field_addr);
                         uint16_t value = *field_addr;
                         set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
                     }
@@ -6148,6 +6408,7 @@ method_start:
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                         const int32_t* field_addr = get_static_field_address<int32_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldI4PreInit, field_addr);
                         int32_t value = *field_addr;
                         set_stack_value_at<int32_t>(eval_stack_base, ir->dst, value);
                     }
@@ -6157,6 +6418,7 @@ method_start:
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                         const int64_t* field_addr = get_static_field_address<int64_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldI8PreInit, field_addr);
                         int64_t value = *field_addr;
                         set_stack_value_at<int64_t>(eval_stack_base, ir->dst, value);
                     }
@@ -6166,6 +6428,7 @@ method_start:
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
                         const uint8_t* field_addr = get_static_field_address<uint8_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldAnyPreInit, field_addr);
                         RtStackObject* dst = eval_stack_base + ir->dst;
                         std::memcpy(dst, field_addr, ir->size);
                     }
@@ -6176,6 +6439,7 @@ method_start:
                         metadata::RtClass* klass = field->parent;
                         TRY_RUN_CLASS_STATIC_CCTOR(klass);
                         const void* field_addr = get_static_field_address<void>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::LdsfldaPreInit, field_addr);
                         set_stack_value_at(eval_stack_base, ir->dst, field_addr);
                     }
                     LEANCLR_CASE_END1()
@@ -6192,6 +6456,7 @@ method_start:
                         metadata::RtClass* klass = field->parent;
                         TRY_RUN_CLASS_STATIC_CCTOR(klass);
                         int8_t* field_addr = get_static_field_address<int8_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::StsfldI1PreInit, field_addr);
                         *field_addr = static_cast<int8_t>(value);
                     }
                     LEANCLR_CASE_END1()
@@ -6199,7 +6464,10 @@ method_start:
                     {
                         int32_t value = get_stack_value_at<int32_t>(eval_stack_base, ir->value);
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                        metadata::RtClass* klass = field->parent;
+                        TRY_RUN_CLASS_STATIC_CCTOR(klass);
                         int16_t* field_addr = get_static_field_address<int16_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::StsfldI2PreInit, field_addr);
                         *field_addr = static_cast<int16_t>(value);
                     }
                     LEANCLR_CASE_END1()
@@ -6210,6 +6478,7 @@ method_start:
                         metadata::RtClass* klass = field->parent;
                         TRY_RUN_CLASS_STATIC_CCTOR(klass);
                         int32_t* field_addr = get_static_field_address<int32_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::StsfldI4PreInit, field_addr);
                         *field_addr = value;
                     }
                     LEANCLR_CASE_END1()
@@ -6220,6 +6489,7 @@ method_start:
                         metadata::RtClass* klass = field->parent;
                         TRY_RUN_CLASS_STATIC_CCTOR(klass);
                         int64_t* field_addr = get_static_field_address<int64_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::StsfldI8PreInit, field_addr);
                         *field_addr = value;
                     }
                     LEANCLR_CASE_END1()
@@ -6230,6 +6500,7 @@ method_start:
                         metadata::RtClass* klass = field->parent;
                         TRY_RUN_CLASS_STATIC_CCTOR(klass);
                         uint8_t* field_addr = get_static_field_address<uint8_t>(field);
+                        try_quicken_static_field_access(imi, ir, field, ll::OpCodeValue2::StsfldAnyPreInit, field_addr);
                         std::memcpy(field_addr, src, ir->size);
                     }
                     LEANCLR_CASE_END1()
@@ -6870,216 +7141,1562 @@ method_start:
                         set_stack_value_at<int32_t>(eval_stack_base, ir->dst, hash);
                     }
                     LEANCLR_CASE_END2()
-#if !LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
-                default:
-                {
-                    assert(false && "Invalid opcode");
-                    RAISE_RUNTIME_ERROR(RtErr::ExecutionEngine);
-                }
-#endif
-                }
-            }
-            LEANCLR_CASE_END_LITE0()
-            LEANCLR_CASE_BEGIN_LITE0(Prefix3)
-            {
-                LEANCLR_SWITCH3()
-                {
-                    LEANCLR_CASE_BEGIN3(LdIndI2Unaligned)
+                    LEANCLR_CASE_BEGIN2(VecAddR4x2)
                     {
-                        const uint8_t* addr = get_stack_value_at<const uint8_t*>(eval_stack_base, ir->src);
-                        int16_t value = utils::MemOp::read_i16_may_unaligned(addr);
-                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                        vm::NumericsVector::add<2>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(LdIndU2Unaligned)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecAddR4x3)
                     {
-                        const uint8_t* addr = get_stack_value_at<const uint8_t*>(eval_stack_base, ir->src);
-                        uint16_t value = utils::MemOp::read_u16_may_unaligned(addr);
-                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                        vm::NumericsVector::add<3>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(LdIndI4Unaligned)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecAddR4x4)
                     {
-                        const uint8_t* addr = get_stack_value_at<const uint8_t*>(eval_stack_base, ir->src);
-                        int32_t value = utils::MemOp::read_i32_may_unaligned(addr);
-                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, value);
+                        vm::NumericsVector::add<4>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(LdIndI8Unaligned)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecSubR4x2)
                     {
-                        const uint8_t* addr = get_stack_value_at<const uint8_t*>(eval_stack_base, ir->src);
-                        int64_t value = utils::MemOp::read_i64_may_unaligned(addr);
-                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, value);
+                        vm::NumericsVector::sub<2>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(StIndI2Unaligned)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecSubR4x3)
                     {
-                        uint8_t* addr = get_stack_value_at<uint8_t*>(eval_stack_base, ir->dst);
-                        int16_t value = get_stack_value_at<int16_t>(eval_stack_base, ir->src);
-                        utils::MemOp::write_i16_may_unaligned(addr, value);
+                        vm::NumericsVector::sub<3>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(StIndI4Unaligned)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecSubR4x4)
                     {
-                        uint8_t* addr = get_stack_value_at<uint8_t*>(eval_stack_base, ir->dst);
-                        int32_t value = get_stack_value_at<int32_t>(eval_stack_base, ir->src);
-                        utils::MemOp::write_i32_may_unaligned(addr, value);
+                        vm::NumericsVector::sub<4>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(StIndI8Unaligned)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMulR4x2)
                     {
-                        uint8_t* addr = get_stack_value_at<uint8_t*>(eval_stack_base, ir->dst);
-                        int64_t value = get_stack_value_at<int64_t>(eval_stack_base, ir->src);
-                        utils::MemOp::write_i64_may_unaligned(addr, value);
+                        vm::NumericsVector::mul<2>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-
-                    LEANCLR_CASE_BEGIN3(StIndI8I4Unaligned)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMulR4x3)
                     {
-                        uint8_t* addr = get_stack_value_at<uint8_t*>(eval_stack_base, ir->dst);
-                        int32_t value = get_stack_value_at<int32_t>(eval_stack_base, ir->src);
-                        utils::MemOp::write_i64_may_unaligned(addr, static_cast<int64_t>(value));
+                        vm::NumericsVector::mul<3>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(StIndI8U4Unaligned)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMulR4x4)
                     {
-                        uint8_t* addr = get_stack_value_at<uint8_t*>(eval_stack_base, ir->dst);
-                        uint32_t value = get_stack_value_at<uint32_t>(eval_stack_base, ir->src);
-                        utils::MemOp::write_i64_may_unaligned(addr, static_cast<int64_t>(value));
+                        vm::NumericsVector::mul<4>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(AddOvfI4)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDivR4x2)
                     {
-                        int32_t left = get_stack_value_at<int32_t>(eval_stack_base, ir->arg1);
-                        int32_t right = get_stack_value_at<int32_t>(eval_stack_base, ir->arg2);
-                        int32_t result;
-                        if (CHECK_ADD_OVERFLOW_I32(left, right, &result))
-                        {
-                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
-                        }
-                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, result);
+                        vm::NumericsVector::div<2>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(AddOvfI8)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDivR4x3)
                     {
-                        int64_t left = get_stack_value_at<int64_t>(eval_stack_base, ir->arg1);
-                        int64_t right = get_stack_value_at<int64_t>(eval_stack_base, ir->arg2);
-                        int64_t result;
-                        if (CHECK_ADD_OVERFLOW_I64(left, right, &result))
-                        {
-                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
-                        }
-                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, result);
+                        vm::NumericsVector::div<3>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(AddOvfUnI4)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDivR4x4)
                     {
-                        uint32_t left = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg1);
-                        uint32_t right = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg2);
-                        uint32_t result;
-                        if (CHECK_ADD_OVERFLOW_U32(left, right, &result))
-                        {
-                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
-                        }
-                        set_stack_value_at<uint32_t>(eval_stack_base, ir->dst, result);
+                        vm::NumericsVector::div<4>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(AddOvfUnI8)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMinR4x2)
                     {
-                        uint64_t left = get_stack_value_at<uint64_t>(eval_stack_base, ir->arg1);
-                        uint64_t right = get_stack_value_at<uint64_t>(eval_stack_base, ir->arg2);
-                        uint64_t result;
-                        if (CHECK_ADD_OVERFLOW_U64(left, right, &result))
-                        {
-                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
-                        }
-                        set_stack_value_at<uint64_t>(eval_stack_base, ir->dst, result);
+                        vm::NumericsVector::min<2>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(MulOvfI4)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMinR4x3)
                     {
-                        int32_t left = get_stack_value_at<int32_t>(eval_stack_base, ir->arg1);
-                        int32_t right = get_stack_value_at<int32_t>(eval_stack_base, ir->arg2);
-                        int32_t result;
-                        if (CHECK_MUL_OVERFLOW_I32(left, right, &result))
-                        {
-                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
-                        }
-                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, result);
+                        vm::NumericsVector::min<3>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(MulOvfI8)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMinR4x4)
                     {
-                        int64_t left = get_stack_value_at<int64_t>(eval_stack_base, ir->arg1);
-                        int64_t right = get_stack_value_at<int64_t>(eval_stack_base, ir->arg2);
-                        int64_t result;
-                        if (CHECK_MUL_OVERFLOW_I64(left, right, &result))
-                        {
-                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
-                        }
-                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, result);
+                        vm::NumericsVector::min<4>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(MulOvfUnI4)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMaxR4x2)
                     {
-                        uint32_t left = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg1);
-                        uint32_t right = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg2);
-                        uint32_t result;
-                        if (CHECK_MUL_OVERFLOW_U32(left, right, &result))
-                        {
-                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
-                        }
-                        set_stack_value_at<uint32_t>(eval_stack_base, ir->dst, result);
+                        vm::NumericsVector::max<2>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(MulOvfUnI8)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMaxR4x3)
                     {
-                        uint64_t left = get_stack_value_at<uint64_t>(eval_stack_base, ir->arg1);
-                        uint64_t right = get_stack_value_at<uint64_t>(eval_stack_base, ir->arg2);
-                        uint64_t result;
-                        if (CHECK_MUL_OVERFLOW_U64(left, right, &result))
-                        {
-                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
-                        }
-                        set_stack_value_at<uint64_t>(eval_stack_base, ir->dst, result);
+                        vm::NumericsVector::max<3>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(SubOvfI4)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMaxR4x4)
                     {
-                        int32_t left = get_stack_value_at<int32_t>(eval_stack_base, ir->arg1);
-                        int32_t right = get_stack_value_at<int32_t>(eval_stack_base, ir->arg2);
-                        int32_t result;
-                        if (CHECK_SUB_OVERFLOW_I32(left, right, &result))
-                        {
-                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
-                        }
-                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, result);
+                        vm::NumericsVector::max<4>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(SubOvfI8)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMulScalarR4x2)
                     {
-                        int64_t left = get_stack_value_at<int64_t>(eval_stack_base, ir->arg1);
-                        int64_t right = get_stack_value_at<int64_t>(eval_stack_base, ir->arg2);
-                        int64_t result;
-                        if (CHECK_SUB_OVERFLOW_I64(left, right, &result))
-                        {
-                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
-                        }
-                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, result);
+                        float scalar = get_stack_value_at<float>(eval_stack_base, ir->arg2);
+                        vm::NumericsVector::mul_scalar<2>(eval_stack_base + ir->arg1, scalar, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
-                    LEANCLR_CASE_BEGIN3(SubOvfUnI4)
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMulScalarR4x3)
                     {
-                        uint32_t left = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg1);
-                        uint32_t right = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg2);
-                        uint32_t result;
-                        if (CHECK_SUB_OVERFLOW_U32(left, right, &result))
-                        {
-                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
-                        }
-                        set_stack_value_at<uint32_t>(eval_stack_base, ir->dst, result);
+                        float scalar = get_stack_value_at<float>(eval_stack_base, ir->arg2);
+                        vm::NumericsVector::mul_scalar<3>(eval_stack_base + ir->arg1, scalar, eval_stack_base + ir->dst);
                     }
-                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMulScalarR4x4)
+                    {
+                        float scalar = get_stack_value_at<float>(eval_stack_base, ir->arg2);
+                        vm::NumericsVector::mul_scalar<4>(eval_stack_base + ir->arg1, scalar, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDivScalarR4x2)
+                    {
+                        float scalar = get_stack_value_at<float>(eval_stack_base, ir->arg2);
+                        vm::NumericsVector::div_scalar<2>(eval_stack_base + ir->arg1, scalar, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDivScalarR4x3)
+                    {
+                        float scalar = get_stack_value_at<float>(eval_stack_base, ir->arg2);
+                        vm::NumericsVector::div_scalar<3>(eval_stack_base + ir->arg1, scalar, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDivScalarR4x4)
+                    {
+                        float scalar = get_stack_value_at<float>(eval_stack_base, ir->arg2);
+                        vm::NumericsVector::div_scalar<4>(eval_stack_base + ir->arg1, scalar, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDotR4x2)
+                    {
+                        float result = vm::NumericsVector::dot<2>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDotR4x3)
+                    {
+                        float result = vm::NumericsVector::dot<3>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDotR4x4)
+                    {
+                        float result = vm::NumericsVector::dot<4>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDistanceR4x2)
+                    {
+                        float result = vm::NumericsVector::distance<2>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDistanceR4x3)
+                    {
+                        float result = vm::NumericsVector::distance<3>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDistanceR4x4)
+                    {
+                        float result = vm::NumericsVector::distance<4>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDistanceSquaredR4x2)
+                    {
+                        float result = vm::NumericsVector::distance_squared<2>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDistanceSquaredR4x3)
+                    {
+                        float result = vm::NumericsVector::distance_squared<3>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDistanceSquaredR4x4)
+                    {
+                        float result = vm::NumericsVector::distance_squared<4>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecCrossR4x3)
+                    {
+                        vm::NumericsVector::cross(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecNegR4x2)
+                    {
+                        vm::NumericsVector::negate<2>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecNegR4x3)
+                    {
+                        vm::NumericsVector::negate<3>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecNegR4x4)
+                    {
+                        vm::NumericsVector::negate<4>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecAbsR4x2)
+                    {
+                        vm::NumericsVector::abs<2>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecAbsR4x3)
+                    {
+                        vm::NumericsVector::abs<3>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecAbsR4x4)
+                    {
+                        vm::NumericsVector::abs<4>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecSqrtR4x2)
+                    {
+                        vm::NumericsVector::square_root<2>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecSqrtR4x3)
+                    {
+                        vm::NumericsVector::square_root<3>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecSqrtR4x4)
+                    {
+                        vm::NumericsVector::square_root<4>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecNormalizeR4x2)
+                    {
+                        vm::NumericsVector::normalize<2>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecNormalizeR4x3)
+                    {
+                        vm::NumericsVector::normalize<3>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecNormalizeR4x4)
+                    {
+                        vm::NumericsVector::normalize<4>(eval_stack_base + ir->src, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecLengthR4x2)
+                    {
+                        const void* self = get_stack_value_at<const void*>(eval_stack_base, ir->src);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, vm::NumericsVector::length<2>(self));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecLengthR4x3)
+                    {
+                        const void* self = get_stack_value_at<const void*>(eval_stack_base, ir->src);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, vm::NumericsVector::length<3>(self));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecLengthR4x4)
+                    {
+                        const void* self = get_stack_value_at<const void*>(eval_stack_base, ir->src);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, vm::NumericsVector::length<4>(self));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecLengthSquaredR4x2)
+                    {
+                        const void* self = get_stack_value_at<const void*>(eval_stack_base, ir->src);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, vm::NumericsVector::length_squared<2>(self));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecLengthSquaredR4x3)
+                    {
+                        const void* self = get_stack_value_at<const void*>(eval_stack_base, ir->src);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, vm::NumericsVector::length_squared<3>(self));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecLengthSquaredR4x4)
+                    {
+                        const void* self = get_stack_value_at<const void*>(eval_stack_base, ir->src);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, vm::NumericsVector::length_squared<4>(self));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecLerpR4x2)
+                    {
+                        float amount = get_stack_value_at<float>(eval_stack_base, ir->arg3);
+                        vm::NumericsVector::lerp<2>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, amount, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecLerpR4x3)
+                    {
+                        float amount = get_stack_value_at<float>(eval_stack_base, ir->arg3);
+                        vm::NumericsVector::lerp<3>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, amount, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecLerpR4x4)
+                    {
+                        float amount = get_stack_value_at<float>(eval_stack_base, ir->arg3);
+                        vm::NumericsVector::lerp<4>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, amount, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecClampR4x2)
+                    {
+                        vm::NumericsVector::clamp<2>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->arg3,
+                                                      eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecClampR4x3)
+                    {
+                        vm::NumericsVector::clamp<3>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->arg3,
+                                                      eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecClampR4x4)
+                    {
+                        vm::NumericsVector::clamp<4>(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->arg3,
+                                                      eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecAddI4x4)
+                    {
+                        vm::NumericsVector::add_i32x4(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecSubI4x4)
+                    {
+                        vm::NumericsVector::sub_i32x4(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMulI4x4)
+                    {
+                        vm::NumericsVector::mul_i32x4(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecAddI8x2)
+                    {
+                        vm::NumericsVector::add_i64x2(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecSubI8x2)
+                    {
+                        vm::NumericsVector::sub_i64x2(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecAddR8x2)
+                    {
+                        vm::NumericsVector::add_r8x2(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecSubR8x2)
+                    {
+                        vm::NumericsVector::sub_r8x2(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecMulR8x2)
+                    {
+                        vm::NumericsVector::mul_r8x2(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecDivR8x2)
+                    {
+                        vm::NumericsVector::div_r8x2(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecAndX128)
+                    {
+                        vm::NumericsVector::and_x128(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecOrX128)
+                    {
+                        vm::NumericsVector::or_x128(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(VecXorX128)
+                    {
+                        vm::NumericsVector::xor_x128(eval_stack_base + ir->arg1, eval_stack_base + ir->arg2, eval_stack_base + ir->dst);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(AbsI4)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        int32_t value = (eval_stack_base + ir->src)->i32;
+                        if (value == INT32_MIN)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        dst->i32 = value < 0 ? -value : value;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(AbsI8)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        int64_t value = (eval_stack_base + ir->src)->i64;
+                        if (value == INT64_MIN)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        dst->i64 = value < 0 ? -value : value;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(AbsR4)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f32 = std::fabs((eval_stack_base + ir->src)->f32);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(AbsR8)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f64 = std::fabs((eval_stack_base + ir->src)->f64);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(SqrtR4)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f32 = std::sqrt((eval_stack_base + ir->src)->f32);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(SqrtR8)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f64 = std::sqrt((eval_stack_base + ir->src)->f64);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(FloorR4)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f32 = std::floor((eval_stack_base + ir->src)->f32);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(FloorR8)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f64 = std::floor((eval_stack_base + ir->src)->f64);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CeilR4)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f32 = std::ceil((eval_stack_base + ir->src)->f32);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CeilR8)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f64 = std::ceil((eval_stack_base + ir->src)->f64);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(RoundR4)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f32 = std::nearbyint((eval_stack_base + ir->src)->f32);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(RoundR8)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f64 = std::nearbyint((eval_stack_base + ir->src)->f64);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MinI4)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->i32 = src1->i32 < src2->i32 ? src1->i32 : src2->i32;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MinU4)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->u32 = src1->u32 < src2->u32 ? src1->u32 : src2->u32;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MinI8)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->i64 = src1->i64 < src2->i64 ? src1->i64 : src2->i64;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MinU8)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->u64 = src1->u64 < src2->u64 ? src1->u64 : src2->u64;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MinR4)
+                    {
+                        // Same as the managed implementation: NaN in either operand wins, ties return the second operand.
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->f32 = (src1->f32 < src2->f32 || std::isnan(src1->f32)) ? src1->f32 : src2->f32;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MinR8)
+                    {
+                        // Same as the managed implementation: NaN in either operand wins, ties return the second operand.
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->f64 = (src1->f64 < src2->f64 || std::isnan(src1->f64)) ? src1->f64 : src2->f64;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MaxI4)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->i32 = src1->i32 > src2->i32 ? src1->i32 : src2->i32;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MaxU4)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->u32 = src1->u32 > src2->u32 ? src1->u32 : src2->u32;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MaxI8)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->i64 = src1->i64 > src2->i64 ? src1->i64 : src2->i64;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MaxU8)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->u64 = src1->u64 > src2->u64 ? src1->u64 : src2->u64;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MaxR4)
+                    {
+                        // Same as the managed implementation: NaN in either operand wins, ties return the second operand.
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->f32 = (src1->f32 > src2->f32 || std::isnan(src1->f32)) ? src1->f32 : src2->f32;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(MaxR8)
+                    {
+                        // Same as the managed implementation: NaN in either operand wins, ties return the second operand.
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        RtStackObject* src1 = eval_stack_base + ir->arg1;
+                        RtStackObject* src2 = eval_stack_base + ir->arg2;
+                        dst->f64 = (src1->f64 > src2->f64 || std::isnan(src1->f64)) ? src1->f64 : src2->f64;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(FmaR4)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f32 = std::fma((eval_stack_base + ir->arg1)->f32, (eval_stack_base + ir->arg2)->f32, (eval_stack_base + ir->arg3)->f32);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(FmaR8)
+                    {
+                        RtStackObject* dst = eval_stack_base + ir->dst;
+                        dst->f64 = std::fma((eval_stack_base + ir->arg1)->f64, (eval_stack_base + ir->arg2)->f64, (eval_stack_base + ir->arg3)->f64);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldI1PreInit)
+                    {
+                        const int8_t* field_addr = get_resolved_data<const int8_t>(imi, ir->field_idx);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(*field_addr));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldU1PreInit)
+                    {
+                        const uint8_t* field_addr = get_resolved_data<const uint8_t>(imi, ir->field_idx);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(*field_addr));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldI2PreInit)
+                    {
+                        const int16_t* field_addr = get_resolved_data<const int16_t>(imi, ir->field_idx);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(*field_addr));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldU2PreInit)
+                    {
+                        const uint16_t* field_addr = get_resolved_data<const uint16_t>(imi, ir->field_idx);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(*field_addr));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldI4PreInit)
+                    {
+                        const int32_t* field_addr = get_resolved_data<const int32_t>(imi, ir->field_idx);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, *field_addr);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldI8PreInit)
+                    {
+                        const int64_t* field_addr = get_resolved_data<const int64_t>(imi, ir->field_idx);
+                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, *field_addr);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldAnyPreInit)
+                    {
+                        const uint8_t* field_addr = get_resolved_data<const uint8_t>(imi, ir->field_idx);
+                        std::memcpy(eval_stack_base + ir->dst, field_addr, ir->size);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldaPreInit)
+                    {
+                        const void* field_addr = get_resolved_data<const void>(imi, ir->field_idx);
+                        set_stack_value_at(eval_stack_base, ir->dst, field_addr);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StsfldI1PreInit)
+                    {
+                        int8_t* field_addr = get_resolved_data<int8_t>(imi, ir->field_idx);
+                        *field_addr = static_cast<int8_t>(get_stack_value_at<int32_t>(eval_stack_base, ir->value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StsfldI2PreInit)
+                    {
+                        int16_t* field_addr = get_resolved_data<int16_t>(imi, ir->field_idx);
+                        *field_addr = static_cast<int16_t>(get_stack_value_at<int32_t>(eval_stack_base, ir->value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StsfldI4PreInit)
+                    {
+                        int32_t* field_addr = get_resolved_data<int32_t>(imi, ir->field_idx);
+                        *field_addr = get_stack_value_at<int32_t>(eval_stack_base, ir->value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StsfldI8PreInit)
+                    {
+                        int64_t* field_addr = get_resolved_data<int64_t>(imi, ir->field_idx);
+                        *field_addr = get_stack_value_at<int64_t>(eval_stack_base, ir->value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StsfldAnyPreInit)
+                    {
+                        uint8_t* field_addr = get_resolved_data<uint8_t>(imi, ir->field_idx);
+                        std::memcpy(field_addr, eval_stack_base + ir->value, ir->size);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemI1Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        int8_t value = vm::Array::get_array_data_at<int8_t>(array, index);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemU1Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        uint8_t value = vm::Array::get_array_data_at<uint8_t>(array, index);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemI2Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        int16_t value = vm::Array::get_array_data_at<int16_t>(array, index);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemU2Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        uint16_t value = vm::Array::get_array_data_at<uint16_t>(array, index);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemI4Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        int32_t value = vm::Array::get_array_data_at<int32_t>(array, index);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemI8Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        int64_t value = vm::Array::get_array_data_at<int64_t>(array, index);
+                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemIUnchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        intptr_t value = vm::Array::get_array_data_at<intptr_t>(array, index);
+                        set_stack_value_at<intptr_t>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemI1Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        int8_t value = get_stack_value_at<int8_t>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<int8_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemI2Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        int16_t value = get_stack_value_at<int16_t>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<int16_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemI4Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        int32_t value = get_stack_value_at<int32_t>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<int32_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemI8Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        int64_t value = get_stack_value_at<int64_t>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<int64_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemIUnchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        assert(array && !vm::Array::is_out_of_range(array, index));
+                        intptr_t value = get_stack_value_at<intptr_t>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<intptr_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableV0)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        auto fn = reinterpret_cast<void (*)()>(target_method->method_ptr);
+                        fn();
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableV1)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<void (*)(intptr_t)>(target_method->method_ptr);
+                        fn(get_stack_value_at<intptr_t>(frame_base, 0));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableV2)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<void (*)(intptr_t, intptr_t)>(target_method->method_ptr);
+                        fn(get_stack_value_at<intptr_t>(frame_base, 0), get_stack_value_at<intptr_t>(frame_base, 1));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableV3)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<void (*)(intptr_t, intptr_t, intptr_t)>(target_method->method_ptr);
+                        fn(get_stack_value_at<intptr_t>(frame_base, 0),
+                           get_stack_value_at<intptr_t>(frame_base, 1),
+                           get_stack_value_at<intptr_t>(frame_base, 2));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableV4)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<void (*)(intptr_t, intptr_t, intptr_t, intptr_t)>(target_method->method_ptr);
+                        fn(get_stack_value_at<intptr_t>(frame_base, 0),
+                           get_stack_value_at<intptr_t>(frame_base, 1),
+                           get_stack_value_at<intptr_t>(frame_base, 2),
+                           get_stack_value_at<intptr_t>(frame_base, 3));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableW0)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<intptr_t (*)()>(target_method->method_ptr);
+                        intptr_t result = fn();
+                        set_stack_value_at<intptr_t>(frame_base, 0, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableW1)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<intptr_t (*)(intptr_t)>(target_method->method_ptr);
+                        intptr_t result = fn(get_stack_value_at<intptr_t>(frame_base, 0));
+                        set_stack_value_at<intptr_t>(frame_base, 0, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableW2)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<intptr_t (*)(intptr_t, intptr_t)>(target_method->method_ptr);
+                        intptr_t result = fn(get_stack_value_at<intptr_t>(frame_base, 0), get_stack_value_at<intptr_t>(frame_base, 1));
+                        set_stack_value_at<intptr_t>(frame_base, 0, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableW3)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<intptr_t (*)(intptr_t, intptr_t, intptr_t)>(target_method->method_ptr);
+                        intptr_t result = fn(get_stack_value_at<intptr_t>(frame_base, 0),
+                                             get_stack_value_at<intptr_t>(frame_base, 1),
+                                             get_stack_value_at<intptr_t>(frame_base, 2));
+                        set_stack_value_at<intptr_t>(frame_base, 0, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableW4)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<intptr_t (*)(intptr_t, intptr_t, intptr_t, intptr_t)>(target_method->method_ptr);
+                        intptr_t result = fn(get_stack_value_at<intptr_t>(frame_base, 0),
+                                             get_stack_value_at<intptr_t>(frame_base, 1),
+                                             get_stack_value_at<intptr_t>(frame_base, 2),
+                                             get_stack_value_at<intptr_t>(frame_base, 3));
+                        set_stack_value_at<intptr_t>(frame_base, 0, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableR4R4)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<float (*)(float)>(target_method->method_ptr);
+                        float result = fn(get_stack_value_at<float>(frame_base, 0));
+                        set_stack_value_at<float>(frame_base, 0, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableR4R4R4)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<float (*)(float, float)>(target_method->method_ptr);
+                        float result = fn(get_stack_value_at<float>(frame_base, 0), get_stack_value_at<float>(frame_base, 1));
+                        set_stack_value_at<float>(frame_base, 0, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableR8R8)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<double (*)(double)>(target_method->method_ptr);
+                        double result = fn(get_stack_value_at<double>(frame_base, 0));
+                        set_stack_value_at<double>(frame_base, 0, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CallPInvokeBlittableR8R8R8)
+                    {
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        PREPARE_BLITTABLE_PINVOKE(target_method);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        auto fn = reinterpret_cast<double (*)(double, double)>(target_method->method_ptr);
+                        double result = fn(get_stack_value_at<double>(frame_base, 0), get_stack_value_at<double>(frame_base, 1));
+                        set_stack_value_at<double>(frame_base, 0, result);
+                    }
+                    LEANCLR_CASE_END2()
+                    ///{{MDARRAY_ELEMENT_CASES
+                    LEANCLR_CASE_BEGIN2(LdelemMD2I1)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int8_t value = vm::Array::get_array_data_at<int8_t>(array, index);
+                        set_stack_value_at<int32_t>(frame_base, 0, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD2U1)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        uint8_t value = vm::Array::get_array_data_at<uint8_t>(array, index);
+                        set_stack_value_at<int32_t>(frame_base, 0, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD2I2)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int16_t value = vm::Array::get_array_data_at<int16_t>(array, index);
+                        set_stack_value_at<int32_t>(frame_base, 0, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD2U2)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        uint16_t value = vm::Array::get_array_data_at<uint16_t>(array, index);
+                        set_stack_value_at<int32_t>(frame_base, 0, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD2I4)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int32_t value = vm::Array::get_array_data_at<int32_t>(array, index);
+                        set_stack_value_at<int32_t>(frame_base, 0, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD2I8)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int64_t value = vm::Array::get_array_data_at<int64_t>(array, index);
+                        set_stack_value_at<int64_t>(frame_base, 0, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD2I)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        intptr_t value = vm::Array::get_array_data_at<intptr_t>(array, index);
+                        set_stack_value_at<intptr_t>(frame_base, 0, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemMD2I1)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int8_t value = get_stack_value_at<int8_t>(frame_base, 3);
+                        vm::Array::set_array_data_at<int8_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemMD2I2)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int16_t value = get_stack_value_at<int16_t>(frame_base, 3);
+                        vm::Array::set_array_data_at<int16_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemMD2I4)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int32_t value = get_stack_value_at<int32_t>(frame_base, 3);
+                        vm::Array::set_array_data_at<int32_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemMD2I8)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int64_t value = get_stack_value_at<int64_t>(frame_base, 3);
+                        vm::Array::set_array_data_at<int64_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemMD2I)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        intptr_t value = get_stack_value_at<intptr_t>(frame_base, 3);
+                        vm::Array::set_array_data_at<intptr_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemaMD2)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<2>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        const void* element_addr = vm::Array::get_array_element_address_as_ptr_void(array, index);
+                        set_stack_value_at(frame_base, 0, element_addr);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD3I1)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int8_t value = vm::Array::get_array_data_at<int8_t>(array, index);
+                        set_stack_value_at<int32_t>(frame_base, 0, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD3U1)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        uint8_t value = vm::Array::get_array_data_at<uint8_t>(array, index);
+                        set_stack_value_at<int32_t>(frame_base, 0, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD3I2)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int16_t value = vm::Array::get_array_data_at<int16_t>(array, index);
+                        set_stack_value_at<int32_t>(frame_base, 0, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD3U2)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        uint16_t value = vm::Array::get_array_data_at<uint16_t>(array, index);
+                        set_stack_value_at<int32_t>(frame_base, 0, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD3I4)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int32_t value = vm::Array::get_array_data_at<int32_t>(array, index);
+                        set_stack_value_at<int32_t>(frame_base, 0, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD3I8)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int64_t value = vm::Array::get_array_data_at<int64_t>(array, index);
+                        set_stack_value_at<int64_t>(frame_base, 0, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemMD3I)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        intptr_t value = vm::Array::get_array_data_at<intptr_t>(array, index);
+                        set_stack_value_at<intptr_t>(frame_base, 0, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemMD3I1)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int8_t value = get_stack_value_at<int8_t>(frame_base, 4);
+                        vm::Array::set_array_data_at<int8_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemMD3I2)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int16_t value = get_stack_value_at<int16_t>(frame_base, 4);
+                        vm::Array::set_array_data_at<int16_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemMD3I4)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int32_t value = get_stack_value_at<int32_t>(frame_base, 4);
+                        vm::Array::set_array_data_at<int32_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemMD3I8)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        int64_t value = get_stack_value_at<int64_t>(frame_base, 4);
+                        vm::Array::set_array_data_at<int64_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemMD3I)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        intptr_t value = get_stack_value_at<intptr_t>(frame_base, 4);
+                        vm::Array::set_array_data_at<intptr_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemaMD3)
+                    {
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(frame_base, 0);
+                        if (!array)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        int32_t index = vm::Array::get_mdarray_global_index<3>(array, frame_base + 1);
+                        if (index < 0)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
+                        }
+                        const void* element_addr = vm::Array::get_array_element_address_as_ptr_void(array, index);
+                        set_stack_value_at(frame_base, 0, element_addr);
+                    }
+                    LEANCLR_CASE_END2()
+
+                    ///}}MDARRAY_ELEMENT_CASES
+#if !LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
+                default:
+                {
+                    assert(false && "Invalid opcode");
+                    RAISE_RUNTIME_ERROR(RtErr::ExecutionEngine);
+                }
+#endif
+                }
+            }
+            LEANCLR_CASE_END_LITE0()
+            LEANCLR_CASE_BEGIN_LITE0(Prefix3)
+            {
+                LEANCLR_SWITCH3()
+                {
+                    LEANCLR_CASE_BEGIN3(LdIndI2Unaligned)
+                    {
+                        const uint8_t* addr = get_stack_value_at<const uint8_t*>(eval_stack_base, ir->src);
+                        int16_t value = utils::MemOp::read_i16_may_unaligned(addr);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(LdIndU2Unaligned)
+                    {
+                        const uint8_t* addr = get_stack_value_at<const uint8_t*>(eval_stack_base, ir->src);
+                        uint16_t value = utils::MemOp::read_u16_may_unaligned(addr);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(LdIndI4Unaligned)
+                    {
+                        const uint8_t* addr = get_stack_value_at<const uint8_t*>(eval_stack_base, ir->src);
+                        int32_t value = utils::MemOp::read_i32_may_unaligned(addr);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(LdIndI8Unaligned)
+                    {
+                        const uint8_t* addr = get_stack_value_at<const uint8_t*>(eval_stack_base, ir->src);
+                        int64_t value = utils::MemOp::read_i64_may_unaligned(addr);
+                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(StIndI2Unaligned)
+                    {
+                        uint8_t* addr = get_stack_value_at<uint8_t*>(eval_stack_base, ir->dst);
+                        int16_t value = get_stack_value_at<int16_t>(eval_stack_base, ir->src);
+                        utils::MemOp::write_i16_may_unaligned(addr, value);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(StIndI4Unaligned)
+                    {
+                        uint8_t* addr = get_stack_value_at<uint8_t*>(eval_stack_base, ir->dst);
+                        int32_t value = get_stack_value_at<int32_t>(eval_stack_base, ir->src);
+                        utils::MemOp::write_i32_may_unaligned(addr, value);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(StIndI8Unaligned)
+                    {
+                        uint8_t* addr = get_stack_value_at<uint8_t*>(eval_stack_base, ir->dst);
+                        int64_t value = get_stack_value_at<int64_t>(eval_stack_base, ir->src);
+                        utils::MemOp::write_i64_may_unaligned(addr, value);
+                    }
+                    LEANCLR_CASE_END3()
+
+                    LEANCLR_CASE_BEGIN3(StIndI8I4Unaligned)
+                    {
+                        uint8_t* addr = get_stack_value_at<uint8_t*>(eval_stack_base, ir->dst);
+                        int32_t value = get_stack_value_at<int32_t>(eval_stack_base, ir->src);
+                        utils::MemOp::write_i64_may_unaligned(addr, static_cast<int64_t>(value));
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(StIndI8U4Unaligned)
+                    {
+                        uint8_t* addr = get_stack_value_at<uint8_t*>(eval_stack_base, ir->dst);
+                        uint32_t value = get_stack_value_at<uint32_t>(eval_stack_base, ir->src);
+                        utils::MemOp::write_i64_may_unaligned(addr, static_cast<int64_t>(value));
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(AddOvfI4)
+                    {
+                        int32_t left = get_stack_value_at<int32_t>(eval_stack_base, ir->arg1);
+                        int32_t right = get_stack_value_at<int32_t>(eval_stack_base, ir->arg2);
+                        int32_t result;
+                        if (CHECK_ADD_OVERFLOW_I32(left, right, &result))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(AddOvfI8)
+                    {
+                        int64_t left = get_stack_value_at<int64_t>(eval_stack_base, ir->arg1);
+                        int64_t right = get_stack_value_at<int64_t>(eval_stack_base, ir->arg2);
+                        int64_t result;
+                        if (CHECK_ADD_OVERFLOW_I64(left, right, &result))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(AddOvfUnI4)
+                    {
+                        uint32_t left = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg1);
+                        uint32_t right = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg2);
+                        uint32_t result;
+                        if (CHECK_ADD_OVERFLOW_U32(left, right, &result))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        set_stack_value_at<uint32_t>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(AddOvfUnI8)
+                    {
+                        uint64_t left = get_stack_value_at<uint64_t>(eval_stack_base, ir->arg1);
+                        uint64_t right = get_stack_value_at<uint64_t>(eval_stack_base, ir->arg2);
+                        uint64_t result;
+                        if (CHECK_ADD_OVERFLOW_U64(left, right, &result))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        set_stack_value_at<uint64_t>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(MulOvfI4)
+                    {
+                        int32_t left = get_stack_value_at<int32_t>(eval_stack_base, ir->arg1);
+                        int32_t right = get_stack_value_at<int32_t>(eval_stack_base, ir->arg2);
+                        int32_t result;
+                        if (CHECK_MUL_OVERFLOW_I32(left, right, &result))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(MulOvfI8)
+                    {
+                        int64_t left = get_stack_value_at<int64_t>(eval_stack_base, ir->arg1);
+                        int64_t right = get_stack_value_at<int64_t>(eval_stack_base, ir->arg2);
+                        int64_t result;
+                        if (CHECK_MUL_OVERFLOW_I64(left, right, &result))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(MulOvfUnI4)
+                    {
+                        uint32_t left = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg1);
+                        uint32_t right = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg2);
+                        uint32_t result;
+                        if (CHECK_MUL_OVERFLOW_U32(left, right, &result))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        set_stack_value_at<uint32_t>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(MulOvfUnI8)
+                    {
+                        uint64_t left = get_stack_value_at<uint64_t>(eval_stack_base, ir->arg1);
+                        uint64_t right = get_stack_value_at<uint64_t>(eval_stack_base, ir->arg2);
+                        uint64_t result;
+                        if (CHECK_MUL_OVERFLOW_U64(left, right, &result))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        set_stack_value_at<uint64_t>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(SubOvfI4)
+                    {
+                        int32_t left = get_stack_value_at<int32_t>(eval_stack_base, ir->arg1);
+                        int32_t right = get_stack_value_at<int32_t>(eval_stack_base, ir->arg2);
+                        int32_t result;
+                        if (CHECK_SUB_OVERFLOW_I32(left, right, &result))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(SubOvfI8)
+                    {
+                        int64_t left = get_stack_value_at<int64_t>(eval_stack_base, ir->arg1);
+                        int64_t right = get_stack_value_at<int64_t>(eval_stack_base, ir->arg2);
+                        int64_t result;
+                        if (CHECK_SUB_OVERFLOW_I64(left, right, &result))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(SubOvfUnI4)
+                    {
+                        uint32_t left = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg1);
+                        uint32_t right = get_stack_value_at<uint32_t>(eval_stack_base, ir->arg2);
+                        uint32_t result;
+                        if (CHECK_SUB_OVERFLOW_U32(left, right, &result))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::Overflow);
+                        }
+                        set_stack_value_at<uint32_t>(eval_stack_base, ir->dst, result);
+                    }
+                    LEANCLR_CASE_END3()
                     LEANCLR_CASE_BEGIN3(SubOvfUnI8)
                     {
                         uint64_t left = get_stack_value_at<uint64_t>(eval_stack_base, ir->arg1);
@@ -8108,50 +9725,27 @@ unwind_exception_handler:
             vm::RtException* ex = data.ex;
             uint32_t throw_ip_offset = static_cast<uint32_t>(reinterpret_cast<const uint8_t*>(data.ip) - imi->codes);
             bool handled = false;
-            for (size_t i = data.next_search_clause_idx; i < clause_count; ++i)
+            size_t clause_idx = find_handler_clause(imi, ex->klass, throw_ip_offset, data.next_search_clause_idx);
+            if (clause_idx < clause_count)
             {
-                data.next_search_clause_idx = static_cast<size_t>(i + 1);
-                const RtInterpExceptionClause* clause = &clauses[i];
-                if (!clause->is_in_try_block(throw_ip_offset))
-                {
-                    continue;
-                }
-
+                data.next_search_clause_idx = clause_idx + 1;
+                const RtInterpExceptionClause* clause = &clauses[clause_idx];
+                ip = imi->codes + clause->handler_begin_offset;
                 switch (clause->flags)
                 {
                 case metadata::RtILExceptionClauseType::Exception:
-                {
-                    if (!clause->ex_klass || vm::Class::is_assignable_from(ex->klass, clause->ex_klass))
-                    {
-                        ip = imi->codes + clause->handler_begin_offset;
-                        setup_catch_handler(imi, frame, clause, ip);
-                        set_stack_value_at<vm::RtObject*>(eval_stack_base, imi->total_arg_and_local_stack_object_size, ex);
-                        handled = true;
-                    }
+                    setup_catch_handler(imi, frame, clause, ip);
                     break;
-                }
                 case metadata::RtILExceptionClauseType::Filter:
-                {
-                    ip = imi->codes + clause->handler_begin_offset;
                     setup_filter_checker(clause);
-                    set_stack_value_at<vm::RtObject*>(eval_stack_base, imi->total_arg_and_local_stack_object_size, ex);
-                    handled = true;
                     break;
-                }
                 case metadata::RtILExceptionClauseType::Finally:
                 case metadata::RtILExceptionClauseType::Fault:
-                {
-                    ip = imi->codes + clause->handler_begin_offset;
                     setup_finally_or_fault_handler(imi, clause, ip);
-                    set_stack_value_at<vm::RtObject*>(eval_stack_base, imi->total_arg_and_local_stack_object_size, ex);
-                    handled = true;
-                    break;
-                }
-                }
-                if (handled)
-                {
                     break;
                 }
+                set_stack_value_at<vm::RtObject*>(eval_stack_base, imi->total_arg_and_local_stack_object_size, ex);
+                handled = true;
             }
             if (!handled)
             {
@@ -8180,18 +9774,21 @@ unwind_exception_handler:
                 uint32_t src_ip_offset = static_cast<uint32_t>(reinterpret_cast<const uint8_t*>(data.src_ip) - imi->codes);
                 uint32_t target_ip_offset = static_cast<uint32_t>(reinterpret_cast<const uint8_t*>(data.target_ip) - imi->codes);
                 const RtInterpExceptionClause* next_finally_clause = nullptr;
-                for (size_t i = data.next_search_clause_idx; i < clause_count; ++i)
+                const RtInterpTryRange* range = InterpDefs::find_try_range(imi, src_ip_offset);
+                assert(range);
+                for (uint32_t i = 0; i < range->clause_count; ++i)
                 {
-                    const RtInterpExceptionClause* clause = &clauses[i];
-                    if (clause->try_begin_offset <= src_ip_offset && src_ip_offset < clause->try_end_offset)
+                    size_t clause_idx = imi->try_range_clauses[range->first_clause + i];
+                    if (clause_idx < data.next_search_clause_idx)
                     {
-                        data.next_search_clause_idx = static_cast<uint32_t>(i + 1);
-                        if (clause->flags == metadata::RtILExceptionClauseType::Finally && clause->is_in_try_block(src_ip_offset) &&
-                            !clause->is_in_try_block(target_ip_offset))
-                        {
-                            next_finally_clause = clause;
-                            break;
-                        }
+                        continue;
+                    }
+                    data.next_search_clause_idx = clause_idx + 1;
+                    const RtInterpExceptionClause* clause = &clauses[clause_idx];
+                    if (clause->flags == metadata::RtILExceptionClauseType::Finally && !clause->is_in_try_block(target_ip_offset))
+                    {
+                        next_finally_clause = clause;
+                        break;
                     }
                 }
                 assert(next_finally_clause);
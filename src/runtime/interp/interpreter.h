@@ -11,5 +11,10 @@ class Interpreter
     // Execute method by method info and parameters
     static RtResult<const RtInterpMethodInfo*> init_interpreter_method(const metadata::RtMethodInfo* method);
     static RtResult<const interp::RtStackObject*> execute(const metadata::RtMethodInfo* method, const interp::RtStackObject* params);
+
+    // Handler caches memoize exception classes, which may belong to a collectible module unloaded before the
+    // method owning the cache. Every cache is registered so that purge_unloading_modules can forget them.
+    static void register_handler_cache(const metadata::RtMethodInfo* method, RtInterpHandlerCacheEntry* cache);
+    static void purge_unloading_modules();
 };
 } // namespace leanclr::interp
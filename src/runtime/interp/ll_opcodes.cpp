@@ -662,6 +662,167 @@ size_t OpCodes::s_opsizes[static_cast<size_t>(OpCodeEnum::__Count)] = {
     sizeof(EndFault),
     sizeof(EndFaultShort),
     sizeof(GetEnumLongHashCode),
+    sizeof(VecAddR4x2),
+    sizeof(VecAddR4x3),
+    sizeof(VecAddR4x4),
+    sizeof(VecSubR4x2),
+    sizeof(VecSubR4x3),
+    sizeof(VecSubR4x4),
+    sizeof(VecMulR4x2),
+    sizeof(VecMulR4x3),
+    sizeof(VecMulR4x4),
+    sizeof(VecDivR4x2),
+    sizeof(VecDivR4x3),
+    sizeof(VecDivR4x4),
+    sizeof(VecMinR4x2),
+    sizeof(VecMinR4x3),
+    sizeof(VecMinR4x4),
+    sizeof(VecMaxR4x2),
+    sizeof(VecMaxR4x3),
+    sizeof(VecMaxR4x4),
+    sizeof(VecMulScalarR4x2),
+    sizeof(VecMulScalarR4x3),
+    sizeof(VecMulScalarR4x4),
+    sizeof(VecDivScalarR4x2),
+    sizeof(VecDivScalarR4x3),
+    sizeof(VecDivScalarR4x4),
+    sizeof(VecDotR4x2),
+    sizeof(VecDotR4x3),
+    sizeof(VecDotR4x4),
+    sizeof(VecDistanceR4x2),
+    sizeof(VecDistanceR4x3),
+    sizeof(VecDistanceR4x4),
+    sizeof(VecDistanceSquaredR4x2),
+    sizeof(VecDistanceSquaredR4x3),
+    sizeof(VecDistanceSquaredR4x4),
+    sizeof(VecCrossR4x3),
+    sizeof(VecNegR4x2),
+    sizeof(VecNegR4x3),
+    sizeof(VecNegR4x4),
+    sizeof(VecAbsR4x2),
+    sizeof(VecAbsR4x3),
+    sizeof(VecAbsR4x4),
+    sizeof(VecSqrtR4x2),
+    sizeof(VecSqrtR4x3),
+    sizeof(VecSqrtR4x4),
+    sizeof(VecNormalizeR4x2),
+    sizeof(VecNormalizeR4x3),
+    sizeof(VecNormalizeR4x4),
+    sizeof(VecLengthR4x2),
+    sizeof(VecLengthR4x3),
+    sizeof(VecLengthR4x4),
+    sizeof(VecLengthSquaredR4x2),
+    sizeof(VecLengthSquaredR4x3),
+    sizeof(VecLengthSquaredR4x4),
+    sizeof(VecLerpR4x2),
+    sizeof(VecLerpR4x3),
+    sizeof(VecLerpR4x4),
+    sizeof(VecClampR4x2),
+    sizeof(VecClampR4x3),
+    sizeof(VecClampR4x4),
+    sizeof(VecAddI4x4),
+    sizeof(VecSubI4x4),
+    sizeof(VecMulI4x4),
+    sizeof(VecAddI8x2),
+    sizeof(VecSubI8x2),
+    sizeof(VecAddR8x2),
+    sizeof(VecSubR8x2),
+    sizeof(VecMulR8x2),
+    sizeof(VecDivR8x2),
+    sizeof(VecAndX128),
+    sizeof(VecOrX128),
+    sizeof(VecXorX128),
+    sizeof(AbsI4),
+    sizeof(AbsI8),
+    sizeof(AbsR4),
+    sizeof(AbsR8),
+    sizeof(SqrtR4),
+    sizeof(SqrtR8),
+    sizeof(FloorR4),
+    sizeof(FloorR8),
+    sizeof(CeilR4),
+    sizeof(CeilR8),
+    sizeof(RoundR4),
+    sizeof(RoundR8),
+    sizeof(MinI4),
+    sizeof(MinU4),
+    sizeof(MinI8),
+    sizeof(MinU8),
+    sizeof(MinR4),
+    sizeof(MinR8),
+    sizeof(MaxI4),
+    sizeof(MaxU4),
+    sizeof(MaxI8),
+    sizeof(MaxU8),
+    sizeof(MaxR4),
+    sizeof(MaxR8),
+    sizeof(FmaR4),
+    sizeof(FmaR8),
+    sizeof(LdsfldI1PreInit),
+    sizeof(LdsfldU1PreInit),
+    sizeof(LdsfldI2PreInit),
+    sizeof(LdsfldU2PreInit),
+    sizeof(LdsfldI4PreInit),
+    sizeof(LdsfldI8PreInit),
+    sizeof(LdsfldAnyPreInit),
+    sizeof(LdsfldaPreInit),
+    sizeof(StsfldI1PreInit),
+    sizeof(StsfldI2PreInit),
+    sizeof(StsfldI4PreInit),
+    sizeof(StsfldI8PreInit),
+    sizeof(StsfldAnyPreInit),
+    sizeof(LdelemI1Unchecked),
+    sizeof(LdelemU1Unchecked),
+    sizeof(LdelemI2Unchecked),
+    sizeof(LdelemU2Unchecked),
+    sizeof(LdelemI4Unchecked),
+    sizeof(LdelemI8Unchecked),
+    sizeof(LdelemIUnchecked),
+    sizeof(StelemI1Unchecked),
+    sizeof(StelemI2Unchecked),
+    sizeof(StelemI4Unchecked),
+    sizeof(StelemI8Unchecked),
+    sizeof(StelemIUnchecked),
+    sizeof(CallPInvokeBlittableV0),
+    sizeof(CallPInvokeBlittableV1),
+    sizeof(CallPInvokeBlittableV2),
+    sizeof(CallPInvokeBlittableV3),
+    sizeof(CallPInvokeBlittableV4),
+    sizeof(CallPInvokeBlittableW0),
+    sizeof(CallPInvokeBlittableW1),
+    sizeof(CallPInvokeBlittableW2),
+    sizeof(CallPInvokeBlittableW3),
+    sizeof(CallPInvokeBlittableW4),
+    sizeof(CallPInvokeBlittableR4R4),
+    sizeof(CallPInvokeBlittableR4R4R4),
+    sizeof(CallPInvokeBlittableR8R8),
+    sizeof(CallPInvokeBlittableR8R8R8),
+    sizeof(LdelemMD2I1),
+    sizeof(LdelemMD2U1),
+    sizeof(LdelemMD2I2),
+    sizeof(LdelemMD2U2),
+    sizeof(LdelemMD2I4),
+    sizeof(LdelemMD2I8),
+    sizeof(LdelemMD2I),
+    sizeof(StelemMD2I1),
+    sizeof(StelemMD2I2),
+    sizeof(StelemMD2I4),
+    sizeof(StelemMD2I8),
+    sizeof(StelemMD2I),
+    sizeof(LdelemaMD2),
+    sizeof(LdelemMD3I1),
+    sizeof(LdelemMD3U1),
+    sizeof(LdelemMD3I2),
+    sizeof(LdelemMD3U2),
+    sizeof(LdelemMD3I4),
+    sizeof(LdelemMD3I8),
+    sizeof(LdelemMD3I),
+    sizeof(StelemMD3I1),
+    sizeof(StelemMD3I2),
+    sizeof(StelemMD3I4),
+    sizeof(StelemMD3I8),
+    sizeof(StelemMD3I),
+    sizeof(LdelemaMD3),
 
     //}}LOW_LEVEL_INSTRUCTION_SIZESS
 };
@@ -6609,6 +6770,1517 @@ uint8_t* OpCodes::write_instruction_to_data(uint8_t* codes, const GeneralInst& i
         ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
         return codes + sizeof(GetEnumLongHashCode);
     }
+    case OpCodeEnum::VecAddR4x2:
+    {
+        auto ir = (VecAddR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 51;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecAddR4x2);
+    }
+    case OpCodeEnum::VecAddR4x3:
+    {
+        auto ir = (VecAddR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 52;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecAddR4x3);
+    }
+    case OpCodeEnum::VecAddR4x4:
+    {
+        auto ir = (VecAddR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 53;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecAddR4x4);
+    }
+    case OpCodeEnum::VecSubR4x2:
+    {
+        auto ir = (VecSubR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 54;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecSubR4x2);
+    }
+    case OpCodeEnum::VecSubR4x3:
+    {
+        auto ir = (VecSubR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 55;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecSubR4x3);
+    }
+    case OpCodeEnum::VecSubR4x4:
+    {
+        auto ir = (VecSubR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 56;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecSubR4x4);
+    }
+    case OpCodeEnum::VecMulR4x2:
+    {
+        auto ir = (VecMulR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 57;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMulR4x2);
+    }
+    case OpCodeEnum::VecMulR4x3:
+    {
+        auto ir = (VecMulR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 58;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMulR4x3);
+    }
+    case OpCodeEnum::VecMulR4x4:
+    {
+        auto ir = (VecMulR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 59;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMulR4x4);
+    }
+    case OpCodeEnum::VecDivR4x2:
+    {
+        auto ir = (VecDivR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 60;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDivR4x2);
+    }
+    case OpCodeEnum::VecDivR4x3:
+    {
+        auto ir = (VecDivR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 61;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDivR4x3);
+    }
+    case OpCodeEnum::VecDivR4x4:
+    {
+        auto ir = (VecDivR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 62;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDivR4x4);
+    }
+    case OpCodeEnum::VecMinR4x2:
+    {
+        auto ir = (VecMinR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 63;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMinR4x2);
+    }
+    case OpCodeEnum::VecMinR4x3:
+    {
+        auto ir = (VecMinR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 64;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMinR4x3);
+    }
+    case OpCodeEnum::VecMinR4x4:
+    {
+        auto ir = (VecMinR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 65;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMinR4x4);
+    }
+    case OpCodeEnum::VecMaxR4x2:
+    {
+        auto ir = (VecMaxR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 66;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMaxR4x2);
+    }
+    case OpCodeEnum::VecMaxR4x3:
+    {
+        auto ir = (VecMaxR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 67;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMaxR4x3);
+    }
+    case OpCodeEnum::VecMaxR4x4:
+    {
+        auto ir = (VecMaxR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 68;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMaxR4x4);
+    }
+    case OpCodeEnum::VecMulScalarR4x2:
+    {
+        auto ir = (VecMulScalarR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 69;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMulScalarR4x2);
+    }
+    case OpCodeEnum::VecMulScalarR4x3:
+    {
+        auto ir = (VecMulScalarR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 70;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMulScalarR4x3);
+    }
+    case OpCodeEnum::VecMulScalarR4x4:
+    {
+        auto ir = (VecMulScalarR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 71;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMulScalarR4x4);
+    }
+    case OpCodeEnum::VecDivScalarR4x2:
+    {
+        auto ir = (VecDivScalarR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 72;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDivScalarR4x2);
+    }
+    case OpCodeEnum::VecDivScalarR4x3:
+    {
+        auto ir = (VecDivScalarR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 73;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDivScalarR4x3);
+    }
+    case OpCodeEnum::VecDivScalarR4x4:
+    {
+        auto ir = (VecDivScalarR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 74;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDivScalarR4x4);
+    }
+    case OpCodeEnum::VecDotR4x2:
+    {
+        auto ir = (VecDotR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 75;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDotR4x2);
+    }
+    case OpCodeEnum::VecDotR4x3:
+    {
+        auto ir = (VecDotR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 76;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDotR4x3);
+    }
+    case OpCodeEnum::VecDotR4x4:
+    {
+        auto ir = (VecDotR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 77;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDotR4x4);
+    }
+    case OpCodeEnum::VecDistanceR4x2:
+    {
+        auto ir = (VecDistanceR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 78;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDistanceR4x2);
+    }
+    case OpCodeEnum::VecDistanceR4x3:
+    {
+        auto ir = (VecDistanceR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 79;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDistanceR4x3);
+    }
+    case OpCodeEnum::VecDistanceR4x4:
+    {
+        auto ir = (VecDistanceR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 80;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDistanceR4x4);
+    }
+    case OpCodeEnum::VecDistanceSquaredR4x2:
+    {
+        auto ir = (VecDistanceSquaredR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 81;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDistanceSquaredR4x2);
+    }
+    case OpCodeEnum::VecDistanceSquaredR4x3:
+    {
+        auto ir = (VecDistanceSquaredR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 82;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDistanceSquaredR4x3);
+    }
+    case OpCodeEnum::VecDistanceSquaredR4x4:
+    {
+        auto ir = (VecDistanceSquaredR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 83;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDistanceSquaredR4x4);
+    }
+    case OpCodeEnum::VecCrossR4x3:
+    {
+        auto ir = (VecCrossR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 84;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecCrossR4x3);
+    }
+    case OpCodeEnum::VecNegR4x2:
+    {
+        auto ir = (VecNegR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 85;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecNegR4x2);
+    }
+    case OpCodeEnum::VecNegR4x3:
+    {
+        auto ir = (VecNegR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 86;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecNegR4x3);
+    }
+    case OpCodeEnum::VecNegR4x4:
+    {
+        auto ir = (VecNegR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 87;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecNegR4x4);
+    }
+    case OpCodeEnum::VecAbsR4x2:
+    {
+        auto ir = (VecAbsR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 88;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecAbsR4x2);
+    }
+    case OpCodeEnum::VecAbsR4x3:
+    {
+        auto ir = (VecAbsR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 89;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecAbsR4x3);
+    }
+    case OpCodeEnum::VecAbsR4x4:
+    {
+        auto ir = (VecAbsR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 90;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecAbsR4x4);
+    }
+    case OpCodeEnum::VecSqrtR4x2:
+    {
+        auto ir = (VecSqrtR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 91;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecSqrtR4x2);
+    }
+    case OpCodeEnum::VecSqrtR4x3:
+    {
+        auto ir = (VecSqrtR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 92;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecSqrtR4x3);
+    }
+    case OpCodeEnum::VecSqrtR4x4:
+    {
+        auto ir = (VecSqrtR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 93;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecSqrtR4x4);
+    }
+    case OpCodeEnum::VecNormalizeR4x2:
+    {
+        auto ir = (VecNormalizeR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 94;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecNormalizeR4x2);
+    }
+    case OpCodeEnum::VecNormalizeR4x3:
+    {
+        auto ir = (VecNormalizeR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 95;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecNormalizeR4x3);
+    }
+    case OpCodeEnum::VecNormalizeR4x4:
+    {
+        auto ir = (VecNormalizeR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 96;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecNormalizeR4x4);
+    }
+    case OpCodeEnum::VecLengthR4x2:
+    {
+        auto ir = (VecLengthR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 97;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecLengthR4x2);
+    }
+    case OpCodeEnum::VecLengthR4x3:
+    {
+        auto ir = (VecLengthR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 98;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecLengthR4x3);
+    }
+    case OpCodeEnum::VecLengthR4x4:
+    {
+        auto ir = (VecLengthR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 99;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecLengthR4x4);
+    }
+    case OpCodeEnum::VecLengthSquaredR4x2:
+    {
+        auto ir = (VecLengthSquaredR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 100;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecLengthSquaredR4x2);
+    }
+    case OpCodeEnum::VecLengthSquaredR4x3:
+    {
+        auto ir = (VecLengthSquaredR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 101;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecLengthSquaredR4x3);
+    }
+    case OpCodeEnum::VecLengthSquaredR4x4:
+    {
+        auto ir = (VecLengthSquaredR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 102;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecLengthSquaredR4x4);
+    }
+    case OpCodeEnum::VecLerpR4x2:
+    {
+        auto ir = (VecLerpR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 103;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->arg3 = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecLerpR4x2);
+    }
+    case OpCodeEnum::VecLerpR4x3:
+    {
+        auto ir = (VecLerpR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 104;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->arg3 = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecLerpR4x3);
+    }
+    case OpCodeEnum::VecLerpR4x4:
+    {
+        auto ir = (VecLerpR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 105;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->arg3 = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecLerpR4x4);
+    }
+    case OpCodeEnum::VecClampR4x2:
+    {
+        auto ir = (VecClampR4x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 106;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->arg3 = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecClampR4x2);
+    }
+    case OpCodeEnum::VecClampR4x3:
+    {
+        auto ir = (VecClampR4x3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 107;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->arg3 = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecClampR4x3);
+    }
+    case OpCodeEnum::VecClampR4x4:
+    {
+        auto ir = (VecClampR4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 108;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->arg3 = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecClampR4x4);
+    }
+    case OpCodeEnum::VecAddI4x4:
+    {
+        auto ir = (VecAddI4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 109;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecAddI4x4);
+    }
+    case OpCodeEnum::VecSubI4x4:
+    {
+        auto ir = (VecSubI4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 110;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecSubI4x4);
+    }
+    case OpCodeEnum::VecMulI4x4:
+    {
+        auto ir = (VecMulI4x4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 111;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMulI4x4);
+    }
+    case OpCodeEnum::VecAddI8x2:
+    {
+        auto ir = (VecAddI8x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 112;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecAddI8x2);
+    }
+    case OpCodeEnum::VecSubI8x2:
+    {
+        auto ir = (VecSubI8x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 113;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecSubI8x2);
+    }
+    case OpCodeEnum::VecAddR8x2:
+    {
+        auto ir = (VecAddR8x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 114;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecAddR8x2);
+    }
+    case OpCodeEnum::VecSubR8x2:
+    {
+        auto ir = (VecSubR8x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 115;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecSubR8x2);
+    }
+    case OpCodeEnum::VecMulR8x2:
+    {
+        auto ir = (VecMulR8x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 116;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecMulR8x2);
+    }
+    case OpCodeEnum::VecDivR8x2:
+    {
+        auto ir = (VecDivR8x2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 117;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecDivR8x2);
+    }
+    case OpCodeEnum::VecAndX128:
+    {
+        auto ir = (VecAndX128*)codes;
+        ir->__prefix = 252;
+        ir->__code = 118;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecAndX128);
+    }
+    case OpCodeEnum::VecOrX128:
+    {
+        auto ir = (VecOrX128*)codes;
+        ir->__prefix = 252;
+        ir->__code = 119;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecOrX128);
+    }
+    case OpCodeEnum::VecXorX128:
+    {
+        auto ir = (VecXorX128*)codes;
+        ir->__prefix = 252;
+        ir->__code = 120;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(VecXorX128);
+    }
+    case OpCodeEnum::AbsI4:
+    {
+        auto ir = (AbsI4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 121;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(AbsI4);
+    }
+    case OpCodeEnum::AbsI8:
+    {
+        auto ir = (AbsI8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 122;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(AbsI8);
+    }
+    case OpCodeEnum::AbsR4:
+    {
+        auto ir = (AbsR4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 123;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(AbsR4);
+    }
+    case OpCodeEnum::AbsR8:
+    {
+        auto ir = (AbsR8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 124;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(AbsR8);
+    }
+    case OpCodeEnum::SqrtR4:
+    {
+        auto ir = (SqrtR4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 125;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(SqrtR4);
+    }
+    case OpCodeEnum::SqrtR8:
+    {
+        auto ir = (SqrtR8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 126;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(SqrtR8);
+    }
+    case OpCodeEnum::FloorR4:
+    {
+        auto ir = (FloorR4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 127;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(FloorR4);
+    }
+    case OpCodeEnum::FloorR8:
+    {
+        auto ir = (FloorR8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 128;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(FloorR8);
+    }
+    case OpCodeEnum::CeilR4:
+    {
+        auto ir = (CeilR4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 129;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(CeilR4);
+    }
+    case OpCodeEnum::CeilR8:
+    {
+        auto ir = (CeilR8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 130;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(CeilR8);
+    }
+    case OpCodeEnum::RoundR4:
+    {
+        auto ir = (RoundR4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 131;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(RoundR4);
+    }
+    case OpCodeEnum::RoundR8:
+    {
+        auto ir = (RoundR8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 132;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(RoundR8);
+    }
+    case OpCodeEnum::MinI4:
+    {
+        auto ir = (MinI4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 133;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MinI4);
+    }
+    case OpCodeEnum::MinU4:
+    {
+        auto ir = (MinU4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 134;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MinU4);
+    }
+    case OpCodeEnum::MinI8:
+    {
+        auto ir = (MinI8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 135;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MinI8);
+    }
+    case OpCodeEnum::MinU8:
+    {
+        auto ir = (MinU8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 136;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MinU8);
+    }
+    case OpCodeEnum::MinR4:
+    {
+        auto ir = (MinR4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 137;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MinR4);
+    }
+    case OpCodeEnum::MinR8:
+    {
+        auto ir = (MinR8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 138;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MinR8);
+    }
+    case OpCodeEnum::MaxI4:
+    {
+        auto ir = (MaxI4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 139;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MaxI4);
+    }
+    case OpCodeEnum::MaxU4:
+    {
+        auto ir = (MaxU4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 140;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MaxU4);
+    }
+    case OpCodeEnum::MaxI8:
+    {
+        auto ir = (MaxI8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 141;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MaxI8);
+    }
+    case OpCodeEnum::MaxU8:
+    {
+        auto ir = (MaxU8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 142;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MaxU8);
+    }
+    case OpCodeEnum::MaxR4:
+    {
+        auto ir = (MaxR4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 143;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MaxR4);
+    }
+    case OpCodeEnum::MaxR8:
+    {
+        auto ir = (MaxR8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 144;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(MaxR8);
+    }
+    case OpCodeEnum::FmaR4:
+    {
+        auto ir = (FmaR4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 145;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->arg3 = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(FmaR4);
+    }
+    case OpCodeEnum::FmaR8:
+    {
+        auto ir = (FmaR8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 146;
+        ir->arg1 = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->arg2 = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->arg3 = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(FmaR8);
+    }
+    case OpCodeEnum::LdsfldI1PreInit:
+    {
+        auto ir = (LdsfldI1PreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 147;
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldI1PreInit);
+    }
+    case OpCodeEnum::LdsfldU1PreInit:
+    {
+        auto ir = (LdsfldU1PreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 148;
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldU1PreInit);
+    }
+    case OpCodeEnum::LdsfldI2PreInit:
+    {
+        auto ir = (LdsfldI2PreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 149;
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldI2PreInit);
+    }
+    case OpCodeEnum::LdsfldU2PreInit:
+    {
+        auto ir = (LdsfldU2PreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 150;
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldU2PreInit);
+    }
+    case OpCodeEnum::LdsfldI4PreInit:
+    {
+        auto ir = (LdsfldI4PreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 151;
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldI4PreInit);
+    }
+    case OpCodeEnum::LdsfldI8PreInit:
+    {
+        auto ir = (LdsfldI8PreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 152;
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldI8PreInit);
+    }
+    case OpCodeEnum::LdsfldAnyPreInit:
+    {
+        auto ir = (LdsfldAnyPreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 153;
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->size = (uint16_t)inst.get_field_size();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdsfldAnyPreInit);
+    }
+    case OpCodeEnum::LdsfldaPreInit:
+    {
+        auto ir = (LdsfldaPreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 154;
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdsfldaPreInit);
+    }
+    case OpCodeEnum::StsfldI1PreInit:
+    {
+        auto ir = (StsfldI1PreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 155;
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->value = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        return codes + sizeof(StsfldI1PreInit);
+    }
+    case OpCodeEnum::StsfldI2PreInit:
+    {
+        auto ir = (StsfldI2PreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 156;
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->value = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        return codes + sizeof(StsfldI2PreInit);
+    }
+    case OpCodeEnum::StsfldI4PreInit:
+    {
+        auto ir = (StsfldI4PreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 157;
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->value = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        return codes + sizeof(StsfldI4PreInit);
+    }
+    case OpCodeEnum::StsfldI8PreInit:
+    {
+        auto ir = (StsfldI8PreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 158;
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->value = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        return codes + sizeof(StsfldI8PreInit);
+    }
+    case OpCodeEnum::StsfldAnyPreInit:
+    {
+        auto ir = (StsfldAnyPreInit*)codes;
+        ir->__prefix = 252;
+        ir->__code = 159;
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->size = (uint16_t)inst.get_field_size();
+        ir->value = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        return codes + sizeof(StsfldAnyPreInit);
+    }
+    case OpCodeEnum::LdelemI1Unchecked:
+    {
+        auto ir = (LdelemI1Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 160;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemI1Unchecked);
+    }
+    case OpCodeEnum::LdelemU1Unchecked:
+    {
+        auto ir = (LdelemU1Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 161;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemU1Unchecked);
+    }
+    case OpCodeEnum::LdelemI2Unchecked:
+    {
+        auto ir = (LdelemI2Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 162;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemI2Unchecked);
+    }
+    case OpCodeEnum::LdelemU2Unchecked:
+    {
+        auto ir = (LdelemU2Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 163;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemU2Unchecked);
+    }
+    case OpCodeEnum::LdelemI4Unchecked:
+    {
+        auto ir = (LdelemI4Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 164;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemI4Unchecked);
+    }
+    case OpCodeEnum::LdelemI8Unchecked:
+    {
+        auto ir = (LdelemI8Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 165;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemI8Unchecked);
+    }
+    case OpCodeEnum::LdelemIUnchecked:
+    {
+        auto ir = (LdelemIUnchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 166;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemIUnchecked);
+    }
+    case OpCodeEnum::StelemI1Unchecked:
+    {
+        auto ir = (StelemI1Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 167;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemI1Unchecked);
+    }
+    case OpCodeEnum::StelemI2Unchecked:
+    {
+        auto ir = (StelemI2Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 168;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemI2Unchecked);
+    }
+    case OpCodeEnum::StelemI4Unchecked:
+    {
+        auto ir = (StelemI4Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 169;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemI4Unchecked);
+    }
+    case OpCodeEnum::StelemI8Unchecked:
+    {
+        auto ir = (StelemI8Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 170;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemI8Unchecked);
+    }
+    case OpCodeEnum::StelemIUnchecked:
+    {
+        auto ir = (StelemIUnchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 171;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemIUnchecked);
+    }
+    case OpCodeEnum::CallPInvokeBlittableV0:
+    {
+        auto ir = (CallPInvokeBlittableV0*)codes;
+        ir->__prefix = 252;
+        ir->__code = 172;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableV0);
+    }
+    case OpCodeEnum::CallPInvokeBlittableV1:
+    {
+        auto ir = (CallPInvokeBlittableV1*)codes;
+        ir->__prefix = 252;
+        ir->__code = 173;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableV1);
+    }
+    case OpCodeEnum::CallPInvokeBlittableV2:
+    {
+        auto ir = (CallPInvokeBlittableV2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 174;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableV2);
+    }
+    case OpCodeEnum::CallPInvokeBlittableV3:
+    {
+        auto ir = (CallPInvokeBlittableV3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 175;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableV3);
+    }
+    case OpCodeEnum::CallPInvokeBlittableV4:
+    {
+        auto ir = (CallPInvokeBlittableV4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 176;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableV4);
+    }
+    case OpCodeEnum::CallPInvokeBlittableW0:
+    {
+        auto ir = (CallPInvokeBlittableW0*)codes;
+        ir->__prefix = 252;
+        ir->__code = 177;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableW0);
+    }
+    case OpCodeEnum::CallPInvokeBlittableW1:
+    {
+        auto ir = (CallPInvokeBlittableW1*)codes;
+        ir->__prefix = 252;
+        ir->__code = 178;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableW1);
+    }
+    case OpCodeEnum::CallPInvokeBlittableW2:
+    {
+        auto ir = (CallPInvokeBlittableW2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 179;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableW2);
+    }
+    case OpCodeEnum::CallPInvokeBlittableW3:
+    {
+        auto ir = (CallPInvokeBlittableW3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 180;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableW3);
+    }
+    case OpCodeEnum::CallPInvokeBlittableW4:
+    {
+        auto ir = (CallPInvokeBlittableW4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 181;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableW4);
+    }
+    case OpCodeEnum::CallPInvokeBlittableR4R4:
+    {
+        auto ir = (CallPInvokeBlittableR4R4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 182;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableR4R4);
+    }
+    case OpCodeEnum::CallPInvokeBlittableR4R4R4:
+    {
+        auto ir = (CallPInvokeBlittableR4R4R4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 183;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableR4R4R4);
+    }
+    case OpCodeEnum::CallPInvokeBlittableR8R8:
+    {
+        auto ir = (CallPInvokeBlittableR8R8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 184;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableR8R8);
+    }
+    case OpCodeEnum::CallPInvokeBlittableR8R8R8:
+    {
+        auto ir = (CallPInvokeBlittableR8R8R8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 185;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallPInvokeBlittableR8R8R8);
+    }
+    case OpCodeEnum::LdelemMD2I1:
+    {
+        auto ir = (LdelemMD2I1*)codes;
+        ir->__prefix = 252;
+        ir->__code = 186;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD2I1);
+    }
+    case OpCodeEnum::LdelemMD2U1:
+    {
+        auto ir = (LdelemMD2U1*)codes;
+        ir->__prefix = 252;
+        ir->__code = 187;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD2U1);
+    }
+    case OpCodeEnum::LdelemMD2I2:
+    {
+        auto ir = (LdelemMD2I2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 188;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD2I2);
+    }
+    case OpCodeEnum::LdelemMD2U2:
+    {
+        auto ir = (LdelemMD2U2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 189;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD2U2);
+    }
+    case OpCodeEnum::LdelemMD2I4:
+    {
+        auto ir = (LdelemMD2I4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 190;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD2I4);
+    }
+    case OpCodeEnum::LdelemMD2I8:
+    {
+        auto ir = (LdelemMD2I8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 191;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD2I8);
+    }
+    case OpCodeEnum::LdelemMD2I:
+    {
+        auto ir = (LdelemMD2I*)codes;
+        ir->__prefix = 252;
+        ir->__code = 192;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD2I);
+    }
+    case OpCodeEnum::StelemMD2I1:
+    {
+        auto ir = (StelemMD2I1*)codes;
+        ir->__prefix = 252;
+        ir->__code = 193;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(StelemMD2I1);
+    }
+    case OpCodeEnum::StelemMD2I2:
+    {
+        auto ir = (StelemMD2I2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 194;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(StelemMD2I2);
+    }
+    case OpCodeEnum::StelemMD2I4:
+    {
+        auto ir = (StelemMD2I4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 195;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(StelemMD2I4);
+    }
+    case OpCodeEnum::StelemMD2I8:
+    {
+        auto ir = (StelemMD2I8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 196;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(StelemMD2I8);
+    }
+    case OpCodeEnum::StelemMD2I:
+    {
+        auto ir = (StelemMD2I*)codes;
+        ir->__prefix = 252;
+        ir->__code = 197;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(StelemMD2I);
+    }
+    case OpCodeEnum::LdelemaMD2:
+    {
+        auto ir = (LdelemaMD2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 198;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemaMD2);
+    }
+    case OpCodeEnum::LdelemMD3I1:
+    {
+        auto ir = (LdelemMD3I1*)codes;
+        ir->__prefix = 252;
+        ir->__code = 199;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD3I1);
+    }
+    case OpCodeEnum::LdelemMD3U1:
+    {
+        auto ir = (LdelemMD3U1*)codes;
+        ir->__prefix = 252;
+        ir->__code = 200;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD3U1);
+    }
+    case OpCodeEnum::LdelemMD3I2:
+    {
+        auto ir = (LdelemMD3I2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 201;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD3I2);
+    }
+    case OpCodeEnum::LdelemMD3U2:
+    {
+        auto ir = (LdelemMD3U2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 202;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD3U2);
+    }
+    case OpCodeEnum::LdelemMD3I4:
+    {
+        auto ir = (LdelemMD3I4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 203;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD3I4);
+    }
+    case OpCodeEnum::LdelemMD3I8:
+    {
+        auto ir = (LdelemMD3I8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 204;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD3I8);
+    }
+    case OpCodeEnum::LdelemMD3I:
+    {
+        auto ir = (LdelemMD3I*)codes;
+        ir->__prefix = 252;
+        ir->__code = 205;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemMD3I);
+    }
+    case OpCodeEnum::StelemMD3I1:
+    {
+        auto ir = (StelemMD3I1*)codes;
+        ir->__prefix = 252;
+        ir->__code = 206;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(StelemMD3I1);
+    }
+    case OpCodeEnum::StelemMD3I2:
+    {
+        auto ir = (StelemMD3I2*)codes;
+        ir->__prefix = 252;
+        ir->__code = 207;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(StelemMD3I2);
+    }
+    case OpCodeEnum::StelemMD3I4:
+    {
+        auto ir = (StelemMD3I4*)codes;
+        ir->__prefix = 252;
+        ir->__code = 208;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(StelemMD3I4);
+    }
+    case OpCodeEnum::StelemMD3I8:
+    {
+        auto ir = (StelemMD3I8*)codes;
+        ir->__prefix = 252;
+        ir->__code = 209;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(StelemMD3I8);
+    }
+    case OpCodeEnum::StelemMD3I:
+    {
+        auto ir = (StelemMD3I*)codes;
+        ir->__prefix = 252;
+        ir->__code = 210;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(StelemMD3I);
+    }
+    case OpCodeEnum::LdelemaMD3:
+    {
+        auto ir = (LdelemaMD3*)codes;
+        ir->__prefix = 252;
+        ir->__code = 211;
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(LdelemaMD3);
+    }
 
     //}}LOW_LEVEL_INSTRUCTION_WRITE_TO_DATA_DATA
     default:
@@ -661,6 +661,167 @@ enum class OpCodeEnum
     EndFault,
     EndFaultShort,
     GetEnumLongHashCode,
+    VecAddR4x2,
+    VecAddR4x3,
+    VecAddR4x4,
+    VecSubR4x2,
+    VecSubR4x3,
+    VecSubR4x4,
+    VecMulR4x2,
+    VecMulR4x3,
+    VecMulR4x4,
+    VecDivR4x2,
+    VecDivR4x3,
+    VecDivR4x4,
+    VecMinR4x2,
+    VecMinR4x3,
+    VecMinR4x4,
+    VecMaxR4x2,
+    VecMaxR4x3,
+    VecMaxR4x4,
+    VecMulScalarR4x2,
+    VecMulScalarR4x3,
+    VecMulScalarR4x4,
+    VecDivScalarR4x2,
+    VecDivScalarR4x3,
+    VecDivScalarR4x4,
+    VecDotR4x2,
+    VecDotR4x3,
+    VecDotR4x4,
+    VecDistanceR4x2,
+    VecDistanceR4x3,
+    VecDistanceR4x4,
+    VecDistanceSquaredR4x2,
+    VecDistanceSquaredR4x3,
+    VecDistanceSquaredR4x4,
+    VecCrossR4x3,
+    VecNegR4x2,
+    VecNegR4x3,
+    VecNegR4x4,
+    VecAbsR4x2,
+    VecAbsR4x3,
+    VecAbsR4x4,
+    VecSqrtR4x2,
+    VecSqrtR4x3,
+    VecSqrtR4x4,
+    VecNormalizeR4x2,
+    VecNormalizeR4x3,
+    VecNormalizeR4x4,
+    VecLengthR4x2,
+    VecLengthR4x3,
+    VecLengthR4x4,
+    VecLengthSquaredR4x2,
+    VecLengthSquaredR4x3,
+    VecLengthSquaredR4x4,
+    VecLerpR4x2,
+    VecLerpR4x3,
+    VecLerpR4x4,
+    VecClampR4x2,
+    VecClampR4x3,
+    VecClampR4x4,
+    VecAddI4x4,
+    VecSubI4x4,
+    VecMulI4x4,
+    VecAddI8x2,
+    VecSubI8x2,
+    VecAddR8x2,
+    VecSubR8x2,
+    VecMulR8x2,
+    VecDivR8x2,
+    VecAndX128,
+    VecOrX128,
+    VecXorX128,
+    AbsI4,
+    AbsI8,
+    AbsR4,
+    AbsR8,
+    SqrtR4,
+    SqrtR8,
+    FloorR4,
+    FloorR8,
+    CeilR4,
+    CeilR8,
+    RoundR4,
+    RoundR8,
+    MinI4,
+    MinU4,
+    MinI8,
+    MinU8,
+    MinR4,
+    MinR8,
+    MaxI4,
+    MaxU4,
+    MaxI8,
+    MaxU8,
+    MaxR4,
+    MaxR8,
+    FmaR4,
+    FmaR8,
+    LdsfldI1PreInit,
+    LdsfldU1PreInit,
+    LdsfldI2PreInit,
+    LdsfldU2PreInit,
+    LdsfldI4PreInit,
+    LdsfldI8PreInit,
+    LdsfldAnyPreInit,
+    LdsfldaPreInit,
+    StsfldI1PreInit,
+    StsfldI2PreInit,
+    StsfldI4PreInit,
+    StsfldI8PreInit,
+    StsfldAnyPreInit,
+    LdelemI1Unchecked,
+    LdelemU1Unchecked,
+    LdelemI2Unchecked,
+    LdelemU2Unchecked,
+    LdelemI4Unchecked,
+    LdelemI8Unchecked,
+    LdelemIUnchecked,
+    StelemI1Unchecked,
+    StelemI2Unchecked,
+    StelemI4Unchecked,
+    StelemI8Unchecked,
+    StelemIUnchecked,
+    CallPInvokeBlittableV0,
+    CallPInvokeBlittableV1,
+    CallPInvokeBlittableV2,
+    CallPInvokeBlittableV3,
+    CallPInvokeBlittableV4,
+    CallPInvokeBlittableW0,
+    CallPInvokeBlittableW1,
+    CallPInvokeBlittableW2,
+    CallPInvokeBlittableW3,
+    CallPInvokeBlittableW4,
+    CallPInvokeBlittableR4R4,
+    CallPInvokeBlittableR4R4R4,
+    CallPInvokeBlittableR8R8,
+    CallPInvokeBlittableR8R8R8,
+    LdelemMD2I1,
+    LdelemMD2U1,
+    LdelemMD2I2,
+    LdelemMD2U2,
+    LdelemMD2I4,
+    LdelemMD2I8,
+    LdelemMD2I,
+    StelemMD2I1,
+    StelemMD2I2,
+    StelemMD2I4,
+    StelemMD2I8,
+    StelemMD2I,
+    LdelemaMD2,
+    LdelemMD3I1,
+    LdelemMD3U1,
+    LdelemMD3I2,
+    LdelemMD3U2,
+    LdelemMD3I4,
+    LdelemMD3I8,
+    LdelemMD3I,
+    StelemMD3I1,
+    StelemMD3I2,
+    StelemMD3I4,
+    StelemMD3I8,
+    StelemMD3I,
+    LdelemaMD3,
 
     //}}LOW_LEVEL_OPCODE_ENUMM
     __Count,
@@ -1240,6 +1401,167 @@ enum class OpCodeValue2 : uint8_t
     InitBlk = 0x30,
     CpBlk = 0x31,
     GetEnumLongHashCode = 0x32,
+    VecAddR4x2 = 0x33,
+    VecAddR4x3 = 0x34,
+    VecAddR4x4 = 0x35,
+    VecSubR4x2 = 0x36,
+    VecSubR4x3 = 0x37,
+    VecSubR4x4 = 0x38,
+    VecMulR4x2 = 0x39,
+    VecMulR4x3 = 0x3A,
+    VecMulR4x4 = 0x3B,
+    VecDivR4x2 = 0x3C,
+    VecDivR4x3 = 0x3D,
+    VecDivR4x4 = 0x3E,
+    VecMinR4x2 = 0x3F,
+    VecMinR4x3 = 0x40,
+    VecMinR4x4 = 0x41,
+    VecMaxR4x2 = 0x42,
+    VecMaxR4x3 = 0x43,
+    VecMaxR4x4 = 0x44,
+    VecMulScalarR4x2 = 0x45,
+    VecMulScalarR4x3 = 0x46,
+    VecMulScalarR4x4 = 0x47,
+    VecDivScalarR4x2 = 0x48,
+    VecDivScalarR4x3 = 0x49,
+    VecDivScalarR4x4 = 0x4A,
+    VecDotR4x2 = 0x4B,
+    VecDotR4x3 = 0x4C,
+    VecDotR4x4 = 0x4D,
+    VecDistanceR4x2 = 0x4E,
+    VecDistanceR4x3 = 0x4F,
+    VecDistanceR4x4 = 0x50,
+    VecDistanceSquaredR4x2 = 0x51,
+    VecDistanceSquaredR4x3 = 0x52,
+    VecDistanceSquaredR4x4 = 0x53,
+    VecCrossR4x3 = 0x54,
+    VecNegR4x2 = 0x55,
+    VecNegR4x3 = 0x56,
+    VecNegR4x4 = 0x57,
+    VecAbsR4x2 = 0x58,
+    VecAbsR4x3 = 0x59,
+    VecAbsR4x4 = 0x5A,
+    VecSqrtR4x2 = 0x5B,
+    VecSqrtR4x3 = 0x5C,
+    VecSqrtR4x4 = 0x5D,
+    VecNormalizeR4x2 = 0x5E,
+    VecNormalizeR4x3 = 0x5F,
+    VecNormalizeR4x4 = 0x60,
+    VecLengthR4x2 = 0x61,
+    VecLengthR4x3 = 0x62,
+    VecLengthR4x4 = 0x63,
+    VecLengthSquaredR4x2 = 0x64,
+    VecLengthSquaredR4x3 = 0x65,
+    VecLengthSquaredR4x4 = 0x66,
+    VecLerpR4x2 = 0x67,
+    VecLerpR4x3 = 0x68,
+    VecLerpR4x4 = 0x69,
+    VecClampR4x2 = 0x6A,
+    VecClampR4x3 = 0x6B,
+    VecClampR4x4 = 0x6C,
+    VecAddI4x4 = 0x6D,
+    VecSubI4x4 = 0x6E,
+    VecMulI4x4 = 0x6F,
+    VecAddI8x2 = 0x70,
+    VecSubI8x2 = 0x71,
+    VecAddR8x2 = 0x72,
+    VecSubR8x2 = 0x73,
+    VecMulR8x2 = 0x74,
+    VecDivR8x2 = 0x75,
+    VecAndX128 = 0x76,
+    VecOrX128 = 0x77,
+    VecXorX128 = 0x78,
+    AbsI4 = 0x79,
+    AbsI8 = 0x7A,
+    AbsR4 = 0x7B,
+    AbsR8 = 0x7C,
+    SqrtR4 = 0x7D,
+    SqrtR8 = 0x7E,
+    FloorR4 = 0x7F,
+    FloorR8 = 0x80,
+    CeilR4 = 0x81,
+    CeilR8 = 0x82,
+    RoundR4 = 0x83,
+    RoundR8 = 0x84,
+    MinI4 = 0x85,
+    MinU4 = 0x86,
+    MinI8 = 0x87,
+    MinU8 = 0x88,
+    MinR4 = 0x89,
+    MinR8 = 0x8A,
+    MaxI4 = 0x8B,
+    MaxU4 = 0x8C,
+    MaxI8 = 0x8D,
+    MaxU8 = 0x8E,
+    MaxR4 = 0x8F,
+    MaxR8 = 0x90,
+    FmaR4 = 0x91,
+    FmaR8 = 0x92,
+    LdsfldI1PreInit = 0x93,
+    LdsfldU1PreInit = 0x94,
+    LdsfldI2PreInit = 0x95,
+    LdsfldU2PreInit = 0x96,
+    LdsfldI4PreInit = 0x97,
+    LdsfldI8PreInit = 0x98,
+    LdsfldAnyPreInit = 0x99,
+    LdsfldaPreInit = 0x9A,
+    StsfldI1PreInit = 0x9B,
+    StsfldI2PreInit = 0x9C,
+    StsfldI4PreInit = 0x9D,
+    StsfldI8PreInit = 0x9E,
+    StsfldAnyPreInit = 0x9F,
+    LdelemI1Unchecked = 0xA0,
+    LdelemU1Unchecked = 0xA1,
+    LdelemI2Unchecked = 0xA2,
+    LdelemU2Unchecked = 0xA3,
+    LdelemI4Unchecked = 0xA4,
+    LdelemI8Unchecked = 0xA5,
+    LdelemIUnchecked = 0xA6,
+    StelemI1Unchecked = 0xA7,
+    StelemI2Unchecked = 0xA8,
+    StelemI4Unchecked = 0xA9,
+    StelemI8Unchecked = 0xAA,
+    StelemIUnchecked = 0xAB,
+    CallPInvokeBlittableV0 = 0xAC,
+    CallPInvokeBlittableV1 = 0xAD,
+    CallPInvokeBlittableV2 = 0xAE,
+    CallPInvokeBlittableV3 = 0xAF,
+    CallPInvokeBlittableV4 = 0xB0,
+    CallPInvokeBlittableW0 = 0xB1,
+    CallPInvokeBlittableW1 = 0xB2,
+    CallPInvokeBlittableW2 = 0xB3,
+    CallPInvokeBlittableW3 = 0xB4,
+    CallPInvokeBlittableW4 = 0xB5,
+    CallPInvokeBlittableR4R4 = 0xB6,
+    CallPInvokeBlittableR4R4R4 = 0xB7,
+    CallPInvokeBlittableR8R8 = 0xB8,
+    CallPInvokeBlittableR8R8R8 = 0xB9,
+    LdelemMD2I1 = 0xBA,
+    LdelemMD2U1 = 0xBB,
+    LdelemMD2I2 = 0xBC,
+    LdelemMD2U2 = 0xBD,
+    LdelemMD2I4 = 0xBE,
+    LdelemMD2I8 = 0xBF,
+    LdelemMD2I = 0xC0,
+    StelemMD2I1 = 0xC1,
+    StelemMD2I2 = 0xC2,
+    StelemMD2I4 = 0xC3,
+    StelemMD2I8 = 0xC4,
+    StelemMD2I = 0xC5,
+    LdelemaMD2 = 0xC6,
+    LdelemMD3I1 = 0xC7,
+    LdelemMD3U1 = 0xC8,
+    LdelemMD3I2 = 0xC9,
+    LdelemMD3U2 = 0xCA,
+    LdelemMD3I4 = 0xCB,
+    LdelemMD3I8 = 0xCC,
+    LdelemMD3I = 0xCD,
+    StelemMD3I1 = 0xCE,
+    StelemMD3I2 = 0xCF,
+    StelemMD3I4 = 0xD0,
+    StelemMD3I8 = 0xD1,
+    StelemMD3I = 0xD2,
+    LdelemaMD3 = 0xD3,
 
     //}}LOW_LEVEL_OPCODE2
 };
@@ -7306,6 +7628,1483 @@ struct GetEnumLongHashCode
     uint8_t __padding_7;
 };
 
+struct VecAddR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecAddR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecAddR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecSubR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecSubR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecSubR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMulR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMulR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMulR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDivR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDivR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDivR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMinR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMinR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMinR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMaxR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMaxR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMaxR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMulScalarR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMulScalarR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMulScalarR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDivScalarR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDivScalarR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDivScalarR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDotR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDotR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDotR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDistanceR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDistanceR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDistanceR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDistanceSquaredR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDistanceSquaredR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDistanceSquaredR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecCrossR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecNegR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecNegR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecNegR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecAbsR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecAbsR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecAbsR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecSqrtR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecSqrtR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecSqrtR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecNormalizeR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecNormalizeR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecNormalizeR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecLengthR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecLengthR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecLengthR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecLengthSquaredR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecLengthSquaredR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecLengthSquaredR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct VecLerpR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t arg3;
+    uint16_t dst;
+    uint8_t __padding_10;
+    uint8_t __padding_11;
+};
+
+struct VecLerpR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t arg3;
+    uint16_t dst;
+    uint8_t __padding_10;
+    uint8_t __padding_11;
+};
+
+struct VecLerpR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t arg3;
+    uint16_t dst;
+    uint8_t __padding_10;
+    uint8_t __padding_11;
+};
+
+struct VecClampR4x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t arg3;
+    uint16_t dst;
+    uint8_t __padding_10;
+    uint8_t __padding_11;
+};
+
+struct VecClampR4x3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t arg3;
+    uint16_t dst;
+    uint8_t __padding_10;
+    uint8_t __padding_11;
+};
+
+struct VecClampR4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t arg3;
+    uint16_t dst;
+    uint8_t __padding_10;
+    uint8_t __padding_11;
+};
+
+struct VecAddI4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecSubI4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMulI4x4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecAddI8x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecSubI8x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecAddR8x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecSubR8x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecMulR8x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecDivR8x2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecAndX128
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecOrX128
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct VecXorX128
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct AbsI4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct AbsI8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct AbsR4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct AbsR8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct SqrtR4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct SqrtR8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct FloorR4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct FloorR8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CeilR4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CeilR8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct RoundR4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct RoundR8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct MinI4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct MinU4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct MinI8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct MinU8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct MinR4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct MinR8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct MaxI4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct MaxU4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct MaxI8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct MaxU8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct MaxR4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct MaxR8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t dst;
+};
+
+struct FmaR4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t arg3;
+    uint16_t dst;
+    uint8_t __padding_10;
+    uint8_t __padding_11;
+};
+
+struct FmaR8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arg1;
+    uint16_t arg2;
+    uint16_t arg3;
+    uint16_t dst;
+    uint8_t __padding_10;
+    uint8_t __padding_11;
+};
+
+struct LdsfldI1PreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t dst;
+    uint16_t field_idx;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct LdsfldU1PreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t dst;
+    uint16_t field_idx;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct LdsfldI2PreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t dst;
+    uint16_t field_idx;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct LdsfldU2PreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t dst;
+    uint16_t field_idx;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct LdsfldI4PreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t dst;
+    uint16_t field_idx;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct LdsfldI8PreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t dst;
+    uint16_t field_idx;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct LdsfldAnyPreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t field_idx;
+    uint16_t size;
+    uint16_t dst;
+};
+
+struct LdsfldaPreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t field_idx;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct StsfldI1PreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t field_idx;
+    uint16_t value;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct StsfldI2PreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t field_idx;
+    uint16_t value;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct StsfldI4PreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t field_idx;
+    uint16_t value;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct StsfldI8PreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t field_idx;
+    uint16_t value;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct StsfldAnyPreInit
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t field_idx;
+    uint16_t size;
+    uint16_t value;
+};
+
+struct LdelemI1Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemU1Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemI2Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemU2Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemI4Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemI8Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemIUnchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct StelemI1Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct StelemI2Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct StelemI4Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct StelemI8Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct StelemIUnchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct CallPInvokeBlittableV0
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableV1
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableV2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableV3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableV4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableW0
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableW1
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableW2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableW3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableW4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableR4R4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableR4R4R4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableR8R8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallPInvokeBlittableR8R8R8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct LdelemMD2I1
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD2U1
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD2I2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD2U2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD2I4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD2I8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD2I
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct StelemMD2I1
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct StelemMD2I2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct StelemMD2I4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct StelemMD2I8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct StelemMD2I
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemaMD2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD3I1
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD3U1
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD3I2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD3U2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD3I4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD3I8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemMD3I
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct StelemMD3I1
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct StelemMD3I2
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct StelemMD3I4
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct StelemMD3I8
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct StelemMD3I
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+struct LdelemaMD3
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t frame_base;
+};
+
+
 //}}LOW_LEVEL_INSTRUCTION_STRUCTSS
 
 struct GeneralInst;
@@ -1,12 +1,16 @@
+#include <algorithm>
 #include <climits>
 #include <cstdint>
 #include "ll_transformer.h"
 #include "hl_transformer.h"
+#include "interpreter.h"
 #include "vm/class.h"
 #include "vm/field.h"
 #include "vm/rt_string.h"
 #include "vm/assembly.h"
 #include "vm/array_class.h"
+#include "vm/method.h"
+#include "vm/pinvoke.h"
 #include "metadata/metadata_const.h"
 #include "metadata/module_def.h"
 #include "utils/platform.h"
@@ -63,36 +67,48 @@ RtResultVoid Transformer::transform_basic_blocks()
     RET_VOID_OK();
 }
 
-size_t Transformer::get_resolved_data_index(const void* data)
+size_t Transformer::get_resolved_data_index(const void* data, RtResolvedDataKind kind)
 {
     auto it = _resolved_data_2_index_map.find(data);
     if (it != _resolved_data_2_index_map.end())
     {
+        assert(_resolved_data_kinds[it->second] == kind);
         return it->second;
     }
 
     size_t index = _resolved_datas.size();
     _resolved_datas.push_back(data);
+    _resolved_data_kinds.push_back(kind);
     _resolved_data_2_index_map.insert({data, index});
     return index;
 }
 
-void Transformer::setup_inst_resolved_data(GeneralInst* ll_inst, const void* data)
+void Transformer::setup_inst_resolved_data(GeneralInst* ll_inst, const void* data, RtResolvedDataKind kind)
 {
-    size_t index = get_resolved_data_index(data);
+    size_t index = get_resolved_data_index(data, kind);
+    ll_inst->set_resolved_data_index(index);
+}
+
+// Static field accesses get a resolved data slot of their own instead of a shared one: the interpreter
+// overwrites it with the field address when it quickens the instruction to its PreInit variant.
+void Transformer::setup_inst_static_field(GeneralInst* ll_inst, const metadata::RtFieldInfo* field)
+{
+    size_t index = _resolved_datas.size();
+    _resolved_datas.push_back(field);
+    _resolved_data_kinds.push_back(RtResolvedDataKind::Field);
     ll_inst->set_resolved_data_index(index);
 }
 
 void Transformer::setup_inst_klass(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst)
 {
     metadata::RtClass* klass = hl_inst->get_class();
-    setup_inst_resolved_data(ll_inst, klass);
+    setup_inst_resolved_data(ll_inst, klass, RtResolvedDataKind::Class);
 }
 
 void Transformer::setup_inst_method(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst)
 {
     const metadata::RtMethodInfo* method = hl_inst->get_method();
-    setup_inst_resolved_data(ll_inst, method);
+    setup_inst_resolved_data(ll_inst, method, RtResolvedDataKind::Method);
 }
 
 utils::NotFreeList<size_t> Transformer::find_finally_clause_idx_of_leave_target(const BasicBlock* leave_src, const BasicBlock* leave_target)
@@ -394,16 +410,515 @@ RtResultVoid Transformer::transform_cmp_op(GeneralInst* ll_inst, const hl::Gener
     RET_VOID_OK();
 }
 
+// Argument shapes of System.Numerics vector methods: V = the vector type itself, S = System.Single,
+// This = instance method without parameters.
+enum class VectorCallShape
+{
+    Unknown,
+    V,
+    VV,
+    VS,
+    SV,
+    VVS,
+    VVV,
+    This,
+};
+
+struct VectorCallLowering
+{
+    const char* method_name;
+    VectorCallShape shape;
+    OpCodeEnum op_x2;
+    OpCodeEnum op_x3;
+    OpCodeEnum op_x4;
+};
+
+#define LEANCLR_VECTOR_LOWERING(NAME, SHAPE, OP)                                                                                                             \
+    {NAME, VectorCallShape::SHAPE, OpCodeEnum::OP##R4x2, OpCodeEnum::OP##R4x3, OpCodeEnum::OP##R4x4}
+
+static const VectorCallLowering s_vector_call_lowerings[] = {
+    LEANCLR_VECTOR_LOWERING("op_Addition", VV, VecAdd),
+    LEANCLR_VECTOR_LOWERING("Add", VV, VecAdd),
+    LEANCLR_VECTOR_LOWERING("op_Subtraction", VV, VecSub),
+    LEANCLR_VECTOR_LOWERING("Subtract", VV, VecSub),
+    LEANCLR_VECTOR_LOWERING("op_Multiply", VV, VecMul),
+    LEANCLR_VECTOR_LOWERING("Multiply", VV, VecMul),
+    LEANCLR_VECTOR_LOWERING("op_Multiply", VS, VecMulScalar),
+    LEANCLR_VECTOR_LOWERING("Multiply", VS, VecMulScalar),
+    LEANCLR_VECTOR_LOWERING("op_Multiply", SV, VecMulScalar),
+    LEANCLR_VECTOR_LOWERING("Multiply", SV, VecMulScalar),
+    LEANCLR_VECTOR_LOWERING("op_Division", VV, VecDiv),
+    LEANCLR_VECTOR_LOWERING("Divide", VV, VecDiv),
+    LEANCLR_VECTOR_LOWERING("op_Division", VS, VecDivScalar),
+    LEANCLR_VECTOR_LOWERING("Divide", VS, VecDivScalar),
+    LEANCLR_VECTOR_LOWERING("op_UnaryNegation", V, VecNeg),
+    LEANCLR_VECTOR_LOWERING("Negate", V, VecNeg),
+    LEANCLR_VECTOR_LOWERING("Min", VV, VecMin),
+    LEANCLR_VECTOR_LOWERING("Max", VV, VecMax),
+    LEANCLR_VECTOR_LOWERING("Abs", V, VecAbs),
+    LEANCLR_VECTOR_LOWERING("SquareRoot", V, VecSqrt),
+    LEANCLR_VECTOR_LOWERING("Normalize", V, VecNormalize),
+    LEANCLR_VECTOR_LOWERING("Dot", VV, VecDot),
+    LEANCLR_VECTOR_LOWERING("Distance", VV, VecDistance),
+    LEANCLR_VECTOR_LOWERING("DistanceSquared", VV, VecDistanceSquared),
+    LEANCLR_VECTOR_LOWERING("Lerp", VVS, VecLerp),
+    LEANCLR_VECTOR_LOWERING("Clamp", VVV, VecClamp),
+    LEANCLR_VECTOR_LOWERING("Length", This, VecLength),
+    LEANCLR_VECTOR_LOWERING("LengthSquared", This, VecLengthSquared),
+    {"Cross", VectorCallShape::VV, OpCodeEnum::Illegal, OpCodeEnum::VecCrossR4x3, OpCodeEnum::Illegal},
+};
+
+#undef LEANCLR_VECTOR_LOWERING
+
+static RtResult<VectorCallShape> get_vector_call_shape(const metadata::RtMethodInfo* method, metadata::RtClass* vector_klass)
+{
+    char kinds[3];
+    size_t param_count = static_cast<size_t>(method->parameter_count);
+    if (param_count > 3)
+    {
+        RET_OK(VectorCallShape::Unknown);
+    }
+    for (size_t i = 0; i < param_count; ++i)
+    {
+        const metadata::RtTypeSig* param = method->parameters[i];
+        if (param->by_ref)
+        {
+            RET_OK(VectorCallShape::Unknown);
+        }
+        if (param->ele_type == metadata::RtElementType::R4)
+        {
+            kinds[i] = 'S';
+            continue;
+        }
+        if (param->ele_type != metadata::RtElementType::ValueType && param->ele_type != metadata::RtElementType::GenericInst)
+        {
+            RET_OK(VectorCallShape::Unknown);
+        }
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, param_klass, vm::Class::get_class_from_typesig(param));
+        if (param_klass != vector_klass)
+        {
+            RET_OK(VectorCallShape::Unknown);
+        }
+        kinds[i] = 'V';
+    }
+
+    if (vm::Method::is_instance(method))
+    {
+        RET_OK(param_count == 0 ? VectorCallShape::This : VectorCallShape::Unknown);
+    }
+    switch (param_count)
+    {
+    case 1:
+        RET_OK(kinds[0] == 'V' ? VectorCallShape::V : VectorCallShape::Unknown);
+    case 2:
+        if (kinds[0] == 'V')
+        {
+            RET_OK(kinds[1] == 'V' ? VectorCallShape::VV : VectorCallShape::VS);
+        }
+        RET_OK(kinds[1] == 'V' ? VectorCallShape::SV : VectorCallShape::Unknown);
+    case 3:
+        if (kinds[0] != 'V' || kinds[1] != 'V')
+        {
+            RET_OK(VectorCallShape::Unknown);
+        }
+        RET_OK(kinds[2] == 'V' ? VectorCallShape::VVV : VectorCallShape::VVS);
+    default:
+        RET_OK(VectorCallShape::Unknown);
+    }
+}
+
+// Vector<T> is lowered only for the 16-byte layout; T selects the lane type.
+static OpCodeEnum get_generic_vector_opcode(const char* method_name, metadata::RtElementType element_type)
+{
+    if (std::strcmp(method_name, "op_BitwiseAnd") == 0)
+        return OpCodeEnum::VecAndX128;
+    if (std::strcmp(method_name, "op_BitwiseOr") == 0)
+        return OpCodeEnum::VecOrX128;
+    if (std::strcmp(method_name, "op_ExclusiveOr") == 0)
+        return OpCodeEnum::VecXorX128;
+
+    bool is_add = std::strcmp(method_name, "op_Addition") == 0;
+    bool is_sub = std::strcmp(method_name, "op_Subtraction") == 0;
+    bool is_mul = std::strcmp(method_name, "op_Multiply") == 0;
+    bool is_div = std::strcmp(method_name, "op_Division") == 0;
+    switch (element_type)
+    {
+    case metadata::RtElementType::R4:
+        return is_add ? OpCodeEnum::VecAddR4x4
+               : is_sub ? OpCodeEnum::VecSubR4x4
+               : is_mul ? OpCodeEnum::VecMulR4x4
+               : is_div ? OpCodeEnum::VecDivR4x4
+                        : OpCodeEnum::Illegal;
+    case metadata::RtElementType::R8:
+        return is_add ? OpCodeEnum::VecAddR8x2
+               : is_sub ? OpCodeEnum::VecSubR8x2
+               : is_mul ? OpCodeEnum::VecMulR8x2
+               : is_div ? OpCodeEnum::VecDivR8x2
+                        : OpCodeEnum::Illegal;
+    case metadata::RtElementType::I4:
+    case metadata::RtElementType::U4:
+        return is_add ? OpCodeEnum::VecAddI4x4 : is_sub ? OpCodeEnum::VecSubI4x4 : is_mul ? OpCodeEnum::VecMulI4x4 : OpCodeEnum::Illegal;
+    case metadata::RtElementType::I8:
+    case metadata::RtElementType::U8:
+        return is_add ? OpCodeEnum::VecAddI8x2 : is_sub ? OpCodeEnum::VecSubI8x2 : OpCodeEnum::Illegal;
+    default:
+        return OpCodeEnum::Illegal;
+    }
+}
+
+// Only the vector types of the assemblies that ship them are lowered; a user assembly may declare its own
+// System.Numerics types with the same names and different semantics.
+static bool is_numerics_vector_image(const metadata::RtModuleDef* image)
+{
+    const char* name = image->get_name_no_ext();
+    return image->is_corlib() || std::strcmp(name, "System.Numerics") == 0 || std::strcmp(name, "System.Numerics.Vectors") == 0;
+}
+
+RtResult<bool> Transformer::transform_numerics_vector_call_methods(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst)
+{
+    const metadata::RtMethodInfo* method = hl_inst->get_method();
+    metadata::RtClass* klass = method->parent;
+    const char* klass_name = klass->name;
+
+    int32_t lanes = 0;
+    if (std::strcmp(klass_name, "Vector2") == 0)
+        lanes = 2;
+    else if (std::strcmp(klass_name, "Vector3") == 0)
+        lanes = 3;
+    else if (std::strcmp(klass_name, "Vector4") == 0)
+        lanes = 4;
+    else if (std::strcmp(klass_name, "Vector`1") != 0)
+        RET_OK(false);
+
+    if (!vm::Class::is_value_type(klass))
+    {
+        RET_OK(false);
+    }
+    RET_ERR_ON_FAIL(vm::Class::initialize_fields(klass));
+    uint32_t expected_size = lanes != 0 ? static_cast<uint32_t>(lanes * sizeof(float)) : 16;
+    if (vm::Class::get_instance_size_without_object_header(klass) != expected_size)
+    {
+        RET_OK(false);
+    }
+
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(VectorCallShape, shape, get_vector_call_shape(method, klass));
+    if (shape == VectorCallShape::Unknown)
+    {
+        RET_OK(false);
+    }
+
+    OpCodeEnum opcode = OpCodeEnum::Illegal;
+    if (lanes == 0)
+    {
+        const metadata::RtGenericInst* class_inst = klass->by_val->data.generic_class->class_inst;
+        if (shape == VectorCallShape::VV && class_inst->generic_arg_count == 1)
+        {
+            opcode = get_generic_vector_opcode(method->name, class_inst->generic_args[0]->ele_type);
+        }
+    }
+    else
+    {
+        for (const VectorCallLowering& lowering : s_vector_call_lowerings)
+        {
+            if (lowering.shape == shape && std::strcmp(lowering.method_name, method->name) == 0)
+            {
+                opcode = lanes == 2 ? lowering.op_x2 : lanes == 3 ? lowering.op_x3 : lowering.op_x4;
+                break;
+            }
+        }
+    }
+    if (opcode == OpCodeEnum::Illegal)
+    {
+        RET_OK(false);
+    }
+
+    const Variable* const* params = ll_inst->get_params();
+    const Variable* ret = ll_inst->get_var_ret();
+    switch (shape)
+    {
+    case VectorCallShape::V:
+    case VectorCallShape::This:
+        ll_inst->update_var_src(params[0]);
+        break;
+    case VectorCallShape::SV:
+        ll_inst->update_var_arg1(params[1]);
+        ll_inst->update_var_arg2(params[0]);
+        break;
+    case VectorCallShape::VVS:
+    case VectorCallShape::VVV:
+        ll_inst->update_var_arg3(params[2]);
+        ll_inst->update_var_arg1(params[0]);
+        ll_inst->update_var_arg2(params[1]);
+        break;
+    default:
+        ll_inst->update_var_arg1(params[0]);
+        ll_inst->update_var_arg2(params[1]);
+        break;
+    }
+    ll_inst->update_var_dst(ret);
+    ll_inst->set_opcode(opcode);
+    RET_OK(true);
+}
+
+// Operand kind of the Math/MathF overloads lowered to LL opcodes. Small integers are widened on
+// the eval stack, so Min/Max over them share the 32-bit opcodes.
+enum class MathOperandKind
+{
+    Unknown,
+    I4,
+    U4,
+    I8,
+    U8,
+    R4,
+    R8,
+};
+
+static MathOperandKind get_math_operand_kind(metadata::RtElementType ele_type)
+{
+    switch (ele_type)
+    {
+    case metadata::RtElementType::I1:
+    case metadata::RtElementType::I2:
+    case metadata::RtElementType::U1:
+    case metadata::RtElementType::U2:
+    case metadata::RtElementType::I4:
+        return MathOperandKind::I4;
+    case metadata::RtElementType::U4:
+        return MathOperandKind::U4;
+    case metadata::RtElementType::I8:
+        return MathOperandKind::I8;
+    case metadata::RtElementType::U8:
+        return MathOperandKind::U8;
+    case metadata::RtElementType::I:
+        return utils::Platform::select_arch(MathOperandKind::I4, MathOperandKind::I8);
+    case metadata::RtElementType::U:
+        return utils::Platform::select_arch(MathOperandKind::U4, MathOperandKind::U8);
+    case metadata::RtElementType::R4:
+        return MathOperandKind::R4;
+    case metadata::RtElementType::R8:
+        return MathOperandKind::R8;
+    default:
+        return MathOperandKind::Unknown;
+    }
+}
+
+static OpCodeEnum select_math_opcode(MathOperandKind kind, OpCodeEnum op_i4, OpCodeEnum op_u4, OpCodeEnum op_i8, OpCodeEnum op_u8, OpCodeEnum op_r4,
+                                     OpCodeEnum op_r8)
+{
+    switch (kind)
+    {
+    case MathOperandKind::I4:
+        return op_i4;
+    case MathOperandKind::U4:
+        return op_u4;
+    case MathOperandKind::I8:
+        return op_i8;
+    case MathOperandKind::U8:
+        return op_u8;
+    case MathOperandKind::R4:
+        return op_r4;
+    case MathOperandKind::R8:
+        return op_r8;
+    default:
+        return OpCodeEnum::Illegal;
+    }
+}
+
+bool Transformer::transform_math_call_methods(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst)
+{
+    const metadata::RtMethodInfo* method = hl_inst->get_method();
+    const char* method_name = method->name;
+    size_t param_count = static_cast<size_t>(method->parameter_count);
+    if (param_count == 0 || param_count > 3 || !vm::Method::is_static(method))
+    {
+        return false;
+    }
+    MathOperandKind kind = get_math_operand_kind(method->parameters[0]->ele_type);
+    for (size_t i = 1; i < param_count; ++i)
+    {
+        if (method->parameters[i]->ele_type != method->parameters[0]->ele_type)
+        {
+            return false;
+        }
+    }
+    if (method->parameters[0]->by_ref || method->return_type->ele_type != method->parameters[0]->ele_type)
+    {
+        return false;
+    }
+
+    const OpCodeEnum x = OpCodeEnum::Illegal;
+    OpCodeEnum opcode = OpCodeEnum::Illegal;
+    if (param_count == 1)
+    {
+        // Abs(Int16/SByte) must throw for their own MinValue, so only the 32/64-bit overloads are lowered.
+        metadata::RtElementType ele_type = method->parameters[0]->ele_type;
+        bool is_full_width = ele_type == metadata::RtElementType::I4 || ele_type == metadata::RtElementType::I8 ||
+                             ele_type == metadata::RtElementType::R4 || ele_type == metadata::RtElementType::R8;
+        if (std::strcmp(method_name, "Abs") == 0 && is_full_width)
+            opcode = select_math_opcode(kind, OpCodeEnum::AbsI4, x, OpCodeEnum::AbsI8, x, OpCodeEnum::AbsR4, OpCodeEnum::AbsR8);
+        else if (std::strcmp(method_name, "Sqrt") == 0)
+            opcode = select_math_opcode(kind, x, x, x, x, OpCodeEnum::SqrtR4, OpCodeEnum::SqrtR8);
+        else if (std::strcmp(method_name, "Floor") == 0)
+            opcode = select_math_opcode(kind, x, x, x, x, OpCodeEnum::FloorR4, OpCodeEnum::FloorR8);
+        else if (std::strcmp(method_name, "Ceiling") == 0)
+            opcode = select_math_opcode(kind, x, x, x, x, OpCodeEnum::CeilR4, OpCodeEnum::CeilR8);
+        else if (std::strcmp(method_name, "Round") == 0)
+            opcode = select_math_opcode(kind, x, x, x, x, OpCodeEnum::RoundR4, OpCodeEnum::RoundR8);
+    }
+    else if (param_count == 2)
+    {
+        if (std::strcmp(method_name, "Min") == 0)
+            opcode = select_math_opcode(kind, OpCodeEnum::MinI4, OpCodeEnum::MinU4, OpCodeEnum::MinI8, OpCodeEnum::MinU8, OpCodeEnum::MinR4,
+                                        OpCodeEnum::MinR8);
+        else if (std::strcmp(method_name, "Max") == 0)
+            opcode = select_math_opcode(kind, OpCodeEnum::MaxI4, OpCodeEnum::MaxU4, OpCodeEnum::MaxI8, OpCodeEnum::MaxU8, OpCodeEnum::MaxR4,
+                                        OpCodeEnum::MaxR8);
+    }
+    else if (std::strcmp(method_name, "FusedMultiplyAdd") == 0)
+    {
+        opcode = select_math_opcode(kind, x, x, x, x, OpCodeEnum::FmaR4, OpCodeEnum::FmaR8);
+    }
+    if (opcode == OpCodeEnum::Illegal)
+    {
+        return false;
+    }
+
+    const Variable* const* params = ll_inst->get_params();
+    const Variable* ret = ll_inst->get_var_ret();
+    switch (param_count)
+    {
+    case 1:
+        ll_inst->update_var_src(params[0]);
+        break;
+    case 3:
+        ll_inst->update_var_arg3(params[2]);
+        ll_inst->update_var_arg1(params[0]);
+        ll_inst->update_var_arg2(params[1]);
+        break;
+    default:
+        ll_inst->update_var_arg1(params[0]);
+        ll_inst->update_var_arg2(params[1]);
+        break;
+    }
+    ll_inst->update_var_dst(ret);
+    ll_inst->set_opcode(opcode);
+    return true;
+}
+
+// Rank-2 and rank-3 Get/Set/Address run inline instead of through the array invokers. The opcodes read the call
+// arguments in place, so only the frame base set up by the call is kept. Struct elements and reference stores,
+// which need the covariance check, keep the call.
+RtResult<bool> Transformer::transform_mdarray_call_methods(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst)
+{
+    const metadata::RtMethodInfo* method = hl_inst->get_method();
+    metadata::RtClass* klass = method->parent;
+    uint8_t rank = vm::Class::get_rank(klass);
+    if (rank != 2 && rank != 3)
+    {
+        RET_OK(false);
+    }
+    const bool md2 = rank == 2;
+    const char* method_name = method->name;
+
+    OpCodeEnum opcode = OpCodeEnum::Illegal;
+    if (std::strcmp(method_name, STR_ARRAY_GET_NZ) == 0)
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(ReduceTypeAndSize, ele_type, InterpDefs::get_reduce_type_and_size_by_typesig(method->return_type));
+        switch (ele_type.reduce_type)
+        {
+        case metadata::RtArgOrLocOrFieldReduceType::I1:
+            opcode = md2 ? OpCodeEnum::LdelemMD2I1 : OpCodeEnum::LdelemMD3I1;
+            break;
+        case metadata::RtArgOrLocOrFieldReduceType::U1:
+            opcode = md2 ? OpCodeEnum::LdelemMD2U1 : OpCodeEnum::LdelemMD3U1;
+            break;
+        case metadata::RtArgOrLocOrFieldReduceType::I2:
+            opcode = md2 ? OpCodeEnum::LdelemMD2I2 : OpCodeEnum::LdelemMD3I2;
+            break;
+        case metadata::RtArgOrLocOrFieldReduceType::U2:
+            opcode = md2 ? OpCodeEnum::LdelemMD2U2 : OpCodeEnum::LdelemMD3U2;
+            break;
+        case metadata::RtArgOrLocOrFieldReduceType::I4:
+        case metadata::RtArgOrLocOrFieldReduceType::R4:
+            opcode = md2 ? OpCodeEnum::LdelemMD2I4 : OpCodeEnum::LdelemMD3I4;
+            break;
+        case metadata::RtArgOrLocOrFieldReduceType::I8:
+        case metadata::RtArgOrLocOrFieldReduceType::R8:
+            opcode = md2 ? OpCodeEnum::LdelemMD2I8 : OpCodeEnum::LdelemMD3I8;
+            break;
+        case metadata::RtArgOrLocOrFieldReduceType::I:
+        case metadata::RtArgOrLocOrFieldReduceType::Ref:
+            opcode = md2 ? OpCodeEnum::LdelemMD2I : OpCodeEnum::LdelemMD3I;
+            break;
+        default:
+            break;
+        }
+    }
+    else if (std::strcmp(method_name, STR_ARRAY_SET_NZ) == 0)
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(ReduceTypeAndSize, ele_type, InterpDefs::get_reduce_type_and_size_by_typesig(method->parameters[rank]));
+        switch (ele_type.reduce_type)
+        {
+        case metadata::RtArgOrLocOrFieldReduceType::I1:
+        case metadata::RtArgOrLocOrFieldReduceType::U1:
+            opcode = md2 ? OpCodeEnum::StelemMD2I1 : OpCodeEnum::StelemMD3I1;
+            break;
+        case metadata::RtArgOrLocOrFieldReduceType::I2:
+        case metadata::RtArgOrLocOrFieldReduceType::U2:
+            opcode = md2 ? OpCodeEnum::StelemMD2I2 : OpCodeEnum::StelemMD3I2;
+            break;
+        case metadata::RtArgOrLocOrFieldReduceType::I4:
+        case metadata::RtArgOrLocOrFieldReduceType::R4:
+            opcode = md2 ? OpCodeEnum::StelemMD2I4 : OpCodeEnum::StelemMD3I4;
+            break;
+        case metadata::RtArgOrLocOrFieldReduceType::I8:
+        case metadata::RtArgOrLocOrFieldReduceType::R8:
+            opcode = md2 ? OpCodeEnum::StelemMD2I8 : OpCodeEnum::StelemMD3I8;
+            break;
+        case metadata::RtArgOrLocOrFieldReduceType::I:
+            opcode = md2 ? OpCodeEnum::StelemMD2I : OpCodeEnum::StelemMD3I;
+            break;
+        default:
+            break;
+        }
+    }
+    else if (std::strcmp(method_name, STR_ARRAY_ADDRESS_NZ) == 0 && vm::Class::is_value_type(klass->element_class))
+    {
+        opcode = md2 ? OpCodeEnum::LdelemaMD2 : OpCodeEnum::LdelemaMD3;
+    }
+    if (opcode == OpCodeEnum::Illegal)
+    {
+        RET_OK(false);
+    }
+    ll_inst->set_opcode(opcode);
+    RET_OK(true);
+}
+
 RtResult<bool> Transformer::transform_special_call_methods(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst)
 {
     const metadata::RtMethodInfo* method = hl_inst->get_method();
     metadata::RtClass* klass = method->parent;
 
+    if (vm::Class::is_array_or_szarray(klass))
+    {
+        return transform_mdarray_call_methods(ll_inst, hl_inst);
+    }
+
+    if (std::strcmp(klass->namespaze, "System.Numerics") == 0 && is_numerics_vector_image(klass->image))
+    {
+        return transform_numerics_vector_call_methods(ll_inst, hl_inst);
+    }
+
     if (!klass->image->is_corlib())
     {
         RET_OK(false);
     }
 
+    if (std::strcmp(klass->namespaze, "System") == 0 && (std::strcmp(klass->name, "Math") == 0 || std::strcmp(klass->name, "MathF") == 0))
+    {
+        RET_OK(transform_math_call_methods(ll_inst, hl_inst));
+    }
+
     ll_inst->set_opcode(OpCodeEnum::Illegal);
 
     const vm::CorLibTypes& corlib_types = vm::Class::get_corlib_types();
@@ -607,6 +1122,102 @@ RtResult<bool> Transformer::transform_special_newobj_methods(GeneralInst* ll_ins
     RET_OK(ll_inst->get_opcode() != OpCodeEnum::Illegal);
 }
 
+#if LEANCLR_ENABLE_DYNAMIC_PINVOKE
+// Whether a P/Invoke argument or return value travels in a general purpose register as a whole word.
+// Small integer returns are left to the invoker, which normalizes them.
+static bool is_blittable_pinvoke_word(const metadata::RtTypeSig* type_sig, metadata::RtArgOrLocOrFieldReduceType reduce_type, bool is_return)
+{
+    if (type_sig->is_by_ref())
+    {
+        return !is_return;
+    }
+    switch (reduce_type)
+    {
+    case metadata::RtArgOrLocOrFieldReduceType::I1:
+    case metadata::RtArgOrLocOrFieldReduceType::U1:
+    case metadata::RtArgOrLocOrFieldReduceType::I2:
+    case metadata::RtArgOrLocOrFieldReduceType::U2:
+        return !is_return;
+    case metadata::RtArgOrLocOrFieldReduceType::I4:
+    case metadata::RtArgOrLocOrFieldReduceType::I:
+        return true;
+    case metadata::RtArgOrLocOrFieldReduceType::I8:
+        return utils::Platform::select_arch(false, true);
+    default:
+        return false;
+    }
+}
+
+static OpCodeEnum get_blittable_pinvoke_float_opcode(metadata::RtArgOrLocOrFieldReduceType ret_type, const metadata::RtMethodInfo* method)
+{
+    if (ret_type != metadata::RtArgOrLocOrFieldReduceType::R4 && ret_type != metadata::RtArgOrLocOrFieldReduceType::R8)
+    {
+        return OpCodeEnum::Illegal;
+    }
+    if (method->parameter_count < 1 || method->parameter_count > 2)
+    {
+        return OpCodeEnum::Illegal;
+    }
+    for (uint16_t i = 0; i < method->parameter_count; ++i)
+    {
+        if (method->parameters[i]->is_by_ref() || method->arg_descs[i].reduce_type != ret_type)
+        {
+            return OpCodeEnum::Illegal;
+        }
+    }
+    if (ret_type == metadata::RtArgOrLocOrFieldReduceType::R4)
+    {
+        return method->parameter_count == 1 ? OpCodeEnum::CallPInvokeBlittableR4R4 : OpCodeEnum::CallPInvokeBlittableR4R4R4;
+    }
+    return method->parameter_count == 1 ? OpCodeEnum::CallPInvokeBlittableR8R8 : OpCodeEnum::CallPInvokeBlittableR8R8R8;
+}
+
+RtResult<bool> Transformer::transform_blittable_pinvoke(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst)
+{
+    const metadata::RtMethodInfo* method = hl_inst->get_method();
+    // Only the signature decides: the opcodes bind the method and run the static constructor when first executed.
+    if (method->invoker_type != metadata::RtInvokerType::DynamicPInvoke)
+    {
+        RET_OK(false);
+    }
+    // SetLastError methods go through their invoker, which keeps the error code of the call. A method without
+    // an ImplMap is left to CallPInvoke, which reports it when called.
+    auto direct_callable = vm::PInvokes::is_direct_callable(method);
+    if (direct_callable.is_err() || !direct_callable.unwrap())
+    {
+        RET_OK(false);
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(ReduceTypeAndSize, ret_type, InterpDefs::get_reduce_type_and_size_by_typesig(method->return_type));
+
+    OpCodeEnum opcode = get_blittable_pinvoke_float_opcode(ret_type.reduce_type, method);
+    // Word signatures are limited to the arguments every supported ABI passes in registers, so that the
+    // native callee cannot tell them from its declared types.
+    if (opcode == OpCodeEnum::Illegal && method->parameter_count <= 4)
+    {
+        bool all_words = true;
+        for (uint16_t i = 0; i < method->parameter_count && all_words; ++i)
+        {
+            all_words = is_blittable_pinvoke_word(method->parameters[i], method->arg_descs[i].reduce_type, false);
+        }
+        if (all_words && ret_type.reduce_type == metadata::RtArgOrLocOrFieldReduceType::Void)
+        {
+            opcode = static_cast<OpCodeEnum>(static_cast<uint32_t>(OpCodeEnum::CallPInvokeBlittableV0) + method->parameter_count);
+        }
+        else if (all_words && is_blittable_pinvoke_word(method->return_type, ret_type.reduce_type, true))
+        {
+            opcode = static_cast<OpCodeEnum>(static_cast<uint32_t>(OpCodeEnum::CallPInvokeBlittableW0) + method->parameter_count);
+        }
+    }
+    if (opcode == OpCodeEnum::Illegal)
+    {
+        RET_OK(false);
+    }
+    ll_inst->set_opcode(opcode);
+    setup_inst_method(ll_inst, hl_inst);
+    RET_OK(true);
+}
+#endif
+
 RtResultVoid Transformer::transform_instructions()
 {
     BasicBlock* cur_bb = _bb_head;
@@ -792,7 +1403,7 @@ RtResultVoid Transformer::transform_instructions()
 
             case hl::OpCodeEnum::LdStr:
                 ll_inst->set_opcode(OpCodeEnum::LdStr);
-                setup_inst_resolved_data(ll_inst, hl_inst->get_user_string());
+                setup_inst_resolved_data(ll_inst, hl_inst->get_user_string(), RtResolvedDataKind::Literal);
                 break;
 
             case hl::OpCodeEnum::Dup:
@@ -1411,7 +2022,7 @@ RtResultVoid Transformer::transform_instructions()
                 ll_inst->set_opcode(OpCodeEnum::NewArr);
                 metadata::RtClass* ele_klass = hl_inst->get_class();
                 DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, arr_klass, vm::ArrayClass::get_szarray_class_from_element_class(ele_klass));
-                setup_inst_resolved_data(ll_inst, arr_klass);
+                setup_inst_resolved_data(ll_inst, arr_klass, RtResolvedDataKind::Class);
                 break;
             }
 
@@ -1425,43 +2036,43 @@ RtResultVoid Transformer::transform_instructions()
                 break;
 
             case hl::OpCodeEnum::LdelemI1:
-                ll_inst->set_opcode(OpCodeEnum::LdelemI1);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::LdelemI1Unchecked : OpCodeEnum::LdelemI1);
                 break;
 
             case hl::OpCodeEnum::LdelemU1:
-                ll_inst->set_opcode(OpCodeEnum::LdelemU1);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::LdelemU1Unchecked : OpCodeEnum::LdelemU1);
                 break;
 
             case hl::OpCodeEnum::LdelemI2:
-                ll_inst->set_opcode(OpCodeEnum::LdelemI2);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::LdelemI2Unchecked : OpCodeEnum::LdelemI2);
                 break;
 
             case hl::OpCodeEnum::LdelemU2:
-                ll_inst->set_opcode(OpCodeEnum::LdelemU2);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::LdelemU2Unchecked : OpCodeEnum::LdelemU2);
                 break;
 
             case hl::OpCodeEnum::LdelemI4:
-                ll_inst->set_opcode(OpCodeEnum::LdelemI4);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::LdelemI4Unchecked : OpCodeEnum::LdelemI4);
                 break;
 
             case hl::OpCodeEnum::LdelemI8:
-                ll_inst->set_opcode(OpCodeEnum::LdelemI8);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::LdelemI8Unchecked : OpCodeEnum::LdelemI8);
                 break;
 
             case hl::OpCodeEnum::LdelemI:
-                ll_inst->set_opcode(OpCodeEnum::LdelemI);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::LdelemIUnchecked : OpCodeEnum::LdelemI);
                 break;
 
             case hl::OpCodeEnum::LdelemR4:
-                ll_inst->set_opcode(OpCodeEnum::LdelemR4);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::LdelemI4Unchecked : OpCodeEnum::LdelemR4);
                 break;
 
             case hl::OpCodeEnum::LdelemR8:
-                ll_inst->set_opcode(OpCodeEnum::LdelemR8);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::LdelemI8Unchecked : OpCodeEnum::LdelemR8);
                 break;
 
             case hl::OpCodeEnum::LdelemRef:
-                ll_inst->set_opcode(OpCodeEnum::LdelemRef);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::LdelemIUnchecked : OpCodeEnum::LdelemRef);
                 break;
 
             case hl::OpCodeEnum::LdelemAny:
@@ -1474,31 +2085,31 @@ RtResultVoid Transformer::transform_instructions()
             }
 
             case hl::OpCodeEnum::StelemI1:
-                ll_inst->set_opcode(OpCodeEnum::StelemI1);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::StelemI1Unchecked : OpCodeEnum::StelemI1);
                 break;
 
             case hl::OpCodeEnum::StelemI2:
-                ll_inst->set_opcode(OpCodeEnum::StelemI2);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::StelemI2Unchecked : OpCodeEnum::StelemI2);
                 break;
 
             case hl::OpCodeEnum::StelemI4:
-                ll_inst->set_opcode(OpCodeEnum::StelemI4);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::StelemI4Unchecked : OpCodeEnum::StelemI4);
                 break;
 
             case hl::OpCodeEnum::StelemI8:
-                ll_inst->set_opcode(OpCodeEnum::StelemI8);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::StelemI8Unchecked : OpCodeEnum::StelemI8);
                 break;
 
             case hl::OpCodeEnum::StelemI:
-                ll_inst->set_opcode(OpCodeEnum::StelemI);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::StelemIUnchecked : OpCodeEnum::StelemI);
                 break;
 
             case hl::OpCodeEnum::StelemR4:
-                ll_inst->set_opcode(OpCodeEnum::StelemR4);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::StelemI4Unchecked : OpCodeEnum::StelemR4);
                 break;
 
             case hl::OpCodeEnum::StelemR8:
-                ll_inst->set_opcode(OpCodeEnum::StelemR8);
+                ll_inst->set_opcode(_array_bounds_analysis.is_in_bounds(hl_inst) ? OpCodeEnum::StelemI8Unchecked : OpCodeEnum::StelemR8);
                 break;
 
             case hl::OpCodeEnum::StelemRef:
@@ -1530,9 +2141,15 @@ RtResultVoid Transformer::transform_instructions()
                 break;
 
             case hl::OpCodeEnum::LdToken:
+            {
                 ll_inst->set_opcode(OpCodeEnum::LdToken);
-                setup_inst_resolved_data(ll_inst, (const void*)hl_inst->get_runtime_handle().get_handle_without_type());
+                metadata::RtRuntimeHandle handle = metadata::RtEncodedRuntimeHandle::decode(hl_inst->get_runtime_handle());
+                RtResolvedDataKind kind = handle.is_type() ? RtResolvedDataKind::TypeSig
+                                          : handle.is_method() ? RtResolvedDataKind::Method
+                                                               : RtResolvedDataKind::Field;
+                setup_inst_resolved_data(ll_inst, handle.value, kind);
                 break;
+            }
 
             case hl::OpCodeEnum::Ckfinite:
             {
@@ -1865,7 +2482,7 @@ RtResultVoid Transformer::transform_instructions()
                     RET_ERR(core::RtErr::NotImplemented);
                 }
                 ll_inst->set_opcode(op);
-                setup_inst_resolved_data(ll_inst, field);
+                setup_inst_static_field(ll_inst, field);
                 break;
             }
 
@@ -1876,12 +2493,12 @@ RtResultVoid Transformer::transform_instructions()
                 {
                     ll_inst->set_opcode(OpCodeEnum::LdsfldRvaData);
                     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const uint8_t*, rva_data, vm::Field::get_field_rva_data(field));
-                    setup_inst_resolved_data(ll_inst, rva_data);
+                    setup_inst_resolved_data(ll_inst, rva_data, RtResolvedDataKind::Literal);
                 }
                 else
                 {
                     ll_inst->set_opcode(OpCodeEnum::Ldsflda);
-                    setup_inst_resolved_data(ll_inst, field);
+                    setup_inst_static_field(ll_inst, field);
                 }
                 break;
             }
@@ -1920,7 +2537,7 @@ RtResultVoid Transformer::transform_instructions()
                     RET_ERR(core::RtErr::NotImplemented);
                 }
                 ll_inst->set_opcode(op);
-                setup_inst_resolved_data(ll_inst, field);
+                setup_inst_static_field(ll_inst, field);
                 break;
             }
 
@@ -1963,9 +2580,18 @@ RtResultVoid Transformer::transform_instructions()
             }
 
             case hl::OpCodeEnum::CallPInvoke:
+            {
+#if LEANCLR_ENABLE_DYNAMIC_PINVOKE
+                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, handled, transform_blittable_pinvoke(ll_inst, hl_inst));
+                if (handled)
+                {
+                    break;
+                }
+#endif
                 ll_inst->set_opcode(OpCodeEnum::CallPInvoke);
                 setup_inst_method(ll_inst, hl_inst);
                 break;
+            }
 
             case hl::OpCodeEnum::CallRuntimeImplemented:
                 ll_inst->set_opcode(OpCodeEnum::CallRuntimeImplemented);
@@ -1974,7 +2600,7 @@ RtResultVoid Transformer::transform_instructions()
 
             case hl::OpCodeEnum::Calli:
                 ll_inst->set_opcode(OpCodeEnum::CalliInterp);
-                setup_inst_method(ll_inst, hl_inst);
+                setup_inst_resolved_data(ll_inst, hl_inst->get_method_sig(), RtResolvedDataKind::Literal);
                 break;
 
             case hl::OpCodeEnum::NewObj:
@@ -2010,12 +2636,12 @@ RtResultVoid Transformer::transform_instructions()
 
             case hl::OpCodeEnum::Ldftn:
                 ll_inst->set_opcode(OpCodeEnum::Ldftn);
-                setup_inst_resolved_data(ll_inst, hl_inst->get_method());
+                setup_inst_resolved_data(ll_inst, hl_inst->get_method(), RtResolvedDataKind::Method);
                 break;
 
             case hl::OpCodeEnum::Ldvirtftn:
                 ll_inst->set_opcode(OpCodeEnum::Ldvirtftn);
-                setup_inst_resolved_data(ll_inst, hl_inst->get_method());
+                setup_inst_resolved_data(ll_inst, hl_inst->get_method(), RtResolvedDataKind::Method);
                 break;
 
             case hl::OpCodeEnum::Throw:
@@ -2134,8 +2760,8 @@ RtResultVoid Transformer::build_exception_clauses(RtInterpMethodInfo* interp_met
         RET_ERR(core::RtErr::ExecutionEngine);
     }
 
-    metadata::RtModuleDef* ass = _hl_transformer.get_module();
-    RtInterpExceptionClause* exception_clauses = ass->get_mem_pool().calloc_any<RtInterpExceptionClause>(exception_clause_count);
+    alloc::MemPool& pool = vm::Method::get_code_mem_pool(_hl_transformer.get_method_info());
+    RtInterpExceptionClause* exception_clauses = pool.calloc_any<RtInterpExceptionClause>(exception_clause_count);
     interp_method->exception_clauses = exception_clauses;
     interp_method->exception_clause_count = static_cast<uint8_t>(exception_clause_count);
 
@@ -2155,11 +2781,7 @@ RtResultVoid Transformer::build_exception_clauses(RtInterpMethodInfo* interp_met
         else if (src.flags == metadata::RtILExceptionClauseType::Exception)
         {
             filter_begin_offset = 0;
-            metadata::RtToken token = metadata::RtToken::decode(src.class_token_or_filter_offset);
-            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(
-                const metadata::RtTypeSig*, final_type_sig,
-                ass->get_typesig_by_type_def_ref_spec_token(token, _hl_transformer.get_generic_container_context(), _hl_transformer.get_generic_context()));
-            UNWRAP_OR_RET_ERR_ON_FAIL(ex_klass, vm::Class::get_class_from_typesig(final_type_sig));
+            UNWRAP_OR_RET_ERR_ON_FAIL(ex_klass, _hl_transformer.get_class_from_token(src.class_token_or_filter_offset));
         }
         else
         {
@@ -2181,9 +2803,61 @@ RtResultVoid Transformer::build_exception_clauses(RtInterpMethodInfo* interp_met
         dst.ex_klass = ex_klass;
     }
 
+    if (exception_clause_count > 0)
+    {
+        build_try_ranges(interp_method);
+        interp_method->handler_cache = pool.calloc_any<RtInterpHandlerCacheEntry>(INTERP_HANDLER_CACHE_SIZE);
+        Interpreter::register_handler_cache(_hl_transformer.get_method_info(), interp_method->handler_cache);
+    }
     RET_VOID_OK();
 }
 
+void Transformer::build_try_ranges(RtInterpMethodInfo* interp_method)
+{
+    alloc::MemPool& pool = vm::Method::get_code_mem_pool(_hl_transformer.get_method_info());
+    const RtInterpExceptionClause* clauses = interp_method->exception_clauses;
+    size_t clause_count = interp_method->exception_clause_count;
+
+    // Try blocks nest or are disjoint, so the set of covering clauses only changes at their boundaries.
+    utils::Vector<uint32_t> boundaries;
+    boundaries.reserve(clause_count * 2);
+    for (size_t i = 0; i < clause_count; ++i)
+    {
+        boundaries.push_back(clauses[i].try_begin_offset);
+        boundaries.push_back(clauses[i].try_end_offset);
+    }
+    std::sort(boundaries.begin(), boundaries.end());
+    uint32_t* boundaries_end = std::unique(boundaries.begin(), boundaries.end());
+    size_t boundary_count = static_cast<size_t>(boundaries_end - boundaries.begin());
+
+    utils::Vector<RtInterpTryRange> ranges;
+    utils::Vector<uint8_t> range_clauses;
+    for (size_t i = 0; i + 1 < boundary_count; ++i)
+    {
+        RtInterpTryRange range = {boundaries[i], boundaries[i + 1], static_cast<uint32_t>(range_clauses.size()), 0};
+        for (size_t j = 0; j < clause_count; ++j)
+        {
+            if (clauses[j].is_in_try_block(range.begin_offset))
+            {
+                range_clauses.push_back(static_cast<uint8_t>(j));
+                ++range.clause_count;
+            }
+        }
+        if (range.clause_count > 0)
+        {
+            ranges.push_back(range);
+        }
+    }
+
+    RtInterpTryRange* try_ranges = pool.calloc_any<RtInterpTryRange>(ranges.size());
+    std::memcpy(try_ranges, ranges.data(), ranges.size() * sizeof(RtInterpTryRange));
+    uint8_t* try_range_clauses = pool.calloc_any<uint8_t>(range_clauses.size());
+    std::memcpy(try_range_clauses, range_clauses.data(), range_clauses.size());
+    interp_method->try_ranges = try_ranges;
+    interp_method->try_range_clauses = try_range_clauses;
+    interp_method->try_range_count = static_cast<uint32_t>(ranges.size());
+}
+
 RtResult<uint32_t> Transformer::translate_il_offset_to_ir_offset(uint32_t il_offset)
 {
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const hl::BasicBlock*, hl_bb, _hl_transformer.get_branch_target_bb(static_cast<size_t>(il_offset)));
@@ -2199,7 +2873,7 @@ RtResult<uint32_t> Transformer::translate_il_offset_to_ir_offset(uint32_t il_off
 
 RtResultVoid Transformer::build_codes(RtInterpMethodInfo* interp_method)
 {
-    metadata::RtModuleDef* mod = _hl_transformer.get_module();
+    alloc::MemPool& pool = vm::Method::get_code_mem_pool(_hl_transformer.get_method_info());
 
     // First pass: calculate total size and set offsets
     size_t total_ir_size = 0;
@@ -2218,8 +2892,26 @@ RtResultVoid Transformer::build_codes(RtInterpMethodInfo* interp_method)
 
     interp_method->code_size = static_cast<uint32_t>(total_ir_size);
 
+    // Lets profilers and stack walks map a saved ip back to IL at basic block granularity.
+    size_t bb_count = 0;
+    for (BasicBlock* cur_bb = _bb_head; cur_bb != nullptr; cur_bb = cur_bb->next_bb)
+    {
+        ++bb_count;
+    }
+    if (bb_count > 0)
+    {
+        RtInterpIlMapEntry* il_map = pool.calloc_any<RtInterpIlMapEntry>(bb_count);
+        size_t index = 0;
+        for (BasicBlock* cur_bb = _bb_head; cur_bb != nullptr; cur_bb = cur_bb->next_bb)
+        {
+            il_map[index++] = {static_cast<uint32_t>(cur_bb->ir_offset), static_cast<uint32_t>(cur_bb->hl_bb->il_begin_offset)};
+        }
+        interp_method->il_map = il_map;
+        interp_method->il_map_count = static_cast<uint32_t>(bb_count);
+    }
+
     // Second pass: write instructions
-    uint8_t* codes = (uint8_t*)mod->get_mem_pool().calloc_any<uint8_t>(total_ir_size);
+    uint8_t* codes = (uint8_t*)pool.calloc_any<uint8_t>(total_ir_size);
     interp_method->codes = codes;
 
     uint8_t* codes_cur = codes;
@@ -2238,6 +2930,7 @@ RtResultVoid Transformer::build_codes(RtInterpMethodInfo* interp_method)
 RtResultVoid Transformer::transform()
 {
     RET_ERR_ON_FAIL(transform_basic_blocks());
+    _array_bounds_analysis.analyze();
     RET_ERR_ON_FAIL(transform_instructions());
     RET_ERR_ON_FAIL(optimize_short_instructions());
     RET_VOID_OK();
@@ -2246,8 +2939,7 @@ RtResultVoid Transformer::transform()
 RtResult<const RtInterpMethodInfo*> Transformer::build_interp_method_info()
 {
     const metadata::RtMethodInfo* method = _hl_transformer.get_method_info();
-    metadata::RtModuleDef* mod = _hl_transformer.get_module();
-    alloc::MemPool& pool = mod->get_mem_pool();
+    alloc::MemPool& pool = vm::Method::get_code_mem_pool(method);
 
     RtInterpMethodInfo* interp_method = pool.malloc_any_zeroed<RtInterpMethodInfo>();
 
@@ -2264,8 +2956,37 @@ RtResult<const RtInterpMethodInfo*> Transformer::build_interp_method_info()
 
     RET_ERR_ON_FAIL(build_codes(interp_method));
     RET_ERR_ON_FAIL(build_exception_clauses(interp_method));
+    if (_hl_transformer.is_shared_generic_body())
+    {
+        build_shared_body(interp_method);
+    }
 
     RET_OK(interp_method);
 }
 
+void Transformer::build_shared_body(RtInterpMethodInfo* interp_method)
+{
+    alloc::MemPool& pool = vm::Method::get_code_mem_pool(_hl_transformer.get_method_info());
+    RtInterpSharedBody* shared_body = pool.malloc_any_zeroed<RtInterpSharedBody>();
+
+    const auto& handles = _hl_transformer.get_resolved_runtime_handles();
+    uint32_t* tokens = pool.calloc_any<uint32_t>(handles.size());
+    uint32_t token_count = 0;
+    for (const auto& it : handles)
+    {
+        tokens[token_count++] = it.first;
+    }
+    shared_body->tokens = tokens;
+    shared_body->token_count = token_count;
+
+    if (!_resolved_data_kinds.empty())
+    {
+        RtResolvedDataKind* kinds = pool.calloc_any<RtResolvedDataKind>(_resolved_data_kinds.size());
+        std::memcpy(kinds, _resolved_data_kinds.data(), _resolved_data_kinds.size() * sizeof(RtResolvedDataKind));
+        shared_body->resolved_data_kinds = kinds;
+    }
+    shared_body->resolved_data_count = static_cast<uint32_t>(_resolved_data_kinds.size());
+    interp_method->shared_body = shared_body;
+}
+
 } // namespace leanclr::interp::ll
@@ -2,6 +2,7 @@
 
 #include "transform_defs.h"
 #include "ll_opcodes.h"
+#include "array_bounds_analysis.h"
 #include "utils/not_free_list.h"
 #include "utils/hashmap.h"
 
@@ -98,6 +99,11 @@ struct GeneralInst
         arg2.var = arg;
     }
 
+    void update_var_arg3(const interp::Variable* arg)
+    {
+        arg3.var = arg;
+    }
+
     void set_var_src_invalid()
     {
         arg1_or_src.var = nullptr;
@@ -438,7 +444,8 @@ struct GeneralInst
 class Transformer
 {
   public:
-    Transformer(hl::Transformer& hl_trans, alloc::MemPool& mem_pool) : _hl_transformer(hl_trans), _mem_pool(mem_pool), _resolved_datas(&mem_pool)
+    Transformer(hl::Transformer& hl_trans, alloc::MemPool& mem_pool)
+        : _hl_transformer(hl_trans), _mem_pool(mem_pool), _array_bounds_analysis(hl_trans), _resolved_datas(&mem_pool), _resolved_data_kinds(&mem_pool)
     {
     }
 
@@ -456,16 +463,19 @@ class Transformer
 
     hl::Transformer& _hl_transformer;
     alloc::MemPool& _mem_pool;
+    ArrayBoundsAnalysis _array_bounds_analysis;
     utils::HashMap<const hl::BasicBlock*, BasicBlock*> _hl_2_ll_bb_map;
     BasicBlock* _bb_head = nullptr;
     utils::NotFreeList<const void*> _resolved_datas;
+    utils::NotFreeList<RtResolvedDataKind> _resolved_data_kinds;
     utils::HashMap<const void*, size_t> _resolved_data_2_index_map;
 
     // Helper functions
     RtResult<BasicBlock*> translate_hl_basic_to_ll_basic(const hl::BasicBlock* hl_bb);
     RtResultVoid transform_basic_blocks();
-    size_t get_resolved_data_index(const void* data);
-    void setup_inst_resolved_data(GeneralInst* ll_inst, const void* data);
+    size_t get_resolved_data_index(const void* data, RtResolvedDataKind kind);
+    void setup_inst_resolved_data(GeneralInst* ll_inst, const void* data, RtResolvedDataKind kind);
+    void setup_inst_static_field(GeneralInst* ll_inst, const metadata::RtFieldInfo* field);
     void setup_inst_klass(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst);
     void setup_inst_method(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst);
     utils::NotFreeList<size_t> find_finally_clause_idx_of_leave_target(const BasicBlock* leave_src, const BasicBlock* leave_target);
@@ -493,11 +503,19 @@ class Transformer
                                   OpCodeEnum opcode_r8);
 
     RtResult<bool> transform_special_call_methods(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst);
+    RtResult<bool> transform_numerics_vector_call_methods(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst);
+    bool transform_math_call_methods(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst);
+    RtResult<bool> transform_mdarray_call_methods(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst);
     RtResult<bool> transform_special_newobj_methods(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst);
+#if LEANCLR_ENABLE_DYNAMIC_PINVOKE
+    RtResult<bool> transform_blittable_pinvoke(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst);
+#endif
     RtResultVoid transform_instructions();
     RtResultVoid optimize_short_instructions();
     RtResultVoid build_exception_clauses(RtInterpMethodInfo* interp_method);
+    void build_try_ranges(RtInterpMethodInfo* interp_method);
     RtResult<uint32_t> translate_il_offset_to_ir_offset(uint32_t il_offset);
     RtResultVoid build_codes(RtInterpMethodInfo* interp_method);
+    void build_shared_body(RtInterpMethodInfo* interp_method);
 };
 } // namespace leanclr::interp::ll
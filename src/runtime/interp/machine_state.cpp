@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include "machine_state.h"
 
@@ -7,47 +9,147 @@
 
 namespace leanclr::interp
 {
+static uint32_t clamp_to_u32(size_t value)
+{
+    return static_cast<uint32_t>(value < UINT32_MAX ? value : UINT32_MAX);
+}
+
 void MachineState::initialize()
 {
     MachineState& ms = get_global_machine_state();
-    if (ms._eval_stack_base == nullptr)
+    if (ms._frame_segments == nullptr)
     {
-        size_t default_size = vm::Settings::get_default_eval_stack_object_count();
-        ms._eval_stack_base = alloc::GeneralAllocation::calloc_any<RtStackObject>(default_size);
-        assert(ms._eval_stack_base != nullptr);
-        ms._eval_stack_size = default_size;
+        ms._eval_stack_limit = clamp_to_u32(vm::Settings::get_default_eval_stack_object_count());
+        ms._frame_stack_limit = clamp_to_u32(vm::Settings::get_default_frame_stack_size());
+        ms._shrink_segments = vm::Settings::is_machine_stack_shrink_enabled();
+
+        // Frame segments hold a power of two frames, so that a frame index splits into segment and slot by shifting.
+        size_t frame_segment_size = std::max<size_t>(vm::Settings::get_frame_stack_segment_size(), 1);
+        while ((static_cast<size_t>(1) << ms._frame_segment_shift) < frame_segment_size && ms._frame_segment_shift < 31)
+        {
+            ++ms._frame_segment_shift;
+        }
+        ms._frame_segment_mask = (1u << ms._frame_segment_shift) - 1;
+        ms._frame_segment_count = static_cast<uint32_t>((static_cast<uint64_t>(ms._frame_stack_limit) + ms._frame_segment_mask) >> ms._frame_segment_shift);
+        ms._frame_segments = alloc::GeneralAllocation::calloc_any<InterpFrame*>(ms._frame_segment_count, alloc::MemoryCategory::MachineStacks);
+        assert(ms._frame_segments != nullptr || ms._frame_segment_count == 0);
     }
 
-    if (ms._frame_stack_base == nullptr)
+    if (ms._eval_segments.empty())
     {
-        size_t default_frame_size = vm::Settings::get_default_frame_stack_size();
-        ms._frame_stack_base = static_cast<InterpFrame*>(alloc::GeneralAllocation::malloc_zeroed(sizeof(InterpFrame) * default_frame_size));
-        assert(ms._frame_stack_base != nullptr);
-        ms._frame_stack_size = default_frame_size;
+        uint32_t capacity = std::min(clamp_to_u32(vm::Settings::get_eval_stack_segment_object_count()), ms._eval_stack_limit);
+        RtStackObject* base = alloc::GeneralAllocation::calloc_any<RtStackObject>(capacity, alloc::MemoryCategory::MachineStacks);
+        assert(base != nullptr);
+        ms._eval_segments.push_back({base, 0, capacity});
     }
 
-    ms._eval_stack_top = 0;
     ms._frame_stack_top = 0;
+    ms._eval_stack_top = 0;
+    ms._eval_segment_index = 0;
+    ms._eval_segment = ms._eval_segments[0];
 }
 
-RtResult<RtStackObject*> MachineState::alloc_eval_stack(uint32_t size)
+RtResult<RtStackObject*> MachineState::enter_next_eval_segment(uint32_t size)
 {
-    if (_eval_stack_top + size > _eval_stack_size)
+    uint32_t begin = _eval_segment.begin + _eval_segment.capacity;
+    if (size > _eval_stack_limit || begin > _eval_stack_limit - size)
     {
         RET_ERR(RtErr::StackOverflow);
     }
-    RtStackObject* ptr = _eval_stack_base + _eval_stack_top;
+    size_t next_index = _eval_segment_index + 1;
+    if (next_index < _eval_segments.size() && _eval_segments[next_index].capacity < size)
+    {
+        // Segments past the top are unused, and a segment too small to hold the frame would also break the
+        // contiguity of the index space of the ones after it.
+        while (_eval_segments.size() > next_index)
+        {
+            alloc::GeneralAllocation::free(_eval_segments.back().base, alloc::MemoryCategory::MachineStacks);
+            _eval_segments.pop_back();
+        }
+    }
+    if (next_index == _eval_segments.size())
+    {
+        uint32_t capacity = std::max(clamp_to_u32(vm::Settings::get_eval_stack_segment_object_count()), size);
+        capacity = std::min(capacity, _eval_stack_limit - begin);
+        RtStackObject* base = alloc::GeneralAllocation::calloc_any<RtStackObject>(capacity, alloc::MemoryCategory::MachineStacks);
+        if (base == nullptr)
+        {
+            RET_ERR(RtErr::OutOfMemory);
+        }
+        _eval_segments.push_back({base, begin, capacity});
+    }
+    _eval_segment_index = next_index;
+    _eval_segment = _eval_segments[next_index];
+    assert(_eval_segment.begin == begin);
+    _eval_stack_top = begin + size;
+    RET_OK(_eval_segment.base);
+}
+
+void MachineState::leave_eval_segments(uint32_t new_top)
+{
+    while (new_top <= _eval_segment.begin && _eval_segment_index > 0)
+    {
+        _eval_segment = _eval_segments[--_eval_segment_index];
+    }
+    if (_shrink_segments)
+    {
+        // One spare segment is kept, so that a call at a segment boundary does not allocate every time, and
+        // so that the return value of a frame entered from native code stays valid after the frame is left.
+        while (_eval_segments.size() > _eval_segment_index + 2)
+        {
+            alloc::GeneralAllocation::free(_eval_segments.back().base, alloc::MemoryCategory::MachineStacks);
+            _eval_segments.pop_back();
+        }
+    }
+}
+
+void MachineState::shrink_frame_segments()
+{
+    // Same policy as the eval stack: keep the segment holding the top and the one after it.
+    for (uint32_t i = (_frame_stack_top >> _frame_segment_shift) + 2; i < _frame_segment_count && _frame_segments[i]; ++i)
+    {
+        InterpFrame* segment = _frame_segments[i];
+        _frame_segments[i] = nullptr;
+        alloc::GeneralAllocation::free(segment, alloc::MemoryCategory::MachineStacks);
+    }
+}
+
+RtResult<RtStackObject*> MachineState::alloc_eval_stack(uint32_t size)
+{
+    uint32_t segment_end = _eval_segment.begin + _eval_segment.capacity;
+    if (size > segment_end - _eval_stack_top)
+    {
+        return enter_next_eval_segment(size);
+    }
+    RtStackObject* ptr = _eval_segment.base + (_eval_stack_top - _eval_segment.begin);
     _eval_stack_top += size;
     RET_OK(ptr);
 }
 
 RtResult<InterpFrame*> MachineState::alloc_frame_stack()
 {
-    if (_frame_stack_top + 1 > _frame_stack_size)
+    if (_frame_stack_top >= _frame_stack_limit)
     {
         RET_ERR(RtErr::StackOverflow);
     }
-    InterpFrame* ptr = _frame_stack_base + _frame_stack_top;
+    uint32_t segment_index = _frame_stack_top >> _frame_segment_shift;
+    if (_frame_segments[segment_index] == nullptr)
+    {
+        InterpFrame* segment =
+            static_cast<InterpFrame*>(alloc::GeneralAllocation::calloc(_frame_segment_mask + 1, sizeof(InterpFrame), alloc::MemoryCategory::MachineStacks));
+        if (segment == nullptr)
+        {
+            RET_ERR(RtErr::OutOfMemory);
+        }
+        _frame_segments[segment_index] = segment;
+    }
+    InterpFrame* ptr = get_frame(_frame_stack_top);
+    ptr->caller_frame_base = nullptr;
+    // A sampling signal handler may walk the frames as soon as the top moves, so the slot must not show the
+    // method and ip of its previous occupant, and the stores must not sink below the increment.
+    ptr->method = nullptr;
+    ptr->ip = nullptr;
+    std::atomic_signal_fence(std::memory_order_release);
     _frame_stack_top += 1;
     RET_OK(ptr);
 }
@@ -56,8 +158,8 @@ void MachineState::free_frame_stack(uint32_t old_eval_stack_top)
 {
     assert(_frame_stack_top > 0);
     _frame_stack_top -= 1;
-    assert((_frame_stack_base + _frame_stack_top)->old_eval_stack_top == old_eval_stack_top);
-    _eval_stack_top = old_eval_stack_top;
+    assert(get_frame(_frame_stack_top)->old_eval_stack_top == old_eval_stack_top);
+    set_eval_stack_top(old_eval_stack_top);
 }
 
 RtResult<InterpFrame*> MachineState::enter_frame_from_native(const metadata::RtMethodInfo* method, const RtStackObject* args)
@@ -75,7 +177,14 @@ RtResult<InterpFrame*> MachineState::enter_frame_from_native(const metadata::RtM
 
     const uint32_t method_max_stack = imi->max_stack_object_size;
     frame->old_eval_stack_top = get_eval_stack_top();
-    UNWRAP_OR_RET_ERR_ON_FAIL(frame->eval_stack_base, alloc_eval_stack(method_max_stack));
+    auto eval_stack_ret = alloc_eval_stack(method_max_stack);
+    if (eval_stack_ret.is_err())
+    {
+        // Unwinding starts from the caller, so the frame must not stay on top.
+        _frame_stack_top -= 1;
+        RET_ERR(eval_stack_ret.unwrap_err());
+    }
+    frame->eval_stack_base = eval_stack_ret.unwrap();
 #ifndef NDEBUG
     std::memset(frame->eval_stack_base, 0, static_cast<size_t>(method_max_stack) * sizeof(RtStackObject));
 #endif
@@ -104,13 +213,27 @@ RtResult<InterpFrame*> MachineState::enter_frame_from_interp(const metadata::RtM
 
     const uint32_t method_max_stack = imi->max_stack_object_size;
     frame->old_eval_stack_top = get_eval_stack_top();
-    const uint32_t frame_base_idx = static_cast<uint32_t>(frame_base - _eval_stack_base);
-    const uint32_t new_eval_stack_top = frame_base_idx + method_max_stack;
-    if (new_eval_stack_top > _eval_stack_size)
+    // The caller is the top frame, so frame_base lies in the current segment.
+    const uint32_t frame_base_idx = _eval_segment.begin + static_cast<uint32_t>(frame_base - _eval_segment.base);
+    if (method_max_stack <= _eval_segment.begin + _eval_segment.capacity - frame_base_idx)
     {
-        RET_ERR(RtErr::StackOverflow);
+        _eval_stack_top = frame_base_idx + method_max_stack;
+    }
+    else
+    {
+        // Move the arguments to a segment of their own; leave_frame copies the return value back.
+        RtStackObject* caller_frame_base = frame_base;
+        auto eval_stack_ret = enter_next_eval_segment(method_max_stack);
+        if (eval_stack_ret.is_err())
+        {
+            // Unwinding starts from the caller, so the frame must not stay on top.
+            _frame_stack_top -= 1;
+            RET_ERR(eval_stack_ret.unwrap_err());
+        }
+        frame_base = eval_stack_ret.unwrap();
+        std::memcpy(frame_base, caller_frame_base, method->total_arg_stack_object_size * sizeof(RtStackObject));
+        frame->caller_frame_base = caller_frame_base;
     }
-    _eval_stack_top = new_eval_stack_top;
     frame->eval_stack_base = frame_base;
     frame->eval_stack_size = method_max_stack;
 #ifndef NDEBUG
@@ -127,15 +250,23 @@ InterpFrame* MachineState::leave_frame(const MachineStateSavePoint& sp, InterpFr
     std::printf("exit_frame: token:0x%0x method:%s.%s::%s\n", frame->method->token, frame->method->parent->namespaze, frame->method->parent->name,
                 frame->method->name);
 #endif
-    const uint32_t index = static_cast<uint32_t>(frame - _frame_stack_base);
-    assert(_frame_stack_top == index + 1);
+    const uint32_t index = _frame_stack_top - 1;
+    assert(get_frame(index) == frame);
     if (index <= sp._old_frame_stack_top)
     {
         return nullptr;
     }
+    if (frame->caller_frame_base)
+    {
+        std::memcpy(frame->caller_frame_base, frame->eval_stack_base, frame->method->ret_stack_object_size * sizeof(RtStackObject));
+    }
     _frame_stack_top = index;
-    _eval_stack_top = frame->old_eval_stack_top;
-    return frame - 1;
+    set_eval_stack_top(frame->old_eval_stack_top);
+    if (_shrink_segments && (index & _frame_segment_mask) == 0)
+    {
+        shrink_frame_segments();
+    }
+    return get_frame(index - 1);
 }
 
 uint32_t MachineState::enter_frame_from_icall_or_intrinsic(const metadata::RtMethodInfo* method)
@@ -145,10 +276,11 @@ uint32_t MachineState::enter_frame_from_icall_or_intrinsic(const metadata::RtMet
                 method->name);
 #endif
     const uint32_t old_frame_top = _frame_stack_top;
-    if (_frame_stack_top < _frame_stack_size)
+    // A frame that does not fit is left out, which only hides the method from stack walks.
+    auto alloc_ret = alloc_frame_stack();
+    if (alloc_ret.is_ok())
     {
-        InterpFrame* frame = _frame_stack_base + _frame_stack_top;
-        _frame_stack_top += 1;
+        InterpFrame* frame = alloc_ret.unwrap();
         frame->method = method;
 #ifndef NDEBUG
         frame->eval_stack_base = nullptr;
@@ -164,7 +296,7 @@ void MachineState::leave_frame_from_icall_or_intrinsic(uint32_t old_frame_top)
 #if LEANCLR_ENABLE_FRAME_TRACE
     if (old_frame_top < _frame_stack_top)
     {
-        InterpFrame* frame = _frame_stack_base + old_frame_top;
+        InterpFrame* frame = get_frame(old_frame_top);
         std::printf("exit_frame_from_icall_or_intrinsic: token:0x%0x\n", frame->method->token);
     }
 #endif
@@ -1,10 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 
 #include "interp_defs.h"
-#include "utils/rt_span.h"
+#include "utils/rt_vector.h"
 
 namespace leanclr::interp
 {
@@ -16,6 +17,9 @@ struct InterpFrame
     uint32_t eval_stack_size;
     uint32_t old_eval_stack_top;
     const uint8_t* ip;
+    // Where the caller expects the return value if the frame did not fit in the eval stack segment of its
+    // caller and its arguments were moved to the next one; nullptr otherwise.
+    RtStackObject* caller_frame_base;
 
     void save(const uint8_t* next_ip)
     {
@@ -25,6 +29,9 @@ struct InterpFrame
 
 class MachineStateSavePoint;
 
+// The eval and frame stacks of the interpreter. Both grow in segments allocated on demand, up to the limits
+// set in vm::Settings. Eval stack positions are indices into one index space spanning every segment, so
+// that they can be saved and restored like plain offsets; a frame always lies within a single segment.
 class MachineState
 {
   public:
@@ -37,8 +44,8 @@ class MachineState
 
     void reset()
     {
-        _eval_stack_top = 0;
         _frame_stack_top = 0;
+        set_eval_stack_top(0);
     }
 
     uint32_t get_eval_stack_top() const
@@ -49,6 +56,10 @@ class MachineState
     void set_eval_stack_top(uint32_t new_top)
     {
         _eval_stack_top = new_top;
+        if (new_top <= _eval_segment.begin && _eval_segment_index > 0)
+        {
+            leave_eval_segments(new_top);
+        }
     }
 
     uint32_t get_frame_stack_top() const
@@ -67,7 +78,7 @@ class MachineState
         {
             return nullptr;
         }
-        return _frame_stack_base + (_frame_stack_top - 1);
+        return get_frame(_frame_stack_top - 1);
     }
 
     InterpFrame* get_calling_frame_stack()
@@ -76,12 +87,23 @@ class MachineState
         {
             return nullptr;
         }
-        return _frame_stack_base + (_frame_stack_top - 2);
+        return get_frame(_frame_stack_top - 2);
+    }
+
+    // Active frames, outermost first. Safe to walk from a signal handler interrupting the runtime thread:
+    // alloc_frame_stack clears a slot and fences before publishing it, and a frame just entered may still
+    // report a null method or ip.
+    size_t get_active_frame_count() const
+    {
+        size_t count = static_cast<size_t>(_frame_stack_top);
+        std::atomic_signal_fence(std::memory_order_acquire);
+        return count;
     }
 
-    utils::Span<const InterpFrame> get_active_frames() const
+    const InterpFrame* get_active_frame(size_t index) const
     {
-        return utils::Span<const InterpFrame>(_frame_stack_base, static_cast<size_t>(_frame_stack_top));
+        assert(index < _frame_stack_top);
+        return get_frame(static_cast<uint32_t>(index));
     }
 
     RtResult<RtStackObject*> alloc_eval_stack(uint32_t size);
@@ -96,14 +118,40 @@ class MachineState
     void leave_frame_from_icall_or_intrinsic(uint32_t old_frame_top);
 
   private:
+    struct EvalStackSegment
+    {
+        RtStackObject* base;
+        // Index of base in the eval stack index space.
+        uint32_t begin;
+        uint32_t capacity;
+    };
+
     MachineState() = default;
 
-    RtStackObject* _eval_stack_base = nullptr;
-    uint32_t _eval_stack_size = 0;
+    InterpFrame* get_frame(uint32_t index) const
+    {
+        return _frame_segments[index >> _frame_segment_shift] + (index & _frame_segment_mask);
+    }
+
+    RtResult<RtStackObject*> enter_next_eval_segment(uint32_t size);
+    void leave_eval_segments(uint32_t new_top);
+    void shrink_frame_segments();
+
+    utils::Vector<EvalStackSegment> _eval_segments;
+    // Copy of _eval_segments[_eval_segment_index], the segment holding the top of the eval stack.
+    EvalStackSegment _eval_segment = {};
+    size_t _eval_segment_index = 0;
     uint32_t _eval_stack_top = 0;
-    InterpFrame* _frame_stack_base = nullptr;
-    uint32_t _frame_stack_size = 0;
+    uint32_t _eval_stack_limit = 0;
+
+    // Fixed size segments, so that a frame is found by its index without locking; unallocated ones are null.
+    InterpFrame** _frame_segments = nullptr;
+    uint32_t _frame_segment_count = 0;
+    uint32_t _frame_segment_shift = 0;
+    uint32_t _frame_segment_mask = 0;
     uint32_t _frame_stack_top = 0;
+    uint32_t _frame_stack_limit = 0;
+    bool _shrink_segments = false;
 };
 
 struct MachineStateSavePoint
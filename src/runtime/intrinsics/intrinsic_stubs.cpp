@@ -1,8 +1,10 @@
 #include "intrinsic_stubs.h"
 #include "system_array.h"
+#include "system_double.h"
 #include "system_object.h"
 #include "system_span.h"
 #include "system_string.h"
+#include "system_text_utf8encoding.h"
 #include "system_threading_interlocked.h"
 #include "system_threading_volatile.h"
 #include "system_numerics_vector.h"
@@ -20,9 +22,11 @@ void IntrinsicStubs::get_intrinsic_entries(utils::Vector<vm::IntrinsicEntry>& en
     entries.reserve(1000);
     // append intrinsic entries from various classes
     Append(entries, SystemArray::get_intrinsic_entries());
+    Append(entries, SystemDouble::get_intrinsic_entries());
     Append(entries, SystemObject::get_intrinsic_entries());
     Append(entries, SystemSpan::get_intrinsic_entries());
     Append(entries, SystemString::get_intrinsic_entries());
+    Append(entries, SystemTextUtf8Encoding::get_intrinsic_entries());
     Append(entries, SystemThreadingInterlocked::get_intrinsic_entries());
     Append(entries, SystemThreadingVolatile::get_intrinsic_entries());
     Append(entries, SystemNumericsVector::get_intrinsic_entries());
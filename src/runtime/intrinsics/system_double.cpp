@@ -0,0 +1,78 @@
+#include "system_double.h"
+#include "interp/eval_stack_op.h"
+#include "vm/rt_string.h"
+#include "utils/float_format.h"
+
+namespace leanclr::intrinsics
+{
+
+// Precisions of the "G" format the corlib uses for Double.ToString() and Single.ToString().
+constexpr int32_t DOUBLE_PRECISION = 15;
+constexpr int32_t SINGLE_PRECISION = 7;
+
+static RtResult<vm::RtString*> format_general(double value, int32_t precision)
+{
+    char text[utils::FloatFormat::MAX_GENERAL_LENGTH];
+    size_t length = utils::FloatFormat::format_general(value, precision, text);
+    vm::RtString* str = vm::String::fast_allocate_string(static_cast<int32_t>(length));
+    if (!str)
+    {
+        RET_ERR(RtErr::OutOfMemory);
+    }
+    Utf16Char* chars = &str->first_char;
+    for (size_t i = 0; i < length; ++i)
+    {
+        chars[i] = static_cast<Utf16Char>(text[i]);
+    }
+    chars[length] = 0;
+    RET_OK(str);
+}
+
+// ========== Implementation Functions ==========
+
+RtResult<vm::RtString*> SystemDouble::to_string(const double* value)
+{
+    return format_general(*value, DOUBLE_PRECISION);
+}
+
+RtResult<vm::RtString*> SystemDouble::to_string_single(const float* value)
+{
+    return format_general(static_cast<double>(*value), SINGLE_PRECISION);
+}
+
+// ========== Invoker Functions ==========
+
+/// @intrinsic: System.Double::ToString()
+static RtResultVoid to_string_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method, const interp::RtStackObject* params,
+                                      interp::RtStackObject* ret)
+{
+    auto value = interp::EvalStackOp::get_param<const double*>(params, 0);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(vm::RtString*, str, SystemDouble::to_string(value));
+    interp::EvalStackOp::set_return(ret, str);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Single::ToString()
+static RtResultVoid to_string_single_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto value = interp::EvalStackOp::get_param<const float*>(params, 0);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(vm::RtString*, str, SystemDouble::to_string_single(value));
+    interp::EvalStackOp::set_return(ret, str);
+    RET_VOID_OK();
+}
+
+// ========== Intrinsic Entries ==========
+
+static vm::IntrinsicEntry s_intrinsic_entries[] = {
+    {"System.Double::ToString()", (vm::IntrinsicFunction)&SystemDouble::to_string, to_string_invoker},
+    {"System.Single::ToString()", (vm::IntrinsicFunction)&SystemDouble::to_string_single, to_string_single_invoker},
+};
+
+utils::Span<vm::IntrinsicEntry> SystemDouble::get_intrinsic_entries()
+{
+    constexpr size_t entry_count = sizeof(s_intrinsic_entries) / sizeof(s_intrinsic_entries[0]);
+    return utils::Span<vm::IntrinsicEntry>(s_intrinsic_entries, entry_count);
+}
+
+} // namespace leanclr::intrinsics
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "vm/intrinsics.h"
+
+namespace leanclr::intrinsics
+{
+class SystemDouble
+{
+  public:
+    // Double.ToString() and Single.ToString(), formatted natively as "G15" and "G7". Only the invariant
+    // culture is supported by the runtime, so the current culture never changes the result. The overloads
+    // taking a format or a provider, and TryFormat, stay in the corlib's managed formatter.
+    static RtResult<vm::RtString*> to_string(const double* value);
+    static RtResult<vm::RtString*> to_string_single(const float* value);
+
+    static utils::Span<vm::IntrinsicEntry> get_intrinsic_entries();
+};
+} // namespace leanclr::intrinsics
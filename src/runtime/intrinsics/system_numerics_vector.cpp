@@ -1,10 +1,14 @@
 #include "system_numerics_vector.h"
 #include "interp/interp_defs.h"
+#include "interp/eval_stack_op.h"
 #include "platform/hardware.h"
+#include "vm/numerics_vector.h"
 
 namespace leanclr::intrinsics
 {
 
+using vm::NumericsVector;
+
 RtResult<bool> SystemNumericsVector::get_is_hardware_accelerated()
 {
     RET_OK(pal::Hardware::is_hardware_accelerated());
@@ -22,12 +26,148 @@ static RtResultVoid get_is_hardware_accelerated_invoker(metadata::RtManagedMetho
     RET_VOID_OK();
 }
 
+// Invokers for Vector2/3/4 methods. A VectorN argument occupies vector_slots<N>() eval stack slots.
+
+template <int N>
+constexpr size_t vector_slots()
+{
+    return (N * sizeof(float) + sizeof(interp::RtStackObject) - 1) / sizeof(interp::RtStackObject);
+}
+
+using VectorBinaryOp = void (*)(const void*, const void*, void*);
+using VectorUnaryOp = void (*)(const void*, void*);
+using VectorScalarOp = void (*)(const void*, float, void*);
+using VectorReduceOp = float (*)(const void*, const void*);
+using VectorLengthOp = float (*)(const void*);
+
+/// @intrinsic: System.Numerics.VectorN::op_Addition(VectorN,VectorN) and other (VectorN,VectorN) -> VectorN methods
+template <int N, VectorBinaryOp Op>
+static RtResultVoid vector_binary_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                          interp::RtStackObject* ret)
+{
+    Op(params, params + vector_slots<N>(), ret);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Numerics.VectorN::op_UnaryNegation(VectorN) and other VectorN -> VectorN methods
+template <VectorUnaryOp Op>
+static RtResultVoid vector_unary_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                         interp::RtStackObject* ret)
+{
+    Op(params, ret);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Numerics.VectorN::op_Multiply(VectorN,System.Single) and op_Division(VectorN,System.Single)
+template <int N, VectorScalarOp Op>
+static RtResultVoid vector_scalar_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                          interp::RtStackObject* ret)
+{
+    Op(params, interp::EvalStackOp::get_param<float>(params, vector_slots<N>()), ret);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Numerics.VectorN::op_Multiply(System.Single,VectorN)
+template <VectorScalarOp Op>
+static RtResultVoid scalar_vector_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                          interp::RtStackObject* ret)
+{
+    Op(params + 1, interp::EvalStackOp::get_param<float>(params, 0), ret);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Numerics.VectorN::Dot(VectorN,VectorN), Distance and DistanceSquared
+template <int N, VectorReduceOp Op>
+static RtResultVoid vector_reduce_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                          interp::RtStackObject* ret)
+{
+    interp::EvalStackOp::set_return(ret, Op(params, params + vector_slots<N>()));
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Numerics.VectorN::Length() and LengthSquared()
+template <VectorLengthOp Op>
+static RtResultVoid vector_length_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                          interp::RtStackObject* ret)
+{
+    const void* self = interp::EvalStackOp::get_param<const void*>(params, 0);
+    interp::EvalStackOp::set_return(ret, Op(self));
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Numerics.VectorN::Lerp(VectorN,VectorN,System.Single)
+template <int N>
+static RtResultVoid vector_lerp_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                        interp::RtStackObject* ret)
+{
+    NumericsVector::lerp<N>(params, params + vector_slots<N>(), interp::EvalStackOp::get_param<float>(params, 2 * vector_slots<N>()), ret);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Numerics.VectorN::Clamp(VectorN,VectorN,VectorN)
+template <int N>
+static RtResultVoid vector_clamp_invoker(metadata::RtManagedMethodPointer, const metadata::RtMethodInfo*, const interp::RtStackObject* params,
+                                         interp::RtStackObject* ret)
+{
+    NumericsVector::clamp<N>(params, params + vector_slots<N>(), params + 2 * vector_slots<N>(), ret);
+    RET_VOID_OK();
+}
+
+#define LEANCLR_VECTOR_TYPE(T) "System.Numerics." T
+#define LEANCLR_VECTOR_BINARY_ENTRY(T, N, NAME, OP)                                                                                                          \
+    {LEANCLR_VECTOR_TYPE(T) "::" NAME "(" LEANCLR_VECTOR_TYPE(T) "," LEANCLR_VECTOR_TYPE(T) ")", (vm::IntrinsicFunction)&NumericsVector::OP<N>,            \
+     vector_binary_invoker<N, &NumericsVector::OP<N>>}
+#define LEANCLR_VECTOR_UNARY_ENTRY(T, N, NAME, OP)                                                                                                           \
+    {LEANCLR_VECTOR_TYPE(T) "::" NAME "(" LEANCLR_VECTOR_TYPE(T) ")", (vm::IntrinsicFunction)&NumericsVector::OP<N>, vector_unary_invoker<&NumericsVector::OP<N>>}
+#define LEANCLR_VECTOR_SCALAR_ENTRY(T, N, NAME, OP)                                                                                                          \
+    {LEANCLR_VECTOR_TYPE(T) "::" NAME "(" LEANCLR_VECTOR_TYPE(T) ",System.Single)", (vm::IntrinsicFunction)&NumericsVector::OP<N>,                         \
+     vector_scalar_invoker<N, &NumericsVector::OP<N>>}
+#define LEANCLR_VECTOR_REDUCE_ENTRY(T, N, NAME, OP)                                                                                                          \
+    {LEANCLR_VECTOR_TYPE(T) "::" NAME "(" LEANCLR_VECTOR_TYPE(T) "," LEANCLR_VECTOR_TYPE(T) ")", (vm::IntrinsicFunction)&NumericsVector::OP<N>,            \
+     vector_reduce_invoker<N, &NumericsVector::OP<N>>}
+
+#define LEANCLR_VECTOR_ENTRIES(T, N)                                                                                                                         \
+    LEANCLR_VECTOR_BINARY_ENTRY(T, N, "op_Addition", add), LEANCLR_VECTOR_BINARY_ENTRY(T, N, "Add", add),                                                  \
+        LEANCLR_VECTOR_BINARY_ENTRY(T, N, "op_Subtraction", sub), LEANCLR_VECTOR_BINARY_ENTRY(T, N, "Subtract", sub),                                      \
+        LEANCLR_VECTOR_BINARY_ENTRY(T, N, "op_Multiply", mul), LEANCLR_VECTOR_BINARY_ENTRY(T, N, "Multiply", mul),                                         \
+        LEANCLR_VECTOR_BINARY_ENTRY(T, N, "op_Division", div), LEANCLR_VECTOR_BINARY_ENTRY(T, N, "Divide", div),                                           \
+        LEANCLR_VECTOR_BINARY_ENTRY(T, N, "Min", min), LEANCLR_VECTOR_BINARY_ENTRY(T, N, "Max", max),                                                      \
+        LEANCLR_VECTOR_SCALAR_ENTRY(T, N, "op_Multiply", mul_scalar), LEANCLR_VECTOR_SCALAR_ENTRY(T, N, "Multiply", mul_scalar),                           \
+        LEANCLR_VECTOR_SCALAR_ENTRY(T, N, "op_Division", div_scalar), LEANCLR_VECTOR_SCALAR_ENTRY(T, N, "Divide", div_scalar),                             \
+        {LEANCLR_VECTOR_TYPE(T) "::op_Multiply(System.Single," LEANCLR_VECTOR_TYPE(T) ")", (vm::IntrinsicFunction)&NumericsVector::mul_scalar<N>,          \
+         scalar_vector_invoker<&NumericsVector::mul_scalar<N>>},                                                                                           \
+        {LEANCLR_VECTOR_TYPE(T) "::Multiply(System.Single," LEANCLR_VECTOR_TYPE(T) ")", (vm::IntrinsicFunction)&NumericsVector::mul_scalar<N>,             \
+         scalar_vector_invoker<&NumericsVector::mul_scalar<N>>},                                                                                           \
+        LEANCLR_VECTOR_UNARY_ENTRY(T, N, "op_UnaryNegation", negate), LEANCLR_VECTOR_UNARY_ENTRY(T, N, "Negate", negate),                                  \
+        LEANCLR_VECTOR_UNARY_ENTRY(T, N, "Abs", abs), LEANCLR_VECTOR_UNARY_ENTRY(T, N, "SquareRoot", square_root),                                         \
+        LEANCLR_VECTOR_UNARY_ENTRY(T, N, "Normalize", normalize), LEANCLR_VECTOR_REDUCE_ENTRY(T, N, "Dot", dot),                                           \
+        LEANCLR_VECTOR_REDUCE_ENTRY(T, N, "Distance", distance), LEANCLR_VECTOR_REDUCE_ENTRY(T, N, "DistanceSquared", distance_squared),                    \
+        {LEANCLR_VECTOR_TYPE(T) "::Lerp(" LEANCLR_VECTOR_TYPE(T) "," LEANCLR_VECTOR_TYPE(T) ",System.Single)",                                              \
+         (vm::IntrinsicFunction)&NumericsVector::lerp<N>, vector_lerp_invoker<N>},                                                                         \
+        {LEANCLR_VECTOR_TYPE(T) "::Clamp(" LEANCLR_VECTOR_TYPE(T) "," LEANCLR_VECTOR_TYPE(T) "," LEANCLR_VECTOR_TYPE(T) ")",                                \
+         (vm::IntrinsicFunction)&NumericsVector::clamp<N>, vector_clamp_invoker<N>},                                                                       \
+        {LEANCLR_VECTOR_TYPE(T) "::Length()", (vm::IntrinsicFunction)&NumericsVector::length<N>, vector_length_invoker<&NumericsVector::length<N>>},      \
+        {LEANCLR_VECTOR_TYPE(T) "::LengthSquared()", (vm::IntrinsicFunction)&NumericsVector::length_squared<N>,                                            \
+         vector_length_invoker<&NumericsVector::length_squared<N>>}
+
 // Intrinsic registry
 static vm::IntrinsicEntry s_intrinsic_entries[] = {
     {"System.Numerics.Vector::get_IsHardwareAccelerated", (vm::IntrinsicFunction)&SystemNumericsVector::get_is_hardware_accelerated,
      get_is_hardware_accelerated_invoker},
+    LEANCLR_VECTOR_ENTRIES("Vector2", 2),
+    LEANCLR_VECTOR_ENTRIES("Vector3", 3),
+    LEANCLR_VECTOR_ENTRIES("Vector4", 4),
+    {"System.Numerics.Vector3::Cross(System.Numerics.Vector3,System.Numerics.Vector3)", (vm::IntrinsicFunction)&NumericsVector::cross,
+     vector_binary_invoker<3, &NumericsVector::cross>},
 };
 
+#undef LEANCLR_VECTOR_ENTRIES
+#undef LEANCLR_VECTOR_REDUCE_ENTRY
+#undef LEANCLR_VECTOR_SCALAR_ENTRY
+#undef LEANCLR_VECTOR_UNARY_ENTRY
+#undef LEANCLR_VECTOR_BINARY_ENTRY
+#undef LEANCLR_VECTOR_TYPE
+
 utils::Span<vm::IntrinsicEntry> SystemNumericsVector::get_intrinsic_entries()
 {
     return utils::Span<vm::IntrinsicEntry>(s_intrinsic_entries, sizeof(s_intrinsic_entries) / sizeof(vm::IntrinsicEntry));
@@ -1,7 +1,9 @@
 #include "system_string.h"
 
 #include "interp/eval_stack_op.h"
+#include "vm/rt_array.h"
 #include "vm/rt_string.h"
+#include "utils/string_kernels.h"
 
 namespace leanclr::intrinsics
 {
@@ -26,6 +28,109 @@ RtResult<int32_t> SystemString::get_hash_code(vm::RtString* str)
     RET_OK(hash);
 }
 
+static bool equals_not_null(vm::RtString* a, vm::RtString* b)
+{
+    if (a == b)
+    {
+        return true;
+    }
+    int32_t length = vm::String::get_length(a);
+    if (length != vm::String::get_length(b))
+    {
+        return false;
+    }
+    return utils::StringKernels::ordinal_equals(vm::String::get_chars_ptr(a), vm::String::get_chars_ptr(b), static_cast<size_t>(length));
+}
+
+RtResult<bool> SystemString::equals(vm::RtString* s, vm::RtString* value)
+{
+    if (s == nullptr)
+    {
+        RET_ERR(RtErr::NullReference);
+    }
+    RET_OK(value != nullptr && equals_not_null(s, value));
+}
+
+RtResult<bool> SystemString::equals_static(vm::RtString* a, vm::RtString* b)
+{
+    if (a == b)
+    {
+        RET_OK(true);
+    }
+    RET_OK(a != nullptr && b != nullptr && equals_not_null(a, b));
+}
+
+RtResult<bool> SystemString::not_equals_static(vm::RtString* a, vm::RtString* b)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, result, equals_static(a, b));
+    RET_OK(!result);
+}
+
+RtResult<int32_t> SystemString::compare_ordinal(vm::RtString* a, vm::RtString* b)
+{
+    if (a == b)
+    {
+        RET_OK(0);
+    }
+    if (a == nullptr)
+    {
+        RET_OK(-1);
+    }
+    if (b == nullptr)
+    {
+        RET_OK(1);
+    }
+    RET_OK(utils::StringKernels::ordinal_compare(vm::String::get_chars_ptr(a), static_cast<size_t>(vm::String::get_length(a)), vm::String::get_chars_ptr(b),
+                                                 static_cast<size_t>(vm::String::get_length(b))));
+}
+
+// count < 0 means "to the end of the string".
+static RtResultVoid check_search_range(vm::RtString* s, int32_t start_index, int32_t& count)
+{
+    if (s == nullptr)
+    {
+        RET_ERR(RtErr::NullReference);
+    }
+    int32_t length = vm::String::get_length(s);
+    if (start_index < 0 || start_index > length)
+    {
+        RET_ERR(RtErr::ArgumentOutOfRange);
+    }
+    if (count < 0)
+    {
+        count = length - start_index;
+    }
+    else if (count > length - start_index)
+    {
+        RET_ERR(RtErr::ArgumentOutOfRange);
+    }
+    RET_VOID_OK();
+}
+
+RtResult<int32_t> SystemString::index_of_char(vm::RtString* s, Utf16Char value, int32_t start_index, int32_t count)
+{
+    RET_ERR_ON_FAIL(check_search_range(s, start_index, count));
+    int32_t index = utils::StringKernels::index_of_char(vm::String::get_chars_ptr(s) + start_index, static_cast<size_t>(count), value);
+    RET_OK(index < 0 ? -1 : start_index + index);
+}
+
+RtResult<int32_t> SystemString::index_of_any(vm::RtString* s, vm::RtArray* any_of, int32_t start_index, int32_t count)
+{
+    if (s == nullptr)
+    {
+        RET_ERR(RtErr::NullReference);
+    }
+    if (any_of == nullptr)
+    {
+        RET_ERR(RtErr::ArgumentNull);
+    }
+    RET_ERR_ON_FAIL(check_search_range(s, start_index, count));
+    int32_t index = utils::StringKernels::index_of_any(vm::String::get_chars_ptr(s) + start_index, static_cast<size_t>(count),
+                                                       vm::Array::get_array_data_start_as<Utf16Char>(any_of),
+                                                       static_cast<size_t>(vm::Array::get_array_length(any_of)));
+    RET_OK(index < 0 ? -1 : start_index + index);
+}
+
 /// @intrinsic: System.String::get_Chars
 RtResultVoid get_chars_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method, const interp::RtStackObject* params,
                                interp::RtStackObject* ret)
@@ -59,6 +164,131 @@ static RtResultVoid get_hash_code_invoker(metadata::RtManagedMethodPointer metho
     RET_VOID_OK();
 }
 
+/// @intrinsic: System.String::Equals(System.String)
+static RtResultVoid equals_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method, const interp::RtStackObject* params,
+                                   interp::RtStackObject* ret)
+{
+    auto s = interp::EvalStackOp::get_param<vm::RtString*>(params, 0);
+    auto value = interp::EvalStackOp::get_param<vm::RtString*>(params, 1);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, result, SystemString::equals(s, value));
+    interp::EvalStackOp::set_return(ret, static_cast<int32_t>(result));
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.String::Equals(System.String,System.String)
+/// @intrinsic: System.String::op_Equality(System.String,System.String)
+static RtResultVoid equals_static_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto a = interp::EvalStackOp::get_param<vm::RtString*>(params, 0);
+    auto b = interp::EvalStackOp::get_param<vm::RtString*>(params, 1);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, result, SystemString::equals_static(a, b));
+    interp::EvalStackOp::set_return(ret, static_cast<int32_t>(result));
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.String::op_Inequality(System.String,System.String)
+static RtResultVoid not_equals_static_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto a = interp::EvalStackOp::get_param<vm::RtString*>(params, 0);
+    auto b = interp::EvalStackOp::get_param<vm::RtString*>(params, 1);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, result, SystemString::not_equals_static(a, b));
+    interp::EvalStackOp::set_return(ret, static_cast<int32_t>(result));
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.String::CompareOrdinal(System.String,System.String)
+static RtResultVoid compare_ordinal_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto a = interp::EvalStackOp::get_param<vm::RtString*>(params, 0);
+    auto b = interp::EvalStackOp::get_param<vm::RtString*>(params, 1);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(int32_t, result, SystemString::compare_ordinal(a, b));
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.String::IndexOf(System.Char)
+static RtResultVoid index_of_char_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto s = interp::EvalStackOp::get_param<vm::RtString*>(params, 0);
+    auto value = static_cast<Utf16Char>(interp::EvalStackOp::get_param<int32_t>(params, 1));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(int32_t, index, SystemString::index_of_char(s, value, 0, -1));
+    interp::EvalStackOp::set_return(ret, index);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.String::IndexOf(System.Char,System.Int32)
+static RtResultVoid index_of_char_start_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto s = interp::EvalStackOp::get_param<vm::RtString*>(params, 0);
+    auto value = static_cast<Utf16Char>(interp::EvalStackOp::get_param<int32_t>(params, 1));
+    auto start_index = interp::EvalStackOp::get_param<int32_t>(params, 2);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(int32_t, index, SystemString::index_of_char(s, value, start_index, -1));
+    interp::EvalStackOp::set_return(ret, index);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.String::IndexOf(System.Char,System.Int32,System.Int32)
+static RtResultVoid index_of_char_range_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto s = interp::EvalStackOp::get_param<vm::RtString*>(params, 0);
+    auto value = static_cast<Utf16Char>(interp::EvalStackOp::get_param<int32_t>(params, 1));
+    auto start_index = interp::EvalStackOp::get_param<int32_t>(params, 2);
+    auto count = interp::EvalStackOp::get_param<int32_t>(params, 3);
+    if (count < 0)
+    {
+        RET_ERR(RtErr::ArgumentOutOfRange);
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(int32_t, index, SystemString::index_of_char(s, value, start_index, count));
+    interp::EvalStackOp::set_return(ret, index);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.String::IndexOfAny(System.Char[])
+static RtResultVoid index_of_any_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                         const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto s = interp::EvalStackOp::get_param<vm::RtString*>(params, 0);
+    auto any_of = interp::EvalStackOp::get_param<vm::RtArray*>(params, 1);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(int32_t, index, SystemString::index_of_any(s, any_of, 0, -1));
+    interp::EvalStackOp::set_return(ret, index);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.String::IndexOfAny(System.Char[],System.Int32)
+static RtResultVoid index_of_any_start_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto s = interp::EvalStackOp::get_param<vm::RtString*>(params, 0);
+    auto any_of = interp::EvalStackOp::get_param<vm::RtArray*>(params, 1);
+    auto start_index = interp::EvalStackOp::get_param<int32_t>(params, 2);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(int32_t, index, SystemString::index_of_any(s, any_of, start_index, -1));
+    interp::EvalStackOp::set_return(ret, index);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.String::IndexOfAny(System.Char[],System.Int32,System.Int32)
+static RtResultVoid index_of_any_range_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto s = interp::EvalStackOp::get_param<vm::RtString*>(params, 0);
+    auto any_of = interp::EvalStackOp::get_param<vm::RtArray*>(params, 1);
+    auto start_index = interp::EvalStackOp::get_param<int32_t>(params, 2);
+    auto count = interp::EvalStackOp::get_param<int32_t>(params, 3);
+    if (count < 0)
+    {
+        RET_ERR(RtErr::ArgumentOutOfRange);
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(int32_t, index, SystemString::index_of_any(s, any_of, start_index, count));
+    interp::EvalStackOp::set_return(ret, index);
+    RET_VOID_OK();
+}
+
 // Intrinsic registry
 static vm::IntrinsicEntry s_intrinsic_entries[] = {
     {"System.String::get_Chars", (vm::IntrinsicFunction)&SystemString::get_chars, get_chars_invoker},
@@ -66,6 +296,17 @@ static vm::IntrinsicEntry s_intrinsic_entries[] = {
     {"System.String::GetHashCode", (vm::IntrinsicFunction)&SystemString::get_hash_code, get_hash_code_invoker},
     // redirected to intrinsic
     {"System.String::GetLegacyNonRandomizedHashCode", (vm::IntrinsicFunction)&SystemString::get_hash_code, get_hash_code_invoker},
+    {"System.String::Equals(System.String)", (vm::IntrinsicFunction)&SystemString::equals, equals_invoker},
+    {"System.String::Equals(System.String,System.String)", (vm::IntrinsicFunction)&SystemString::equals_static, equals_static_invoker},
+    {"System.String::op_Equality(System.String,System.String)", (vm::IntrinsicFunction)&SystemString::equals_static, equals_static_invoker},
+    {"System.String::op_Inequality(System.String,System.String)", (vm::IntrinsicFunction)&SystemString::not_equals_static, not_equals_static_invoker},
+    {"System.String::CompareOrdinal(System.String,System.String)", (vm::IntrinsicFunction)&SystemString::compare_ordinal, compare_ordinal_invoker},
+    {"System.String::IndexOf(System.Char)", (vm::IntrinsicFunction)&SystemString::index_of_char, index_of_char_invoker},
+    {"System.String::IndexOf(System.Char,System.Int32)", (vm::IntrinsicFunction)&SystemString::index_of_char, index_of_char_start_invoker},
+    {"System.String::IndexOf(System.Char,System.Int32,System.Int32)", (vm::IntrinsicFunction)&SystemString::index_of_char, index_of_char_range_invoker},
+    {"System.String::IndexOfAny(System.Char[])", (vm::IntrinsicFunction)&SystemString::index_of_any, index_of_any_invoker},
+    {"System.String::IndexOfAny(System.Char[],System.Int32)", (vm::IntrinsicFunction)&SystemString::index_of_any, index_of_any_start_invoker},
+    {"System.String::IndexOfAny(System.Char[],System.Int32,System.Int32)", (vm::IntrinsicFunction)&SystemString::index_of_any, index_of_any_range_invoker},
 };
 
 utils::Span<vm::IntrinsicEntry> SystemString::get_intrinsic_entries()
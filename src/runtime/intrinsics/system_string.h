@@ -16,6 +16,15 @@ class SystemString
     static RtResult<int32_t> get_length(vm::RtString* s);
     static RtResult<int32_t> get_hash_code(vm::RtString* str);
 
+    // Ordinal comparisons backed by utils::StringKernels.
+    static RtResult<bool> equals(vm::RtString* s, vm::RtString* value);
+    static RtResult<bool> equals_static(vm::RtString* a, vm::RtString* b);
+    static RtResult<bool> not_equals_static(vm::RtString* a, vm::RtString* b);
+    static RtResult<int32_t> compare_ordinal(vm::RtString* a, vm::RtString* b);
+
+    static RtResult<int32_t> index_of_char(vm::RtString* s, Utf16Char value, int32_t start_index, int32_t count);
+    static RtResult<int32_t> index_of_any(vm::RtString* s, vm::RtArray* any_of, int32_t start_index, int32_t count);
+
     static utils::Span<vm::IntrinsicEntry> get_intrinsic_entries();
 };
 } // namespace leanclr::intrinsics
@@ -0,0 +1,207 @@
+#include "system_text_utf8encoding.h"
+
+#include <cstring>
+
+#include "interp/eval_stack_op.h"
+#include "interp/interpreter.h"
+#include "vm/rt_array.h"
+#include "vm/rt_string.h"
+#include "utils/utf8_transcoder.h"
+
+namespace leanclr::intrinsics
+{
+
+bool SystemTextUtf8Encoding::try_get_byte_count(const Utf16Char* chars, int32_t char_count, int32_t* byte_count)
+{
+    if (char_count < 0 || (chars == nullptr && char_count > 0))
+    {
+        return false;
+    }
+    bool valid;
+    size_t length = utils::Utf8Transcoder::get_utf8_length(chars, static_cast<size_t>(char_count), &valid);
+    if (!valid || length > static_cast<size_t>(INT32_MAX))
+    {
+        return false;
+    }
+    *byte_count = static_cast<int32_t>(length);
+    return true;
+}
+
+bool SystemTextUtf8Encoding::try_get_bytes(const Utf16Char* chars, int32_t char_count, uint8_t* bytes, int32_t byte_count, int32_t* written)
+{
+    int32_t needed;
+    if (!try_get_byte_count(chars, char_count, &needed) || byte_count < needed || (bytes == nullptr && needed > 0))
+    {
+        return false;
+    }
+    *written = static_cast<int32_t>(utils::Utf8Transcoder::utf16_to_utf8(chars, static_cast<size_t>(char_count), reinterpret_cast<char*>(bytes),
+                                                                          static_cast<size_t>(needed)));
+    return true;
+}
+
+bool SystemTextUtf8Encoding::try_get_char_count(const uint8_t* bytes, int32_t byte_count, int32_t* char_count)
+{
+    if (byte_count < 0 || (bytes == nullptr && byte_count > 0))
+    {
+        return false;
+    }
+    bool valid;
+    size_t length = utils::Utf8Transcoder::get_utf16_length(reinterpret_cast<const char*>(bytes), static_cast<size_t>(byte_count), &valid);
+    if (!valid)
+    {
+        return false;
+    }
+    *char_count = static_cast<int32_t>(length);
+    return true;
+}
+
+bool SystemTextUtf8Encoding::try_get_chars(const uint8_t* bytes, int32_t byte_count, Utf16Char* chars, int32_t char_count, int32_t* written)
+{
+    int32_t needed;
+    if (!try_get_char_count(bytes, byte_count, &needed) || char_count < needed || (chars == nullptr && needed > 0))
+    {
+        return false;
+    }
+    *written = static_cast<int32_t>(utils::Utf8Transcoder::utf8_to_utf16(reinterpret_cast<const char*>(bytes), static_cast<size_t>(byte_count), chars,
+                                                                          static_cast<size_t>(needed)));
+    return true;
+}
+
+bool SystemTextUtf8Encoding::try_get_string(vm::RtArray* bytes, int32_t index, int32_t count, vm::RtString** result)
+{
+    if (bytes == nullptr || index < 0 || count < 0 || vm::Array::get_array_length(bytes) - index < count)
+    {
+        return false;
+    }
+    const uint8_t* start = vm::Array::get_array_data_start_as<uint8_t>(bytes) + index;
+    int32_t length;
+    if (!try_get_char_count(start, count, &length))
+    {
+        return false;
+    }
+    if (length == 0)
+    {
+        *result = vm::String::get_empty_string();
+        return true;
+    }
+    vm::RtString* str = vm::String::fast_allocate_string(length);
+    if (!str)
+    {
+        return false;
+    }
+    utils::Utf8Transcoder::utf8_to_utf16(reinterpret_cast<const char*>(start), static_cast<size_t>(count), &str->first_char, static_cast<size_t>(length));
+    *result = str;
+    return true;
+}
+
+// ========== Invoker Functions ==========
+
+// Runs the IL body of method, for the calls the native paths leave to the corlib.
+static RtResultVoid invoke_managed(const metadata::RtMethodInfo* method, const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const interp::RtStackObject*, result, interp::Interpreter::execute(method, params));
+    std::memcpy(ret, result, method->ret_stack_object_size * sizeof(interp::RtStackObject));
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Text.UTF8Encoding::GetByteCount(System.Char*,System.Int32,System.Text.EncoderNLS)
+static RtResultVoid get_byte_count_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto chars = interp::EvalStackOp::get_param<const Utf16Char*>(params, 1);
+    auto char_count = interp::EvalStackOp::get_param<int32_t>(params, 2);
+    auto encoder = interp::EvalStackOp::get_param<vm::RtObject*>(params, 3);
+    int32_t byte_count;
+    if (encoder != nullptr || !SystemTextUtf8Encoding::try_get_byte_count(chars, char_count, &byte_count))
+    {
+        return invoke_managed(method, params, ret);
+    }
+    interp::EvalStackOp::set_return(ret, byte_count);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Text.UTF8Encoding::GetBytes(System.Char*,System.Int32,System.Byte*,System.Int32,System.Text.EncoderNLS)
+static RtResultVoid get_bytes_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method, const interp::RtStackObject* params,
+                                      interp::RtStackObject* ret)
+{
+    auto chars = interp::EvalStackOp::get_param<const Utf16Char*>(params, 1);
+    auto char_count = interp::EvalStackOp::get_param<int32_t>(params, 2);
+    auto bytes = interp::EvalStackOp::get_param<uint8_t*>(params, 3);
+    auto byte_count = interp::EvalStackOp::get_param<int32_t>(params, 4);
+    auto encoder = interp::EvalStackOp::get_param<vm::RtObject*>(params, 5);
+    int32_t written;
+    if (encoder != nullptr || !SystemTextUtf8Encoding::try_get_bytes(chars, char_count, bytes, byte_count, &written))
+    {
+        return invoke_managed(method, params, ret);
+    }
+    interp::EvalStackOp::set_return(ret, written);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Text.UTF8Encoding::GetCharCount(System.Byte*,System.Int32,System.Text.DecoderNLS)
+static RtResultVoid get_char_count_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto bytes = interp::EvalStackOp::get_param<const uint8_t*>(params, 1);
+    auto byte_count = interp::EvalStackOp::get_param<int32_t>(params, 2);
+    auto decoder = interp::EvalStackOp::get_param<vm::RtObject*>(params, 3);
+    int32_t char_count;
+    if (decoder != nullptr || !SystemTextUtf8Encoding::try_get_char_count(bytes, byte_count, &char_count))
+    {
+        return invoke_managed(method, params, ret);
+    }
+    interp::EvalStackOp::set_return(ret, char_count);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Text.UTF8Encoding::GetChars(System.Byte*,System.Int32,System.Char*,System.Int32,System.Text.DecoderNLS)
+static RtResultVoid get_chars_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method, const interp::RtStackObject* params,
+                                      interp::RtStackObject* ret)
+{
+    auto bytes = interp::EvalStackOp::get_param<const uint8_t*>(params, 1);
+    auto byte_count = interp::EvalStackOp::get_param<int32_t>(params, 2);
+    auto chars = interp::EvalStackOp::get_param<Utf16Char*>(params, 3);
+    auto char_count = interp::EvalStackOp::get_param<int32_t>(params, 4);
+    auto decoder = interp::EvalStackOp::get_param<vm::RtObject*>(params, 5);
+    int32_t written;
+    if (decoder != nullptr || !SystemTextUtf8Encoding::try_get_chars(bytes, byte_count, chars, char_count, &written))
+    {
+        return invoke_managed(method, params, ret);
+    }
+    interp::EvalStackOp::set_return(ret, written);
+    RET_VOID_OK();
+}
+
+/// @intrinsic: System.Text.UTF8Encoding::GetString(System.Byte[],System.Int32,System.Int32)
+static RtResultVoid get_string_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method, const interp::RtStackObject* params,
+                                       interp::RtStackObject* ret)
+{
+    auto bytes = interp::EvalStackOp::get_param<vm::RtArray*>(params, 1);
+    auto index = interp::EvalStackOp::get_param<int32_t>(params, 2);
+    auto count = interp::EvalStackOp::get_param<int32_t>(params, 3);
+    vm::RtString* str;
+    if (!SystemTextUtf8Encoding::try_get_string(bytes, index, count, &str))
+    {
+        return invoke_managed(method, params, ret);
+    }
+    interp::EvalStackOp::set_return(ret, str);
+    RET_VOID_OK();
+}
+
+// ========== Intrinsic Entries ==========
+
+static vm::IntrinsicEntry s_intrinsic_entries[] = {
+    {"System.Text.UTF8Encoding::GetByteCount(System.Char*,System.Int32,System.Text.EncoderNLS)", nullptr, get_byte_count_invoker},
+    {"System.Text.UTF8Encoding::GetBytes(System.Char*,System.Int32,System.Byte*,System.Int32,System.Text.EncoderNLS)", nullptr, get_bytes_invoker},
+    {"System.Text.UTF8Encoding::GetCharCount(System.Byte*,System.Int32,System.Text.DecoderNLS)", nullptr, get_char_count_invoker},
+    {"System.Text.UTF8Encoding::GetChars(System.Byte*,System.Int32,System.Char*,System.Int32,System.Text.DecoderNLS)", nullptr, get_chars_invoker},
+    {"System.Text.UTF8Encoding::GetString(System.Byte[],System.Int32,System.Int32)", nullptr, get_string_invoker},
+};
+
+utils::Span<vm::IntrinsicEntry> SystemTextUtf8Encoding::get_intrinsic_entries()
+{
+    constexpr size_t entry_count = sizeof(s_intrinsic_entries) / sizeof(s_intrinsic_entries[0]);
+    return utils::Span<vm::IntrinsicEntry>(s_intrinsic_entries, entry_count);
+}
+
+} // namespace leanclr::intrinsics
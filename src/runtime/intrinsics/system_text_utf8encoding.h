@@ -0,0 +1,23 @@
+#pragma once
+
+#include "vm/intrinsics.h"
+
+namespace leanclr::intrinsics
+{
+// UTF8Encoding conversions that every Encoding.UTF8 GetByteCount/GetBytes/GetCharCount/GetChars/GetString
+// overload funnels into, run by utils::Utf8Transcoder. Only stateless calls on well-formed input that fits
+// the destination are handled natively; encoder and decoder state, fallbacks and argument errors stay with
+// the corlib implementation, which the invokers run instead.
+class SystemTextUtf8Encoding
+{
+  public:
+    // Each returns false when the call has to go to the corlib implementation.
+    static bool try_get_byte_count(const Utf16Char* chars, int32_t char_count, int32_t* byte_count);
+    static bool try_get_bytes(const Utf16Char* chars, int32_t char_count, uint8_t* bytes, int32_t byte_count, int32_t* written);
+    static bool try_get_char_count(const uint8_t* bytes, int32_t byte_count, int32_t* char_count);
+    static bool try_get_chars(const uint8_t* bytes, int32_t byte_count, Utf16Char* chars, int32_t char_count, int32_t* written);
+    static bool try_get_string(vm::RtArray* bytes, int32_t index, int32_t count, vm::RtString** result);
+
+    static utils::Span<vm::IntrinsicEntry> get_intrinsic_entries();
+};
+} // namespace leanclr::intrinsics
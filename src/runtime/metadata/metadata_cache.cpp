@@ -382,13 +382,14 @@ RtResult<const RtGenericInst*> MetadataCache::get_pooled_generic_inst(const RtTy
         RET_OK(*it);
 
     // Allocate new generic instance
-    const RtTypeSig** new_args = alloc::MetadataAllocation::calloc_any<const RtTypeSig*>(genericArgCount);
+    alloc::MemPool& pool = get_owner_mem_pool(get_collectible_owner(&key), alloc::MemoryCategory::GenericInstances);
+    const RtTypeSig** new_args = pool.calloc_any<const RtTypeSig*>(genericArgCount);
     for (uint8_t i = 0; i < genericArgCount; ++i)
     {
         UNWRAP_OR_RET_ERR_ON_FAIL(new_args[i], get_pooled_typesig(genericArgs[i]->to_canonized_without_byref()));
     }
 
-    RtGenericInst* new_gi = alloc::MetadataAllocation::malloc_any_zeroed<RtGenericInst>();
+    RtGenericInst* new_gi = pool.malloc_any_zeroed<RtGenericInst>();
     new_gi->generic_args = new_args;
     new_gi->generic_arg_count = genericArgCount;
 
@@ -406,7 +407,8 @@ const RtGenericClass* MetadataCache::get_pooled_generic_class(uint32_t baseTypeD
         return *it;
 
     // Allocate new generic class
-    RtGenericClass* new_gc = alloc::MetadataAllocation::malloc_any_zeroed<RtGenericClass>();
+    alloc::MemPool& pool = get_owner_mem_pool(get_collectible_owner(&key), alloc::MemoryCategory::GenericInstances);
+    RtGenericClass* new_gc = pool.malloc_any_zeroed<RtGenericClass>();
     new_gc->base_type_def_gid = baseTypeDefGid;
     new_gc->class_inst = classInst;
 
@@ -431,7 +433,8 @@ const RtGenericMethod* MetadataCache::get_pooled_generic_method(uint32_t methodD
     if (it != g_genericMethodCache.end())
         return *it;
 
-    RtGenericMethod* gm = alloc::MetadataAllocation::malloc_any_zeroed<RtGenericMethod>();
+    alloc::MemPool& pool = get_owner_mem_pool(get_collectible_owner(&key), alloc::MemoryCategory::GenericInstances);
+    RtGenericMethod* gm = pool.malloc_any_zeroed<RtGenericMethod>();
     gm->base_method_gid = methodDefGid;
     gm->generic_context = RtGenericContext{classInst, methodInst};
     g_genericMethodCache.insert(gm);
@@ -450,17 +453,19 @@ RtResult<RtTypeSigByValRef> MetadataCache::get_pooled_ptr_typesigs_by_element_ty
 
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const RtTypeSig*, canonEle, get_pooled_typesig(eleType->to_canonized_without_byref()));
 
-    RtTypeSig* byVal = alloc::MetadataAllocation::malloc_any_zeroed<RtTypeSig>();
+    alloc::MemPool& pool = get_owner_mem_pool(get_collectible_owner(canonEle), alloc::MemoryCategory::Metadata);
+    RtTypeSig* byVal = pool.malloc_any_zeroed<RtTypeSig>();
     byVal->ele_type = RtElementType::Ptr;
     byVal->data.element_type = canonEle;
     byVal->by_ref = 0;
 
-    RtTypeSig* byRef = alloc::MetadataAllocation::malloc_any_zeroed<RtTypeSig>();
+    RtTypeSig* byRef = pool.malloc_any_zeroed<RtTypeSig>();
     *byRef = *byVal;
     byRef->by_ref = 1;
 
     RtTypeSigByValRef ret{byVal, byRef};
-    g_ptrTypesigCache.insert({key, ret});
+    // Keyed by the pooled element, the caller's one may not live as long as the cache.
+    g_ptrTypesigCache.insert({canonEle, ret});
     RET_OK(ret);
 }
 
@@ -484,17 +489,18 @@ RtResult<RtTypeSigByValRef> MetadataCache::get_pooled_szarray_typesigs_by_elemen
 
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const RtTypeSig*, canonEle, get_pooled_typesig(eleType->to_canonized_without_byref()));
 
-    RtTypeSig* byVal = alloc::MetadataAllocation::malloc_any_zeroed<RtTypeSig>();
+    alloc::MemPool& pool = get_owner_mem_pool(get_collectible_owner(canonEle), alloc::MemoryCategory::Metadata);
+    RtTypeSig* byVal = pool.malloc_any_zeroed<RtTypeSig>();
     byVal->ele_type = RtElementType::SZArray;
     byVal->data.element_type = canonEle;
     byVal->by_ref = 0;
 
-    RtTypeSig* byRef = alloc::MetadataAllocation::malloc_any_zeroed<RtTypeSig>();
+    RtTypeSig* byRef = pool.malloc_any_zeroed<RtTypeSig>();
     *byRef = *byVal;
     byRef->by_ref = 1;
 
     RtTypeSigByValRef ret{byVal, byRef};
-    g_szarrayTypesigCache.insert({key, ret});
+    g_szarrayTypesigCache.insert({canonEle, ret});
     RET_OK(ret);
 }
 
@@ -515,20 +521,21 @@ static RtResult<RtTypeSigByValRef> get_pooled_array_type_info(const RtTypeSig* e
         return it->second;
 
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const RtTypeSig*, canonEle, MetadataCache::get_pooled_typesig(eleTypeSig->to_canonized_without_byref()));
-    RtArrayType* array_type = alloc::MetadataAllocation::malloc_any_zeroed<RtArrayType>();
+    alloc::MemPool& pool = MetadataCache::get_owner_mem_pool(MetadataCache::get_collectible_owner(canonEle), alloc::MemoryCategory::Metadata);
+    RtArrayType* array_type = pool.malloc_any_zeroed<RtArrayType>();
     array_type->ele_type = canonEle;
     array_type->rank = rank;
 
-    RtTypeSig* byVal = alloc::MetadataAllocation::malloc_any_zeroed<RtTypeSig>();
+    RtTypeSig* byVal = pool.malloc_any_zeroed<RtTypeSig>();
     byVal->ele_type = RtElementType::Array;
     byVal->data.array_type = array_type;
 
-    RtTypeSig* byRef = alloc::MetadataAllocation::malloc_any_zeroed<RtTypeSig>();
+    RtTypeSig* byRef = pool.malloc_any_zeroed<RtTypeSig>();
     *byRef = *byVal;
     byRef->by_ref = 1;
 
     auto value = RtTypeSigByValRef{byVal, byRef};
-    g_arrayTypesigCache.insert({key, value});
+    g_arrayTypesigCache.insert({ArrayTypeSigKey{canonEle, rank}, value});
     return value;
 }
 
@@ -554,4 +561,159 @@ RtResult<const RtTypeSig*> MetadataCache::get_pooled_array_typesig_by_element_ty
     RtTypeSigByValRef pair = res.unwrap();
     RET_OK(byRef ? pair.by_ref : pair.by_val);
 }
+
+// ===== Collectible modules =====
+
+template <typename Pred>
+static RtModuleDef* find_module_by_gid(uint32_t gid, Pred pred)
+{
+    RtModuleDef* mod = RtModuleDef::get_module_by_id(RtMetadata::decode_module_id_from_gid(gid));
+    return mod && pred(mod) ? mod : nullptr;
+}
+
+template <typename Pred>
+static RtModuleDef* find_module_in_typesig(const RtTypeSig* typesig, Pred pred);
+
+template <typename Pred>
+static RtModuleDef* find_module_in_generic_inst(const RtGenericInst* inst, Pred pred)
+{
+    if (!inst)
+    {
+        return nullptr;
+    }
+    for (uint8_t i = 0; i < inst->generic_arg_count; ++i)
+    {
+        if (RtModuleDef* mod = find_module_in_typesig(inst->generic_args[i], pred))
+        {
+            return mod;
+        }
+    }
+    return nullptr;
+}
+
+template <typename Pred>
+static RtModuleDef* find_module_in_generic_class(const RtGenericClass* genericClass, Pred pred)
+{
+    RtModuleDef* mod = find_module_by_gid(genericClass->base_type_def_gid, pred);
+    return mod ? mod : find_module_in_generic_inst(genericClass->class_inst, pred);
+}
+
+template <typename Pred>
+static RtModuleDef* find_module_in_generic_method(const RtGenericMethod* genericMethod, Pred pred)
+{
+    RtModuleDef* mod = find_module_by_gid(genericMethod->base_method_gid, pred);
+    if (!mod)
+    {
+        mod = find_module_in_generic_inst(genericMethod->generic_context.class_inst, pred);
+    }
+    return mod ? mod : find_module_in_generic_inst(genericMethod->generic_context.method_inst, pred);
+}
+
+template <typename Pred>
+static RtModuleDef* find_module_in_typesig(const RtTypeSig* typesig, Pred pred)
+{
+    switch (typesig->ele_type)
+    {
+    case RtElementType::Class:
+    case RtElementType::ValueType:
+        return find_module_by_gid(typesig->data.type_def_gid, pred);
+    case RtElementType::Ptr:
+    case RtElementType::SZArray:
+        return find_module_in_typesig(typesig->data.element_type, pred);
+    case RtElementType::Array:
+        return find_module_in_typesig(typesig->data.array_type->ele_type, pred);
+    case RtElementType::GenericInst:
+        return find_module_in_generic_class(typesig->data.generic_class, pred);
+    case RtElementType::Var:
+    case RtElementType::MVar:
+        return find_module_by_gid(typesig->data.generic_param->gid, pred);
+    default:
+        return nullptr;
+    }
+}
+
+static bool is_collectible_module(const RtModuleDef* mod)
+{
+    return mod->is_collectible();
+}
+
+static bool is_unloading_module(const RtModuleDef* mod)
+{
+    return mod->is_unloading();
+}
+
+RtModuleDef* MetadataCache::get_collectible_owner(const RtTypeSig* typesig)
+{
+    return RtModuleDef::has_collectible_modules() ? find_module_in_typesig(typesig, is_collectible_module) : nullptr;
+}
+
+RtModuleDef* MetadataCache::get_collectible_owner(const RtGenericInst* inst)
+{
+    return RtModuleDef::has_collectible_modules() ? find_module_in_generic_inst(inst, is_collectible_module) : nullptr;
+}
+
+RtModuleDef* MetadataCache::get_collectible_owner(const RtGenericClass* genericClass)
+{
+    return RtModuleDef::has_collectible_modules() ? find_module_in_generic_class(genericClass, is_collectible_module) : nullptr;
+}
+
+RtModuleDef* MetadataCache::get_collectible_owner(const RtGenericMethod* genericMethod)
+{
+    return RtModuleDef::has_collectible_modules() ? find_module_in_generic_method(genericMethod, is_collectible_module) : nullptr;
+}
+
+alloc::MemPool& MetadataCache::get_owner_mem_pool(RtModuleDef* owner, alloc::MemoryCategory category)
+{
+    return owner ? owner->get_mem_pool() : alloc::MetadataAllocation::get_pool(category);
+}
+
+bool MetadataCache::refers_to_unloading_module(const RtTypeSig* typesig)
+{
+    return find_module_in_typesig(typesig, is_unloading_module) != nullptr;
+}
+
+bool MetadataCache::refers_to_unloading_module(const RtGenericInst* inst)
+{
+    return find_module_in_generic_inst(inst, is_unloading_module) != nullptr;
+}
+
+bool MetadataCache::refers_to_unloading_module(const RtClass* klass)
+{
+    if (klass->image && klass->image->is_unloading())
+    {
+        return true;
+    }
+    return klass->by_val && refers_to_unloading_module(klass->by_val);
+}
+
+bool MetadataCache::refers_to_unloading_module(const RtMethodInfo* method)
+{
+    if (refers_to_unloading_module(method->parent))
+    {
+        return true;
+    }
+    return method->generic_method && find_module_in_generic_method(method->generic_method, is_unloading_module) != nullptr;
+}
+
+void MetadataCache::purge_unloading_modules(utils::Vector<RtClass*>& releasedClasses)
+{
+    utils::erase_if(g_genericMethodCache, [](const RtGenericMethod* gm) { return find_module_in_generic_method(gm, is_unloading_module) != nullptr; });
+    utils::erase_if(g_genericClassCache,
+                    [&releasedClasses](const RtGenericClass* gc)
+                    {
+                        if (!find_module_in_generic_class(gc, is_unloading_module))
+                        {
+                            return false;
+                        }
+                        if (gc->cache_klass)
+                        {
+                            releasedClasses.push_back(gc->cache_klass);
+                        }
+                        return true;
+                    });
+    utils::erase_if(g_genericInstCache, [](const RtGenericInst* gi) { return refers_to_unloading_module(gi); });
+    utils::erase_if(g_ptrTypesigCache, [](const auto& entry) { return refers_to_unloading_module(entry.first); });
+    utils::erase_if(g_szarrayTypesigCache, [](const auto& entry) { return refers_to_unloading_module(entry.first); });
+    utils::erase_if(g_arrayTypesigCache, [](const auto& entry) { return refers_to_unloading_module(entry.first.element_type); });
+}
 } // namespace leanclr::metadata
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "rt_metadata.h"
+#include "alloc/mem_pool.h"
+#include "utils/rt_vector.h"
 
 namespace leanclr::metadata
 {
@@ -35,5 +37,23 @@ class MetadataCache
     // Multidimensional Array types
     static RtResult<RtTypeSigByValRef> get_pooled_array_typesigs_by_element_typesig(const RtTypeSig* elementType, uint8_t rank);
     static RtResult<const RtTypeSig*> get_pooled_array_typesig_by_element_typesig(const RtTypeSig* elementType, uint8_t rank, bool byRef);
+
+    // Collectible modules. Runtime data built over the metadata of a collectible module is allocated from that
+    // module's pool and dropped from the caches when the module is unloaded. These return the collectible module
+    // the given metadata refers to, the first one found if several, or null.
+    static RtModuleDef* get_collectible_owner(const RtTypeSig* typesig);
+    static RtModuleDef* get_collectible_owner(const RtGenericInst* inst);
+    static RtModuleDef* get_collectible_owner(const RtGenericClass* genericClass);
+    static RtModuleDef* get_collectible_owner(const RtGenericMethod* genericMethod);
+    // The owner's metadata pool, or the runtime-wide pool of category when there is no owner.
+    static alloc::MemPool& get_owner_mem_pool(RtModuleDef* owner, alloc::MemoryCategory category);
+
+    static bool refers_to_unloading_module(const RtTypeSig* typesig);
+    static bool refers_to_unloading_module(const RtGenericInst* inst);
+    static bool refers_to_unloading_module(const RtClass* klass);
+    static bool refers_to_unloading_module(const RtMethodInfo* method);
+    // Drops every cached signature, generic instance and generic method that refers to an unloading module.
+    // The classes created for the dropped generic classes are appended to releasedClasses.
+    static void purge_unloading_modules(utils::Vector<RtClass*>& releasedClasses);
 };
 } // namespace leanclr::metadata
@@ -1,5 +1,6 @@
 #include "metadata_name.h"
 #include "utils/string_builder.h"
+#include "utils/hash_util.h"
 #include "vm/class.h"
 #include "vm/method.h"
 #include "module_def.h"
@@ -8,7 +9,8 @@ namespace leanclr::metadata
 {
 
 // Helper to append class full name recursively (namespace + name, handling nested types)
-RtResultVoid MetadataName::append_klass_full_name(utils::StringBuilder& sb, RtClass* klass)
+template <typename Sink>
+static RtResultVoid append_klass_full_name_impl(Sink& sb, RtClass* klass)
 {
     // Check for enclosing type (nested class)
     if (klass->image)
@@ -17,7 +19,7 @@ RtResultVoid MetadataName::append_klass_full_name(utils::StringBuilder& sb, RtCl
         if (optEnclosingTypeDefRid)
         {
             DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtClass*, enclosing_klass, klass->image->get_class_by_type_def_rid(optEnclosingTypeDefRid.value()));
-            RET_ERR_ON_FAIL(append_klass_full_name(sb, enclosing_klass));
+            RET_ERR_ON_FAIL(append_klass_full_name_impl(sb, enclosing_klass));
             sb.append_char('/'); // nested types use '/' separator
             sb.append_cstr(klass->name);
             RET_VOID_OK();
@@ -35,7 +37,8 @@ RtResultVoid MetadataName::append_klass_full_name(utils::StringBuilder& sb, RtCl
 }
 
 // Helper to append type signature name based on element type
-RtResultVoid MetadataName::append_type_sig_name(utils::StringBuilder& sb, const RtTypeSig* type_sig)
+template <typename Sink>
+static RtResultVoid append_type_sig_name_impl(Sink& sb, const RtTypeSig* type_sig)
 {
     if (!type_sig)
     {
@@ -89,14 +92,14 @@ RtResultVoid MetadataName::append_type_sig_name(utils::StringBuilder& sb, const
     case RtElementType::Ptr:
     {
         const RtTypeSig* base_type = type_sig->data.element_type;
-        RET_ERR_ON_FAIL(append_type_sig_name(sb, base_type));
+        RET_ERR_ON_FAIL(append_type_sig_name_impl(sb, base_type));
         sb.append_char('*');
         break;
     }
     case RtElementType::ByRef:
     {
         const RtTypeSig* base_type = type_sig->data.element_type;
-        RET_ERR_ON_FAIL(append_type_sig_name(sb, base_type));
+        RET_ERR_ON_FAIL(append_type_sig_name_impl(sb, base_type));
         sb.append_char('&');
         break;
     }
@@ -104,7 +107,7 @@ RtResultVoid MetadataName::append_type_sig_name(utils::StringBuilder& sb, const
     case RtElementType::Class:
     {
         DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtClass*, klass, vm::Class::get_class_by_type_def_gid(type_sig->data.type_def_gid));
-        RET_ERR_ON_FAIL(append_klass_full_name(sb, klass));
+        RET_ERR_ON_FAIL(append_klass_full_name_impl(sb, klass));
         break;
     }
     case RtElementType::Var:
@@ -118,7 +121,7 @@ RtResultVoid MetadataName::append_type_sig_name(utils::StringBuilder& sb, const
     {
         const RtArrayType* arr_type = type_sig->data.array_type;
         const RtTypeSig* base_type = arr_type->ele_type;
-        RET_ERR_ON_FAIL(append_type_sig_name(sb, base_type));
+        RET_ERR_ON_FAIL(append_type_sig_name_impl(sb, base_type));
         sb.append_char('[');
         uint8_t rank = arr_type->rank;
         sb.append_chars(',', rank - 1);
@@ -129,7 +132,7 @@ RtResultVoid MetadataName::append_type_sig_name(utils::StringBuilder& sb, const
     {
         const RtGenericClass* generic_class = type_sig->data.generic_class;
         DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtClass*, generic_base_klass, vm::Class::get_class_by_type_def_gid(generic_class->base_type_def_gid));
-        RET_ERR_ON_FAIL(append_klass_full_name(sb, generic_base_klass));
+        RET_ERR_ON_FAIL(append_klass_full_name_impl(sb, generic_base_klass));
         sb.append_char('<');
 
         const RtGenericInst* generic_inst = generic_class->class_inst;
@@ -142,7 +145,7 @@ RtResultVoid MetadataName::append_type_sig_name(utils::StringBuilder& sb, const
                 sb.append_char(',');
             }
             const RtTypeSig* generic_arg_type = generic_args[i];
-            RET_ERR_ON_FAIL(append_type_sig_name(sb, generic_arg_type));
+            RET_ERR_ON_FAIL(append_type_sig_name_impl(sb, generic_arg_type));
         }
         sb.append_char('>');
         break;
@@ -164,7 +167,7 @@ RtResultVoid MetadataName::append_type_sig_name(utils::StringBuilder& sb, const
     case RtElementType::SZArray:
     {
         const RtTypeSig* base_type = type_sig->data.element_type;
-        RET_ERR_ON_FAIL(append_type_sig_name(sb, base_type));
+        RET_ERR_ON_FAIL(append_type_sig_name_impl(sb, base_type));
         sb.append_cstr("[]");
         break;
     }
@@ -184,12 +187,13 @@ RtResultVoid MetadataName::append_type_sig_name(utils::StringBuilder& sb, const
     RET_VOID_OK();
 }
 
-RtResultVoid MetadataName::append_method_full_name_without_params(utils::StringBuilder& sb, const RtMethodInfo* method)
+template <typename Sink>
+static RtResultVoid append_method_full_name_without_params_impl(Sink& sb, const RtMethodInfo* method)
 {
     RtClass* klass = method->parent;
 
     // Append class full name
-    RET_ERR_ON_FAIL(append_klass_full_name(sb, klass));
+    RET_ERR_ON_FAIL(append_klass_full_name_impl(sb, klass));
 
     // Append :: and method name
     sb.append_cstr("::");
@@ -203,15 +207,12 @@ RtResultVoid MetadataName::append_method_full_name_without_params(utils::StringB
         sb.append_chars(',', generic_param_count - 1);
         sb.append_char('>');
     }
-    sb.sure_null_terminator_but_not_append();
     RET_VOID_OK();
 }
 
-RtResultVoid MetadataName::append_method_full_name_with_params(utils::StringBuilder& sb, const RtMethodInfo* method)
+template <typename Sink>
+static RtResultVoid append_method_params_impl(Sink& sb, const RtMethodInfo* method)
 {
-    RET_ERR_ON_FAIL(append_method_full_name_without_params(sb, method));
-
-    // Append parameters
     sb.append_char('(');
     uint16_t param_count = method->parameter_count;
     for (uint16_t i = 0; i < param_count; ++i)
@@ -221,13 +222,58 @@ RtResultVoid MetadataName::append_method_full_name_with_params(utils::StringBuil
             sb.append_char(',');
         }
         const RtTypeSig* param = method->parameters[i];
-        RET_ERR_ON_FAIL(append_type_sig_name(sb, param));
+        RET_ERR_ON_FAIL(append_type_sig_name_impl(sb, param));
     }
     sb.append_char(')');
+    RET_VOID_OK();
+}
+
+RtResultVoid MetadataName::append_klass_full_name(utils::StringBuilder& sb, RtClass* klass)
+{
+    return append_klass_full_name_impl(sb, klass);
+}
+
+RtResultVoid MetadataName::append_type_sig_name(utils::StringBuilder& sb, const RtTypeSig* type_sig)
+{
+    return append_type_sig_name_impl(sb, type_sig);
+}
+
+RtResultVoid MetadataName::append_method_full_name_without_params(utils::StringBuilder& sb, const RtMethodInfo* method)
+{
+    RET_ERR_ON_FAIL(append_method_full_name_without_params_impl(sb, method));
+    sb.sure_null_terminator_but_not_append();
+    RET_VOID_OK();
+}
+
+RtResultVoid MetadataName::append_method_full_name_with_params(utils::StringBuilder& sb, const RtMethodInfo* method)
+{
+    RET_ERR_ON_FAIL(append_method_full_name_without_params_impl(sb, method));
+    RET_ERR_ON_FAIL(append_method_params_impl(sb, method));
+    sb.sure_null_terminator_but_not_append();
+    RET_VOID_OK();
+}
+
+RtResultVoid MetadataName::append_method_params(utils::StringBuilder& sb, const RtMethodInfo* method)
+{
+    RET_ERR_ON_FAIL(append_method_params_impl(sb, method));
     sb.sure_null_terminator_but_not_append();
     RET_VOID_OK();
 }
 
+RtResult<uint64_t> MetadataName::hash_method_full_name_without_params(const RtMethodInfo* method)
+{
+    utils::StreamingNameHasher hasher;
+    RET_ERR_ON_FAIL(append_method_full_name_without_params_impl(hasher, method));
+    RET_OK(hasher.get_hash());
+}
+
+RtResult<uint64_t> MetadataName::hash_method_params(const RtMethodInfo* method)
+{
+    utils::StreamingNameHasher hasher;
+    RET_ERR_ON_FAIL(append_method_params_impl(hasher, method));
+    RET_OK(hasher.get_hash());
+}
+
 // RtResult<const char*> MetadataName::build_class_full_name(const RtClass* klass)
 // {
 //     utils::StringBuilder sb;
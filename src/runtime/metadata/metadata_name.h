@@ -12,6 +12,13 @@ class MetadataName
     static RtResultVoid append_type_sig_name(utils::StringBuilder& sb, const RtTypeSig* type_sig);
     static RtResultVoid append_method_full_name_with_params(utils::StringBuilder& sb, const RtMethodInfo* method);
     static RtResultVoid append_method_full_name_without_params(utils::StringBuilder& sb, const RtMethodInfo* method);
+    // Appends "(T1,T2)".
+    static RtResultVoid append_method_params(utils::StringBuilder& sb, const RtMethodInfo* method);
+
+    // Hash the same bytes the append_* functions would produce, without building the string.
+    // without_params hashes "Namespace.Class::Method", params hashes "(T1,T2)".
+    static RtResult<uint64_t> hash_method_full_name_without_params(const RtMethodInfo* method);
+    static RtResult<uint64_t> hash_method_params(const RtMethodInfo* method);
 
     // static RtResult<const char*> build_class_full_name(const RtClass* klass);
     // static RtResult<const char*> build_method_full_name_with_params(const RtMethodInfo* method);
@@ -0,0 +1,365 @@
+#include "metadata_snapshot.h"
+
+#include "module_def.h"
+#include "alloc/general_allocation.h"
+#include "utils/binary_reader.h"
+#include "utils/rt_vector.h"
+
+#include <cstring>
+
+namespace leanclr::metadata
+{
+
+constexpr uint32_t kSnapshotMagic = 0x534D434C; // "LCMS"
+// Bump whenever the record layout or the tables RtModuleDef::load derives change.
+constexpr uint32_t kSnapshotVersion = 1;
+constexpr size_t kMvidSize = 16;
+
+struct SnapshotModuleRecord
+{
+    const char* name;
+    uint32_t name_length;
+    const uint8_t* mvid;
+    uint32_t image_length;
+    // Offset of the tables, which run up to the next record.
+    size_t tables_offset;
+    size_t tables_length;
+};
+
+static uint8_t* g_snapshot_data = nullptr;
+static size_t g_snapshot_size = 0;
+static utils::Vector<SnapshotModuleRecord> g_snapshot_records;
+
+static const uint8_t* get_mvid(const RtModuleDef& mod)
+{
+    static const uint8_t kEmptyMvid[kMvidSize] = {};
+    const CliImage& image = mod.get_cli_image();
+    auto opt_row = image.read_module(1);
+    const CliHeap& guid_heap = image.get_guid_heap();
+    // Guid heap indices are 1-based.
+    if (!opt_row || opt_row->mvid == 0 || opt_row->mvid * kMvidSize > guid_heap.size)
+    {
+        return kEmptyMvid;
+    }
+    return guid_heap.data + (opt_row->mvid - 1) * kMvidSize;
+}
+
+class SnapshotWriter
+{
+  public:
+    void write_u32(uint32_t value)
+    {
+        write_bytes(&value, sizeof(value));
+    }
+
+    void write_bytes(const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            _data.push_back(bytes[i]);
+        }
+    }
+
+    void patch_u32(size_t offset, uint32_t value)
+    {
+        std::memcpy(_data.data() + offset, &value, sizeof(value));
+    }
+
+    size_t size() const
+    {
+        return _data.size();
+    }
+
+    const uint8_t* data() const
+    {
+        return _data.data();
+    }
+
+  private:
+    utils::Vector<uint8_t> _data;
+};
+
+class RtModuleDefSnapshot
+{
+  public:
+    static void write(const RtModuleDef& mod, SnapshotWriter& writer)
+    {
+        const uint8_t* strings = mod._cliImage.get_string_heap().data;
+        uint32_t name_length = static_cast<uint32_t>(std::strlen(mod._nameNoExt));
+        writer.write_u32(name_length);
+        writer.write_bytes(mod._nameNoExt, name_length);
+        writer.write_bytes(get_mvid(mod), kMvidSize);
+        writer.write_u32(static_cast<uint32_t>(mod._cliImage.get_image_length()));
+        size_t tables_length_offset = writer.size();
+        writer.write_u32(0);
+        size_t tables_offset = writer.size();
+
+        writer.write_u32(static_cast<uint32_t>(mod._typeDefFullName2TypeDefRidMap.size()));
+        for (const auto& [full_name, rid] : mod._typeDefFullName2TypeDefRidMap)
+        {
+            writer.write_u32(static_cast<uint32_t>(reinterpret_cast<const uint8_t*>(full_name.namespace_name) - strings));
+            writer.write_u32(static_cast<uint32_t>(reinterpret_cast<const uint8_t*>(full_name.name) - strings));
+            writer.write_u32(rid);
+        }
+        writer.write_u32(static_cast<uint32_t>(mod._typeDefFullName2ExportedTypeRidMap.size()));
+        for (const auto& [full_name, token] : mod._typeDefFullName2ExportedTypeRidMap)
+        {
+            writer.write_u32(static_cast<uint32_t>(reinterpret_cast<const uint8_t*>(full_name.namespace_name) - strings));
+            writer.write_u32(static_cast<uint32_t>(reinterpret_cast<const uint8_t*>(full_name.name) - strings));
+            writer.write_u32(token.to_encoded_id());
+        }
+        writer.write_u32(static_cast<uint32_t>(mod._nestedTypeDefRid2EnclosingTypeDefRidMap.size()));
+        for (const auto& [nested_rid, enclosing_rid] : mod._nestedTypeDefRid2EnclosingTypeDefRidMap)
+        {
+            writer.write_u32(nested_rid);
+            writer.write_u32(enclosing_rid);
+        }
+        writer.write_u32(static_cast<uint32_t>(mod._fieldRid2OffsetMap.size()));
+        for (const auto& [field_rid, offset] : mod._fieldRid2OffsetMap)
+        {
+            writer.write_u32(field_rid);
+            writer.write_u32(offset);
+        }
+        writer.write_u32(static_cast<uint32_t>(mod._typeDefRid2ClassLayoutMap.size()));
+        for (const auto& [type_def_rid, layout] : mod._typeDefRid2ClassLayoutMap)
+        {
+            writer.write_u32(type_def_rid);
+            writer.write_u32(layout.packing);
+            writer.write_u32(layout.size);
+        }
+        writer.patch_u32(tables_length_offset, static_cast<uint32_t>(writer.size() - tables_offset));
+    }
+
+    static bool restore(RtModuleDef& mod, utils::BinaryReader& reader)
+    {
+        if (read_tables(mod, reader))
+        {
+            mod.setup_enclosing_types();
+            return true;
+        }
+        mod._typeDefFullName2TypeDefRidMap.clear();
+        mod._typeDefFullName2ExportedTypeRidMap.clear();
+        mod._nestedTypeDefRid2EnclosingTypeDefRidMap.clear();
+        mod._fieldRid2OffsetMap.clear();
+        mod._typeDefRid2ClassLayoutMap.clear();
+        return false;
+    }
+
+  private:
+    static bool read_full_name(const RtModuleDef& mod, utils::BinaryReader& reader, utils::FullNameStr& full_name)
+    {
+        uint32_t namespace_index;
+        uint32_t name_index;
+        if (!reader.try_read_u32(namespace_index) || !reader.try_read_u32(name_index))
+        {
+            return false;
+        }
+        auto namespace_ret = mod.get_string(namespace_index);
+        auto name_ret = mod.get_string(name_index);
+        if (namespace_ret.is_err() || name_ret.is_err())
+        {
+            return false;
+        }
+        full_name = utils::FullNameStr(namespace_ret.unwrap(), name_ret.unwrap());
+        return true;
+    }
+
+    static bool read_tables(RtModuleDef& mod, utils::BinaryReader& reader)
+    {
+        const CliImage& image = mod._cliImage;
+        uint32_t type_def_count = image.get_table_row_num(TableType::TypeDef);
+        uint32_t field_count = image.get_table_row_num(TableType::Field);
+        uint32_t count;
+
+        if (!reader.try_read_u32(count))
+        {
+            return false;
+        }
+        mod._typeDefFullName2TypeDefRidMap.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            utils::FullNameStr full_name(nullptr, nullptr);
+            uint32_t rid;
+            if (!read_full_name(mod, reader, full_name) || !reader.try_read_u32(rid) || rid == 0 || rid > type_def_count)
+            {
+                return false;
+            }
+            mod._typeDefFullName2TypeDefRidMap.insert({full_name, rid});
+        }
+
+        if (!reader.try_read_u32(count))
+        {
+            return false;
+        }
+        mod._typeDefFullName2ExportedTypeRidMap.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            utils::FullNameStr full_name(nullptr, nullptr);
+            uint32_t token;
+            if (!read_full_name(mod, reader, full_name) || !reader.try_read_u32(token))
+            {
+                return false;
+            }
+            mod._typeDefFullName2ExportedTypeRidMap.insert({full_name, RtToken::decode(token)});
+        }
+
+        if (!reader.try_read_u32(count))
+        {
+            return false;
+        }
+        mod._nestedTypeDefRid2EnclosingTypeDefRidMap.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t nested_rid;
+            uint32_t enclosing_rid;
+            if (!reader.try_read_u32(nested_rid) || !reader.try_read_u32(enclosing_rid) || nested_rid == 0 || nested_rid > type_def_count ||
+                enclosing_rid == 0 || enclosing_rid > type_def_count)
+            {
+                return false;
+            }
+            mod._nestedTypeDefRid2EnclosingTypeDefRidMap.insert({nested_rid, enclosing_rid});
+        }
+
+        if (!reader.try_read_u32(count))
+        {
+            return false;
+        }
+        mod._fieldRid2OffsetMap.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t field_rid;
+            uint32_t offset;
+            if (!reader.try_read_u32(field_rid) || !reader.try_read_u32(offset) || field_rid == 0 || field_rid > field_count)
+            {
+                return false;
+            }
+            mod._fieldRid2OffsetMap.insert({field_rid, offset});
+        }
+
+        if (!reader.try_read_u32(count))
+        {
+            return false;
+        }
+        mod._typeDefRid2ClassLayoutMap.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t type_def_rid;
+            uint32_t packing;
+            uint32_t size;
+            if (!reader.try_read_u32(type_def_rid) || !reader.try_read_u32(packing) || !reader.try_read_u32(size) || type_def_rid == 0 ||
+                type_def_rid > type_def_count)
+            {
+                return false;
+            }
+            mod._typeDefRid2ClassLayoutMap.insert({type_def_rid, ClassLayoutData(static_cast<uint16_t>(packing), size)});
+        }
+        return reader.get_position() == reader.length();
+    }
+};
+
+size_t MetadataSnapshot::write(uint8_t* buffer, size_t buffer_size)
+{
+    SnapshotWriter writer;
+    writer.write_u32(kSnapshotMagic);
+    writer.write_u32(kSnapshotVersion);
+    utils::Span<RtModuleDef*> modules = RtModuleDef::get_registered_modules();
+    writer.write_u32(static_cast<uint32_t>(modules.size()));
+    for (RtModuleDef* mod : modules)
+    {
+        RtModuleDefSnapshot::write(*mod, writer);
+    }
+    if (writer.size() <= buffer_size)
+    {
+        std::memcpy(buffer, writer.data(), writer.size());
+    }
+    return writer.size();
+}
+
+static bool read_records(utils::BinaryReader& reader)
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t module_count;
+    if (!reader.try_read_u32(magic) || !reader.try_read_u32(version) || !reader.try_read_u32(module_count) || magic != kSnapshotMagic ||
+        version != kSnapshotVersion)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < module_count; ++i)
+    {
+        SnapshotModuleRecord record;
+        const char* name;
+        const uint8_t* mvid;
+        if (!reader.try_read_u32(record.name_length) || !reader.try_peek_any_ptr_range(record.name_length, name) ||
+            !reader.try_advance(record.name_length) || !reader.try_peek_any_ptr_range(kMvidSize, mvid) || !reader.try_advance(kMvidSize))
+        {
+            return false;
+        }
+        uint32_t tables_length;
+        if (!reader.try_read_u32(record.image_length) || !reader.try_read_u32(tables_length))
+        {
+            return false;
+        }
+        record.name = name;
+        record.mvid = mvid;
+        record.tables_offset = reader.get_position();
+        record.tables_length = tables_length;
+        if (!reader.try_advance(tables_length))
+        {
+            return false;
+        }
+        g_snapshot_records.push_back(record);
+    }
+    return reader.get_position() == reader.length();
+}
+
+RtResultVoid MetadataSnapshot::set(const uint8_t* data, size_t size)
+{
+    clear();
+    g_snapshot_data = static_cast<uint8_t*>(alloc::GeneralAllocation::malloc(size, alloc::MemoryCategory::Metadata));
+    std::memcpy(g_snapshot_data, data, size);
+    g_snapshot_size = size;
+    utils::BinaryReader reader(g_snapshot_data, g_snapshot_size);
+    if (!read_records(reader))
+    {
+        clear();
+        RET_ERR(RtErr::BadImageFormat);
+    }
+    RET_VOID_OK();
+}
+
+void MetadataSnapshot::clear()
+{
+    if (g_snapshot_data)
+    {
+        alloc::GeneralAllocation::free(g_snapshot_data, alloc::MemoryCategory::Metadata);
+        g_snapshot_data = nullptr;
+        g_snapshot_size = 0;
+    }
+    g_snapshot_records.clear();
+}
+
+bool MetadataSnapshot::restore(RtModuleDef& mod)
+{
+    if (g_snapshot_records.empty())
+    {
+        return false;
+    }
+    const char* name = mod.get_name_no_ext();
+    size_t name_length = std::strlen(name);
+    const uint8_t* mvid = get_mvid(mod);
+    size_t image_length = mod.get_cli_image().get_image_length();
+    for (const SnapshotModuleRecord& record : g_snapshot_records)
+    {
+        if (record.name_length == name_length && std::memcmp(record.name, name, name_length) == 0 && std::memcmp(record.mvid, mvid, kMvidSize) == 0 &&
+            record.image_length == image_length)
+        {
+            utils::BinaryReader reader(g_snapshot_data + record.tables_offset, record.tables_length);
+            return RtModuleDefSnapshot::restore(mod, reader);
+        }
+    }
+    return false;
+}
+
+} // namespace leanclr::metadata
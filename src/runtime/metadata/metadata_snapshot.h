@@ -0,0 +1,33 @@
+#pragma once
+
+#include "rt_base.h"
+
+namespace leanclr::metadata
+{
+
+class RtModuleDef;
+
+// Snapshot of the lookup tables RtModuleDef::load derives from the metadata tables: the type full name and
+// exported type maps, nested classes, explicit field offsets and class layouts.
+//
+// Entries are stored as string heap indices and rids, so a snapshot stays valid across processes for as long
+// as the assemblies are byte for byte the same. Each module is matched by name, MVID and image size; modules
+// without a matching record are set up from their metadata tables as usual.
+class MetadataSnapshot
+{
+  public:
+    // Writes the tables of all loaded modules and returns the number of bytes the snapshot takes. Nothing is
+    // written if that is more than buffer_size.
+    static size_t write(uint8_t* buffer, size_t buffer_size);
+
+    // Copies a snapshot for the modules loaded from now on, replacing the current one. Fails with
+    // BadImageFormat, leaving no snapshot set, if data is not a snapshot of this runtime version.
+    static RtResultVoid set(const uint8_t* data, size_t size);
+    static void clear();
+
+    // Fills the tables of mod from the snapshot. Returns false, leaving them empty, if the snapshot has no
+    // record for the module or the record does not fit its metadata.
+    static bool restore(RtModuleDef& mod);
+};
+
+} // namespace leanclr::metadata
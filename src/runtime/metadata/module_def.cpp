@@ -6,29 +6,58 @@
 #include "alloc/general_allocator.h"
 #include "metadata/metadata_cache.h"
 #include "metadata/metadata_compare.h"
+#include "metadata/metadata_snapshot.h"
 #include "vm/rt_string.h"
 #include "vm/assembly.h"
 #include "vm/class.h"
 #include "vm/method.h"
 
+#include <algorithm>
+
 namespace leanclr::metadata
 {
 
 // Helper constants
 
-static uint32_t allocate_image_id()
+// Modules indexed by id - 1. A slot is taken from the start of RtModuleDef::load, so that nested loads
+// never get the same id, and freed with the module. Slots of unloaded collectible modules are reused.
+static utils::Vector<RtModuleDef*> g_moduleSlots;
+// Registered modules in load order.
+static utils::Vector<RtModuleDef*> g_loadedModuleDefs;
+static RtModuleDef* g_corlibModule = nullptr;
+static uint32_t g_collectibleModuleCount = 0;
+
+static uint32_t allocate_image_id(RtModuleDef* moduleDef)
 {
-    static uint32_t next_id = 1;
-    if (next_id >= MAX_ASSEMBLY_ID_COUNT)
+    for (size_t i = 0; i < g_moduleSlots.size(); ++i)
+    {
+        if (!g_moduleSlots[i])
+        {
+            g_moduleSlots[i] = moduleDef;
+            return static_cast<uint32_t>(i + 1);
+        }
+    }
+    if (g_moduleSlots.size() + 1 >= MAX_ASSEMBLY_ID_COUNT)
     {
         // Exhausted all available IDs
         return 0;
     }
-    return next_id++;
+    g_moduleSlots.push_back(moduleDef);
+    return static_cast<uint32_t>(g_moduleSlots.size());
 }
 
-static utils::Vector<RtModuleDef*> g_loadedModuleDefs;
-static RtModuleDef* g_corlibModule = nullptr;
+RtModuleDef::~RtModuleDef()
+{
+    if (_id != 0 && g_moduleSlots[_id - 1] == this)
+    {
+        g_moduleSlots[_id - 1] = nullptr;
+    }
+    if (_codePool)
+    {
+        alloc::GeneralAllocation::delete_any(_codePool);
+    }
+    alloc::GeneralAllocation::free(const_cast<char*>(_name));
+}
 
 void RtModuleDef::register_module_def(RtModuleDef* moduleDef)
 {
@@ -37,8 +66,28 @@ void RtModuleDef::register_module_def(RtModuleDef* moduleDef)
         assert(g_corlibModule == nullptr && "Corlib module already registered");
         g_corlibModule = moduleDef;
     }
+    assert(g_moduleSlots[moduleDef->get_id() - 1] == moduleDef);
     g_loadedModuleDefs.push_back(moduleDef);
-    assert(g_loadedModuleDefs.size() == moduleDef->get_id());
+    if (moduleDef->is_collectible())
+    {
+        ++g_collectibleModuleCount;
+    }
+}
+
+void RtModuleDef::unregister_module_def(RtModuleDef* moduleDef)
+{
+    assert(moduleDef->is_collectible());
+    // Keep the load order of the remaining modules.
+    auto it = std::find(g_loadedModuleDefs.begin(), g_loadedModuleDefs.end(), moduleDef);
+    assert(it != g_loadedModuleDefs.end());
+    std::copy(it + 1, g_loadedModuleDefs.end(), it);
+    g_loadedModuleDefs.pop_back();
+    --g_collectibleModuleCount;
+}
+
+bool RtModuleDef::has_collectible_modules()
+{
+    return g_collectibleModuleCount > 0;
 }
 
 utils::Span<RtModuleDef*> RtModuleDef::get_registered_modules()
@@ -60,11 +109,11 @@ RtModuleDef* RtModuleDef::find_module(const char* name)
 
 RtModuleDef* RtModuleDef::get_module_by_id(uint32_t id)
 {
-    if (id == 0 || id > g_loadedModuleDefs.size())
+    if (id == 0 || id > g_moduleSlots.size())
     {
         return nullptr;
     }
-    return g_loadedModuleDefs[id - 1];
+    return g_moduleSlots[id - 1];
 }
 
 RtModuleDef* RtModuleDef::get_corlib_module()
@@ -147,7 +196,7 @@ RtResult<vm::RtString*> RtModuleDef::get_user_string(uint32_t index)
 
 RtResultVoid RtModuleDef::load()
 {
-    _id = allocate_image_id();
+    _id = allocate_image_id(this);
     if (_id == 0)
     {
         return RtErr::ExceedMaxImageCount;
@@ -183,11 +232,15 @@ RtResultVoid RtModuleDef::load()
     _typeDefByRefTypeSigs = _pool.calloc_any<RtTypeSig>(typeDefCount);
 
     RET_ERR_ON_FAIL(setup_generic_params_and_containers());
-    // setup nested classes must be before setup_type_fullname_map because we don't keep fullname map for nested types
-    RET_ERR_ON_FAIL(setup_nested_classes());
-    RET_ERR_ON_FAIL(setup_type_fullname_map());
-    setup_field_offsets();
-    setup_class_layouts();
+    _loadedFromSnapshot = MetadataSnapshot::restore(*this);
+    if (!_loadedFromSnapshot)
+    {
+        // setup nested classes must be before setup_type_fullname_map because we don't keep fullname map for nested types
+        RET_ERR_ON_FAIL(setup_nested_classes());
+        RET_ERR_ON_FAIL(setup_type_fullname_map());
+        setup_field_offsets();
+        setup_class_layouts();
+    }
 
     RET_VOID_OK();
 }
@@ -279,6 +332,15 @@ RtResultVoid RtModuleDef::setup_nested_classes()
         uint32_t nestedTypeDefRid = row.nested_class;
         uint32_t enclosingTypeDefRid = row.enclosing_class;
         _nestedTypeDefRid2EnclosingTypeDefRidMap.insert({nestedTypeDefRid, enclosingTypeDefRid});
+    }
+    setup_enclosing_types();
+    RET_VOID_OK();
+}
+
+void RtModuleDef::setup_enclosing_types()
+{
+    for (auto& [nestedTypeDefRid, enclosingTypeDefRid] : _nestedTypeDefRid2EnclosingTypeDefRidMap)
+    {
         ++_enclosingTypeDefRid2StartRidMap[enclosingTypeDefRid].count;
     }
     for (auto& [key, value] : _enclosingTypeDefRid2StartRidMap)
@@ -293,7 +355,6 @@ RtResultVoid RtModuleDef::setup_nested_classes()
         EnclosingTypeInfo& eti = it->second;
         eti.nested_type_def_rids[eti.count++] = nestedTypeDefRid;
     }
-    RET_VOID_OK();
 }
 
 RtResultVoid RtModuleDef::setup_type_fullname_map()
@@ -389,6 +450,19 @@ RtResultVoid RtModuleDef::get_reference_assemblies(utils::Vector<RtAssembly*>& r
     RET_VOID_OK();
 }
 
+bool RtModuleDef::references_assembly(const RtAssembly* assembly) const
+{
+    for (uint32_t i = 0; i < _referenceAssemblyCount; ++i)
+    {
+        const ReferenceAssembly& ref_asm = _referenceAssemblies[i];
+        if (ref_asm.status == AssemblyResolveStatus::Success && ref_asm.assembly == assembly)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 static bool is_valuetype_or_enum(const char* namespace_name, const char* name)
 {
     return strcmp(namespace_name, STR_SYSTEM) == 0 && (strcmp(name, STR_VALUETYPE) == 0 || strcmp(name, STR_ENUM) == 0);
@@ -1788,6 +1862,30 @@ RtResult<RtCustomAttributeRawData> RtModuleDef::get_custom_attribute_raw_data(ui
     RET_OK(ret);
 }
 
+RtResult<RtCustomAttributeCache*> RtModuleDef::get_custom_attribute_cache(EncodedTokenId parentToken)
+{
+    auto it = _customAttributeCacheMap.find(parentToken);
+    if (it != _customAttributeCacheMap.end())
+    {
+        RET_OK(it->second);
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(RtCustomAttributeRidRange, ridRange, get_custom_attribute_rid_range(parentToken));
+    RtCustomAttributeEntry* entries = ridRange.count > 0 ? _pool.calloc_any<RtCustomAttributeEntry>(ridRange.count) : nullptr;
+    for (uint32_t i = 0; i < ridRange.count; ++i)
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtCustomAttributeRawData, rawData, get_custom_attribute_raw_data(ridRange.start_rid + i));
+        RtCustomAttributeEntry& entry = entries[i];
+        entry.ctor = rawData.ctor;
+        entry.klass = rawData.ctor->parent;
+        entry.data_blob_index = rawData.dataBlobIndex;
+    }
+    RtCustomAttributeCache* cache = _pool.malloc_any_zeroed<RtCustomAttributeCache>();
+    cache->entries = entries;
+    cache->count = ridRange.count;
+    _customAttributeCacheMap.insert({parentToken, cache});
+    RET_OK(cache);
+}
+
 RtResult<RtModuleDef::RtGenericParamConstraint> RtModuleDef::read_generic_param_constraints(uint32_t genericParamRid, const RtGenericContainerContext& gcc)
 {
     auto opt_range = _cliImage.find_row_range_of_owner_at_sorted_table(TableType::GenericParamConstraint, 1, genericParamRid);
@@ -8,6 +8,7 @@
 #include "utils/rt_vector.h"
 #include "utils/binary_reader.h"
 #include "utils/hashmap.h"
+#include "utils/hashset.h"
 #include "utils/string_util.h"
 #include "utils/rt_span.h"
 
@@ -99,14 +100,20 @@ struct RtILEHSectionHeaderFat
 
 class RtModuleDef
 {
+    friend class RtModuleDefSnapshot;
+
   public:
     RtModuleDef(RtAssembly* assembly, const CliImage& cliImage, alloc::MemPool& pool)
         : _assembly(assembly), _cliImage(cliImage), _pool(pool), _name(nullptr), _nameNoExt(nullptr), _classes(nullptr), _classCount(0), _methods(nullptr),
-          _methodCount(0), _id(0), _refOnly(false), _referenceAssemblies(nullptr), _referenceAssemblyCount(0), _corLib(false), _moduleCctorFinished(false)
+          _methodCount(0), _id(0), _refOnly(false), _referenceAssemblies(nullptr), _referenceAssemblyCount(0), _corLib(false), _moduleCctorFinished(false),
+          _codePool(nullptr), _collectible(false), _unloading(false), _loadedFromSnapshot(false)
     {
     }
+    ~RtModuleDef();
 
     static void register_module_def(RtModuleDef* moduleDef);
+    // Removes an unloaded collectible module; its id is handed out again to later loads.
+    static void unregister_module_def(RtModuleDef* moduleDef);
     static utils::Span<RtModuleDef*> get_registered_modules();
     static RtModuleDef* find_module(const char* name);
     static RtModuleDef* get_module_by_id(uint32_t id);
@@ -127,6 +134,17 @@ class RtModuleDef
         return _pool;
     }
 
+    // Holds the transformed interpreter code of the module's methods, apart from the metadata so that memory
+    // stats can tell the two apart. Created by the first transform.
+    alloc::MemPool& get_code_mem_pool() const
+    {
+        if (!_codePool)
+        {
+            _codePool = alloc::GeneralAllocation::new_any<alloc::MemPool>(alloc::MemoryCategory::Code);
+        }
+        return *_codePool;
+    }
+
     // Module state
     bool is_module_cctor_finished() const
     {
@@ -138,6 +156,38 @@ class RtModuleDef
         _moduleCctorFinished = true;
     }
 
+    // Collectible modules belong to a vm::AssemblyLoadContext and are freed when it is unloaded. Runtime data
+    // derived from them (inflated generics, array types, interpreter code) is owned by the module as well.
+    bool is_collectible() const
+    {
+        return _collectible;
+    }
+
+    void set_collectible()
+    {
+        _collectible = true;
+    }
+
+    // True while the load context of the module is being unloaded, when caches drop what refers to it.
+    bool is_unloading() const
+    {
+        return _unloading;
+    }
+
+    void set_unloading(bool unloading)
+    {
+        _unloading = unloading;
+    }
+
+    // True if load restored the lookup tables from a MetadataSnapshot instead of building them.
+    bool is_loaded_from_snapshot() const
+    {
+        return _loadedFromSnapshot;
+    }
+
+    // Whether any collectible module is loaded, the fast path of the collectible owner lookups.
+    static bool has_collectible_modules();
+
     // Assembly info accessors
     const RtAssemblyName& get_assembly_name() const
     {
@@ -185,10 +235,11 @@ class RtModuleDef
     }
 
     // Class and method accessors
-    // RtClass** get_classes()
-    // {
-    //     return _classes;
-    // }
+    // Classes created so far, indexed by TypeDef rid - 1; entries of classes not created yet are null.
+    utils::Span<RtClass*> get_created_classes() const
+    {
+        return utils::Span<RtClass*>(_classes, _classCount);
+    }
     uint32_t get_class_count() const
     {
         return _classCount;
@@ -211,10 +262,22 @@ class RtModuleDef
     RtResult<utils::BinaryReader> get_decoded_blob_reader(uint32_t index) const;
     RtResult<vm::RtString*> get_user_string(uint32_t index);
 
+    // Intern table entries the code of this module asked for; returns false if s was already recorded.
+    bool add_interned_string(vm::RtString* s)
+    {
+        return _internedStrings.insert(s).second;
+    }
+
+    const utils::HashSet<vm::RtString*>& get_interned_strings() const
+    {
+        return _internedStrings;
+    }
+
     RtResultVoid load();
     RtResultVoid setup_assembly_name();
     RtResultVoid setup_generic_params_and_containers();
     RtResultVoid setup_nested_classes();
+    void setup_enclosing_types();
     RtResultVoid setup_type_fullname_map();
     void setup_field_offsets();
     void setup_class_layouts();
@@ -291,6 +354,8 @@ class RtModuleDef
     // TODO: Implement reference assembly resolution
     RtResult<RtAssembly*> get_reference_assembly(uint32_t rid);
     RtResultVoid get_reference_assemblies(utils::Vector<RtAssembly*>& ref_assemblies);
+    // Whether an assembly reference of this module has been resolved to assembly.
+    bool references_assembly(const RtAssembly* assembly) const;
 
     struct RtGenericParamConstraint
     {
@@ -347,6 +412,7 @@ class RtModuleDef
 
     RtResult<RtCustomAttributeRidRange> get_custom_attribute_rid_range(EncodedTokenId parentToken);
     RtResult<RtCustomAttributeRawData> get_custom_attribute_raw_data(uint32_t customAttributeRid);
+    RtResult<RtCustomAttributeCache*> get_custom_attribute_cache(EncodedTokenId parentToken);
 
     /// @brief
     /// @param methodDefToken
@@ -412,7 +478,13 @@ class RtModuleDef
     bool _refOnly;
     bool _corLib;
     bool _moduleCctorFinished;
+    mutable alloc::MemPool* _codePool;
+    bool _collectible;
+    bool _unloading;
+    bool _loadedFromSnapshot;
 
     utils::HashMap<uint32_t, vm::RtString*> _userStringMap;
+    utils::HashSet<vm::RtString*> _internedStrings;
+    utils::HashMap<EncodedTokenId, RtCustomAttributeCache*> _customAttributeCacheMap;
 };
 } // namespace leanclr::metadata
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 #include "cli_metadata.h"
 #include "utils/rt_vector.h"
 
@@ -334,6 +336,19 @@ enum class RtMethodSemanticsAttributes : uint16_t
     Fire = 0x20,
 };
 
+// P/Invoke (ImplMap) attribute flags
+enum class RtPInvokeAttribute : uint16_t
+{
+    NoMangle = 0x0001,
+    CharSetMask = 0x0006,
+    CharSetNotSpec = 0x0000,
+    CharSetAnsi = 0x0002,
+    CharSetUnicode = 0x0004,
+    CharSetAuto = 0x0006,
+    SupportsLastError = 0x0040,
+    CallConvMask = 0x0700,
+};
+
 // Parameter attribute flags
 enum class RtParamAttribute : uint32_t
 {
@@ -527,30 +542,39 @@ enum class RtInvokerType : uint8_t
     RuntimeImpl,
     NewObjInternalCall,
     NewObjIntrinsic,
+    // P/Invoke bound to its DllImport entry point at run time rather than by a registered invoker.
+    DynamicPInvoke,
 };
 
-// Method information structure
-struct RtMethodInfo
+// Width of the cache line the hot fields of RtMethodInfo and RtClass are packed into.
+constexpr size_t RT_CACHE_LINE_SIZE = 64;
+
+// Method information structure. The first cache line holds what calls and virtual dispatch read; names,
+// signatures and tokens used by resolution and reflection follow.
+struct alignas(RT_CACHE_LINE_SIZE) RtMethodInfo
 {
-    RtClass* parent;
-    const char* name;
-    const RtGenericContainer* generic_container;
-    const RtGenericMethod* generic_method;
-    const RtTypeSig* return_type;
-    const RtTypeSig** parameters;
-    const RtMethodArgDesc* arg_descs;
+    // Hot: calls and dispatch
     RtManagedMethodPointer method_ptr;
     RtInvokeMethodPointer invoke_method_ptr;
     RtInvokeMethodPointer virtual_invoke_method_ptr;
     const interp::RtInterpMethodInfo* interp_data;
-    EncodedTokenId token;
-    uint16_t parameter_count;
+    RtClass* parent;
+    const RtGenericContainer* generic_container;
     uint16_t flags;
     uint16_t iflags;
     uint16_t slot;
+    uint16_t parameter_count;
     uint16_t total_arg_stack_object_size;
     uint16_t ret_stack_object_size;
     RtInvokerType invoker_type;
+
+    // Cold: resolution and reflection
+    const char* name;
+    const RtGenericMethod* generic_method;
+    const RtTypeSig* return_type;
+    const RtTypeSig** parameters;
+    const RtMethodArgDesc* arg_descs;
+    EncodedTokenId token;
 };
 
 // Property information structure
@@ -644,19 +668,38 @@ constexpr uint8_t RT_MAX_ARRAY_RANK = 0x32;
 struct RtAssembly;
 class RtModuleDef;
 
-// Class structure
-struct RtClass
+// Class structure. The first cache line holds what virtual and interface dispatch, casts and allocation read;
+// the second what class hierarchy walks, statics and array accesses read; metadata for resolution and
+// reflection follows.
+struct alignas(RT_CACHE_LINE_SIZE) RtClass
 {
-    RtModuleDef* image;
+    // Hot: dispatch, casts and allocation
+    const RtVirtualInvokeData* vtable;
+    const RtInterfaceOffset* interface_vtable_offsets;
+    RtClass** super_types;
+    RtClass* cast_class;
+    RtClass* element_class;
+    const RtTypeSig* by_val;
+    uint32_t instance_size_without_header;
+    uint32_t init_flags;
+    uint32_t flags;
+    uint32_t extra_flags;
+
+    // Warm: hierarchy walks and statics
     RtClass* parent;
+    RtClass** interfaces;
+    uint8_t* static_fields_data;
+    const RtTypeSig* by_ref;
+    uint16_t interface_vtable_offset_count;
+    uint16_t interface_count;
+    uint16_t vtable_count;
+    uint8_t hierarchy_depth;
+    uint8_t alignment;
+
+    // Cold: resolution and reflection
+    RtModuleDef* image;
     const char* namespaze;
     const char* name;
-    const RtTypeSig* by_val;
-    const RtTypeSig* by_ref;
-    RtClass* element_class;
-    RtClass* cast_class;
-    RtClass** super_types;
-    RtClass** interfaces;
     RtClass* declaring_class; // TODO, may be we can optimize out it
     RtClass** nested_classes; // TODO, may be we can optimize out it
     const RtGenericContainer* generic_container;
@@ -664,27 +707,21 @@ struct RtClass
     const RtMethodInfo** methods;
     const RtEventInfo* events;
     const RtPropertyInfo* properties;
-    const RtVirtualInvokeData* vtable;
-    const RtInterfaceOffset* interface_vtable_offsets;
-    uint8_t* static_fields_data;
     EncodedTokenId token;
-    uint32_t instance_size_without_header;
     uint32_t static_size;
-    uint32_t flags;
-    uint32_t extra_flags;
-    uint32_t init_flags;
     uint16_t nested_class_count; // TODO, may be we can optimize out it
-    uint16_t interface_count;
-    uint16_t interface_vtable_offset_count;
     uint16_t field_count;
     uint16_t method_count;
     uint16_t property_count;
     uint16_t event_count;
-    uint16_t vtable_count;
-    uint8_t hierarchy_depth;
-    uint8_t alignment;
 };
 
+// Layout contract of the hot fields. Reordering them past the first cache line slows every call, cast and
+// allocation, so it has to be a deliberate change of these asserts.
+static_assert(offsetof(RtMethodInfo, invoker_type) < RT_CACHE_LINE_SIZE, "RtMethodInfo call fields must fit the first cache line");
+static_assert(offsetof(RtClass, extra_flags) + sizeof(uint32_t) <= RT_CACHE_LINE_SIZE, "RtClass dispatch fields must fit the first cache line");
+static_assert(offsetof(RtClass, alignment) < 2 * RT_CACHE_LINE_SIZE, "RtClass hierarchy fields must fit the second cache line");
+
 struct RtCustomAttributeRidRange
 {
     const uint32_t start_rid;
@@ -697,6 +734,25 @@ struct RtCustomAttributeRawData
     uint32_t dataBlobIndex;
 };
 
+// One resolved CustomAttribute row. fixed_args is filled lazily by vm::CustomAttribute
+// when every ctor parameter is a primitive or enum, so the blob only needs the named args.
+struct RtCustomAttributeEntry
+{
+    const RtMethodInfo* ctor;
+    RtClass* klass;
+    uint32_t data_blob_index;
+    uint32_t named_args_offset;
+    const uint64_t* fixed_args;
+};
+
+// Lazily built per (module, target token) view of the CustomAttribute table.
+struct RtCustomAttributeCache
+{
+    RtCustomAttributeEntry* entries;
+    uint32_t count;
+    bool prepared;
+};
+
 class RtModuleDef;
 
 struct RtAssembly
@@ -0,0 +1,34 @@
+#include "dynamic_library.h"
+
+#if defined(LEANCLR_PLATFORM_WIN)
+#include <windows.h>
+#elif defined(LEANCLR_PLATFORM_POSIX)
+#include <dlfcn.h>
+#endif
+
+namespace leanclr::os
+{
+
+void* DynamicLibrary::open(const char* path)
+{
+#if defined(LEANCLR_PLATFORM_WIN)
+    return path ? reinterpret_cast<void*>(::LoadLibraryA(path)) : reinterpret_cast<void*>(::GetModuleHandleA(nullptr));
+#elif defined(LEANCLR_PLATFORM_POSIX)
+    return ::dlopen(path, RTLD_LAZY | RTLD_LOCAL);
+#else
+    return nullptr;
+#endif
+}
+
+void* DynamicLibrary::get_symbol(void* handle, const char* name)
+{
+#if defined(LEANCLR_PLATFORM_WIN)
+    return reinterpret_cast<void*>(::GetProcAddress(reinterpret_cast<HMODULE>(handle), name));
+#elif defined(LEANCLR_PLATFORM_POSIX)
+    return ::dlsym(handle, name);
+#else
+    return nullptr;
+#endif
+}
+
+} // namespace leanclr::os
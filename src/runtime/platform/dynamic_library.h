@@ -0,0 +1,16 @@
+#pragma once
+
+#include "rt_base.h"
+
+namespace leanclr::os
+{
+// Thin wrapper over dlopen/dlsym and LoadLibrary/GetProcAddress. Platforms without dynamic loading (wasm)
+// find nothing.
+class DynamicLibrary
+{
+  public:
+    // Loads the library at path, or the main program when path is nullptr. Returns nullptr on failure.
+    static void* open(const char* path);
+    static void* get_symbol(void* handle, const char* name);
+};
+} // namespace leanclr::os
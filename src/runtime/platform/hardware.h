@@ -2,14 +2,41 @@
 
 #include "rt_base.h"
 
+// Instruction sets the runtime's vector code may use. Selected at compile time only.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LEANCLR_SIMD_SSE2 1
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define LEANCLR_SIMD_SSE41 1
+#endif
+#if defined(__AVX2__)
+#define LEANCLR_SIMD_AVX2 1
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define LEANCLR_SIMD_NEON 1
+#endif
+
+#ifndef LEANCLR_SIMD_SSE2
+#define LEANCLR_SIMD_SSE2 0
+#endif
+#ifndef LEANCLR_SIMD_SSE41
+#define LEANCLR_SIMD_SSE41 0
+#endif
+#ifndef LEANCLR_SIMD_AVX2
+#define LEANCLR_SIMD_AVX2 0
+#endif
+#ifndef LEANCLR_SIMD_NEON
+#define LEANCLR_SIMD_NEON 0
+#endif
+
 namespace leanclr::pal
 {
 class Hardware
 {
   public:
+    // True when System.Numerics vector operations are lowered to SIMD instructions.
     static constexpr bool is_hardware_accelerated()
     {
-        return false;
+        return LEANCLR_SIMD_SSE2 || LEANCLR_SIMD_NEON;
     }
 };
 } // namespace leanclr::pal
@@ -29,9 +29,43 @@ struct LeanclrPropertyInfo;
 struct LeanclrEventInfo;
 struct LeanclrException;
 struct LeanclrStackObject;
+struct LeanclrAssemblyLoadContext;
 
 #define LEANCLR_STACK_OBJECT_SIZE 8
 
+typedef enum LeanclrMemoryCategory
+{
+    LEANCLR_MEMORY_CATEGORY_OTHER,
+    LEANCLR_MEMORY_CATEGORY_GC_HEAP,
+    LEANCLR_MEMORY_CATEGORY_METADATA,
+    LEANCLR_MEMORY_CATEGORY_CODE,
+    LEANCLR_MEMORY_CATEGORY_GENERIC_INSTANCES,
+    LEANCLR_MEMORY_CATEGORY_INTERNED_STRINGS,
+    LEANCLR_MEMORY_CATEGORY_REFLECTION,
+    LEANCLR_MEMORY_CATEGORY_HANDLES,
+    LEANCLR_MEMORY_CATEGORY_MACHINE_STACKS,
+    LEANCLR_MEMORY_CATEGORY_COUNT,
+} LeanclrMemoryCategory;
+
+typedef struct LeanclrMemoryCategoryStats
+{
+    uint64_t bytes;
+    uint64_t count;
+} LeanclrMemoryCategoryStats;
+
+typedef struct LeanclrMemoryStats
+{
+    LeanclrMemoryCategoryStats categories[LEANCLR_MEMORY_CATEGORY_COUNT];
+    uint64_t total_bytes;
+} LeanclrMemoryStats;
+
+typedef struct LeanclrClassHistogramEntry
+{
+    const LeanclrClass* klass;
+    uint64_t instance_count;
+    uint64_t bytes;
+} LeanclrClassHistogramEntry;
+
 #define leanclr_get_stack_object_size_of_byte_size(byte_size) (((byte_size) + LEANCLR_STACK_OBJECT_SIZE - 1) / LEANCLR_STACK_OBJECT_SIZE)
 
 #ifdef __cplusplus
@@ -46,6 +80,26 @@ extern "C"
     LEANCLR_API size_t leanclr_get_assemblies(LeanclrAssembly** out_assemblies, size_t out_assemblies_capacity, LeanclrException** out_exception);
     LEANCLR_API LeanclrAssembly* leanclr_get_assembly(const char* assembly_name);
     LEANCLR_API LeanclrAssembly* leanclr_load_assembly(const char* assembly_name, LeanclrException** out_exception);
+
+    // Collectible load contexts, for plugins and hot reload. Their assemblies are freed together by
+    // leanclr_unload_load_context, which also frees the context. The GC does not trace yet, so the host must
+    // first drop every reference to managed objects of the context, including pending timers, thread pool
+    // work items and delegates handed to native code. Unloading fails, returning an error code, while code of
+    // the context is running or an assembly outside the context references one of its assemblies.
+    // leanclr_load_assembly_into_context copies the image data.
+    LEANCLR_API LeanclrAssemblyLoadContext* leanclr_create_collectible_load_context();
+    LEANCLR_API LeanclrAssembly* leanclr_load_assembly_into_context(LeanclrAssemblyLoadContext* context, const void* data, size_t size,
+                                                                    LeanclrException** out_exception);
+    LEANCLR_API int32_t leanclr_unload_load_context(LeanclrAssemblyLoadContext* context);
+
+    // Metadata snapshots speed up loading assemblies that are byte for byte the same as in an earlier run.
+    // leanclr_write_metadata_snapshot writes the lookup tables built for the loaded assemblies and returns the
+    // buffer size needed; nothing is written if buffer_size is smaller. leanclr_set_metadata_snapshot copies
+    // a snapshot used by the assemblies loaded afterwards, typically before leanclr_initialize_runtime, and
+    // returns 0 or an error code. Assemblies the snapshot does not match are loaded as usual.
+    LEANCLR_API size_t leanclr_write_metadata_snapshot(void* buffer, size_t buffer_size);
+    LEANCLR_API int32_t leanclr_set_metadata_snapshot(const void* data, size_t size);
+
     LEANCLR_API LeanclrModuleDef* leanclr_get_assembly_by_module(LeanclrAssembly* ass);
     LEANCLR_API LeanclrAssembly* leanclr_get_module_by_assembly(LeanclrModuleDef* mod);
     LEANCLR_API bool leanclr_is_corlib(LeanclrModuleDef* mod);
@@ -98,6 +152,47 @@ extern "C"
     LEANCLR_API void leanclr_register_intrinsic_func(const char* name, LeanclrMethodPointer func, LeanclrMethodInvoker invoker);
     LEANCLR_API void leanclr_register_newobj_intrinsic_func(const char* name, LeanclrMethodInvoker invoker);
 
+    typedef void (*LeanclrThreadPoolWorkFunc)(void* arg);
+
+    // Queues a native callback on the runtime's work-stealing thread pool. The callback runs on a pool
+    // worker and must not call into managed code.
+    LEANCLR_API void leanclr_thread_pool_queue_work(LeanclrThreadPoolWorkFunc func, void* arg);
+    LEANCLR_API int32_t leanclr_thread_pool_get_worker_count();
+    // Runs the managed work items queued through System.Threading.ThreadPool. Managed work executes on the
+    // thread that calls this, typically once per frame of the embedder's main loop.
+    LEANCLR_API int32_t leanclr_run_thread_pool_work();
+
+    // Timers (System.Threading.Timer, Task.Delay) fire on the thread that pumps them. Blocking managed calls
+    // pump them automatically; hosts that never block, e.g. wasm, call leanclr_run_timers from their loop.
+    // Times are in milliseconds on the clock returned by leanclr_get_timer_clock_ms.
+    LEANCLR_API int64_t leanclr_get_timer_clock_ms();
+    LEANCLR_API int32_t leanclr_run_timers(int64_t now_ms);
+    // Time at which leanclr_run_timers next has work to do, or -1 when no timer is pending.
+    LEANCLR_API int64_t leanclr_get_next_timer_due_ms();
+
+    // Live bytes and allocation counts the runtime holds per LeanclrMemoryCategory. Memory pools count the
+    // regions they reserve.
+    LEANCLR_API void leanclr_get_memory_stats(LeanclrMemoryStats* out_stats);
+    LEANCLR_API const char* leanclr_get_memory_category_name(int32_t category);
+    // Per-class instance histogram of the GC heap, off by default as it costs a lookup per allocation.
+    // leanclr_get_class_histogram copies up to capacity entries, largest first, and returns the number of classes.
+    LEANCLR_API void leanclr_set_class_histogram_enabled(bool enabled);
+    LEANCLR_API size_t leanclr_get_class_histogram(LeanclrClassHistogramEntry* entries, size_t capacity);
+
+    // Sampling profiler over interpreter frames. leanclr_profiler_start samples the calling thread, which must
+    // be the runtime thread, frequency_hz times per second; buffer_samples bounds the samples pending between
+    // two drains of the sampler, 0 for the default. Returns 0 or an error code.
+    LEANCLR_API int32_t leanclr_profiler_start(int32_t frequency_hz, int32_t buffer_samples);
+    LEANCLR_API void leanclr_profiler_stop();
+    LEANCLR_API void leanclr_profiler_reset();
+    LEANCLR_API uint64_t leanclr_profiler_get_sample_count();
+    LEANCLR_API uint64_t leanclr_profiler_get_dropped_sample_count();
+    // Writes the samples collected so far in collapsed stack format, one "Frame;Frame;... count" line per
+    // distinct stack, and returns the buffer size needed including the terminating zero. Nothing is written
+    // if buffer_size is smaller. With include_il_offsets, frames are suffixed with "@IL_xxxx".
+    // Must be called on the runtime thread.
+    LEANCLR_API size_t leanclr_profiler_write_collapsed_stacks(char* buffer, size_t buffer_size, int32_t include_il_offsets);
+
     LEANCLR_API void leanclr_invoke_with_buffer(const LeanclrMethodInfo* method, const LeanclrStackObject* arg_buff, LeanclrStackObject* ret_buff,
                                                 LeanclrException** out_exception);
 
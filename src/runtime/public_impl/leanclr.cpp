@@ -9,8 +9,15 @@
 #include "vm/internal_calls.h"
 #include "vm/intrinsics.h"
 #include "vm/assembly.h"
+#include "vm/assembly_load_context.h"
 #include "vm/class.h"
+#include "vm/profiler.h"
+#include "vm/thread_pool.h"
+#include "vm/timer_scheduler.h"
 #include "metadata/module_def.h"
+#include "metadata/metadata_snapshot.h"
+#include "alloc/memory_stats.h"
+#include "gc/garbage_collector.h"
 
 using namespace leanclr;
 
@@ -76,6 +83,53 @@ extern "C"
         }
     }
 
+    LeanclrAssemblyLoadContext* leanclr_create_collectible_load_context()
+    {
+        return reinterpret_cast<LeanclrAssemblyLoadContext*>(vm::AssemblyLoadContext::create_collectible());
+    }
+
+    LeanclrAssembly* leanclr_load_assembly_into_context(LeanclrAssemblyLoadContext* context, const void* data, size_t size, LeanclrException** out_exception)
+    {
+        byte* copy = (byte*)alloc::GeneralAllocation::malloc(size);
+        std::memcpy(copy, data, size);
+        auto ret = vm::AssemblyLoadContext::load_from_data(reinterpret_cast<vm::RtAssemblyLoadContext*>(context), utils::Span<byte>(copy, size));
+        if (ret.is_ok())
+        {
+            return reinterpret_cast<LeanclrAssembly*>(ret.unwrap());
+        }
+        else
+        {
+            if (out_exception)
+            {
+                *out_exception = reinterpret_cast<LeanclrException*>(vm::Exception::raise_error_as_exception(ret.unwrap_err(), nullptr, nullptr));
+            }
+            return nullptr;
+        }
+    }
+
+    int32_t leanclr_unload_load_context(LeanclrAssemblyLoadContext* context)
+    {
+        auto ret = vm::AssemblyLoadContext::unload(reinterpret_cast<vm::RtAssemblyLoadContext*>(context));
+        if (ret.is_ok())
+            return 0;
+        else
+            return (int32_t)ret.unwrap_err();
+    }
+
+    size_t leanclr_write_metadata_snapshot(void* buffer, size_t buffer_size)
+    {
+        return metadata::MetadataSnapshot::write(static_cast<uint8_t*>(buffer), buffer_size);
+    }
+
+    int32_t leanclr_set_metadata_snapshot(const void* data, size_t size)
+    {
+        auto ret = metadata::MetadataSnapshot::set(static_cast<const uint8_t*>(data), size);
+        if (ret.is_ok())
+            return 0;
+        else
+            return (int32_t)ret.unwrap_err();
+    }
+
     LeanclrModuleDef* leanclr_get_assembly_by_module(LeanclrAssembly* ass)
     {
         return reinterpret_cast<LeanclrModuleDef*>(((metadata::RtAssembly*)ass)->mod);
@@ -336,6 +390,108 @@ extern "C"
         vm::Intrinsics::register_newobj_intrinsic(name, (vm::IntrinsicInvoker)invoker);
     }
 
+    void leanclr_thread_pool_queue_work(LeanclrThreadPoolWorkFunc func, void* arg)
+    {
+        vm::ThreadPool::queue_work(func, arg);
+    }
+
+    int32_t leanclr_thread_pool_get_worker_count()
+    {
+        return vm::ThreadPool::get_worker_count();
+    }
+
+    int32_t leanclr_run_thread_pool_work()
+    {
+        auto ret = vm::ThreadPool::run_managed_work_items();
+        if (ret.is_ok())
+            return 0;
+        else
+            return (int32_t)ret.unwrap_err();
+    }
+
+    int64_t leanclr_get_timer_clock_ms()
+    {
+        return vm::TimerScheduler::get_now_ms();
+    }
+
+    int32_t leanclr_run_timers(int64_t now_ms)
+    {
+        auto ret = vm::TimerScheduler::run_timers(now_ms);
+        if (ret.is_ok())
+            return 0;
+        else
+            return (int32_t)ret.unwrap_err();
+    }
+
+    int64_t leanclr_get_next_timer_due_ms()
+    {
+        return vm::TimerScheduler::get_next_due_ms();
+    }
+
+    void leanclr_get_memory_stats(LeanclrMemoryStats* out_stats)
+    {
+        static_assert(LEANCLR_MEMORY_CATEGORY_COUNT == static_cast<int32_t>(alloc::MemoryCategory::Count), "LeanclrMemoryCategory mismatch");
+        out_stats->total_bytes = 0;
+        for (int32_t i = 0; i < LEANCLR_MEMORY_CATEGORY_COUNT; ++i)
+        {
+            alloc::MemoryCategoryStats stats = alloc::MemoryStats::get_stats(static_cast<alloc::MemoryCategory>(i));
+            out_stats->categories[i] = {stats.bytes, stats.count};
+            out_stats->total_bytes += stats.bytes;
+        }
+    }
+
+    const char* leanclr_get_memory_category_name(int32_t category)
+    {
+        if (category < 0 || category >= LEANCLR_MEMORY_CATEGORY_COUNT)
+            return nullptr;
+        return alloc::MemoryStats::get_category_name(static_cast<alloc::MemoryCategory>(category));
+    }
+
+    void leanclr_set_class_histogram_enabled(bool enabled)
+    {
+        gc::GarbageCollector::set_class_histogram_enabled(enabled);
+    }
+
+    size_t leanclr_get_class_histogram(LeanclrClassHistogramEntry* entries, size_t capacity)
+    {
+        static_assert(sizeof(LeanclrClassHistogramEntry) == sizeof(gc::ClassHistogramEntry), "LeanclrClassHistogramEntry mismatch");
+        return gc::GarbageCollector::get_class_histogram(reinterpret_cast<gc::ClassHistogramEntry*>(entries), capacity);
+    }
+
+    int32_t leanclr_profiler_start(int32_t frequency_hz, int32_t buffer_samples)
+    {
+        auto ret = vm::Profiler::start(frequency_hz, buffer_samples);
+        if (ret.is_ok())
+            return 0;
+        else
+            return (int32_t)ret.unwrap_err();
+    }
+
+    void leanclr_profiler_stop()
+    {
+        vm::Profiler::stop();
+    }
+
+    void leanclr_profiler_reset()
+    {
+        vm::Profiler::reset();
+    }
+
+    uint64_t leanclr_profiler_get_sample_count()
+    {
+        return vm::Profiler::get_sample_count();
+    }
+
+    uint64_t leanclr_profiler_get_dropped_sample_count()
+    {
+        return vm::Profiler::get_dropped_sample_count();
+    }
+
+    size_t leanclr_profiler_write_collapsed_stacks(char* buffer, size_t buffer_size, int32_t include_il_offsets)
+    {
+        return vm::Profiler::write_collapsed_stacks(buffer, buffer_size, include_il_offsets != 0);
+    }
+
     void leanclr_invoke_with_buffer(const LeanclrMethodInfo* method, const LeanclrStackObject* arg_buff, LeanclrStackObject* ret_buff,
                                     LeanclrException** out_exception)
     {
@@ -0,0 +1,211 @@
+#include "float_format.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define LEANCLR_HAS_FLOAT_TO_CHARS 1
+#else
+#define LEANCLR_HAS_FLOAT_TO_CHARS 0
+#endif
+
+namespace leanclr::utils
+{
+
+namespace
+{
+// Digits needed to tell any two doubles apart; the ones past it are written as '0'.
+constexpr int32_t MAX_SIGNIFICANT_DIGITS = 17;
+// Up to this precision, rounding a normal double to precision digits gives its shortest digits padded with
+// zeros whenever those are no longer than precision: half an ulp is below half a unit of the 15th digit.
+constexpr int32_t SHORTEST_EXACT_PRECISION = 15;
+constexpr size_t SCIENTIFIC_BUFFER_SIZE = 64;
+
+// Splits "d.ddde+xx" as written by to_chars and printf into its digits and decimal point.
+int32_t split_scientific(const char* text, const char* end, char* digits, int32_t* decimal_point)
+{
+    int32_t count = 0;
+    const char* p = text;
+    for (; p < end && *p != 'e'; ++p)
+    {
+        if (*p >= '0' && *p <= '9')
+        {
+            digits[count++] = *p;
+        }
+    }
+    // to_chars does not zero terminate, so the exponent is read up to end.
+    bool negative_exponent = p + 1 < end && p[1] == '-';
+    int32_t exponent = 0;
+    for (p += 2; p < end; ++p)
+    {
+        exponent = exponent * 10 + (*p - '0');
+    }
+    *decimal_point = (negative_exponent ? -exponent : exponent) + 1;
+    return count;
+}
+
+size_t write_scientific(double value, int32_t precision, char* buffer)
+{
+#if LEANCLR_HAS_FLOAT_TO_CHARS
+    auto result = precision < 0 ? std::to_chars(buffer, buffer + SCIENTIFIC_BUFFER_SIZE, value, std::chars_format::scientific)
+                                : std::to_chars(buffer, buffer + SCIENTIFIC_BUFFER_SIZE, value, std::chars_format::scientific, precision);
+    return static_cast<size_t>(result.ptr - buffer);
+#else
+    return static_cast<size_t>(std::snprintf(buffer, SCIENTIFIC_BUFFER_SIZE, "%.*e", precision, value));
+#endif
+}
+
+// value > 0 and finite, precision in [1, MAX_SIGNIFICANT_DIGITS]. May return fewer than precision digits,
+// in which case the missing ones are zeros.
+int32_t round_to_digits(double value, int32_t precision, char* digits, int32_t* decimal_point)
+{
+    if (precision <= SHORTEST_EXACT_PRECISION && value >= std::numeric_limits<double>::min())
+    {
+        int32_t count = FloatFormat::shortest_digits(value, digits, decimal_point);
+        if (count <= precision)
+        {
+            return count;
+        }
+    }
+    char text[SCIENTIFIC_BUFFER_SIZE];
+    size_t length = write_scientific(value, precision - 1, text);
+    return split_scientific(text, text + length, digits, decimal_point);
+}
+} // namespace
+
+int32_t FloatFormat::shortest_digits(double value, char* digits, int32_t* decimal_point)
+{
+    char text[SCIENTIFIC_BUFFER_SIZE];
+#if LEANCLR_HAS_FLOAT_TO_CHARS
+    size_t length = write_scientific(value, -1, text);
+    return split_scientific(text, text + length, digits, decimal_point);
+#else
+    for (int32_t precision = 1;; ++precision)
+    {
+        size_t length = write_scientific(value, precision - 1, text);
+        if (precision == MAX_SIGNIFICANT_DIGITS || std::strtod(text, nullptr) == value)
+        {
+            return split_scientific(text, text + length, digits, decimal_point);
+        }
+    }
+#endif
+}
+
+bool FloatFormat::ecvt(double value, int32_t precision, char* buffer, size_t size, int32_t* decimal_point, bool* negative)
+{
+    if (buffer == nullptr || size < 2 || precision < 1 || !std::isfinite(value))
+    {
+        return false;
+    }
+    if (static_cast<size_t>(precision) >= size)
+    {
+        precision = static_cast<int32_t>(size - 1);
+    }
+    *negative = std::signbit(value);
+
+    int32_t count = 0;
+    if (value == 0)
+    {
+        *decimal_point = 0;
+    }
+    else
+    {
+        char digits[MAX_SIGNIFICANT_DIGITS];
+        count = round_to_digits(std::fabs(value), std::min(precision, MAX_SIGNIFICANT_DIGITS), digits, decimal_point);
+        std::memcpy(buffer, digits, static_cast<size_t>(count));
+    }
+    std::memset(buffer + count, '0', static_cast<size_t>(precision - count));
+    buffer[precision] = 0;
+    return true;
+}
+
+size_t FloatFormat::format_general(double value, int32_t precision, char* buffer)
+{
+    if (std::isnan(value))
+    {
+        std::memcpy(buffer, "NaN", 3);
+        return 3;
+    }
+    if (std::isinf(value))
+    {
+        if (value < 0)
+        {
+            std::memcpy(buffer, "-Infinity", 9);
+            return 9;
+        }
+        std::memcpy(buffer, "Infinity", 8);
+        return 8;
+    }
+    // Like the corlib formatter, negative zero prints as "0".
+    if (value == 0)
+    {
+        buffer[0] = '0';
+        return 1;
+    }
+
+    precision = std::max(1, std::min(precision, MAX_SIGNIFICANT_DIGITS));
+    char digits[MAX_SIGNIFICANT_DIGITS];
+    int32_t decimal_point;
+    int32_t count = round_to_digits(std::fabs(value), precision, digits, &decimal_point);
+    while (count > 1 && digits[count - 1] == '0')
+    {
+        --count;
+    }
+
+    char* p = buffer;
+    if (value < 0)
+    {
+        *p++ = '-';
+    }
+    if (decimal_point > precision || decimal_point < -3)
+    {
+        *p++ = digits[0];
+        if (count > 1)
+        {
+            *p++ = '.';
+            std::memcpy(p, digits + 1, static_cast<size_t>(count - 1));
+            p += count - 1;
+        }
+        int32_t exponent = decimal_point - 1;
+        *p++ = 'E';
+        *p++ = exponent < 0 ? '-' : '+';
+        exponent = std::abs(exponent);
+        if (exponent >= 100)
+        {
+            *p++ = static_cast<char>('0' + exponent / 100);
+        }
+        *p++ = static_cast<char>('0' + exponent / 10 % 10);
+        *p++ = static_cast<char>('0' + exponent % 10);
+    }
+    else if (decimal_point <= 0)
+    {
+        *p++ = '0';
+        *p++ = '.';
+        std::memset(p, '0', static_cast<size_t>(-decimal_point));
+        p += -decimal_point;
+        std::memcpy(p, digits, static_cast<size_t>(count));
+        p += count;
+    }
+    else
+    {
+        int32_t integer_digits = std::min(count, decimal_point);
+        std::memcpy(p, digits, static_cast<size_t>(integer_digits));
+        p += integer_digits;
+        std::memset(p, '0', static_cast<size_t>(decimal_point - integer_digits));
+        p += decimal_point - integer_digits;
+        if (count > decimal_point)
+        {
+            *p++ = '.';
+            std::memcpy(p, digits + decimal_point, static_cast<size_t>(count - decimal_point));
+            p += count - decimal_point;
+        }
+    }
+    return static_cast<size_t>(p - buffer);
+}
+
+} // namespace leanclr::utils
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "rt_base.h"
+
+namespace leanclr::utils
+{
+
+// Reentrant decimal conversion of doubles, shared by RuntimeImports._ecvt_s and the Double/Single
+// intrinsics. Digits are generated with std::to_chars (Ryu based) where the standard library provides
+// floating point to_chars, and with snprintf elsewhere.
+class FloatFormat
+{
+  public:
+    // Longest text format_general writes, "-" + 17 digits + "." + "E+308" with room to spare.
+    static constexpr size_t MAX_GENERAL_LENGTH = 32;
+
+    // Shortest digits that read back as value, which must be finite and non-zero: value is
+    // 0.d1d2...dn * 10^decimal_point. digits needs room for 17 chars. Returns n.
+    static int32_t shortest_digits(double value, char* digits, int32_t* decimal_point);
+
+    // value rounded to precision significant digits, precision in [1, size). Same contract as the CRT
+    // _ecvt_s: buffer gets exactly precision digits and a terminating zero, zero formats as all '0'
+    // digits with decimal_point 0, and infinities and NaN do not format. Returns false on bad arguments.
+    static bool ecvt(double value, int32_t precision, char* buffer, size_t size, int32_t* decimal_point, bool* negative);
+
+    // value as the invariant culture "G" format with precision significant digits, as formatted by
+    // Double.ToString() (precision 15) and Single.ToString() (precision 7). Returns the length written
+    // to buffer, which needs MAX_GENERAL_LENGTH chars. Not zero terminated.
+    static size_t format_general(double value, int32_t precision, char* buffer);
+};
+
+} // namespace leanclr::utils
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <stdint.h>
+#include <stddef.h>
+#include <cstring>
+
 namespace leanclr::utils
 {
 class HashUtil
@@ -11,4 +15,65 @@ class HashUtil
     }
 };
 
+// 64-bit FNV-1a over a byte stream. It exposes the append surface of StringBuilder,
+// so name formatting code can hash a name without materializing it.
+class StreamingNameHasher
+{
+  public:
+    static constexpr uint64_t OFFSET_BASIS = 0xcbf29ce484222325ULL;
+    static constexpr uint64_t PRIME = 0x100000001b3ULL;
+
+    StreamingNameHasher() : _hash(OFFSET_BASIS)
+    {
+    }
+
+    StreamingNameHasher& append_char(uint8_t c)
+    {
+        _hash = (_hash ^ c) * PRIME;
+        return *this;
+    }
+
+    StreamingNameHasher& append_chars(char c, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            append_char(static_cast<uint8_t>(c));
+        }
+        return *this;
+    }
+
+    StreamingNameHasher& append_cstr(const char* s)
+    {
+        while (*s)
+        {
+            append_char(static_cast<uint8_t>(*s++));
+        }
+        return *this;
+    }
+
+    StreamingNameHasher& append_cstr(const uint8_t* data, size_t len)
+    {
+        for (size_t i = 0; i < len; i++)
+        {
+            append_char(data[i]);
+        }
+        return *this;
+    }
+
+    uint64_t get_hash() const
+    {
+        return _hash;
+    }
+
+    static uint64_t hash(const char* s, size_t len)
+    {
+        StreamingNameHasher hasher;
+        hasher.append_cstr(reinterpret_cast<const uint8_t*>(s), len);
+        return hasher.get_hash();
+    }
+
+  private:
+    uint64_t _hash;
+};
+
 } // namespace leanclr::utils
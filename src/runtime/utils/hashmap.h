@@ -6,4 +6,25 @@ namespace leanclr::utils
 {
 template <typename K, typename V, class _Hasher = std::hash<K>, class _Keyeq = std::equal_to<K>>
 using HashMap = std::unordered_map<K, V, _Hasher, _Keyeq>;
+
+// Removes the elements of a HashMap or HashSet that match pred, which is given the element (the key-value
+// pair for maps). Returns the number of elements removed.
+template <typename Container, typename Pred>
+size_t erase_if(Container& container, Pred pred)
+{
+    size_t removed = 0;
+    for (auto it = container.begin(); it != container.end();)
+    {
+        if (pred(*it))
+        {
+            it = container.erase(it);
+            ++removed;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return removed;
 }
+} // namespace leanclr::utils
@@ -0,0 +1,351 @@
+#include "string_kernels.h"
+
+#include <cstring>
+
+#include "platform/hardware.h"
+
+#if LEANCLR_SIMD_SSE2
+#include <emmintrin.h>
+#if LEANCLR_SIMD_SSE41
+#include <smmintrin.h>
+#endif
+#if LEANCLR_SIMD_AVX2
+#include <immintrin.h>
+#endif
+#elif LEANCLR_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace leanclr::utils
+{
+
+namespace
+{
+constexpr uint32_t kHashSeed = 5381;
+constexpr uint32_t kHashMul = 33;
+constexpr uint32_t kHashMul2 = kHashMul * kHashMul;
+constexpr uint32_t kHashMul3 = kHashMul2 * kHashMul;
+constexpr uint32_t kHashMul4 = kHashMul3 * kHashMul;
+
+inline uint32_t count_trailing_zeros(uint32_t mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+}
+
+inline uint32_t load_u32(const Utf16Char* p)
+{
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline bool equals_at(const Utf16Char* a, const Utf16Char* b, size_t length)
+{
+    return std::memcmp(a, b, length * sizeof(Utf16Char)) == 0;
+}
+
+#if LEANCLR_SIMD_SSE2
+inline __m128i load_128(const Utf16Char* p)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+// Byte mask of lanes in [p, p + 8) equal to any char of any_of.
+inline uint32_t match_any_mask_128(const Utf16Char* p, const Utf16Char* any_of, size_t any_of_length)
+{
+    __m128i chars = load_128(p);
+    __m128i matched = _mm_setzero_si128();
+    for (size_t j = 0; j < any_of_length; ++j)
+    {
+        matched = _mm_or_si128(matched, _mm_cmpeq_epi16(chars, _mm_set1_epi16(static_cast<short>(any_of[j]))));
+    }
+    return static_cast<uint32_t>(_mm_movemask_epi8(matched));
+}
+
+inline __m128i mullo_epi32(__m128i a, __m128i b)
+{
+#if LEANCLR_SIMD_SSE41
+    return _mm_mullo_epi32(a, b);
+#else
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+}
+#endif
+
+#if LEANCLR_SIMD_NEON
+inline bool any_lane_set(uint16x8_t mask)
+{
+    return vmaxvq_u16(mask) != 0;
+}
+#endif
+} // namespace
+
+size_t StringKernels::mismatch(const Utf16Char* a, const Utf16Char* b, size_t length)
+{
+    size_t i = 0;
+#if LEANCLR_SIMD_AVX2
+    for (; i + 16 <= length; i += 16)
+    {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        uint32_t diff = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(va, vb)));
+        if (diff)
+            return i + count_trailing_zeros(diff) / 2;
+    }
+#endif
+#if LEANCLR_SIMD_SSE2
+    for (; i + 8 <= length; i += 8)
+    {
+        uint32_t diff = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(load_128(a + i), load_128(b + i)))) & 0xFFFFu;
+        if (diff)
+            return i + count_trailing_zeros(diff) / 2;
+    }
+#elif LEANCLR_SIMD_NEON
+    for (; i + 8 <= length; i += 8)
+    {
+        uint16x8_t eq = vceqq_u16(vld1q_u16(a + i), vld1q_u16(b + i));
+        if (vminvq_u16(eq) != 0xFFFF)
+            break;
+    }
+#else
+    for (; i + 2 <= length; i += 2)
+    {
+        if (load_u32(a + i) != load_u32(b + i))
+            break;
+    }
+#endif
+    for (; i < length; ++i)
+    {
+        if (a[i] != b[i])
+            return i;
+    }
+    return length;
+}
+
+int32_t StringKernels::ordinal_compare(const Utf16Char* a, size_t length_a, const Utf16Char* b, size_t length_b)
+{
+    size_t common = length_a < length_b ? length_a : length_b;
+    size_t index = mismatch(a, b, common);
+    if (index < common)
+        return static_cast<int32_t>(a[index]) - static_cast<int32_t>(b[index]);
+    return static_cast<int32_t>(length_a) - static_cast<int32_t>(length_b);
+}
+
+int32_t StringKernels::index_of_char(const Utf16Char* s, size_t length, Utf16Char value)
+{
+    size_t i = 0;
+#if LEANCLR_SIMD_AVX2
+    __m256i needle256 = _mm256_set1_epi16(static_cast<short>(value));
+    for (; i + 16 <= length; i += 16)
+    {
+        __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(chars, needle256)));
+        if (mask)
+            return static_cast<int32_t>(i + count_trailing_zeros(mask) / 2);
+    }
+#endif
+#if LEANCLR_SIMD_SSE2
+    __m128i needle = _mm_set1_epi16(static_cast<short>(value));
+    for (; i + 8 <= length; i += 8)
+    {
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(load_128(s + i), needle)));
+        if (mask)
+            return static_cast<int32_t>(i + count_trailing_zeros(mask) / 2);
+    }
+#elif LEANCLR_SIMD_NEON
+    uint16x8_t needle = vdupq_n_u16(value);
+    for (; i + 8 <= length; i += 8)
+    {
+        if (any_lane_set(vceqq_u16(vld1q_u16(s + i), needle)))
+            break;
+    }
+#endif
+    for (; i < length; ++i)
+    {
+        if (s[i] == value)
+            return static_cast<int32_t>(i);
+    }
+    return -1;
+}
+
+int32_t StringKernels::index_of_any(const Utf16Char* s, size_t length, const Utf16Char* any_of, size_t any_of_length)
+{
+    if (any_of_length == 0)
+        return -1;
+    if (any_of_length == 1)
+        return index_of_char(s, length, any_of[0]);
+
+    size_t i = 0;
+#if LEANCLR_SIMD_SSE2
+    for (; i + 8 <= length; i += 8)
+    {
+        uint32_t mask = match_any_mask_128(s + i, any_of, any_of_length);
+        if (mask)
+            return static_cast<int32_t>(i + count_trailing_zeros(mask) / 2);
+    }
+#elif LEANCLR_SIMD_NEON
+    for (; i + 8 <= length; i += 8)
+    {
+        uint16x8_t chars = vld1q_u16(s + i);
+        uint16x8_t matched = vdupq_n_u16(0);
+        for (size_t j = 0; j < any_of_length; ++j)
+        {
+            matched = vorrq_u16(matched, vceqq_u16(chars, vdupq_n_u16(any_of[j])));
+        }
+        if (any_lane_set(matched))
+            break;
+    }
+#endif
+    for (; i < length; ++i)
+    {
+        Utf16Char c = s[i];
+        for (size_t j = 0; j < any_of_length; ++j)
+        {
+            if (c == any_of[j])
+                return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+int32_t StringKernels::index_of_string(const Utf16Char* s, size_t length, const Utf16Char* value, size_t value_length)
+{
+    if (value_length == 0)
+        return 0;
+    if (value_length > length)
+        return -1;
+    if (value_length == 1)
+        return index_of_char(s, length, value[0]);
+
+    // Filter candidates by first and last char of value, then verify the middle.
+    size_t last_start = length - value_length;
+    size_t last_offset = value_length - 1;
+    size_t i = 0;
+#if LEANCLR_SIMD_SSE2
+    __m128i first = _mm_set1_epi16(static_cast<short>(value[0]));
+    __m128i last = _mm_set1_epi16(static_cast<short>(value[last_offset]));
+    for (; i + 8 <= last_start + 1; i += 8)
+    {
+        __m128i eq_first = _mm_cmpeq_epi16(load_128(s + i), first);
+        __m128i eq_last = _mm_cmpeq_epi16(load_128(s + i + last_offset), last);
+        // Keep one bit per char lane.
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(eq_first, eq_last))) & 0x5555u;
+        while (mask)
+        {
+            size_t candidate = i + count_trailing_zeros(mask) / 2;
+            if (equals_at(s + candidate + 1, value + 1, value_length - 2))
+                return static_cast<int32_t>(candidate);
+            mask &= mask - 1;
+        }
+    }
+#elif LEANCLR_SIMD_NEON
+    uint16x8_t first = vdupq_n_u16(value[0]);
+    uint16x8_t last = vdupq_n_u16(value[last_offset]);
+    for (; i + 8 <= last_start + 1; i += 8)
+    {
+        uint16x8_t matched = vandq_u16(vceqq_u16(vld1q_u16(s + i), first), vceqq_u16(vld1q_u16(s + i + last_offset), last));
+        if (!any_lane_set(matched))
+            continue;
+        for (size_t candidate = i; candidate < i + 8; ++candidate)
+        {
+            if (s[candidate] == value[0] && s[candidate + last_offset] == value[last_offset] &&
+                equals_at(s + candidate + 1, value + 1, value_length - 2))
+                return static_cast<int32_t>(candidate);
+        }
+    }
+#endif
+    for (; i <= last_start; ++i)
+    {
+        if (s[i] == value[0] && s[i + last_offset] == value[last_offset] && equals_at(s + i + 1, value + 1, value_length - 2))
+            return static_cast<int32_t>(i);
+    }
+    return -1;
+}
+
+int32_t StringKernels::last_index_of_string(const Utf16Char* s, size_t length, const Utf16Char* value, size_t value_length)
+{
+    if (value_length > length)
+        return -1;
+    if (value_length == 0)
+        return static_cast<int32_t>(length);
+    for (size_t i = length - value_length + 1; i-- > 0;)
+    {
+        if (s[i] == value[0] && equals_at(s + i + 1, value + 1, value_length - 1))
+            return static_cast<int32_t>(i);
+    }
+    return -1;
+}
+
+int32_t StringKernels::hash_code(const Utf16Char* s, size_t length)
+{
+    // hash = hash * 33 + pair for each pair is a polynomial in 33, so four consecutive pairs can be
+    // accumulated in independent lanes with stride 33^4 and folded with 33^3..33^0 afterwards.
+    uint32_t hash = kHashSeed;
+    size_t pair_count = length / 2;
+    size_t i = 0;
+#if LEANCLR_SIMD_SSE2 || LEANCLR_SIMD_NEON
+    if (pair_count >= 8)
+    {
+        uint32_t hash_scale = 1;
+        uint32_t lanes[4];
+#if LEANCLR_SIMD_SSE2
+        __m128i stride = _mm_set1_epi32(static_cast<int>(kHashMul4));
+        __m128i acc = _mm_setzero_si128();
+        for (; i + 4 <= pair_count; i += 4)
+        {
+            acc = _mm_add_epi32(mullo_epi32(acc, stride), load_128(s + i * 2));
+            hash_scale *= kHashMul4;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+#else
+        uint32x4_t stride = vdupq_n_u32(kHashMul4);
+        uint32x4_t acc = vdupq_n_u32(0);
+        for (; i + 4 <= pair_count; i += 4)
+        {
+            acc = vmlaq_u32(vreinterpretq_u32_u16(vld1q_u16(s + i * 2)), acc, stride);
+            hash_scale *= kHashMul4;
+        }
+        vst1q_u32(lanes, acc);
+#endif
+        hash = hash * hash_scale + lanes[0] * kHashMul3 + lanes[1] * kHashMul2 + lanes[2] * kHashMul + lanes[3];
+    }
+#endif
+    for (; i < pair_count; ++i)
+    {
+        hash = hash * kHashMul + load_u32(s + i * 2);
+    }
+    if (length & 1)
+    {
+        hash = hash * kHashMul + s[length - 1];
+    }
+    return static_cast<int32_t>(hash);
+}
+
+int32_t StringKernels::hash_code_scalar(const Utf16Char* s, size_t length)
+{
+    uint32_t hash = kHashSeed;
+    size_t pair_count = length / 2;
+    for (size_t i = 0; i < pair_count; ++i)
+    {
+        hash = hash * kHashMul + load_u32(s + i * 2);
+    }
+    if (length & 1)
+    {
+        hash = hash * kHashMul + s[length - 1];
+    }
+    return static_cast<int32_t>(hash);
+}
+
+} // namespace leanclr::utils
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "rt_base.h"
+
+namespace leanclr::utils
+{
+
+// Ordinal UTF-16 primitives shared by System.String intrinsics and the globalization icalls.
+// Vectorized with SSE2 (AVX2 when the compiler targets it) on x86, NEON on AArch64,
+// and plain loops elsewhere. All functions only read inside the given ranges.
+class StringKernels
+{
+  public:
+    // Index of the first differing char, or length if both ranges are equal.
+    static size_t mismatch(const Utf16Char* a, const Utf16Char* b, size_t length);
+
+    static bool ordinal_equals(const Utf16Char* a, const Utf16Char* b, size_t length)
+    {
+        return mismatch(a, b, length) == length;
+    }
+
+    // Same contract as String.CompareOrdinal: difference of the first differing chars,
+    // otherwise difference of the lengths.
+    static int32_t ordinal_compare(const Utf16Char* a, size_t length_a, const Utf16Char* b, size_t length_b);
+
+    // Searches return the index relative to s, or -1.
+    static int32_t index_of_char(const Utf16Char* s, size_t length, Utf16Char value);
+    static int32_t index_of_any(const Utf16Char* s, size_t length, const Utf16Char* any_of, size_t any_of_length);
+    static int32_t index_of_string(const Utf16Char* s, size_t length, const Utf16Char* value, size_t value_length);
+    static int32_t last_index_of_string(const Utf16Char* s, size_t length, const Utf16Char* value, size_t value_length);
+
+    // djb2 over little-endian char pairs, bit-compatible with the original String::get_hash_code.
+    static int32_t hash_code(const Utf16Char* s, size_t length);
+
+    // Reference implementation of hash_code, kept for validation and benchmarks.
+    static int32_t hash_code_scalar(const Utf16Char* s, size_t length);
+};
+
+} // namespace leanclr::utils
@@ -1,8 +1,8 @@
 #include "string_util.h"
 
 #include "alloc/general_allocation.h"
-#include "utf8/utf8.h"
 #include "string_builder.h"
+#include "utf8_transcoder.h"
 
 namespace leanclr::utils
 {
@@ -97,19 +97,24 @@ void StringUtil::utf16_to_utf8(const Utf16Char* utf16_str, size_t utf16_len, Str
         return;
     }
 
-    // UTF-16 characters can be converted to UTF-8 with at most 4 bytes per character
-    // Add extra space for safety
-    size_t max_utf8_size = utf16_len * 4 + 1;
-    out_utf8_str.reserve(max_utf8_size);
-
-    // Convert UTF-16 to UTF-8
-    char* end = utf8::unchecked::utf16to8(utf16_str, utf16_str + utf16_len, out_utf8_str.get_current_write_ptr());
-    *end = '\0';
-
-    // Calculate actual size written
-    size_t actual_size = std::distance(out_utf8_str.get_mut_data(), end);
+    // Reserve the exact size plus the zero terminator.
+    size_t utf8_size = Utf8Transcoder::get_utf8_length(utf16_str, utf16_len);
+    out_utf8_str.reserve(utf8_size + 1);
+    char* dst = out_utf8_str.get_current_write_ptr();
+    Utf8Transcoder::utf16_to_utf8(utf16_str, utf16_len, dst, utf8_size);
+    dst[utf8_size] = '\0';
+    out_utf8_str.resize(out_utf8_str.length() + utf8_size);
+}
 
-    // Assign to output string
-    out_utf8_str.resize(actual_size);
+const char* StringUtil::strdup_utf16_to_utf8(const Utf16Char* utf16_str, size_t utf16_len)
+{
+    size_t utf8_size = utf16_str ? Utf8Transcoder::get_utf8_length(utf16_str, utf16_len) : 0;
+    char* copy = (char*)alloc::GeneralAllocation::malloc(utf8_size + 1);
+    if (utf8_size > 0)
+    {
+        Utf8Transcoder::utf16_to_utf8(utf16_str, utf16_len, copy, utf8_size);
+    }
+    copy[utf8_size] = 0;
+    return copy;
 }
 } // namespace leanclr::utils
@@ -64,6 +64,9 @@ class StringUtil
     }
 
     static void utf16_to_utf8(const Utf16Char* utf16_str, size_t utf16_len, StringBuilder& out_utf8_str);
+
+    // Zero terminated UTF-8 copy of the chars, allocated at its exact size with GeneralAllocation::malloc.
+    static const char* strdup_utf16_to_utf8(const Utf16Char* utf16_str, size_t utf16_len);
 };
 
 struct CStrCompare
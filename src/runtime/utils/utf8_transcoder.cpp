@@ -0,0 +1,400 @@
+#include "utf8_transcoder.h"
+
+#include "platform/hardware.h"
+
+#if LEANCLR_SIMD_SSE2
+#include <emmintrin.h>
+#elif LEANCLR_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace leanclr::utils
+{
+
+namespace
+{
+constexpr uint32_t INVALID_SEQUENCE = 0xFFFFFFFF;
+
+inline bool in_range(uint8_t value, uint8_t lower, uint8_t upper)
+{
+    return value >= lower && value <= upper;
+}
+
+inline bool is_high_surrogate(Utf16Char c)
+{
+    return c >= 0xD800 && c <= 0xDBFF;
+}
+
+inline bool is_low_surrogate(Utf16Char c)
+{
+    return c >= 0xDC00 && c <= 0xDFFF;
+}
+
+inline uint32_t count_trailing_zeros(uint32_t mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+}
+
+// Length of the ASCII prefix of src, widened to dst when Store is set. Whole blocks are stored while they
+// fit before dst_end, so dst may be written past the prefix.
+template <bool Store>
+size_t widen_ascii(const uint8_t* src, size_t length, Utf16Char* dst, const Utf16Char* dst_end)
+{
+    size_t i = 0;
+#if LEANCLR_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (Store)
+        {
+            if (dst_end - (dst + i) < 16)
+            {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(bytes, zero));
+        }
+        uint32_t non_ascii = static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+        if (non_ascii != 0)
+        {
+            return i + count_trailing_zeros(non_ascii);
+        }
+    }
+#elif LEANCLR_SIMD_NEON
+    for (; i + 16 <= length; i += 16)
+    {
+        uint8x16_t bytes = vld1q_u8(src + i);
+        if (vmaxvq_u8(bytes) >= 0x80)
+        {
+            break;
+        }
+        if (Store)
+        {
+            vst1q_u16(dst + i, vmovl_u8(vget_low_u8(bytes)));
+            vst1q_u16(dst + i + 8, vmovl_u8(vget_high_u8(bytes)));
+        }
+    }
+#endif
+    for (; i < length && src[i] < 0x80; ++i)
+    {
+        if (Store)
+        {
+            dst[i] = src[i];
+        }
+    }
+    return i;
+}
+
+// Length of the ASCII prefix of src, narrowed to dst when Store is set. Whole blocks are stored while they
+// fit before dst_end, so dst may be written past the prefix.
+template <bool Store>
+size_t narrow_ascii(const Utf16Char* src, size_t length, uint8_t* dst, const uint8_t* dst_end)
+{
+    size_t i = 0;
+#if LEANCLR_SIMD_SSE2
+    const __m128i non_ascii_bits = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+        if (Store)
+        {
+            if (dst_end - (dst + i) < 16)
+            {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(low, high));
+        }
+        // One byte per char, set for ASCII chars.
+        __m128i ascii = _mm_packs_epi16(_mm_cmpeq_epi16(_mm_and_si128(low, non_ascii_bits), zero),
+                                        _mm_cmpeq_epi16(_mm_and_si128(high, non_ascii_bits), zero));
+        uint32_t non_ascii = ~static_cast<uint32_t>(_mm_movemask_epi8(ascii)) & 0xFFFF;
+        if (non_ascii != 0)
+        {
+            return i + count_trailing_zeros(non_ascii);
+        }
+    }
+#elif LEANCLR_SIMD_NEON
+    for (; i + 16 <= length; i += 16)
+    {
+        uint16x8_t low = vld1q_u16(src + i);
+        uint16x8_t high = vld1q_u16(src + i + 8);
+        if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80)
+        {
+            break;
+        }
+        if (Store)
+        {
+            vst1q_u8(dst + i, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+        }
+    }
+#endif
+    for (; i < length && src[i] < 0x80; ++i)
+    {
+        if (Store)
+        {
+            dst[i] = static_cast<uint8_t>(src[i]);
+        }
+    }
+    return i;
+}
+
+#if LEANCLR_SIMD_SSE2 || LEANCLR_SIMD_NEON
+// UTF-8 length of the 8 chars at src, or -1 if any of them is a surrogate.
+inline int32_t count_utf8_bytes_8(const Utf16Char* src)
+{
+#if LEANCLR_SIMD_SSE2
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i zero = _mm_setzero_si128();
+    __m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(chars, _mm_set1_epi16(static_cast<short>(0xF800))), _mm_set1_epi16(static_cast<short>(0xD800)));
+    if (_mm_movemask_epi8(surrogates) != 0)
+    {
+        return -1;
+    }
+    // Every char takes 3 bytes, less one if below 0x800 and one more if below 0x80.
+    __m128i below_80 = _mm_srli_epi16(_mm_cmpeq_epi16(_mm_and_si128(chars, _mm_set1_epi16(static_cast<short>(0xFF80))), zero), 15);
+    __m128i below_800 = _mm_srli_epi16(_mm_cmpeq_epi16(_mm_and_si128(chars, _mm_set1_epi16(static_cast<short>(0xF800))), zero), 15);
+    __m128i sums = _mm_sad_epu8(_mm_add_epi16(below_80, below_800), zero);
+    return 24 - (_mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+#elif LEANCLR_SIMD_NEON
+    uint16x8_t chars = vld1q_u16(src);
+    uint16x8_t surrogates = vceqq_u16(vandq_u16(chars, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800));
+    if (vmaxvq_u16(surrogates) != 0)
+    {
+        return -1;
+    }
+    uint16x8_t extra = vaddq_u16(vshrq_n_u16(vcgeq_u16(chars, vdupq_n_u16(0x80)), 15), vshrq_n_u16(vcgeq_u16(chars, vdupq_n_u16(0x800)), 15));
+    return static_cast<int32_t>(8 + vaddvq_u16(extra));
+#endif
+}
+#endif
+
+// Decodes the sequence starting with the non-ASCII byte src[0]. Returns its code point and sets consumed to
+// its length, or returns INVALID_SEQUENCE and sets consumed to the length of its maximal ill-formed subpart.
+uint32_t decode_sequence(const uint8_t* src, size_t length, size_t* consumed)
+{
+    uint8_t lead = src[0];
+    *consumed = 1;
+    if (lead < 0xC2 || lead > 0xF4)
+    {
+        return INVALID_SEQUENCE;
+    }
+    if (lead < 0xE0)
+    {
+        if (length < 2 || !in_range(src[1], 0x80, 0xBF))
+        {
+            return INVALID_SEQUENCE;
+        }
+        *consumed = 2;
+        return (static_cast<uint32_t>(lead & 0x1F) << 6) | (src[1] & 0x3F);
+    }
+    // The range of the second byte rules out overlong forms, surrogates and code points past U+10FFFF.
+    uint8_t lower = lead == 0xE0 ? 0xA0 : (lead == 0xF0 ? 0x90 : 0x80);
+    uint8_t upper = lead == 0xED ? 0x9F : (lead == 0xF4 ? 0x8F : 0xBF);
+    if (length < 2 || !in_range(src[1], lower, upper))
+    {
+        return INVALID_SEQUENCE;
+    }
+    *consumed = 2;
+    if (length < 3 || !in_range(src[2], 0x80, 0xBF))
+    {
+        return INVALID_SEQUENCE;
+    }
+    *consumed = 3;
+    if (lead < 0xF0)
+    {
+        return (static_cast<uint32_t>(lead & 0x0F) << 12) | (static_cast<uint32_t>(src[1] & 0x3F) << 6) | (src[2] & 0x3F);
+    }
+    if (length < 4 || !in_range(src[3], 0x80, 0xBF))
+    {
+        return INVALID_SEQUENCE;
+    }
+    *consumed = 4;
+    return (static_cast<uint32_t>(lead & 0x07) << 18) | (static_cast<uint32_t>(src[1] & 0x3F) << 12) |
+           (static_cast<uint32_t>(src[2] & 0x3F) << 6) | (src[3] & 0x3F);
+}
+} // namespace
+
+size_t Utf8Transcoder::get_utf16_length(const char* src, size_t length, bool* valid)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+    size_t result = 0;
+    bool replaced = false;
+    size_t i = 0;
+    while (i < length)
+    {
+        if (bytes[i] < 0x80)
+        {
+            size_t run = widen_ascii<false>(bytes + i, length - i, nullptr, nullptr);
+            i += run;
+            result += run;
+            continue;
+        }
+        size_t consumed;
+        uint32_t code_point = decode_sequence(bytes + i, length - i, &consumed);
+        i += consumed;
+        replaced |= code_point == INVALID_SEQUENCE;
+        result += code_point != INVALID_SEQUENCE && code_point >= 0x10000 ? 2 : 1;
+    }
+    if (valid)
+    {
+        *valid = !replaced;
+    }
+    return result;
+}
+
+size_t Utf8Transcoder::utf8_to_utf16(const char* src, size_t length, Utf16Char* dst, size_t dst_length)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+    Utf16Char* out = dst;
+    const Utf16Char* out_end = dst + dst_length;
+    size_t i = 0;
+    while (i < length)
+    {
+        if (bytes[i] < 0x80)
+        {
+            size_t run = widen_ascii<true>(bytes + i, length - i, out, out_end);
+            i += run;
+            out += run;
+            continue;
+        }
+        size_t consumed;
+        uint32_t code_point = decode_sequence(bytes + i, length - i, &consumed);
+        i += consumed;
+        if (code_point == INVALID_SEQUENCE)
+        {
+            *out++ = REPLACEMENT_CHAR;
+        }
+        else if (code_point < 0x10000)
+        {
+            *out++ = static_cast<Utf16Char>(code_point);
+        }
+        else
+        {
+            code_point -= 0x10000;
+            *out++ = static_cast<Utf16Char>(0xD800 + (code_point >> 10));
+            *out++ = static_cast<Utf16Char>(0xDC00 + (code_point & 0x3FF));
+        }
+    }
+    return static_cast<size_t>(out - dst);
+}
+
+size_t Utf8Transcoder::get_utf8_length(const Utf16Char* src, size_t length, bool* valid)
+{
+    size_t result = 0;
+    bool replaced = false;
+    size_t i = 0;
+    while (i < length)
+    {
+        if (src[i] < 0x80)
+        {
+            size_t run = narrow_ascii<false>(src + i, length - i, nullptr, nullptr);
+            i += run;
+            result += run;
+            continue;
+        }
+        size_t scalar_end = length;
+#if LEANCLR_SIMD_SSE2 || LEANCLR_SIMD_NEON
+        if (i + 8 <= length)
+        {
+            int32_t block = count_utf8_bytes_8(src + i);
+            if (block >= 0)
+            {
+                result += static_cast<size_t>(block);
+                i += 8;
+                continue;
+            }
+            // Blocks with surrogates are counted one char at a time.
+            scalar_end = i + 8;
+        }
+#endif
+        while (i < scalar_end)
+        {
+            Utf16Char c = src[i];
+            if (c < 0x80)
+            {
+                result += 1;
+                ++i;
+            }
+            else if (c < 0x800)
+            {
+                result += 2;
+                ++i;
+            }
+            else if (is_high_surrogate(c) && i + 1 < length && is_low_surrogate(src[i + 1]))
+            {
+                result += 4;
+                i += 2;
+            }
+            else
+            {
+                // Lone surrogates are replaced by U+FFFD, which also takes 3 bytes.
+                replaced |= is_high_surrogate(c) || is_low_surrogate(c);
+                result += 3;
+                ++i;
+            }
+        }
+    }
+    if (valid)
+    {
+        *valid = !replaced;
+    }
+    return result;
+}
+
+size_t Utf8Transcoder::utf16_to_utf8(const Utf16Char* src, size_t length, char* dst, size_t dst_length)
+{
+    uint8_t* out = reinterpret_cast<uint8_t*>(dst);
+    const uint8_t* out_end = out + dst_length;
+    size_t i = 0;
+    while (i < length)
+    {
+        uint32_t c = src[i];
+        if (c < 0x80)
+        {
+            size_t run = narrow_ascii<true>(src + i, length - i, out, out_end);
+            i += run;
+            out += run;
+            continue;
+        }
+        ++i;
+        if (c < 0x800)
+        {
+            *out++ = static_cast<uint8_t>(0xC0 | (c >> 6));
+            *out++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+            continue;
+        }
+        if (is_high_surrogate(static_cast<Utf16Char>(c)) && i < length && is_low_surrogate(src[i]))
+        {
+            uint32_t code_point = 0x10000 + ((c - 0xD800) << 10) + (src[i] - 0xDC00);
+            ++i;
+            *out++ = static_cast<uint8_t>(0xF0 | (code_point >> 18));
+            *out++ = static_cast<uint8_t>(0x80 | ((code_point >> 12) & 0x3F));
+            *out++ = static_cast<uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+            *out++ = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+            continue;
+        }
+        if (is_high_surrogate(static_cast<Utf16Char>(c)) || is_low_surrogate(static_cast<Utf16Char>(c)))
+        {
+            c = REPLACEMENT_CHAR;
+        }
+        *out++ = static_cast<uint8_t>(0xE0 | (c >> 12));
+        *out++ = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
+        *out++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+    }
+    return static_cast<size_t>(out - reinterpret_cast<uint8_t*>(dst));
+}
+
+} // namespace leanclr::utils
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "rt_base.h"
+
+namespace leanclr::utils
+{
+
+// Validating UTF-8 <-> UTF-16 conversion shared by string creation, marshaling and the UTF8Encoding
+// intrinsics. ASCII runs are widened and narrowed 16 chars at a time with SSE2 or NEON.
+// Ill-formed input is replaced as Unicode recommends: each maximal subpart of an ill-formed UTF-8
+// sequence and each unpaired surrogate becomes U+FFFD. The length functions return
+// the exact size of the matching conversion, so callers can allocate the destination once.
+class Utf8Transcoder
+{
+  public:
+    static constexpr Utf16Char REPLACEMENT_CHAR = 0xFFFD;
+
+    // UTF-16 length of the UTF-8 bytes. valid, when given, is set to whether no replacement happens.
+    static size_t get_utf16_length(const char* src, size_t length, bool* valid = nullptr);
+
+    // Decodes the UTF-8 bytes to dst, which has room for dst_length chars, at least get_utf16_length.
+    // The whole room may be written. Returns the chars decoded.
+    static size_t utf8_to_utf16(const char* src, size_t length, Utf16Char* dst, size_t dst_length);
+
+    // UTF-8 length of the UTF-16 chars. valid, when given, is set to whether no replacement happens.
+    static size_t get_utf8_length(const Utf16Char* src, size_t length, bool* valid = nullptr);
+
+    // Encodes the UTF-16 chars to dst, which has room for dst_length bytes, at least get_utf8_length.
+    // The whole room may be written. Returns the bytes encoded, not zero terminated.
+    static size_t utf16_to_utf8(const Utf16Char* src, size_t length, char* dst, size_t dst_length);
+};
+
+} // namespace leanclr::utils
@@ -66,6 +66,14 @@ static void setup_cast_class(RtClass* klass)
     }
 }
 
+// Methods, interfaces and vtables of an array class live with its metadata: in the pool of the collectible
+// module its element type refers to, if any, so that they go away when that module is unloaded.
+static alloc::MemPool& get_array_mem_pool(RtClass* klass)
+{
+    RtModuleDef* owner = MetadataCache::get_collectible_owner(klass->by_val);
+    return owner ? owner->get_mem_pool() : klass->image->get_mem_pool();
+}
+
 // Common setup for array classes
 static void setup_array_class_common(RtClass* array_class, RtClass* ele_class)
 {
@@ -86,7 +94,7 @@ static void setup_array_class_common(RtClass* array_class, RtClass* ele_class)
 static RtResult<const RtMethodInfo*> build_array_method(RtClass* klass, const char* name, const RtTypeSig* return_type, const RtTypeSig* const* parameters,
                                                         size_t parameter_count)
 {
-    RtMethodInfo* method = klass->image->get_mem_pool().calloc_any<RtMethodInfo>(1);
+    RtMethodInfo* method = get_array_mem_pool(klass).calloc_any<RtMethodInfo>(1);
     method->parent = klass;
     method->name = name;
     method->token = 0;
@@ -96,7 +104,7 @@ static RtResult<const RtMethodInfo*> build_array_method(RtClass* klass, const ch
 
     if (parameter_count > 0)
     {
-        const RtTypeSig** new_params = klass->image->get_mem_pool().calloc_any<const RtTypeSig*>(parameter_count);
+        const RtTypeSig** new_params = get_array_mem_pool(klass).calloc_any<const RtTypeSig*>(parameter_count);
         std::memcpy(new_params, parameters, parameter_count * sizeof(const RtTypeSig*));
         method->parameters = new_params;
     }
@@ -136,7 +144,7 @@ static RtResult<const RtMethodInfo*> build_array_generic_method(RtClass* klass,
     }
 
     // Copy inflated method and update parent and name
-    RtMethodInfo* new_method = klass->image->get_mem_pool().calloc_any<RtMethodInfo>(1);
+    RtMethodInfo* new_method = get_array_mem_pool(klass).calloc_any<RtMethodInfo>(1);
     *new_method = *inflated_method;
     new_method->parent = klass;
     new_method->name = template_method.final_name;
@@ -232,7 +240,8 @@ RtResult<RtClass*> ArrayClass::get_array_class_from_element_klass(RtClass* ele_k
         RET_OK(cached->second);
 
     // Create new array class
-    RtClass* array_class = static_cast<RtClass*>(MetadataAllocation::malloc_any_zeroed<RtClass>());
+    RtModuleDef* owner = MetadataCache::get_collectible_owner(types.by_val);
+    RtClass* array_class = MetadataCache::get_owner_mem_pool(owner, alloc::MemoryCategory::Metadata).malloc_any_zeroed<RtClass>();
     if (!array_class)
         RET_ERR(RtErr::OutOfMemory);
 
@@ -267,7 +276,8 @@ RtResult<RtClass*> ArrayClass::get_szarray_class_from_element_class(RtClass* ele
         RET_OK(cached->second);
 
     // Create new szarray class
-    RtClass* array_class = static_cast<RtClass*>(MetadataAllocation::malloc_any_zeroed<RtClass>());
+    RtModuleDef* owner = MetadataCache::get_collectible_owner(types.by_val);
+    RtClass* array_class = MetadataCache::get_owner_mem_pool(owner, alloc::MemoryCategory::Metadata).malloc_any_zeroed<RtClass>();
     if (!array_class)
         RET_ERR(RtErr::OutOfMemory);
 
@@ -282,6 +292,20 @@ RtResult<RtClass*> ArrayClass::get_szarray_class_from_element_class(RtClass* ele
     RET_OK(array_class);
 }
 
+void ArrayClass::purge_unloading_modules()
+{
+    utils::erase_if(g_arrayClassMap,
+                    [](const auto& entry)
+                    {
+                        if (!MetadataCache::refers_to_unloading_module(entry.first))
+                        {
+                            return false;
+                        }
+                        alloc::GeneralAllocation::free(const_cast<char*>(entry.second->name));
+                        return true;
+                    });
+}
+
 RtResultVoid ArrayClass::setup_interfaces(RtClass* klass)
 {
     // Only SZArray implement collection interfaces
@@ -299,7 +323,7 @@ RtResultVoid ArrayClass::setup_interfaces(RtClass* klass)
     };
 
     size_t interface_count = 5;
-    RtClass** interfaces = klass->image->get_mem_pool().calloc_any<RtClass*>(interface_count);
+    RtClass** interfaces = get_array_mem_pool(klass).calloc_any<RtClass*>(interface_count);
     for (size_t i = 0; i < interface_count; ++i)
     {
         uint32_t gid = Class::get_type_def_gid(to_inflate[i]);
@@ -327,7 +351,7 @@ RtResultVoid ArrayClass::setup_methods(RtClass* klass)
 
     const RtTypeSig* params_buf[32] = {};
     size_t cur_method_index = 0;
-    const RtMethodInfo** methods = klass->image->get_mem_pool().calloc_any<const RtMethodInfo*>(method_count);
+    const RtMethodInfo** methods = get_array_mem_pool(klass).calloc_any<const RtMethodInfo*>(method_count);
 
     // .ctor(lengths)
     {
@@ -419,7 +443,7 @@ RtResultVoid ArrayClass::setup_vtables(metadata::RtClass* klass)
         total_vtable_count += iface->vtable_count;
     }
 
-    alloc::MemPool& mem_pool = klass->image->get_mem_pool();
+    alloc::MemPool& mem_pool = get_array_mem_pool(klass);
 
     metadata::RtInterfaceOffset* interface_vtable_offsets = mem_pool.calloc_any<metadata::RtInterfaceOffset>(new_offsets.size());
     std::memcpy(interface_vtable_offsets, new_offsets.data(), new_offsets.size() * sizeof(metadata::RtInterfaceOffset));
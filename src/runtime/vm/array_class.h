@@ -23,5 +23,8 @@ class ArrayClass
 
     // Interface method initialization
     static RtResultVoid initialize_array_interface_methods();
+
+    // Drops the cached array classes whose element type refers to an unloading module.
+    static void purge_unloading_modules();
 };
 } // namespace leanclr::vm
@@ -58,9 +58,9 @@ RtResult<metadata::RtAssembly*> Assembly::load_by_name(RtAppDomain* app_domain,
     return load_by_name(name_no_ext);
 }
 
-RtResult<metadata::RtAssembly*> Assembly::load_from_data(utils::Span<byte> dllData)
+RtResult<metadata::RtAssembly*> Assembly::load_from_data(utils::Span<byte> dllData, bool collectible)
 {
-    alloc::MemPool* pool = alloc::GeneralAllocation::new_any<alloc::MemPool>();
+    alloc::MemPool* pool = alloc::GeneralAllocation::new_any<alloc::MemPool>(alloc::MemoryCategory::Metadata);
     utils::UniquePtr<alloc::MemPool> poolGuard(pool);
     utils::UniquePtr<byte> dllDataGuard(dllData.data());
 
@@ -73,7 +73,17 @@ RtResult<metadata::RtAssembly*> Assembly::load_from_data(utils::Span<byte> dllDa
     metadata::RtAssembly* ass = alloc::GeneralAllocation::malloc_any_zeroed<metadata::RtAssembly>();
     metadata::RtModuleDef* mod = alloc::GeneralAllocation::new_any<metadata::RtModuleDef>(ass, *image, *pool);
     ass->mod = mod;
-    RET_ERR_ON_FAIL(mod->load());
+    if (collectible)
+    {
+        mod->set_collectible();
+    }
+    auto loadRet = mod->load();
+    if (loadRet.is_err())
+    {
+        // Releases the module id taken by load.
+        mod->~RtModuleDef();
+        RET_ERR(loadRet.unwrap_err());
+    }
 
     if (metadata::RtModuleDef::find_module(mod->get_name_no_ext()))
     {
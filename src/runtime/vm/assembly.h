@@ -16,7 +16,8 @@ class Assembly
     static RtResult<metadata::RtAssembly*> load_by_name(const char* name_no_ext);
     static RtResult<metadata::RtAssembly*> load_by_name(RtAppDomain* app_domain, const char* name_no_ext, RtObject* evidence, bool ref_only,
                                                         RtStackCrawlMark& stack_crawl_mark);
-    static RtResult<metadata::RtAssembly*> load_from_data(utils::Span<byte> dllData);
+    // Takes ownership of dllData. Collectible assemblies are loaded through AssemblyLoadContext.
+    static RtResult<metadata::RtAssembly*> load_from_data(utils::Span<byte> dllData, bool collectible = false);
     static RtResult<metadata::RtAssembly*> load_from_data(RtAppDomain* app_domain, RtArray* dll_data, RtArray* symbol_data, RtObject* evidence, bool ref_only);
 
     static RtResult<RtArray*> get_types(metadata::RtAssembly* assembly, bool exported_only);
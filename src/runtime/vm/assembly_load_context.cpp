@@ -0,0 +1,160 @@
+#include "assembly_load_context.h"
+
+#include "array_class.h"
+#include "assembly.h"
+#include "class.h"
+#include "generic_method.h"
+#include "internal_calls.h"
+#include "intrinsics.h"
+#include "pinvoke.h"
+#include "profiler.h"
+#include "reflection.h"
+#include "reverse_pinvoke.h"
+#include "rt_string.h"
+#include "thread_pool.h"
+#include "timer_scheduler.h"
+#include "value_type_comparer.h"
+#include "alloc/general_allocation.h"
+#include "gc/garbage_collector.h"
+#include "interp/interpreter.h"
+#include "interp/machine_state.h"
+#include "metadata/metadata_cache.h"
+#include "metadata/module_def.h"
+#include "utils/rt_vector.h"
+
+namespace leanclr::vm
+{
+
+struct RtAssemblyLoadContext
+{
+    utils::Vector<metadata::RtAssembly*> assemblies;
+};
+
+RtAssemblyLoadContext* AssemblyLoadContext::create_collectible()
+{
+    return alloc::GeneralAllocation::new_any<RtAssemblyLoadContext>();
+}
+
+RtResult<metadata::RtAssembly*> AssemblyLoadContext::load_from_data(RtAssemblyLoadContext* context, utils::Span<byte> dllData)
+{
+    if (!context)
+    {
+        RET_ERR(RtErr::ArgumentNull);
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtAssembly*, ass, Assembly::load_from_data(dllData, true));
+    context->assemblies.push_back(ass);
+    RET_OK(ass);
+}
+
+static void set_unloading(RtAssemblyLoadContext* context, bool unloading)
+{
+    for (metadata::RtAssembly* ass : context->assemblies)
+    {
+        ass->mod->set_unloading(unloading);
+    }
+}
+
+static bool is_running_unloading_code()
+{
+    const interp::MachineState& ms = interp::MachineState::get_global_machine_state();
+    for (size_t i = 0, frame_count = ms.get_active_frame_count(); i < frame_count; ++i)
+    {
+        if (metadata::MetadataCache::refers_to_unloading_module(ms.get_active_frame(i)->method))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_referenced_from_outside(RtAssemblyLoadContext* context)
+{
+    for (metadata::RtModuleDef* mod : metadata::RtModuleDef::get_registered_modules())
+    {
+        if (mod->is_unloading())
+        {
+            continue;
+        }
+        for (metadata::RtAssembly* ass : context->assemblies)
+        {
+            if (mod->references_assembly(ass))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void free_module(metadata::RtAssembly* ass)
+{
+    metadata::RtModuleDef* mod = ass->mod;
+    alloc::MemPool* pool = &mod->get_mem_pool();
+    // The image lives in the pool, its data is the buffer the module was loaded from.
+    const uint8_t* image_data = mod->get_cli_image().get_image_data();
+
+    metadata::RtModuleDef::unregister_module_def(mod);
+    alloc::GeneralAllocation::delete_any(mod);
+    alloc::GeneralAllocation::delete_any(pool);
+    alloc::GeneralAllocation::free(const_cast<uint8_t*>(image_data));
+    alloc::GeneralAllocation::free(ass);
+}
+
+RtResultVoid AssemblyLoadContext::unload(RtAssemblyLoadContext* context)
+{
+    if (!context)
+    {
+        RET_ERR(RtErr::ArgumentNull);
+    }
+    // Queued work items may call into the context, and the corlib's work queue cannot be searched for them:
+    // run them all while the context is still loaded.
+    RET_ERR_ON_FAIL(ThreadPool::run_managed_work_items());
+    set_unloading(context, true);
+    if (is_running_unloading_code() || is_referenced_from_outside(context) || ThreadPool::has_managed_work_requests())
+    {
+        set_unloading(context, false);
+        RET_ERR(RtErr::InvalidOperation);
+    }
+
+    // Drop everything the runtime-wide caches hold over the context while its metadata is still readable.
+    utils::Vector<metadata::RtClass*> released_classes;
+    metadata::MetadataCache::purge_unloading_modules(released_classes);
+    Class::purge_unloading_modules();
+    ArrayClass::purge_unloading_modules();
+    GenericMethod::purge_unloading_modules();
+    InternalCalls::purge_unloading_modules();
+    Intrinsics::purge_unloading_modules();
+    PInvokes::purge_unloading_modules();
+    Profiler::purge_unloading_modules();
+    Reflection::purge_unloading_modules();
+    ReversePInvoke::purge_unloading_modules();
+    TimerScheduler::purge_unloading_modules();
+    ValueTypeComparer::purge_unloading_modules();
+    gc::GarbageCollector::purge_unloading_modules();
+    interp::Interpreter::purge_unloading_modules();
+
+    for (metadata::RtClass* klass : released_classes)
+    {
+        Class::free_static_field_data(klass);
+    }
+    for (metadata::RtAssembly* ass : context->assemblies)
+    {
+        for (metadata::RtClass* klass : ass->mod->get_created_classes())
+        {
+            if (klass)
+            {
+                Class::free_static_field_data(klass);
+            }
+        }
+        String::release_interned_strings(ass->mod);
+    }
+
+    for (metadata::RtAssembly* ass : context->assemblies)
+    {
+        free_module(ass);
+    }
+    alloc::GeneralAllocation::delete_any(context);
+    RET_VOID_OK();
+}
+
+} // namespace leanclr::vm
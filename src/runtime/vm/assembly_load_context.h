@@ -0,0 +1,35 @@
+#pragma once
+
+#include "rt_managed_types.h"
+#include "utils/rt_span.h"
+
+namespace leanclr::vm
+{
+
+struct RtAssemblyLoadContext;
+
+// Collectible assembly load contexts, for plugins and hot reload.
+//
+// Assemblies loaded into a collectible context are freed together when the context is unloaded: their
+// modules, metadata and code pools, image data, static fields, and the inflated generics, array types and
+// reflection objects built over them. Runtime caches, timers whose callback or state belongs to the context
+// and thunks of its delegates handed to native code are dropped, and queued thread pool work items are run
+// first. The GC does not trace yet, so unloading is explicit and it is up to the host to drop every other
+// reference to managed objects of the context first.
+class AssemblyLoadContext
+{
+  public:
+    static RtAssemblyLoadContext* create_collectible();
+
+    // Takes ownership of dllData, which must come from alloc::GeneralAllocation. References to other
+    // assemblies resolve by name as usual: load the assemblies of a plugin into its context first, or they
+    // end up in the default context and stay loaded.
+    static RtResult<metadata::RtAssembly*> load_from_data(RtAssemblyLoadContext* context, utils::Span<byte> dllData);
+
+    // Unloads the assemblies of context and frees it. Fails with InvalidOperation, leaving everything loaded,
+    // while a method of the context is running, an assembly outside the context references one of its
+    // assemblies, or work items remain queued after running the pending ones.
+    static RtResultVoid unload(RtAssemblyLoadContext* context);
+};
+
+} // namespace leanclr::vm
@@ -2072,7 +2072,9 @@ RtResult<metadata::RtClass*> Class::get_ptr_class_by_element_typesig(const metad
 
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, eleClass, get_class_from_typesig(eleTypeSig));
 
-    auto* ptrClass = alloc::MetadataAllocation::malloc_any_zeroed<metadata::RtClass>();
+    const metadata::RtTypeSig* pooledEleTypeSig = ptrTypeSigs.by_val->data.element_type;
+    metadata::RtModuleDef* owner = metadata::MetadataCache::get_collectible_owner(pooledEleTypeSig);
+    auto* ptrClass = metadata::MetadataCache::get_owner_mem_pool(owner, alloc::MemoryCategory::Metadata).malloc_any_zeroed<metadata::RtClass>();
     ptrClass->image = eleClass->image;
     ptrClass->token = 0;
     ptrClass->parent = nullptr;
@@ -2085,7 +2087,7 @@ RtResult<metadata::RtClass*> Class::get_ptr_class_by_element_typesig(const metad
     ptrClass->by_val = ptrTypeSigs.by_val;
     ptrClass->by_ref = ptrTypeSigs.by_ref;
 
-    g_ptrClassCache.insert({eleTypeSig, ptrClass});
+    g_ptrClassCache.insert({pooledEleTypeSig, ptrClass});
     RET_OK(ptrClass);
 }
 
@@ -2109,7 +2111,8 @@ RtResult<metadata::RtClass*> Class::get_generic_param_class_by_typesig(const met
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtTypeSig*, byValTypeSig, mod->get_generic_param_typesig_by_rid(rid, false));
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtTypeSig*, byRefTypeSig, mod->get_generic_param_typesig_by_rid(rid, true));
 
-    auto* genericParamClass = alloc::MetadataAllocation::malloc_any_zeroed<metadata::RtClass>();
+    auto* genericParamClass =
+        metadata::MetadataCache::get_owner_mem_pool(mod->is_collectible() ? mod : nullptr, alloc::MemoryCategory::Metadata).malloc_any_zeroed<metadata::RtClass>();
     genericParamClass->image = mod;
     genericParamClass->token = 0;
     genericParamClass->parent = nullptr;
@@ -2125,6 +2128,30 @@ RtResult<metadata::RtClass*> Class::get_generic_param_class_by_typesig(const met
     RET_OK(genericParamClass);
 }
 
+void Class::purge_unloading_modules()
+{
+    utils::erase_if(g_ptrClassCache,
+                    [](const auto& entry)
+                    {
+                        if (!metadata::MetadataCache::refers_to_unloading_module(entry.first))
+                        {
+                            return false;
+                        }
+                        alloc::GeneralAllocation::free(const_cast<char*>(entry.second->name));
+                        return true;
+                    });
+    utils::erase_if(g_genericParamClassCache, [](const auto& entry) { return entry.second->image->is_unloading(); });
+}
+
+void Class::free_static_field_data(metadata::RtClass* klass)
+{
+    if (klass->static_fields_data)
+    {
+        gc::GarbageCollector::free_fixed(klass->static_fields_data);
+        klass->static_fields_data = nullptr;
+    }
+}
+
 metadata::RtClass* Class::get_enclosing_class(metadata::RtClass* nestedClass)
 {
     return nestedClass->declaring_class;
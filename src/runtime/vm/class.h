@@ -212,6 +212,9 @@ class Class
     // Type signature resolution
     static RtResult<metadata::RtClass*> get_ptr_class_by_element_typesig(const metadata::RtTypeSig* ele_type_sig);
     static RtResult<metadata::RtClass*> get_generic_param_class_by_typesig(const metadata::RtGenericParam* generic_param);
+    // Drops the cached pointer and generic parameter classes of unloading modules.
+    static void purge_unloading_modules();
+    static void free_static_field_data(metadata::RtClass* klass);
 
     // Nested class lookup
     // static RtResult<uint32_t> find_nested_class_gid_by_name(metadata::RtClass* enclosing_class, const char* nested_class_name);
@@ -723,9 +723,85 @@ static RtResult<bool> is_type_match_for_custom_attribute_elem(metadata::RtElemen
     RET_OK(result);
 }
 
-RtResult<RtObject*> CustomAttribute::read_custom_attribute(metadata::RtModuleDef* mod, const metadata::RtCustomAttributeRawData* data)
+static bool is_simple_custom_attribute_elem_type(metadata::RtElementType ele_type)
+{
+    switch (ele_type)
+    {
+    case metadata::RtElementType::Boolean:
+    case metadata::RtElementType::Char:
+    case metadata::RtElementType::I1:
+    case metadata::RtElementType::U1:
+    case metadata::RtElementType::I2:
+    case metadata::RtElementType::U2:
+    case metadata::RtElementType::I4:
+    case metadata::RtElementType::U4:
+    case metadata::RtElementType::I8:
+    case metadata::RtElementType::U8:
+    case metadata::RtElementType::R4:
+    case metadata::RtElementType::R8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Decodes the fixed args of a ctor whose parameters are all primitives or enums. Such values don't reference
+// managed objects, so they can live in the module pool and be reused by every later instantiation.
+// Any failure just leaves the entry undecoded; the regular path reports the error when the attribute is read.
+static void predecode_customattribute_fixed_args(metadata::RtModuleDef* mod, metadata::RtCustomAttributeEntry& entry)
+{
+    const metadata::RtMethodInfo* ctor_method = entry.ctor;
+    uint32_t param_count = ctor_method->parameter_count;
+    if (entry.data_blob_index == 0 || param_count == 0)
+        return;
+
+    for (uint32_t i = 0; i < param_count; ++i)
+    {
+        auto ele_type_ret = get_custom_attribute_elem_type_from_typesig(ctor_method->parameters[i]);
+        if (ele_type_ret.is_err() || !is_simple_custom_attribute_elem_type(ele_type_ret.unwrap()))
+            return;
+    }
+
+    auto reader_ret = mod->get_decoded_blob_reader(entry.data_blob_index);
+    if (reader_ret.is_err())
+        return;
+    utils::BinaryReader& reader = reader_ret.unwrap();
+    uint16_t prolog = 0;
+    if (!reader.try_read_u16(prolog) || prolog != 0x0001)
+        return;
+
+    uint64_t* fixed_args = mod->get_mem_pool().calloc_any<uint64_t>(param_count);
+    for (uint32_t i = 0; i < param_count; ++i)
+    {
+        metadata::RtElementType ele_type = get_custom_attribute_elem_type_from_typesig(ctor_method->parameters[i]).unwrap();
+        auto value_ret = read_customattribute_elem_simple_value(&reader, ele_type);
+        if (value_ret.is_err())
+            return;
+        fixed_args[i] = value_ret.unwrap();
+    }
+    entry.named_args_offset = (uint32_t)reader.get_position();
+    entry.fixed_args = fixed_args;
+}
+
+static RtResult<const metadata::RtCustomAttributeCache*> get_prepared_customattribute_cache(metadata::RtModuleDef* mod, uint32_t target_token)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtCustomAttributeCache*, cache, mod->get_custom_attribute_cache(target_token));
+    if (!cache->prepared)
+    {
+        for (uint32_t i = 0; i < cache->count; ++i)
+        {
+            metadata::RtCustomAttributeEntry& entry = cache->entries[i];
+            RET_ERR_ON_FAIL(Class::initialize_super_types(entry.klass));
+            predecode_customattribute_fixed_args(mod, entry);
+        }
+        cache->prepared = true;
+    }
+    RET_OK(cache);
+}
+
+static RtResult<RtObject*> read_custom_attribute_impl(metadata::RtModuleDef* mod, const metadata::RtMethodInfo* ctor_method, uint32_t data_blob_index,
+                                                      const uint64_t* predecoded_fixed_args, uint32_t named_args_offset)
 {
-    const metadata::RtMethodInfo* ctor_method = data->ctor;
     metadata::RtClass* klass = ctor_method->parent;
     RET_ERR_ON_FAIL(Class::initialize_all(klass));
 
@@ -739,7 +815,7 @@ RtResult<RtObject*> CustomAttribute::read_custom_attribute(metadata::RtModuleDef
 
     uint32_t param_count = ctor_method->parameter_count;
 
-    if (data->dataBlobIndex == 0)
+    if (data_blob_index == 0)
     {
         if (param_count != 0)
             RET_ERR(RtErr::BadImageFormat);
@@ -748,39 +824,54 @@ RtResult<RtObject*> CustomAttribute::read_custom_attribute(metadata::RtModuleDef
     }
     else
     {
-        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(utils::BinaryReader, reader, mod->get_decoded_blob_reader(data->dataBlobIndex));
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(utils::BinaryReader, reader, mod->get_decoded_blob_reader(data_blob_index));
 
-        uint16_t prolog = 0;
-        if (!reader.try_read_u16(prolog))
-            RET_ERR(RtErr::BadImageFormat);
-        if (prolog != 0x0001)
-            RET_ERR(RtErr::BadImageFormat);
-
-        if (param_count == 0)
+        if (predecoded_fixed_args)
         {
-            RET_ERR_ON_FAIL(Runtime::invoke_with_run_cctor(ctor_method, ca_obj, nullptr));
+            // prolog and fixed args were validated and decoded when the cache was prepared
+            if (!reader.try_set_position(named_args_offset))
+                RET_ERR(RtErr::BadImageFormat);
+            const void** invoke_args = (const void**)alloca(sizeof(void*) * param_count);
+            for (uint32_t i = 0; i < param_count; ++i)
+            {
+                invoke_args[i] = &predecoded_fixed_args[i];
+            }
+            RET_ERR_ON_FAIL(Runtime::invoke_with_run_cctor(ctor_method, ca_obj, invoke_args));
         }
         else
         {
-            // TODO: Allocate fixed_arg_buf using ScopeFixedBuffer or similar
-            // For now, use dynamic allocation
-            int64_t* fixed_arg_buf = (int64_t*)alloca(sizeof(int64_t) * param_count);
-            if (fixed_arg_buf == nullptr)
-                RET_ERR(RtErr::OutOfMemory);
-            const void** invoke_args = (const void**)alloca(sizeof(void*) * param_count);
-            if (invoke_args == nullptr)
-                RET_ERR(RtErr::OutOfMemory);
+            uint16_t prolog = 0;
+            if (!reader.try_read_u16(prolog))
+                RET_ERR(RtErr::BadImageFormat);
+            if (prolog != 0x0001)
+                RET_ERR(RtErr::BadImageFormat);
 
-            for (uint32_t i = 0; i < param_count; ++i)
+            if (param_count == 0)
             {
-                const metadata::RtTypeSig* param_type_sig = ctor_method->parameters[i];
-                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(FixedArg, fixed_arg, read_fixed_arg(mod, param_type_sig, &reader));
-                fixed_arg_buf[i] = fixed_arg.value;
+                RET_ERR_ON_FAIL(Runtime::invoke_with_run_cctor(ctor_method, ca_obj, nullptr));
+            }
+            else
+            {
+                // TODO: Allocate fixed_arg_buf using ScopeFixedBuffer or similar
+                // For now, use dynamic allocation
+                int64_t* fixed_arg_buf = (int64_t*)alloca(sizeof(int64_t) * param_count);
+                if (fixed_arg_buf == nullptr)
+                    RET_ERR(RtErr::OutOfMemory);
+                const void** invoke_args = (const void**)alloca(sizeof(void*) * param_count);
+                if (invoke_args == nullptr)
+                    RET_ERR(RtErr::OutOfMemory);
+
+                for (uint32_t i = 0; i < param_count; ++i)
+                {
+                    const metadata::RtTypeSig* param_type_sig = ctor_method->parameters[i];
+                    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(FixedArg, fixed_arg, read_fixed_arg(mod, param_type_sig, &reader));
+                    fixed_arg_buf[i] = fixed_arg.value;
 
-                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, is_val_type, Type::is_value_type(param_type_sig));
-                invoke_args[i] = is_val_type ? (const void*)&fixed_arg_buf[i] : (const void*)fixed_arg_buf[i];
+                    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, is_val_type, Type::is_value_type(param_type_sig));
+                    invoke_args[i] = is_val_type ? (const void*)&fixed_arg_buf[i] : (const void*)fixed_arg_buf[i];
+                }
+                RET_ERR_ON_FAIL(Runtime::invoke_with_run_cctor(ctor_method, ca_obj, invoke_args));
             }
-            RET_ERR_ON_FAIL(Runtime::invoke_with_run_cctor(ctor_method, ca_obj, invoke_args));
         }
 
         uint16_t named_arg_count = 0;
@@ -832,6 +923,16 @@ RtResult<RtObject*> CustomAttribute::read_custom_attribute(metadata::RtModuleDef
     return ca_obj;
 }
 
+RtResult<RtObject*> CustomAttribute::read_custom_attribute(metadata::RtModuleDef* mod, const metadata::RtCustomAttributeRawData* data)
+{
+    return read_custom_attribute_impl(mod, data->ctor, data->dataBlobIndex, nullptr, 0);
+}
+
+static RtResult<RtObject*> read_cached_custom_attribute(metadata::RtModuleDef* mod, const metadata::RtCustomAttributeEntry& entry)
+{
+    return read_custom_attribute_impl(mod, entry.ctor, entry.data_blob_index, entry.fixed_args, entry.named_args_offset);
+}
+
 static RtResult<RtObject*> new_custom_attribute_typed_argument(const metadata::RtMethodInfo* ctor, const metadata::RtTypeSig* param_type, const void* data)
 {
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, param_klass, Class::get_class_from_typesig(param_type));
@@ -962,17 +1063,11 @@ RtResult<bool> CustomAttribute::has_customattribute_on_target(metadata::RtModule
 
     RET_ERR_ON_FAIL(Class::initialize_super_types(attr_klass));
 
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(metadata::RtCustomAttributeRidRange, rid_range, mod->get_custom_attribute_rid_range(target_token));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtCustomAttributeCache*, cache, get_prepared_customattribute_cache(mod, target_token));
 
-    for (uint32_t i = 0; i < rid_range.count; ++i)
+    for (uint32_t i = 0; i < cache->count; ++i)
     {
-        uint32_t ca_rid = rid_range.start_rid + i;
-        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtCustomAttributeRawData, raw_data, mod->get_custom_attribute_raw_data(ca_rid));
-
-        metadata::RtClass* data_klass = raw_data.ctor->parent;
-        RET_ERR_ON_FAIL(Class::initialize_super_types(data_klass));
-
-        if (Class::has_class_parent_fast(data_klass, attr_klass))
+        if (Class::has_class_parent_fast(cache->entries[i].klass, attr_klass))
             RET_OK(true);
     }
 
@@ -1128,22 +1223,23 @@ RtResult<RtArray*> CustomAttribute::get_customattribute_on_target_token(metadata
         RET_ERR_ON_FAIL(Class::initialize_super_types(attr_klass));
     }
 
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(metadata::RtCustomAttributeRidRange, rid_range, mod->get_custom_attribute_rid_range(target_token));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtCustomAttributeCache*, cache, get_prepared_customattribute_cache(mod, target_token));
 
     utils::Vector<RtObject*> ca_buf;
-    ca_buf.reserve(rid_range.count);
+    ca_buf.reserve(cache->count);
 
-    for (uint32_t i = 0; i < rid_range.count; ++i)
+    for (uint32_t i = 0; i < cache->count; ++i)
     {
-        uint32_t ca_rid = rid_range.start_rid + i;
-        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtCustomAttributeRawData, raw_data, mod->get_custom_attribute_raw_data(ca_rid));
-        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ca, read_custom_attribute(mod, &raw_data));
-
-        if (attr_klass && !Object::is_inst(ca, attr_klass))
+        const metadata::RtCustomAttributeEntry& entry = cache->entries[i];
+        // filter by the resolved attribute class first so non-matching attributes are never instantiated
+        if (attr_klass)
         {
-            continue;
+            RET_ERR_ON_FAIL(Class::initialize_all(entry.klass));
+            if (!Class::is_assignable_from(entry.klass, attr_klass))
+                continue;
         }
 
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ca, read_cached_custom_attribute(mod, entry));
         ca_buf.push_back(ca);
     }
 
@@ -1198,23 +1294,22 @@ RtResult<RtArray*> CustomAttribute::get_customattributes_data_on_target_token(me
         return Array::new_empty_szarray_by_ele_klass(types.cls_customattributedata);
     }
 
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(metadata::RtCustomAttributeRidRange, rid_range, mod->get_custom_attribute_rid_range(target_token));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtCustomAttributeCache*, cache, get_prepared_customattribute_cache(mod, target_token));
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(const metadata::RtMethodInfo*, ca_data_ctor, get_customattribute_data_ctor());
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(RtArray*, ca_data_arr, Array::new_array_from_ele_klass(types.cls_customattributedata, (int32_t)rid_range.count));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(RtArray*, ca_data_arr, Array::new_array_from_ele_klass(types.cls_customattributedata, (int32_t)cache->count));
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtReflectionAssembly*, assembly_obj, Reflection::get_assembly_reflection_object(mod->get_assembly()));
-    for (uint32_t i = 0; i < rid_range.count; ++i)
+    for (uint32_t i = 0; i < cache->count; ++i)
     {
-        uint32_t ca_rid = rid_range.start_rid + i;
-        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtCustomAttributeRawData, raw_data, mod->get_custom_attribute_raw_data(ca_rid));
-        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ca, read_custom_attribute(mod, &raw_data));
+        const metadata::RtCustomAttributeEntry& entry = cache->entries[i];
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ca, read_cached_custom_attribute(mod, entry));
 
-        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(utils::BinaryReader, reader, mod->get_decoded_blob_reader(raw_data.dataBlobIndex));
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(utils::BinaryReader, reader, mod->get_decoded_blob_reader(entry.data_blob_index));
         RtArray* typed_arg_arr = nullptr;
         RtArray* named_arg_arr = nullptr;
-        RET_ERR_ON_FAIL(resolve_customattribute_data_arguments(&reader, mod, raw_data.ctor, &typed_arg_arr, &named_arg_arr));
+        RET_ERR_ON_FAIL(resolve_customattribute_data_arguments(&reader, mod, entry.ctor, &typed_arg_arr, &named_arg_arr));
 
         const void* ctor_args[4];
-        UNWRAP_OR_RET_ERR_ON_FAIL(ctor_args[0], Reflection::get_method_reflection_object(raw_data.ctor, raw_data.ctor->parent));
+        UNWRAP_OR_RET_ERR_ON_FAIL(ctor_args[0], Reflection::get_method_reflection_object(entry.ctor, entry.klass));
         const void* data_ptr = reader.data();
         size_t data_len = reader.length();
         ctor_args[1] = assembly_obj;
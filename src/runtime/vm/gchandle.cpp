@@ -2,6 +2,7 @@
 #include "rt_string.h"
 #include "rt_array.h"
 #include "class.h"
+#include "reverse_pinvoke.h"
 #include "metadata/metadata_cache.h"
 #include "alloc/general_allocation.h"
 
@@ -32,7 +33,7 @@ static HandleInfo* alloc_handle()
     if (s_freed_handle_head == nullptr)
     {
         // Allocate a new handle
-        HandleInfo* h = alloc::GeneralAllocation::malloc_any_zeroed<HandleInfo>();
+        HandleInfo* h = alloc::GeneralAllocation::malloc_any_zeroed<HandleInfo>(alloc::MemoryCategory::Handles);
         return h;
     }
     else
@@ -64,6 +65,13 @@ static void free_handle_impl(HandleInfo* handle)
 void GCHandle::free_handle(void* handle)
 {
     HandleInfo* h = reinterpret_cast<HandleInfo*>(handle);
+    // Nothing is collected, so freeing the handle that kept a callback alive is the only sign that native
+    // code is done with its thunk.
+    bool is_strong = h && (h->type_ == GCHandleType::Normal || h->type_ == GCHandleType::Pinned);
+    if (is_strong && h->obj && Class::is_multicastdelegate_subclass(h->obj->klass))
+    {
+        ReversePInvoke::retire_delegate(reinterpret_cast<RtDelegate*>(h->obj));
+    }
     free_handle_impl(h);
 }
 
@@ -15,6 +15,17 @@ using namespace leanclr::metadata;
 using namespace leanclr::core;
 using namespace leanclr::alloc;
 
+// Inflated generic classes are owned by the collectible module their instantiation refers to, if any.
+static alloc::MemPool& get_generic_class_mem_pool(const RtGenericClass* genericClass)
+{
+    return MetadataCache::get_owner_mem_pool(MetadataCache::get_collectible_owner(genericClass), alloc::MemoryCategory::GenericInstances);
+}
+
+static alloc::MemPool& get_generic_class_mem_pool(RtClass* klass)
+{
+    return get_generic_class_mem_pool(klass->by_val->data.generic_class);
+}
+
 // Helper: get class from not pooled generic class
 static RtResult<RtClass*> get_class_from_not_pooled_generic_class(const RtGenericClass* genericClass)
 {
@@ -37,7 +48,7 @@ static RtResult<RtClass*> get_class_from_pooled_generic_class(const RtGenericCla
         RET_OK(genericClass->cache_klass);
     }
 
-    RtClass* new_class = MetadataAllocation::malloc_any_zeroed<RtClass>();
+    RtClass* new_class = get_generic_class_mem_pool(genericClass).malloc_any_zeroed<RtClass>();
     const_cast<RtGenericClass*>(genericClass)->cache_klass = new_class;
 
     RtGenericContext generic_context{genericClass->class_inst, nullptr};
@@ -108,7 +119,7 @@ RtResultVoid GenericClass::setup_fields(RtClass* klass)
     RET_ERR_ON_FAIL(Class::initialize_fields(base_generic_class));
 
     klass->field_count = base_generic_class->field_count;
-    alloc::MemPool& pool = klass->image->get_mem_pool();
+    alloc::MemPool& pool = get_generic_class_mem_pool(klass);
     if (base_generic_class->fields)
     {
         size_t field_count = base_generic_class->field_count;
@@ -143,7 +154,7 @@ RtResultVoid GenericClass::setup_interfaces(RtClass* klass)
     RET_ERR_ON_FAIL(Class::initialize_interfaces(base_generic_class));
 
     klass->interface_count = base_generic_class->interface_count;
-    alloc::MemPool& pool = klass->image->get_mem_pool();
+    alloc::MemPool& pool = get_generic_class_mem_pool(klass);
     if (base_generic_class->interfaces)
     {
         size_t interface_count = base_generic_class->interface_count;
@@ -180,7 +191,7 @@ RtResultVoid GenericClass::setup_methods(RtClass* klass)
     if (base_generic_class->method_count > 0)
     {
         size_t method_count = base_generic_class->method_count;
-        alloc::MemPool& pool = klass->image->get_mem_pool();
+        alloc::MemPool& pool = get_generic_class_mem_pool(klass);
         const RtMethodInfo** methods = pool.calloc_any<const RtMethodInfo*>(method_count);
 
         for (size_t i = 0; i < method_count; ++i)
@@ -206,7 +217,7 @@ RtResultVoid GenericClass::setup_properties(RtClass* klass)
     if (base_generic_class->property_count > 0)
     {
         size_t property_count = base_generic_class->property_count;
-        alloc::MemPool& pool = klass->image->get_mem_pool();
+        alloc::MemPool& pool = get_generic_class_mem_pool(klass);
         RtPropertyInfo* properties = pool.calloc_any<RtPropertyInfo>(property_count);
 
         RtGenericContext generic_context{generic_class->class_inst, nullptr};
@@ -273,7 +284,7 @@ RtResultVoid GenericClass::setup_events(RtClass* klass)
     if (base_generic_class->event_count > 0)
     {
         size_t event_count = base_generic_class->event_count;
-        alloc::MemPool& pool = klass->image->get_mem_pool();
+        alloc::MemPool& pool = get_generic_class_mem_pool(klass);
         RtEventInfo* events = pool.calloc_any<RtEventInfo>(event_count);
 
         RtGenericContext generic_context{generic_class->class_inst, nullptr};
@@ -343,7 +354,7 @@ RtResultVoid GenericClass::setup_vtables(RtClass* klass)
         inflated_method->slot = base_method->slot;
     }
 
-    alloc::MemPool& pool = klass->image->get_mem_pool();
+    alloc::MemPool& pool = get_generic_class_mem_pool(klass);
     // Setup vtable
     if (base_generic_class->vtable_count > 0)
     {
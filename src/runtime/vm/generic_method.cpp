@@ -82,6 +82,11 @@ RtResult<const RtMethodInfo*> GenericMethod::get_method(const RtMethodInfo* meth
     return get_method_from_pooled_generic_method(generic_method);
 }
 
+void GenericMethod::purge_unloading_modules()
+{
+    utils::erase_if(g_method_map, [](const auto& entry) { return MetadataCache::refers_to_unloading_module(entry.second); });
+}
+
 RtResult<const RtMethodInfo*> GenericMethod::get_method_from_pooled_generic_method(const RtGenericMethod* genericMethod)
 {
     auto it = g_method_map.find(genericMethod);
@@ -93,7 +98,7 @@ RtResult<const RtMethodInfo*> GenericMethod::get_method_from_pooled_generic_meth
     uint32_t base_method_gid = genericMethod->base_method_gid;
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const RtMethodInfo*, base_method, Method::get_method_by_method_def_gid(base_method_gid));
 
-    alloc::MemPool& pool = base_method->parent->image->get_mem_pool();
+    alloc::MemPool& pool = MetadataCache::get_owner_mem_pool(MetadataCache::get_collectible_owner(genericMethod), alloc::MemoryCategory::GenericInstances);
     RtMethodInfo* new_method = pool.malloc_any_zeroed<RtMethodInfo>();
     const RtGenericContext& generic_context = genericMethod->generic_context;
 
@@ -13,5 +13,8 @@ class GenericMethod
 
     // Get inflated method from pooled generic method
     static RtResult<const metadata::RtMethodInfo*> get_method_from_pooled_generic_method(const metadata::RtGenericMethod* genericMethod);
+
+    // Drops the inflated methods that refer to an unloading module.
+    static void purge_unloading_modules();
 };
 } // namespace leanclr::vm
@@ -2,100 +2,61 @@
 #include "method.h"
 #include "class.h"
 #include "metadata/module_def.h"
-#include "utils/string_builder.h"
 #include "utils/string_util.h"
-#include "metadata/metadata_name.h"
 #include "icalls/internal_call_stubs.h"
+#include "method_binding_table.h"
 
 namespace leanclr::vm
 {
 
-// Static maps for internal call functions
-static utils::HashMap<const char*, InternalCallRegistry, utils::CStrHasher, utils::CStrCompare> g_pinvoke_map;
-static utils::HashMap<const char*, InternalCallInvoker, utils::CStrHasher, utils::CStrCompare> g_newobjInternalCallMap;
+// Binding tables for internal call functions
+static MethodBindingTable<InternalCallRegistry> g_internalCallTable;
+static MethodBindingTable<InternalCallInvoker> g_newobjInternalCallTable;
 static utils::Vector<InternalCallInvoker> g_internalCallInvokerIdList;
 static utils::HashMap<InternalCallInvoker, uint16_t> g_internalCallInvokerIdMap;
 
 // Register an internal call function by name
 void InternalCalls::register_internal_call(const char* name, InternalCallFunction func, InternalCallInvoker invoker)
 {
-    assert(g_pinvoke_map.find(name) == g_pinvoke_map.end() && "Internal call already registered");
-    g_pinvoke_map[name] = InternalCallRegistry{func, invoker};
+    g_internalCallTable.add(name, InternalCallRegistry{func, invoker});
 }
 
 // Get internal call by name
 const InternalCallRegistry* InternalCalls::get_internal_call(const char* name)
 {
-    auto it = g_pinvoke_map.find(name);
-    if (it != g_pinvoke_map.end())
-        return &it->second;
-    return nullptr;
+    return g_internalCallTable.find_by_name(name);
 }
 
-// Get internal call by method info (builds full method name with params)
+// Get internal call by method info (matches by name hash, falls back to the entry without params)
 RtResult<const InternalCallRegistry*> InternalCalls::get_internal_call_by_method(const metadata::RtMethodInfo* method)
 {
-    // Try with full method name (including parameters)
-    utils::StringBuilder sb;
-    {
-        RET_ERR_ON_FAIL(metadata::MetadataName::append_method_full_name_with_params(sb, method));
-        auto it = g_pinvoke_map.find(sb.as_cstr());
-        if (it != g_pinvoke_map.end())
-            RET_OK(&it->second);
-    }
-
-    // Try with method name without parameters
-    {
-        sb.clear();
-        RET_ERR_ON_FAIL(metadata::MetadataName::append_method_full_name_without_params(sb, method));
-        auto it = g_pinvoke_map.find(sb.as_cstr());
-        if (it != g_pinvoke_map.end())
-            RET_OK(&it->second);
-    }
-
-    RET_OK(nullptr);
+    return g_internalCallTable.find(method);
 }
 
 // Register newobj internal call
 void InternalCalls::register_newobj_internal_call(const char* name, InternalCallInvoker invoker)
 {
-    assert(g_newobjInternalCallMap.find(name) == g_newobjInternalCallMap.end() && "Newobj internal call already registered");
-    g_newobjInternalCallMap[name] = invoker;
+    g_newobjInternalCallTable.add(name, invoker);
 }
 
 // Get newobj internal call by name
 InternalCallInvoker InternalCalls::get_newobj_internal_call(const char* name)
 {
-    auto it = g_newobjInternalCallMap.find(name);
-    if (it != g_newobjInternalCallMap.end())
-        return it->second;
-    return nullptr;
+    const InternalCallInvoker* invoker = g_newobjInternalCallTable.find_by_name(name);
+    return invoker ? *invoker : nullptr;
 }
 
 // Get newobj internal call by method info
 RtResult<InternalCallInvoker> InternalCalls::get_newobj_internal_call_by_method(const metadata::RtMethodInfo* method)
 {
-    utils::StringBuilder sb;
-    // Try with full method name (including parameters)
-    {
-        RET_ERR_ON_FAIL(metadata::MetadataName::append_method_full_name_with_params(sb, method));
-        const char* fullName = sb.as_cstr();
-        auto it = g_newobjInternalCallMap.find(fullName);
-        if (it != g_newobjInternalCallMap.end())
-            RET_OK(it->second);
-    }
-
-    // Try with method name without parameters
-    {
-        sb.clear();
-        RET_ERR_ON_FAIL(metadata::MetadataName::append_method_full_name_without_params(sb, method));
-        const char* nameOnly = sb.as_cstr();
-        auto it = g_newobjInternalCallMap.find(nameOnly);
-        if (it != g_newobjInternalCallMap.end())
-            RET_OK(it->second);
-    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const InternalCallInvoker*, invoker, g_newobjInternalCallTable.find(method));
+    RET_OK(invoker ? *invoker : (InternalCallInvoker) nullptr);
+}
 
-    RET_OK((InternalCallInvoker) nullptr);
+void InternalCalls::purge_unloading_modules()
+{
+    g_internalCallTable.purge_unloading_modules();
+    g_newobjInternalCallTable.purge_unloading_modules();
 }
 
 // Get ID for an internal call invoker (with registration if needed)
@@ -55,6 +55,9 @@ class InternalCalls
     // Internal call invoker ID management
     static uint16_t get_internal_call_invoker_id(InternalCallInvoker invoker);
     static InternalCallInvoker get_internal_call_invoker_by_id(uint16_t id);
+
+    // Forgets the bindings looked up for methods of unloading modules.
+    static void purge_unloading_modules();
 };
 
 }; // namespace leanclr::vm
@@ -2,94 +2,61 @@
 #include "method.h"
 #include "class.h"
 #include "metadata/module_def.h"
-#include "utils/string_builder.h"
 #include "utils/string_util.h"
-#include "metadata/metadata_name.h"
 #include "intrinsics/intrinsic_stubs.h"
+#include "method_binding_table.h"
 
 namespace leanclr::vm
 {
 
-// Static maps for intrinsic functions
-static utils::HashMap<const char*, IntrinsicRegistry, utils::CStrHasher, utils::CStrCompare> g_intrinsicMap;
-static utils::HashMap<const char*, IntrinsicInvoker, utils::CStrHasher, utils::CStrCompare> g_newobjIntrinsicMap;
+// Binding tables for intrinsic functions
+static MethodBindingTable<IntrinsicRegistry> g_intrinsicTable;
+static MethodBindingTable<IntrinsicInvoker> g_newobjIntrinsicTable;
 static utils::Vector<IntrinsicInvoker> g_intrinsicInvokerIdList;
 static utils::HashMap<IntrinsicInvoker, uint16_t> g_intrinsicInvokerIdMap;
 
 // Register an intrinsic function by name
 void Intrinsics::register_intrinsic(const char* name, IntrinsicFunction func, IntrinsicInvoker invoker)
 {
-    assert(g_intrinsicMap.find(name) == g_intrinsicMap.end() && "Intrinsic already registered");
-    g_intrinsicMap[name] = IntrinsicRegistry{func, invoker};
+    g_intrinsicTable.add(name, IntrinsicRegistry{func, invoker});
 }
 
-// Get intrinsic by name and length
+// Get intrinsic by name
 const IntrinsicRegistry* Intrinsics::get_intrinsic(const char* name)
 {
-    auto it = g_intrinsicMap.find(name);
-    if (it != g_intrinsicMap.end())
-        return &it->second;
-    return nullptr;
+    return g_intrinsicTable.find_by_name(name);
 }
 
-// Get intrinsic by method info (builds full method name with params)
+// Get intrinsic by method info (matches by name hash, falls back to the entry without params)
 RtResult<const IntrinsicRegistry*> Intrinsics::get_intrinsic_by_method(const metadata::RtMethodInfo* method)
 {
-    utils::StringBuilder sb;
-
-    {
-        RET_ERR_ON_FAIL(metadata::MetadataName::append_method_full_name_with_params(sb, method));
-        auto it = g_intrinsicMap.find(sb.as_cstr());
-        if (it != g_intrinsicMap.end())
-            RET_OK(&it->second);
-    }
-
-    {
-        sb.clear();
-        RET_ERR_ON_FAIL(metadata::MetadataName::append_method_full_name_without_params(sb, method));
-        auto it = g_intrinsicMap.find(sb.as_cstr());
-        if (it != g_intrinsicMap.end())
-            RET_OK(&it->second);
-    }
-    RET_OK(nullptr);
+    return g_intrinsicTable.find(method);
 }
 
 // Register newobj intrinsic
 void Intrinsics::register_newobj_intrinsic(const char* name, IntrinsicInvoker invoker)
 {
-    assert(g_newobjIntrinsicMap.find(name) == g_newobjIntrinsicMap.end() && "Newobj intrinsic already registered");
-    g_newobjIntrinsicMap[name] = invoker;
+    g_newobjIntrinsicTable.add(name, invoker);
 }
 
-// Get newobj intrinsic by name and length
+// Get newobj intrinsic by name
 IntrinsicInvoker Intrinsics::get_newobj_intrinsic(const char* name)
 {
-    auto it = g_newobjIntrinsicMap.find(name);
-    if (it != g_newobjIntrinsicMap.end())
-        return it->second;
-    return nullptr;
+    const IntrinsicInvoker* invoker = g_newobjIntrinsicTable.find_by_name(name);
+    return invoker ? *invoker : nullptr;
 }
 
 // Get newobj intrinsic by method info
 RtResult<IntrinsicInvoker> Intrinsics::get_newobj_intrinsic_by_method(const metadata::RtMethodInfo* method)
 {
-    utils::StringBuilder sb;
-
-    {
-        RET_ERR_ON_FAIL(metadata::MetadataName::append_method_full_name_with_params(sb, method));
-        auto it = g_newobjIntrinsicMap.find(sb.as_cstr());
-        if (it != g_newobjIntrinsicMap.end())
-            RET_OK(it->second);
-    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const IntrinsicInvoker*, invoker, g_newobjIntrinsicTable.find(method));
+    RET_OK(invoker ? *invoker : (IntrinsicInvoker) nullptr);
+}
 
-    {
-        sb.clear();
-        RET_ERR_ON_FAIL(metadata::MetadataName::append_method_full_name_without_params(sb, method));
-        auto it = g_newobjIntrinsicMap.find(sb.as_cstr());
-        if (it != g_newobjIntrinsicMap.end())
-            RET_OK(it->second);
-    }
-    RET_OK((IntrinsicInvoker) nullptr);
+void Intrinsics::purge_unloading_modules()
+{
+    g_intrinsicTable.purge_unloading_modules();
+    g_newobjIntrinsicTable.purge_unloading_modules();
 }
 
 // Get ID for an intrinsic invoker (with registration if needed)
@@ -55,5 +55,8 @@ class Intrinsics
     // Intrinsic invoker ID management
     static uint16_t get_intrinsic_invoker_id(IntrinsicInvoker invoker);
     static IntrinsicInvoker get_intrinsic_invoker_by_id(uint16_t id);
+
+    // Forgets the bindings looked up for methods of unloading modules.
+    static void purge_unloading_modules();
 };
 }; // namespace leanclr::vm
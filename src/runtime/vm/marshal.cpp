@@ -4,8 +4,8 @@
 #include "rt_string.h"
 #include "class.h"
 #include "field.h"
+#include "reverse_pinvoke.h"
 #include "utils/string_util.h"
-#include "utils/string_builder.h"
 
 namespace leanclr::vm
 {
@@ -76,9 +76,7 @@ vm::RtString* Marshal::ptr_to_string_bstr(void* ptr)
 
 void* Marshal::string_to_hglobal_ansi(const Utf16Char* chars, int32_t len)
 {
-    utils::StringBuilder utf8_str;
-    utils::StringUtil::utf16_to_utf8(chars, len, utf8_str);
-    return const_cast<char*>(utils::StringUtil::strdup(utf8_str.as_cstr()));
+    return const_cast<char*>(utils::StringUtil::strdup_utf16_to_utf8(chars, static_cast<size_t>(len)));
 }
 
 void* Marshal::string_to_hglobal_uni(const Utf16Char* chars, int32_t len)
@@ -144,12 +142,22 @@ RtResult<void*> Marshal::unsafe_addr_of_pinned_array_element(vm::RtArray* arr, i
 
 RtResult<RtDelegate*> Marshal::marshal_function_pointer_to_delegate(void* ptr, metadata::RtClass* delegate_class)
 {
-    RET_ERR(RtErr::NotImplemented);
+    if (!ptr)
+    {
+        RET_ERR(RtErr::ArgumentNull);
+    }
+    // Only pointers from get_function_pointer_for_delegate map back, to the delegate they were made for.
+    RtDelegate* delegate = ReversePInvoke::get_delegate(ptr);
+    if (!delegate || delegate->klass != delegate_class)
+    {
+        RET_ERR(RtErr::NotSupported);
+    }
+    RET_OK(delegate);
 }
 
 RtResult<void*> Marshal::get_function_pointer_for_delegate(RtDelegate* delegate)
 {
-    RET_ERR(RtErr::NotImplemented);
+    return ReversePInvoke::get_function_pointer(delegate);
 }
 
 int32_t Marshal::get_last_win32_error()
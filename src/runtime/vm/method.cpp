@@ -408,6 +408,16 @@ size_t Method::get_method_index_in_class(const RtMethodInfo* method)
     return static_cast<size_t>(-1);
 }
 
+alloc::MemPool& Method::get_code_mem_pool(const metadata::RtMethodInfo* method)
+{
+    metadata::RtModuleDef* owner = metadata::MetadataCache::get_collectible_owner(method->parent->by_val);
+    if (!owner && method->generic_method)
+    {
+        owner = metadata::MetadataCache::get_collectible_owner(method->generic_method);
+    }
+    return owner ? owner->get_code_mem_pool() : method->parent->image->get_code_mem_pool();
+}
+
 RtResult<const RtMethodInfo*> Method::inflate_method(const RtMethodInfo* method, const RtGenericContext* gc)
 {
     if (!gc)
@@ -7,6 +7,11 @@
 #include "core/rt_result.h"
 #include "utils/rt_vector.h"
 
+namespace leanclr::alloc
+{
+class MemPool;
+}
+
 namespace leanclr::vm
 {
 class Method
@@ -67,6 +72,9 @@ class Method
     static RtResult<bool> is_intrinsic(const metadata::RtMethodInfo* method);
     static RtResultVoid build_method_arg_descs(metadata::RtMethodInfo* method);
     static size_t get_method_index_in_class(const metadata::RtMethodInfo* method);
+    // Pool for the interpreter code of method: the code pool of the collectible module an inflated method
+    // refers to, if any, otherwise that of the module declaring it.
+    static alloc::MemPool& get_code_mem_pool(const metadata::RtMethodInfo* method);
 
     // Metadata accessors
     static RtResult<const metadata::RtMethodInfo*> inflate_method(const metadata::RtMethodInfo* method, const metadata::RtGenericContext* gc);
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+#include "rt_managed_types.h"
+#include "metadata/metadata_cache.h"
+#include "metadata/metadata_name.h"
+#include "metadata/module_def.h"
+#include "utils/hash_util.h"
+#include "utils/hashmap.h"
+#include "utils/rt_vector.h"
+#include "utils/string_builder.h"
+
+namespace leanclr::vm
+{
+
+// Native bindings (icalls, intrinsics, pinvokes) registered by names of the form
+// "[Module]Namespace.Class::Method(params)", where the module prefix and params are optional.
+// Names are split and hashed once when registered and the table is sorted by hash on first lookup.
+// Binding a method streams its metadata name through a hasher to find the entries of that hash, and
+// only formats its names to compare them with those entries. The resolved binding is memoized per method.
+template <typename V>
+class MethodBindingTable
+{
+  public:
+    void add(const char* name, const V& value)
+    {
+        Entry entry{};
+        entry.name = name;
+        entry.value = value;
+
+        const char* type_and_method = name;
+        if (*type_and_method == '[')
+        {
+            const char* module_end = std::strchr(type_and_method, ']');
+            assert(module_end && "Module name of binding is not terminated");
+            entry.module_name = type_and_method + 1;
+            entry.module_name_len = static_cast<uint32_t>(module_end - entry.module_name);
+            type_and_method = module_end + 1;
+        }
+
+        const char* params = std::strchr(type_and_method, '(');
+        entry.type_and_method = type_and_method;
+        entry.type_and_method_len = static_cast<uint32_t>(params ? params - type_and_method : std::strlen(type_and_method));
+        entry.params = params;
+        entry.name_hash = utils::StreamingNameHasher::hash(type_and_method, entry.type_and_method_len);
+
+        _entries.push_back(entry);
+        _sorted = false;
+        _method_cache.clear();
+    }
+
+    const V* find_by_name(const char* name)
+    {
+        ensure_sorted();
+        const char* type_and_method = name;
+        if (*type_and_method == '[')
+        {
+            const char* module_end = std::strchr(type_and_method, ']');
+            if (!module_end)
+                return nullptr;
+            type_and_method = module_end + 1;
+        }
+        const char* params = std::strchr(type_and_method, '(');
+        size_t name_len = params ? static_cast<size_t>(params - type_and_method) : std::strlen(type_and_method);
+        uint64_t name_hash = utils::StreamingNameHasher::hash(type_and_method, name_len);
+        auto range = std::equal_range(_entries.begin(), _entries.end(), name_hash, HashLess{});
+        for (const Entry* it = range.first; it != range.second; ++it)
+        {
+            if (std::strcmp(it->name, name) == 0)
+                return &it->value;
+        }
+        return nullptr;
+    }
+
+    // Preference: module and params match > params match > name-only match.
+    RtResult<const V*> find(const metadata::RtMethodInfo* method)
+    {
+        auto cached = _method_cache.find(method);
+        if (cached != _method_cache.end())
+        {
+            RET_OK(cached->second);
+        }
+
+        ensure_sorted();
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(uint64_t, name_hash, metadata::MetadataName::hash_method_full_name_without_params(method));
+        auto range = std::equal_range(_entries.begin(), _entries.end(), name_hash, HashLess{});
+
+        const Entry* best = nullptr;
+        int32_t best_rank = INT32_MAX;
+        // Formatted on the first candidate: different names can share a hash.
+        utils::StringBuilder name;
+        utils::StringBuilder params;
+        for (const Entry* it = range.first; it != range.second; ++it)
+        {
+            if (it->module_name && !is_module_matched(*it, method))
+                continue;
+            if (name.length() == 0)
+            {
+                RET_ERR_ON_FAIL(metadata::MetadataName::append_method_full_name_without_params(name, method));
+            }
+            if (it->type_and_method_len != name.length() || std::memcmp(it->type_and_method, name.as_cstr(), name.length()) != 0)
+                continue;
+            if (it->params)
+            {
+                if (params.length() == 0)
+                {
+                    RET_ERR_ON_FAIL(metadata::MetadataName::append_method_params(params, method));
+                }
+                if (std::strcmp(it->params, params.as_cstr()) != 0)
+                    continue;
+            }
+            int32_t rank = (it->params ? 0 : 2) + (it->module_name ? 0 : 1);
+            if (rank < best_rank)
+            {
+                best = it;
+                best_rank = rank;
+            }
+        }
+
+        const V* result = best ? &best->value : nullptr;
+        _method_cache[method] = result;
+        RET_OK(result);
+    }
+
+    // Forgets the bindings memoized for methods of unloading modules, misses included.
+    void purge_unloading_modules()
+    {
+        utils::erase_if(_method_cache, [](const auto& entry) { return metadata::MetadataCache::refers_to_unloading_module(entry.first); });
+    }
+
+  private:
+    struct Entry
+    {
+        uint64_t name_hash;
+        // The whole registered name, and its "Namespace.Class::Method" and "(params)" parts.
+        const char* name;
+        const char* type_and_method;
+        uint32_t type_and_method_len;
+        const char* params;
+        const char* module_name;
+        uint32_t module_name_len;
+        V value;
+    };
+
+    struct HashLess
+    {
+        bool operator()(const Entry& a, uint64_t b) const
+        {
+            return a.name_hash < b;
+        }
+
+        bool operator()(uint64_t a, const Entry& b) const
+        {
+            return a < b.name_hash;
+        }
+    };
+
+    static bool is_module_matched(const Entry& entry, const metadata::RtMethodInfo* method)
+    {
+        const char* module_name = method->parent->image->get_name_no_ext();
+        return std::strncmp(module_name, entry.module_name, entry.module_name_len) == 0 && module_name[entry.module_name_len] == '\0';
+    }
+
+    void ensure_sorted()
+    {
+        if (_sorted)
+            return;
+        std::sort(_entries.begin(), _entries.end(), [](const Entry& a, const Entry& b) {
+            if (a.name_hash != b.name_hash)
+                return a.name_hash < b.name_hash;
+            return std::strcmp(a.name, b.name) < 0;
+        });
+        for (size_t i = 1; i < _entries.size(); ++i)
+        {
+            assert(std::strcmp(_entries[i - 1].name, _entries[i].name) != 0 && "Binding already registered");
+        }
+        _sorted = true;
+    }
+
+    utils::Vector<Entry> _entries;
+    utils::HashMap<const metadata::RtMethodInfo*, const V*> _method_cache;
+    bool _sorted = true;
+};
+
+} // namespace leanclr::vm
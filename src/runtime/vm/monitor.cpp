@@ -3,12 +3,20 @@
 namespace leanclr::vm
 {
 
+// Managed code only runs on the runtime thread, so entering never blocks and only the count is kept.
+static int32_t g_held_count = 0;
+
 void Monitor::enter(RtObject* obj)
 {
+    ++g_held_count;
 }
 
 void Monitor::exit(RtObject* obj)
 {
+    if (g_held_count > 0)
+    {
+        --g_held_count;
+    }
 }
 
 bool Monitor::monitor_test_synchronized(RtObject* obj)
@@ -32,6 +40,7 @@ bool Monitor::monitor_wait(RtObject* obj, int32_t milliseconds_timeout)
 void Monitor::monitor_try_enter_with_atomic_var(RtObject* obj, int32_t timeout, bool* lock_taken)
 {
     *lock_taken = true;
+    ++g_held_count;
 }
 
 bool Monitor::monitor_test_owner(RtObject* obj)
@@ -39,4 +48,9 @@ bool Monitor::monitor_test_owner(RtObject* obj)
     return true;
 }
 
+int32_t Monitor::get_held_count()
+{
+    return g_held_count;
+}
+
 } // namespace leanclr::vm
@@ -16,5 +16,9 @@ class Monitor
     static bool monitor_wait(RtObject* obj, int32_t milliseconds_timeout);
     static void monitor_try_enter_with_atomic_var(RtObject* obj, int32_t timeout, bool* lock_taken);
     static bool monitor_test_owner(RtObject* obj);
+
+    // Monitor entries the runtime thread currently holds, counting recursive entries. Managed work items
+    // and timers run on that thread as if on another one, so they are only dispatched while it is zero.
+    static int32_t get_held_count();
 };
 } // namespace leanclr::vm
@@ -0,0 +1,85 @@
+#include "native_library.h"
+
+#include <cstring>
+#include <string>
+
+#include "platform/dynamic_library.h"
+#include "utils/hashmap.h"
+
+namespace leanclr::vm
+{
+
+#if defined(LEANCLR_PLATFORM_WIN)
+static const char* const s_library_prefix = "";
+static const char* const s_library_suffix = ".dll";
+#elif defined(LEANCLR_PLATFORM_MAC) || defined(LEANCLR_PLATFORM_IOS)
+static const char* const s_library_prefix = "lib";
+static const char* const s_library_suffix = ".dylib";
+#else
+static const char* const s_library_prefix = "lib";
+static const char* const s_library_suffix = ".so";
+#endif
+
+struct LoadedLibrary
+{
+    // nullptr if the library could not be loaded.
+    void* handle;
+    utils::HashMap<std::string, void*> symbols;
+};
+
+static utils::HashMap<std::string, LoadedLibrary> g_libraries;
+
+static bool has_suffix(const std::string& name, const char* suffix)
+{
+    size_t len = std::strlen(suffix);
+    return name.size() >= len && name.compare(name.size() - len, len, suffix) == 0;
+}
+
+static void* load_library(const std::string& module_name)
+{
+    if (module_name == "__Internal")
+    {
+        return os::DynamicLibrary::open(nullptr);
+    }
+    void* handle = os::DynamicLibrary::open(module_name.c_str());
+    if (handle || module_name.find_first_of("/\\") != std::string::npos)
+    {
+        return handle;
+    }
+    std::string file_name = has_suffix(module_name, s_library_suffix) ? module_name : module_name + s_library_suffix;
+    if (*s_library_prefix && module_name.compare(0, std::strlen(s_library_prefix), s_library_prefix) != 0)
+    {
+        handle = os::DynamicLibrary::open((s_library_prefix + file_name).c_str());
+    }
+    if (!handle && file_name != module_name)
+    {
+        handle = os::DynamicLibrary::open(file_name.c_str());
+    }
+    return handle;
+}
+
+RtResult<void*> NativeLibrary::get_symbol(const char* module_name, const char* entry_point)
+{
+    auto it = g_libraries.find(module_name);
+    if (it == g_libraries.end())
+    {
+        it = g_libraries.emplace(module_name, LoadedLibrary{load_library(module_name), {}}).first;
+    }
+    LoadedLibrary& library = it->second;
+    if (!library.handle)
+    {
+        RET_ERR(RtErr::EntryPointNotFound);
+    }
+    auto sym_it = library.symbols.find(entry_point);
+    if (sym_it == library.symbols.end())
+    {
+        sym_it = library.symbols.emplace(entry_point, os::DynamicLibrary::get_symbol(library.handle, entry_point)).first;
+    }
+    if (!sym_it->second)
+    {
+        RET_ERR(RtErr::EntryPointNotFound);
+    }
+    RET_OK(sym_it->second);
+}
+
+} // namespace leanclr::vm
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "rt_managed_types.h"
+
+namespace leanclr::vm
+{
+
+// Libraries and symbols named by DllImport. A module name is probed once, as given and then with the platform
+// prefix and suffix ("lib" and ".so" on Linux), and "__Internal" names the main program. Both the loaded
+// libraries and the resolved entry points are cached, including failures.
+class NativeLibrary
+{
+  public:
+    static RtResult<void*> get_symbol(const char* module_name, const char* entry_point);
+};
+
+} // namespace leanclr::vm
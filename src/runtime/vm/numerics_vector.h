@@ -0,0 +1,558 @@
+#pragma once
+
+#include <cmath>
+#include <cstring>
+
+#include "platform/hardware.h"
+
+#if LEANCLR_SIMD_SSE2
+#include <emmintrin.h>
+#if LEANCLR_SIMD_SSE41
+#include <smmintrin.h>
+#endif
+#elif LEANCLR_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace leanclr::vm
+{
+
+// Arithmetic behind the System.Numerics.Vector2/3/4 and Vector<T> LL opcodes and intrinsics.
+// Operands are unaligned storage (eval stack slots or fields); Vector3 is read and written as
+// exactly 12 bytes. Lane-wise operations use SSE2/NEON. Reductions (Dot, Length, ...) multiply
+// in vector registers but sum lanes in X, Y, Z, W order, and every formula follows the managed
+// implementation, so results are bit-identical to running the IL.
+class NumericsVector
+{
+  public:
+#if LEANCLR_SIMD_SSE2
+    using F4 = __m128;
+#elif LEANCLR_SIMD_NEON
+    using F4 = float32x4_t;
+#else
+    struct F4
+    {
+        float v[4];
+    };
+#endif
+
+    template <int N>
+    static F4 load(const void* src)
+    {
+        static_assert(N >= 2 && N <= 4, "Vector2, Vector3 or Vector4");
+        const float* p = static_cast<const float*>(src);
+#if LEANCLR_SIMD_SSE2
+        // X and Y go through memcpy: a double* access to float storage breaks strict aliasing.
+        double xy_bits;
+        std::memcpy(&xy_bits, p, sizeof(xy_bits));
+        __m128 xy = _mm_castpd_ps(_mm_set_sd(xy_bits));
+        if constexpr (N == 2)
+            return xy;
+        else if constexpr (N == 3)
+            return _mm_movelh_ps(xy, _mm_load_ss(p + 2));
+        else
+            return _mm_loadu_ps(p);
+#elif LEANCLR_SIMD_NEON
+        if constexpr (N == 2)
+            return vcombine_f32(vld1_f32(p), vdup_n_f32(0.0f));
+        else if constexpr (N == 3)
+            return vcombine_f32(vld1_f32(p), vld1_lane_f32(p + 2, vdup_n_f32(0.0f), 0));
+        else
+            return vld1q_f32(p);
+#else
+        F4 r = {};
+        std::memcpy(r.v, p, N * sizeof(float));
+        return r;
+#endif
+    }
+
+    template <int N>
+    static void store(void* dst, F4 value)
+    {
+        float* p = static_cast<float*>(dst);
+#if LEANCLR_SIMD_SSE2
+        if constexpr (N == 4)
+        {
+            _mm_storeu_ps(p, value);
+        }
+        else
+        {
+            double xy_bits = _mm_cvtsd_f64(_mm_castps_pd(value));
+            std::memcpy(p, &xy_bits, sizeof(xy_bits));
+            if constexpr (N == 3)
+                _mm_store_ss(p + 2, _mm_movehl_ps(value, value));
+        }
+#elif LEANCLR_SIMD_NEON
+        if constexpr (N == 4)
+        {
+            vst1q_f32(p, value);
+        }
+        else
+        {
+            vst1_f32(p, vget_low_f32(value));
+            if constexpr (N == 3)
+                vst1q_lane_f32(p + 2, value, 2);
+        }
+#else
+        std::memcpy(p, value.v, N * sizeof(float));
+#endif
+    }
+
+    static F4 splat(float x)
+    {
+#if LEANCLR_SIMD_SSE2
+        return _mm_set1_ps(x);
+#elif LEANCLR_SIMD_NEON
+        return vdupq_n_f32(x);
+#else
+        return F4{{x, x, x, x}};
+#endif
+    }
+
+    static F4 add(F4 a, F4 b)
+    {
+#if LEANCLR_SIMD_SSE2
+        return _mm_add_ps(a, b);
+#elif LEANCLR_SIMD_NEON
+        return vaddq_f32(a, b);
+#else
+        return map2(a, b, [](float x, float y) { return x + y; });
+#endif
+    }
+
+    static F4 sub(F4 a, F4 b)
+    {
+#if LEANCLR_SIMD_SSE2
+        return _mm_sub_ps(a, b);
+#elif LEANCLR_SIMD_NEON
+        return vsubq_f32(a, b);
+#else
+        return map2(a, b, [](float x, float y) { return x - y; });
+#endif
+    }
+
+    static F4 mul(F4 a, F4 b)
+    {
+#if LEANCLR_SIMD_SSE2
+        return _mm_mul_ps(a, b);
+#elif LEANCLR_SIMD_NEON
+        return vmulq_f32(a, b);
+#else
+        return map2(a, b, [](float x, float y) { return x * y; });
+#endif
+    }
+
+    static F4 div(F4 a, F4 b)
+    {
+#if LEANCLR_SIMD_SSE2
+        return _mm_div_ps(a, b);
+#elif LEANCLR_SIMD_NEON
+        return vdivq_f32(a, b);
+#else
+        return map2(a, b, [](float x, float y) { return x / y; });
+#endif
+    }
+
+    // (a < b) ? a : b, including its NaN behaviour.
+    static F4 min(F4 a, F4 b)
+    {
+#if LEANCLR_SIMD_SSE2
+        return _mm_min_ps(a, b);
+#elif LEANCLR_SIMD_NEON
+        return vbslq_f32(vcltq_f32(a, b), a, b);
+#else
+        return map2(a, b, [](float x, float y) { return x < y ? x : y; });
+#endif
+    }
+
+    // (a > b) ? a : b, including its NaN behaviour.
+    static F4 max(F4 a, F4 b)
+    {
+#if LEANCLR_SIMD_SSE2
+        return _mm_max_ps(a, b);
+#elif LEANCLR_SIMD_NEON
+        return vbslq_f32(vcgtq_f32(a, b), a, b);
+#else
+        return map2(a, b, [](float x, float y) { return x > y ? x : y; });
+#endif
+    }
+
+    static F4 abs(F4 a)
+    {
+#if LEANCLR_SIMD_SSE2
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+#elif LEANCLR_SIMD_NEON
+        return vabsq_f32(a);
+#else
+        return map2(a, a, [](float x, float) { return std::fabs(x); });
+#endif
+    }
+
+    static F4 sqrt(F4 a)
+    {
+#if LEANCLR_SIMD_SSE2
+        return _mm_sqrt_ps(a);
+#elif LEANCLR_SIMD_NEON
+        return vsqrtq_f32(a);
+#else
+        return map2(a, a, [](float x, float) { return std::sqrt(x); });
+#endif
+    }
+
+    // Sum of the first N lanes, left to right.
+    template <int N>
+    static float sum_lanes(F4 a)
+    {
+        float lanes[4];
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_ps(lanes, a);
+#elif LEANCLR_SIMD_NEON
+        vst1q_f32(lanes, a);
+#else
+        std::memcpy(lanes, a.v, sizeof(lanes));
+#endif
+        float sum = lanes[0] + lanes[1];
+        if constexpr (N >= 3)
+            sum += lanes[2];
+        if constexpr (N == 4)
+            sum += lanes[3];
+        return sum;
+    }
+
+    // Lane-wise operations on Vector2/3/4.
+
+    template <int N>
+    static void add(const void* a, const void* b, void* dst)
+    {
+        store<N>(dst, add(load<N>(a), load<N>(b)));
+    }
+
+    template <int N>
+    static void sub(const void* a, const void* b, void* dst)
+    {
+        store<N>(dst, sub(load<N>(a), load<N>(b)));
+    }
+
+    template <int N>
+    static void mul(const void* a, const void* b, void* dst)
+    {
+        store<N>(dst, mul(load<N>(a), load<N>(b)));
+    }
+
+    template <int N>
+    static void div(const void* a, const void* b, void* dst)
+    {
+        store<N>(dst, div(load<N>(a), load<N>(b)));
+    }
+
+    template <int N>
+    static void min(const void* a, const void* b, void* dst)
+    {
+        store<N>(dst, min(load<N>(a), load<N>(b)));
+    }
+
+    template <int N>
+    static void max(const void* a, const void* b, void* dst)
+    {
+        store<N>(dst, max(load<N>(a), load<N>(b)));
+    }
+
+    template <int N>
+    static void mul_scalar(const void* a, float scalar, void* dst)
+    {
+        store<N>(dst, mul(load<N>(a), splat(scalar)));
+    }
+
+    // value * (1 / divisor), as the managed op_Division(VectorN, Single).
+    template <int N>
+    static void div_scalar(const void* a, float divisor, void* dst)
+    {
+        store<N>(dst, mul(load<N>(a), splat(1.0f / divisor)));
+    }
+
+    // Zero - value, so negating +0 yields +0 like the managed operator.
+    template <int N>
+    static void negate(const void* a, void* dst)
+    {
+        store<N>(dst, sub(splat(0.0f), load<N>(a)));
+    }
+
+    template <int N>
+    static void abs(const void* a, void* dst)
+    {
+        store<N>(dst, abs(load<N>(a)));
+    }
+
+    template <int N>
+    static void square_root(const void* a, void* dst)
+    {
+        store<N>(dst, sqrt(load<N>(a)));
+    }
+
+    // value1 + (value2 - value1) * amount
+    template <int N>
+    static void lerp(const void* a, const void* b, float amount, void* dst)
+    {
+        F4 va = load<N>(a);
+        store<N>(dst, add(va, mul(sub(load<N>(b), va), splat(amount))));
+    }
+
+    // x = (x > max) ? max : x; x = (x < min) ? min : x;
+    template <int N>
+    static void clamp(const void* value, const void* min_value, const void* max_value, void* dst)
+    {
+        store<N>(dst, max(load<N>(min_value), min(load<N>(max_value), load<N>(value))));
+    }
+
+    // Reductions.
+
+    template <int N>
+    static float dot(const void* a, const void* b)
+    {
+        return sum_lanes<N>(mul(load<N>(a), load<N>(b)));
+    }
+
+    template <int N>
+    static float length_squared(const void* a)
+    {
+        F4 va = load<N>(a);
+        return sum_lanes<N>(mul(va, va));
+    }
+
+    template <int N>
+    static float length(const void* a)
+    {
+        return std::sqrt(length_squared<N>(a));
+    }
+
+    template <int N>
+    static float distance_squared(const void* a, const void* b)
+    {
+        F4 d = sub(load<N>(a), load<N>(b));
+        return sum_lanes<N>(mul(d, d));
+    }
+
+    template <int N>
+    static float distance(const void* a, const void* b)
+    {
+        return std::sqrt(distance_squared<N>(a, b));
+    }
+
+    // Vector3 divides by the length; Vector2 and Vector4 multiply by its reciprocal.
+    template <int N>
+    static void normalize(const void* a, void* dst)
+    {
+        F4 va = load<N>(a);
+        float len = std::sqrt(sum_lanes<N>(mul(va, va)));
+        if constexpr (N == 3)
+            store<N>(dst, div(va, splat(len)));
+        else
+            store<N>(dst, mul(va, splat(1.0f / len)));
+    }
+
+    static void cross(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        __m128 va = load<3>(a);
+        __m128 vb = load<3>(b);
+        __m128 a_yzx = _mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 b_yzx = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 a_zxy = _mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 1, 0, 2));
+        __m128 b_zxy = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 1, 0, 2));
+        store<3>(dst, _mm_sub_ps(_mm_mul_ps(a_yzx, b_zxy), _mm_mul_ps(a_zxy, b_yzx)));
+#else
+        float x1, y1, z1, x2, y2, z2;
+        const float* pa = static_cast<const float*>(a);
+        const float* pb = static_cast<const float*>(b);
+        x1 = pa[0], y1 = pa[1], z1 = pa[2];
+        x2 = pb[0], y2 = pb[1], z2 = pb[2];
+        float r[3] = {y1 * z2 - z1 * y2, z1 * x2 - x1 * z2, x1 * y2 - y1 * x2};
+        std::memcpy(dst, r, sizeof(r));
+#endif
+    }
+
+    // 128-bit Vector<T> element-wise operations.
+
+    static void add_i32x4(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_si128(static_cast<__m128i*>(dst), _mm_add_epi32(load_i128(a), load_i128(b)));
+#elif LEANCLR_SIMD_NEON
+        vst1q_s32(static_cast<int32_t*>(dst), vaddq_s32(vld1q_s32(static_cast<const int32_t*>(a)), vld1q_s32(static_cast<const int32_t*>(b))));
+#else
+        map_scalar<uint32_t, 4>(a, b, dst, [](uint32_t x, uint32_t y) { return x + y; });
+#endif
+    }
+
+    static void sub_i32x4(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_si128(static_cast<__m128i*>(dst), _mm_sub_epi32(load_i128(a), load_i128(b)));
+#elif LEANCLR_SIMD_NEON
+        vst1q_s32(static_cast<int32_t*>(dst), vsubq_s32(vld1q_s32(static_cast<const int32_t*>(a)), vld1q_s32(static_cast<const int32_t*>(b))));
+#else
+        map_scalar<uint32_t, 4>(a, b, dst, [](uint32_t x, uint32_t y) { return x - y; });
+#endif
+    }
+
+    static void mul_i32x4(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE41
+        _mm_storeu_si128(static_cast<__m128i*>(dst), _mm_mullo_epi32(load_i128(a), load_i128(b)));
+#elif LEANCLR_SIMD_SSE2
+        __m128i va = load_i128(a);
+        __m128i vb = load_i128(b);
+        __m128i even = _mm_mul_epu32(va, vb);
+        __m128i odd = _mm_mul_epu32(_mm_srli_si128(va, 4), _mm_srli_si128(vb, 4));
+        _mm_storeu_si128(static_cast<__m128i*>(dst),
+                         _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))));
+#elif LEANCLR_SIMD_NEON
+        vst1q_s32(static_cast<int32_t*>(dst), vmulq_s32(vld1q_s32(static_cast<const int32_t*>(a)), vld1q_s32(static_cast<const int32_t*>(b))));
+#else
+        map_scalar<uint32_t, 4>(a, b, dst, [](uint32_t x, uint32_t y) { return x * y; });
+#endif
+    }
+
+    static void add_i64x2(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_si128(static_cast<__m128i*>(dst), _mm_add_epi64(load_i128(a), load_i128(b)));
+#elif LEANCLR_SIMD_NEON
+        vst1q_s64(static_cast<int64_t*>(dst), vaddq_s64(vld1q_s64(static_cast<const int64_t*>(a)), vld1q_s64(static_cast<const int64_t*>(b))));
+#else
+        map_scalar<uint64_t, 2>(a, b, dst, [](uint64_t x, uint64_t y) { return x + y; });
+#endif
+    }
+
+    static void sub_i64x2(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_si128(static_cast<__m128i*>(dst), _mm_sub_epi64(load_i128(a), load_i128(b)));
+#elif LEANCLR_SIMD_NEON
+        vst1q_s64(static_cast<int64_t*>(dst), vsubq_s64(vld1q_s64(static_cast<const int64_t*>(a)), vld1q_s64(static_cast<const int64_t*>(b))));
+#else
+        map_scalar<uint64_t, 2>(a, b, dst, [](uint64_t x, uint64_t y) { return x - y; });
+#endif
+    }
+
+    static void add_r8x2(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_pd(static_cast<double*>(dst), _mm_add_pd(load_r8x2(a), load_r8x2(b)));
+#elif LEANCLR_SIMD_NEON
+        vst1q_f64(static_cast<double*>(dst), vaddq_f64(load_r8x2(a), load_r8x2(b)));
+#else
+        map_scalar<double, 2>(a, b, dst, [](double x, double y) { return x + y; });
+#endif
+    }
+
+    static void sub_r8x2(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_pd(static_cast<double*>(dst), _mm_sub_pd(load_r8x2(a), load_r8x2(b)));
+#elif LEANCLR_SIMD_NEON
+        vst1q_f64(static_cast<double*>(dst), vsubq_f64(load_r8x2(a), load_r8x2(b)));
+#else
+        map_scalar<double, 2>(a, b, dst, [](double x, double y) { return x - y; });
+#endif
+    }
+
+    static void mul_r8x2(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_pd(static_cast<double*>(dst), _mm_mul_pd(load_r8x2(a), load_r8x2(b)));
+#elif LEANCLR_SIMD_NEON
+        vst1q_f64(static_cast<double*>(dst), vmulq_f64(load_r8x2(a), load_r8x2(b)));
+#else
+        map_scalar<double, 2>(a, b, dst, [](double x, double y) { return x * y; });
+#endif
+    }
+
+    static void div_r8x2(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_pd(static_cast<double*>(dst), _mm_div_pd(load_r8x2(a), load_r8x2(b)));
+#elif LEANCLR_SIMD_NEON
+        vst1q_f64(static_cast<double*>(dst), vdivq_f64(load_r8x2(a), load_r8x2(b)));
+#else
+        map_scalar<double, 2>(a, b, dst, [](double x, double y) { return x / y; });
+#endif
+    }
+
+    static void and_x128(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_si128(static_cast<__m128i*>(dst), _mm_and_si128(load_i128(a), load_i128(b)));
+#elif LEANCLR_SIMD_NEON
+        vst1q_u8(static_cast<uint8_t*>(dst), vandq_u8(vld1q_u8(static_cast<const uint8_t*>(a)), vld1q_u8(static_cast<const uint8_t*>(b))));
+#else
+        map_scalar<uint64_t, 2>(a, b, dst, [](uint64_t x, uint64_t y) { return x & y; });
+#endif
+    }
+
+    static void or_x128(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_si128(static_cast<__m128i*>(dst), _mm_or_si128(load_i128(a), load_i128(b)));
+#elif LEANCLR_SIMD_NEON
+        vst1q_u8(static_cast<uint8_t*>(dst), vorrq_u8(vld1q_u8(static_cast<const uint8_t*>(a)), vld1q_u8(static_cast<const uint8_t*>(b))));
+#else
+        map_scalar<uint64_t, 2>(a, b, dst, [](uint64_t x, uint64_t y) { return x | y; });
+#endif
+    }
+
+    static void xor_x128(const void* a, const void* b, void* dst)
+    {
+#if LEANCLR_SIMD_SSE2
+        _mm_storeu_si128(static_cast<__m128i*>(dst), _mm_xor_si128(load_i128(a), load_i128(b)));
+#elif LEANCLR_SIMD_NEON
+        vst1q_u8(static_cast<uint8_t*>(dst), veorq_u8(vld1q_u8(static_cast<const uint8_t*>(a)), vld1q_u8(static_cast<const uint8_t*>(b))));
+#else
+        map_scalar<uint64_t, 2>(a, b, dst, [](uint64_t x, uint64_t y) { return x ^ y; });
+#endif
+    }
+
+  private:
+#if LEANCLR_SIMD_SSE2
+    static __m128i load_i128(const void* p)
+    {
+        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+    }
+
+    static __m128d load_r8x2(const void* p)
+    {
+        return _mm_loadu_pd(static_cast<const double*>(p));
+    }
+#elif LEANCLR_SIMD_NEON
+    static float64x2_t load_r8x2(const void* p)
+    {
+        return vld1q_f64(static_cast<const double*>(p));
+    }
+#else
+    template <typename Op>
+    static F4 map2(F4 a, F4 b, Op op)
+    {
+        F4 r;
+        for (int i = 0; i < 4; ++i)
+        {
+            r.v[i] = op(a.v[i], b.v[i]);
+        }
+        return r;
+    }
+
+    template <typename T, int N, typename Op>
+    static void map_scalar(const void* a, const void* b, void* dst, Op op)
+    {
+        T va[N], vb[N], r[N];
+        std::memcpy(va, a, sizeof(va));
+        std::memcpy(vb, b, sizeof(vb));
+        for (int i = 0; i < N; ++i)
+        {
+            r[i] = op(va[i], vb[i]);
+        }
+        std::memcpy(dst, r, sizeof(r));
+    }
+#endif
+};
+
+} // namespace leanclr::vm
@@ -1,71 +1,241 @@
 #include "pinvoke.h"
 
+#include <cerrno>
+#include <cstring>
+
+#ifdef LEANCLR_PLATFORM_WIN
+#include <windows.h>
+#endif
+
 #include "method.h"
 #include "class.h"
 #include "metadata/module_def.h"
-#include "utils/string_builder.h"
 #include "utils/string_util.h"
-#include "metadata/metadata_name.h"
+#include "marshal.h"
+#include "method_binding_table.h"
+#include "native_library.h"
+#include "pinvoke_invokers.h"
+#include "interp/interp_defs.h"
+#include "metadata/metadata_cache.h"
 
 namespace leanclr::vm
 {
 
-// Static maps for internal call functions
-static utils::HashMap<const char*, PInvokeRegistry, utils::CStrHasher, utils::CStrCompare> g_pinvoke_map;
+// Binding table for pinvoke functions
+static MethodBindingTable<PInvokeRegistry> g_pinvokeTable;
 
-// Register an internal call function by name
+// Register a pinvoke function by name
 void PInvokes::register_pinvoke(const char* name, PInvokeFunction func, PInvokeInvoker invoker)
 {
-    assert(g_pinvoke_map.find(name) == g_pinvoke_map.end() && "PInvoke already registered");
-    g_pinvoke_map[name] = PInvokeRegistry{func, invoker};
+    g_pinvokeTable.add(name, PInvokeRegistry{func, invoker});
 }
 
-// Get internal call by name
+// Get pinvoke by name
 const PInvokeRegistry* PInvokes::get_pinvoke(const char* name)
 {
-    auto it = g_pinvoke_map.find(name);
-    if (it != g_pinvoke_map.end())
-        return &it->second;
-    return nullptr;
+    return g_pinvokeTable.find_by_name(name);
 }
 
-// Get internal call by method info (builds full method name with params)
+// Get pinvoke by method info. Candidates are tried in the order
+// [ModuleName]Namespace.Class::Method(params), Namespace.Class::Method(params), Namespace.Class::Method
 RtResult<const PInvokeRegistry*> PInvokes::get_pinvoke_by_method(const metadata::RtMethodInfo* method)
 {
-    // Try with full method name (including parameters)
-    utils::StringBuilder sb;
+    return g_pinvokeTable.find(method);
+}
+
+#if LEANCLR_ENABLE_DYNAMIC_PINVOKE
+// Longest signature class written, "ptr" for every parameter and the return value.
+static constexpr size_t MAX_SIGNATURE_PARAMS = 16;
+static constexpr size_t SIGNATURE_BUFFER_SIZE = (MAX_SIGNATURE_PARAMS + 1) * 4 + 2;
+
+// Signature invokers of the bound SetLastError methods, which are bound to last_error_pinvoke_invoker instead.
+static utils::HashMap<const metadata::RtMethodInfo*, PInvokeInvoker> g_last_error_invokers;
+
+// Whether char is marshaled as a UTF-16 code unit, which passes the managed value as is.
+static bool is_utf16_char_set(uint16_t mapping_flags)
+{
+    switch (mapping_flags & static_cast<uint16_t>(metadata::RtPInvokeAttribute::CharSetMask))
+    {
+    case static_cast<uint16_t>(metadata::RtPInvokeAttribute::CharSetUnicode):
+        return true;
+    case static_cast<uint16_t>(metadata::RtPInvokeAttribute::CharSetAuto):
+#ifdef LEANCLR_PLATFORM_WIN
+        return true;
+#else
+        return false;
+#endif
+    default:
+        return false;
+    }
+}
+
+static RtResult<const char*> get_signature_class_name(const metadata::RtTypeSig* type_sig, metadata::RtArgOrLocOrFieldReduceType reduce_type,
+                                                      bool utf16_chars)
+{
+    // An Ansi char is a single byte converted from the code page, which only hand-written bindings do.
+    if (type_sig->ele_type == metadata::RtElementType::Char && !utf16_chars)
+    {
+        RET_ERR(RtErr::NotSupported);
+    }
+    // By-ref parameters of blittable types are passed as pointers to the caller's value.
+    if (type_sig->is_by_ref())
+    {
+        RET_OK("ptr");
+    }
+    switch (reduce_type)
+    {
+    case metadata::RtArgOrLocOrFieldReduceType::Void:
+        RET_OK("v");
+    case metadata::RtArgOrLocOrFieldReduceType::I1:
+    case metadata::RtArgOrLocOrFieldReduceType::U1:
+    case metadata::RtArgOrLocOrFieldReduceType::I2:
+    case metadata::RtArgOrLocOrFieldReduceType::U2:
+    case metadata::RtArgOrLocOrFieldReduceType::I4:
+        RET_OK("i4");
+    case metadata::RtArgOrLocOrFieldReduceType::I8:
+        RET_OK("i8");
+    case metadata::RtArgOrLocOrFieldReduceType::I:
+        RET_OK("ptr");
+    case metadata::RtArgOrLocOrFieldReduceType::R4:
+        RET_OK("r4");
+    case metadata::RtArgOrLocOrFieldReduceType::R8:
+        RET_OK("r8");
+    default:
+        // Strings, arrays, delegates and structs by value need marshaling, which only hand-written bindings do.
+        RET_ERR(RtErr::NotSupported);
+    }
+}
+
+// Writes the signature class of method, e.g. "i4(ptr,i4,ptr)".
+static RtResultVoid get_signature_class(const metadata::RtMethodInfo* method, bool utf16_chars, char* buffer)
+{
+    if (method->parameter_count > MAX_SIGNATURE_PARAMS || Method::is_instance(method))
+    {
+        RET_ERR(RtErr::NotSupported);
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(interp::ReduceTypeAndSize, ret_type, interp::InterpDefs::get_reduce_type_and_size_by_typesig(method->return_type));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const char*, ret_name, get_signature_class_name(method->return_type, ret_type.reduce_type, utf16_chars));
+    char* p = buffer;
+    p += std::strlen(std::strcpy(p, ret_name));
+    *p++ = '(';
+    for (uint16_t i = 0; i < method->parameter_count; ++i)
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const char*, param_name,
+                                                get_signature_class_name(method->parameters[i], method->arg_descs[i].reduce_type, utf16_chars));
+        if (i > 0)
+        {
+            *p++ = ',';
+        }
+        p += std::strlen(std::strcpy(p, param_name));
+    }
+    *p++ = ')';
+    *p = '\0';
+    RET_VOID_OK();
+}
+
+static RtResult<void*> resolve_entry_point(const metadata::RtMethodInfo* method, const metadata::RowImplMap& impl_map)
+{
+    metadata::RtModuleDef* mod = method->parent->image;
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const char*, entry_point, mod->get_string(impl_map.import_name));
+    auto module_ref = mod->get_cli_image().read_module_ref(impl_map.import_scope);
+    if (!module_ref)
+    {
+        RET_ERR(RtErr::BadImageFormat);
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const char*, module_name, mod->get_string(module_ref->name));
+    return NativeLibrary::get_symbol(module_name, *entry_point ? entry_point : method->name);
+}
+
+static RtResult<metadata::RowImplMap> get_impl_map(const metadata::RtMethodInfo* method)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(std::optional<metadata::RowImplMap>, impl_map, Method::get_imp_map_info(method));
+    if (!impl_map)
     {
-        // signature: [ModuleName]Namespace.Class.Method(params)
-        sb.append_char('[');
-        sb.append_cstr(method->parent->image->get_name_no_ext());
-        sb.append_char(']');
-        size_t length = sb.length();
-        RET_ERR_ON_FAIL(metadata::MetadataName::append_method_full_name_with_params(sb, method));
-        const char* signature_with_module = sb.as_cstr();
-        auto it = g_pinvoke_map.find(signature_with_module);
-        if (it != g_pinvoke_map.end())
-            RET_OK(&it->second);
-
-        // signature: Namespace.Class.Method(params)
-        const char* signature_without_module = sb.as_cstr() + length;
-        it = g_pinvoke_map.find(signature_without_module);
-        if (it != g_pinvoke_map.end())
-            RET_OK(&it->second);
+        RET_ERR(RtErr::EntryPointNotFound);
     }
+    RET_OK(*impl_map);
+}
+
+static bool sets_last_error(const metadata::RowImplMap& impl_map)
+{
+    return (impl_map.mapping_flags & static_cast<uint16_t>(metadata::RtPInvokeAttribute::SupportsLastError)) != 0;
+}
+
+static int32_t get_system_last_error()
+{
+#ifdef LEANCLR_PLATFORM_WIN
+    return static_cast<int32_t>(::GetLastError());
+#else
+    return errno;
+#endif
+}
+
+static void clear_system_last_error()
+{
+#ifdef LEANCLR_PLATFORM_WIN
+    ::SetLastError(0);
+#else
+    errno = 0;
+#endif
+}
+
+// Invoker of bound SetLastError methods. Calls the signature invoker and keeps the error code of the call for
+// Marshal.GetLastWin32Error.
+static RtResultVoid last_error_pinvoke_invoker(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    auto it = g_last_error_invokers.find(method);
+    assert(it != g_last_error_invokers.end());
+    clear_system_last_error();
+    RtResultVoid result = it->second(method_pointer, method, params, ret);
+    Marshal::set_last_win32_error(get_system_last_error());
+    return result;
+}
 
-    // Try with method name without parameters
+RtResultVoid PInvokes::bind_dynamic_pinvoke(const metadata::RtMethodInfo* method)
+{
+    assert(method->invoker_type == metadata::RtInvokerType::DynamicPInvoke);
+    if (method->invoke_method_ptr != dynamic_pinvoke_invoker)
+    {
+        RET_VOID_OK();
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RowImplMap, impl_map, get_impl_map(method));
+    char signature[SIGNATURE_BUFFER_SIZE];
+    RET_ERR_ON_FAIL(get_signature_class(method, is_utf16_char_set(impl_map.mapping_flags), signature));
+    PInvokeInvoker invoker = PInvokeInvokers::find(signature);
+    if (!invoker)
+    {
+        RET_ERR(RtErr::NotSupported);
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(void*, entry_point, resolve_entry_point(method, impl_map));
+    if (sets_last_error(impl_map))
     {
-        // signature: Namespace.Class.Method
-        sb.clear();
-        RET_ERR_ON_FAIL(metadata::MetadataName::append_method_full_name_without_params(sb, method));
-        auto it = g_pinvoke_map.find(sb.as_cstr());
-        if (it != g_pinvoke_map.end())
-            RET_OK(&it->second);
+        g_last_error_invokers[method] = invoker;
+        invoker = last_error_pinvoke_invoker;
     }
 
-    RET_OK(nullptr);
+    // The interpreter reads both pointers from the method on every call.
+    metadata::RtMethodInfo* bound_method = const_cast<metadata::RtMethodInfo*>(method);
+    bound_method->method_ptr = reinterpret_cast<metadata::RtManagedMethodPointer>(entry_point);
+    bound_method->invoke_method_ptr = invoker;
+    bound_method->virtual_invoke_method_ptr = invoker;
+    RET_VOID_OK();
 }
 
+RtResultVoid PInvokes::dynamic_pinvoke_invoker(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    RET_ERR_ON_FAIL(bind_dynamic_pinvoke(method));
+    return method->invoke_method_ptr(method->method_ptr, method, params, ret);
+}
+
+RtResult<bool> PInvokes::is_direct_callable(const metadata::RtMethodInfo* method)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RowImplMap, impl_map, get_impl_map(method));
+    RET_OK(!sets_last_error(impl_map));
+}
+#endif
+
 static void nop_function()
 {
 }
@@ -82,6 +252,14 @@ static PInvokeEntry s_pinvoke_entries[] = {
     // #endif
 };
 
+void PInvokes::purge_unloading_modules()
+{
+    g_pinvokeTable.purge_unloading_modules();
+#if LEANCLR_ENABLE_DYNAMIC_PINVOKE
+    utils::erase_if(g_last_error_invokers, [](const auto& entry) { return metadata::MetadataCache::refers_to_unloading_module(entry.first); });
+#endif
+}
+
 // Initialize internal calls system
 void PInvokes::initialize()
 {
@@ -40,6 +40,24 @@ class PInvokes
     static void register_pinvoke(const char* name, PInvokeFunction func, PInvokeInvoker invoker);
     static const PInvokeRegistry* get_pinvoke(const char* name);
     static RtResult<const PInvokeRegistry*> get_pinvoke_by_method(const metadata::RtMethodInfo* method);
+
+#if LEANCLR_ENABLE_DYNAMIC_PINVOKE
+    // Binds a P/Invoke without a registered binding to its DllImport entry point, stored as its method_ptr, and
+    // to the generated invoker of its signature class. Does nothing if the method is already bound.
+    static RtResultVoid bind_dynamic_pinvoke(const metadata::RtMethodInfo* method);
+
+    // Invoker of P/Invokes without a registered binding. The first call binds the method, and later calls go to
+    // the bound invoker directly.
+    static RtResultVoid dynamic_pinvoke_invoker(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret);
+
+    // Whether the interpreter may call the bound entry point of a dynamic P/Invoke directly instead of through its
+    // invoker. SetLastError methods need the invoker to keep the error code of the call.
+    static RtResult<bool> is_direct_callable(const metadata::RtMethodInfo* method);
+#endif
+
+    // Forgets the bindings looked up for methods of unloading modules.
+    static void purge_unloading_modules();
 };
 
 }; // namespace leanclr::vm
@@ -0,0 +1,3590 @@
+#include "pinvoke_invokers.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "class.h"
+
+namespace leanclr::vm
+{
+
+//{{PINVOKE_INVOKERS
+// i4()
+static RtResultVoid invoke_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)()>(method_pointer)();
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4)
+static RtResultVoid invoke_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t)>(method_pointer)(params[0].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4)
+static RtResultVoid invoke_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,i4)
+static RtResultVoid invoke_i4_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                       const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,i4,i4)
+static RtResultVoid invoke_i4_i4_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,i4,i4,i4)
+static RtResultVoid invoke_i4_i4_i4_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,i4,i4,ptr)
+static RtResultVoid invoke_i4_i4_i4_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,i4,ptr)
+static RtResultVoid invoke_i4_i4_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,i4,ptr,i4)
+static RtResultVoid invoke_i4_i4_i4_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,i4,ptr,ptr)
+static RtResultVoid invoke_i4_i4_i4_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,ptr)
+static RtResultVoid invoke_i4_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                        const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,ptr,i4)
+static RtResultVoid invoke_i4_i4_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,ptr,i4,i4)
+static RtResultVoid invoke_i4_i4_i4_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, void*, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,ptr,i4,ptr)
+static RtResultVoid invoke_i4_i4_i4_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, void*, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,ptr,ptr)
+static RtResultVoid invoke_i4_i4_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,ptr,ptr,i4)
+static RtResultVoid invoke_i4_i4_i4_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, void*, void*, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i4,ptr,ptr,ptr)
+static RtResultVoid invoke_i4_i4_i4_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int32_t, void*, void*, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,i8)
+static RtResultVoid invoke_i4_i4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, int64_t)>(method_pointer)(params[0].i32, params[1].i64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr)
+static RtResultVoid invoke_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,i4)
+static RtResultVoid invoke_i4_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                        const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,i4,i4)
+static RtResultVoid invoke_i4_i4_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,i4,i4,i4)
+static RtResultVoid invoke_i4_i4_ptr_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,i4,i4,ptr)
+static RtResultVoid invoke_i4_i4_ptr_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,i4,ptr)
+static RtResultVoid invoke_i4_i4_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,i4,ptr,i4)
+static RtResultVoid invoke_i4_i4_ptr_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,i4,ptr,ptr)
+static RtResultVoid invoke_i4_i4_ptr_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,ptr)
+static RtResultVoid invoke_i4_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                         const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,ptr,i4)
+static RtResultVoid invoke_i4_i4_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,ptr,i4,i4)
+static RtResultVoid invoke_i4_i4_ptr_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, void*, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,ptr,i4,ptr)
+static RtResultVoid invoke_i4_i4_ptr_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, void*, int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,ptr,ptr)
+static RtResultVoid invoke_i4_i4_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,ptr,ptr,i4)
+static RtResultVoid invoke_i4_i4_ptr_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, void*, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,ptr,ptr,ptr,ptr)
+static RtResultVoid invoke_i4_i4_ptr_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, void*, void*, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,r4)
+static RtResultVoid invoke_i4_i4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, float)>(method_pointer)(params[0].i32, params[1].f32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i4,r8)
+static RtResultVoid invoke_i4_i4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int32_t, double)>(method_pointer)(params[0].i32, params[1].f64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i8)
+static RtResultVoid invoke_i4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int64_t)>(method_pointer)(params[0].i64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i8,i4)
+static RtResultVoid invoke_i4_i8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int64_t, int32_t)>(method_pointer)(params[0].i64, params[1].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i8,i8)
+static RtResultVoid invoke_i4_i8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int64_t, int64_t)>(method_pointer)(params[0].i64, params[1].i64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i8,ptr)
+static RtResultVoid invoke_i4_i8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int64_t, void*)>(method_pointer)(params[0].i64, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i8,r4)
+static RtResultVoid invoke_i4_i8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int64_t, float)>(method_pointer)(params[0].i64, params[1].f32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(i8,r8)
+static RtResultVoid invoke_i4_i8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(int64_t, double)>(method_pointer)(params[0].i64, params[1].f64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr)
+static RtResultVoid invoke_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*)>(method_pointer)(params[0].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4)
+static RtResultVoid invoke_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,i4)
+static RtResultVoid invoke_i4_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                        const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,i4,i4)
+static RtResultVoid invoke_i4_ptr_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,i4,i4,i4)
+static RtResultVoid invoke_i4_ptr_i4_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, int32_t, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,i4,i4,ptr)
+static RtResultVoid invoke_i4_ptr_i4_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, int32_t, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,i4,ptr)
+static RtResultVoid invoke_i4_ptr_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,i4,ptr,i4)
+static RtResultVoid invoke_i4_ptr_i4_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, int32_t, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,i4,ptr,ptr)
+static RtResultVoid invoke_i4_ptr_i4_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, int32_t, void*, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,ptr)
+static RtResultVoid invoke_i4_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                         const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,ptr,i4)
+static RtResultVoid invoke_i4_ptr_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,ptr,i4,i4)
+static RtResultVoid invoke_i4_ptr_i4_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,ptr,i4,ptr)
+static RtResultVoid invoke_i4_ptr_i4_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,ptr,ptr)
+static RtResultVoid invoke_i4_ptr_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, void*, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,ptr,ptr,i4)
+static RtResultVoid invoke_i4_ptr_i4_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i4,ptr,ptr,ptr)
+static RtResultVoid invoke_i4_ptr_i4_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int32_t, void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i8)
+static RtResultVoid invoke_i4_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int64_t)>(method_pointer)(params[0].ptr, params[1].i64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,i8,ptr,i8)
+static RtResultVoid invoke_i4_ptr_i8_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, int64_t, void*, int64_t)>(method_pointer)(params[0].ptr, params[1].i64, params[2].ptr, params[3].i64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr)
+static RtResultVoid invoke_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,i4)
+static RtResultVoid invoke_i4_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                         const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,i4,i4)
+static RtResultVoid invoke_i4_ptr_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,i4,i4,i4)
+static RtResultVoid invoke_i4_ptr_ptr_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, int32_t, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,i4,i4,ptr)
+static RtResultVoid invoke_i4_ptr_ptr_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, int32_t, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,i4,ptr)
+static RtResultVoid invoke_i4_ptr_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,i4,ptr,i4)
+static RtResultVoid invoke_i4_ptr_ptr_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, int32_t, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,i4,ptr,ptr)
+static RtResultVoid invoke_i4_ptr_ptr_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, int32_t, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,ptr)
+static RtResultVoid invoke_i4_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,ptr,i4)
+static RtResultVoid invoke_i4_ptr_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,ptr,i4,i4)
+static RtResultVoid invoke_i4_ptr_ptr_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,ptr,i4,ptr)
+static RtResultVoid invoke_i4_ptr_ptr_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,ptr,i8)
+static RtResultVoid invoke_i4_ptr_ptr_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, void*, int64_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,ptr,ptr)
+static RtResultVoid invoke_i4_ptr_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,ptr,ptr,i4)
+static RtResultVoid invoke_i4_ptr_ptr_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,ptr,ptr,ptr,ptr)
+static RtResultVoid invoke_i4_ptr_ptr_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, void*, void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,r4)
+static RtResultVoid invoke_i4_ptr_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, float)>(method_pointer)(params[0].ptr, params[1].f32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(ptr,r8)
+static RtResultVoid invoke_i4_ptr_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(void*, double)>(method_pointer)(params[0].ptr, params[1].f64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r4)
+static RtResultVoid invoke_i4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(float)>(method_pointer)(params[0].f32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r4,i4)
+static RtResultVoid invoke_i4_r4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(float, int32_t)>(method_pointer)(params[0].f32, params[1].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r4,i8)
+static RtResultVoid invoke_i4_r4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(float, int64_t)>(method_pointer)(params[0].f32, params[1].i64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r4,ptr)
+static RtResultVoid invoke_i4_r4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(float, void*)>(method_pointer)(params[0].f32, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r4,r4)
+static RtResultVoid invoke_i4_r4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(float, float)>(method_pointer)(params[0].f32, params[1].f32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r4,r8)
+static RtResultVoid invoke_i4_r4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(float, double)>(method_pointer)(params[0].f32, params[1].f64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r8)
+static RtResultVoid invoke_i4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(double)>(method_pointer)(params[0].f64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r8,i4)
+static RtResultVoid invoke_i4_r8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(double, int32_t)>(method_pointer)(params[0].f64, params[1].i32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r8,i8)
+static RtResultVoid invoke_i4_r8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(double, int64_t)>(method_pointer)(params[0].f64, params[1].i64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r8,ptr)
+static RtResultVoid invoke_i4_r8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(double, void*)>(method_pointer)(params[0].f64, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r8,r4)
+static RtResultVoid invoke_i4_r8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(double, float)>(method_pointer)(params[0].f64, params[1].f32);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i4(r8,r8)
+static RtResultVoid invoke_i4_r8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int32_t result = reinterpret_cast<int32_t (*)(double, double)>(method_pointer)(params[0].f64, params[1].f64);
+    interp::EvalStackOp::set_return(ret, PInvokeInvokers::normalize_i4_return(method, result));
+    RET_VOID_OK();
+}
+
+// i8()
+static RtResultVoid invoke_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)()>(method_pointer)();
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i4)
+static RtResultVoid invoke_i8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int32_t)>(method_pointer)(params[0].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i4,i4)
+static RtResultVoid invoke_i8_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i4,i8)
+static RtResultVoid invoke_i8_i4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int32_t, int64_t)>(method_pointer)(params[0].i32, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i4,ptr)
+static RtResultVoid invoke_i8_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i4,r4)
+static RtResultVoid invoke_i8_i4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int32_t, float)>(method_pointer)(params[0].i32, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i4,r8)
+static RtResultVoid invoke_i8_i4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int32_t, double)>(method_pointer)(params[0].i32, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i8)
+static RtResultVoid invoke_i8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int64_t)>(method_pointer)(params[0].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i8,i4)
+static RtResultVoid invoke_i8_i8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int64_t, int32_t)>(method_pointer)(params[0].i64, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i8,i8)
+static RtResultVoid invoke_i8_i8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int64_t, int64_t)>(method_pointer)(params[0].i64, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i8,ptr)
+static RtResultVoid invoke_i8_i8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int64_t, void*)>(method_pointer)(params[0].i64, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i8,r4)
+static RtResultVoid invoke_i8_i8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int64_t, float)>(method_pointer)(params[0].i64, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(i8,r8)
+static RtResultVoid invoke_i8_i8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(int64_t, double)>(method_pointer)(params[0].i64, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(ptr)
+static RtResultVoid invoke_i8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(void*)>(method_pointer)(params[0].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(ptr,i4)
+static RtResultVoid invoke_i8_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(ptr,i8)
+static RtResultVoid invoke_i8_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(void*, int64_t)>(method_pointer)(params[0].ptr, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(ptr,i8,ptr,i8)
+static RtResultVoid invoke_i8_ptr_i8_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(void*, int64_t, void*, int64_t)>(method_pointer)(params[0].ptr, params[1].i64, params[2].ptr, params[3].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(ptr,ptr)
+static RtResultVoid invoke_i8_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(ptr,ptr,ptr,i8)
+static RtResultVoid invoke_i8_ptr_ptr_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(void*, void*, void*, int64_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(ptr,r4)
+static RtResultVoid invoke_i8_ptr_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(void*, float)>(method_pointer)(params[0].ptr, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(ptr,r8)
+static RtResultVoid invoke_i8_ptr_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(void*, double)>(method_pointer)(params[0].ptr, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r4)
+static RtResultVoid invoke_i8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(float)>(method_pointer)(params[0].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r4,i4)
+static RtResultVoid invoke_i8_r4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(float, int32_t)>(method_pointer)(params[0].f32, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r4,i8)
+static RtResultVoid invoke_i8_r4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(float, int64_t)>(method_pointer)(params[0].f32, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r4,ptr)
+static RtResultVoid invoke_i8_r4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(float, void*)>(method_pointer)(params[0].f32, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r4,r4)
+static RtResultVoid invoke_i8_r4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(float, float)>(method_pointer)(params[0].f32, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r4,r8)
+static RtResultVoid invoke_i8_r4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(float, double)>(method_pointer)(params[0].f32, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r8)
+static RtResultVoid invoke_i8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(double)>(method_pointer)(params[0].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r8,i4)
+static RtResultVoid invoke_i8_r8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(double, int32_t)>(method_pointer)(params[0].f64, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r8,i8)
+static RtResultVoid invoke_i8_r8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(double, int64_t)>(method_pointer)(params[0].f64, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r8,ptr)
+static RtResultVoid invoke_i8_r8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(double, void*)>(method_pointer)(params[0].f64, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r8,r4)
+static RtResultVoid invoke_i8_r8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(double, float)>(method_pointer)(params[0].f64, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// i8(r8,r8)
+static RtResultVoid invoke_i8_r8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    int64_t result = reinterpret_cast<int64_t (*)(double, double)>(method_pointer)(params[0].f64, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr()
+static RtResultVoid invoke_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)()>(method_pointer)();
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4)
+static RtResultVoid invoke_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t)>(method_pointer)(params[0].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4)
+static RtResultVoid invoke_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,i4)
+static RtResultVoid invoke_ptr_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                        const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,i4,i4)
+static RtResultVoid invoke_ptr_i4_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,i4,i4,i4)
+static RtResultVoid invoke_ptr_i4_i4_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,i4,i4,ptr)
+static RtResultVoid invoke_ptr_i4_i4_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,i4,ptr)
+static RtResultVoid invoke_ptr_i4_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,i4,ptr,i4)
+static RtResultVoid invoke_ptr_i4_i4_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,i4,ptr,ptr)
+static RtResultVoid invoke_ptr_i4_i4_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,ptr)
+static RtResultVoid invoke_ptr_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                         const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,ptr,i4)
+static RtResultVoid invoke_ptr_i4_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,ptr,i4,i4)
+static RtResultVoid invoke_ptr_i4_i4_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, void*, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,ptr,i4,ptr)
+static RtResultVoid invoke_ptr_i4_i4_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, void*, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,ptr,ptr)
+static RtResultVoid invoke_ptr_i4_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,ptr,ptr,i4)
+static RtResultVoid invoke_ptr_i4_i4_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, void*, void*, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i4,ptr,ptr,ptr)
+static RtResultVoid invoke_ptr_i4_i4_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int32_t, void*, void*, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,i8)
+static RtResultVoid invoke_ptr_i4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, int64_t)>(method_pointer)(params[0].i32, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr)
+static RtResultVoid invoke_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,i4)
+static RtResultVoid invoke_ptr_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                         const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,i4,i4)
+static RtResultVoid invoke_ptr_i4_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,i4,i4,i4)
+static RtResultVoid invoke_ptr_i4_ptr_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,i4,i4,ptr)
+static RtResultVoid invoke_ptr_i4_ptr_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,i4,ptr)
+static RtResultVoid invoke_ptr_i4_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,i4,ptr,i4)
+static RtResultVoid invoke_ptr_i4_ptr_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,i4,ptr,ptr)
+static RtResultVoid invoke_ptr_i4_ptr_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,ptr)
+static RtResultVoid invoke_ptr_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,ptr,i4)
+static RtResultVoid invoke_ptr_i4_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,ptr,i4,i4)
+static RtResultVoid invoke_ptr_i4_ptr_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, void*, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,ptr,i4,ptr)
+static RtResultVoid invoke_ptr_i4_ptr_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, void*, int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,ptr,ptr)
+static RtResultVoid invoke_ptr_i4_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,ptr,ptr,i4)
+static RtResultVoid invoke_ptr_i4_ptr_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, void*, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,ptr,ptr,ptr,ptr)
+static RtResultVoid invoke_ptr_i4_ptr_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, void*, void*, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,r4)
+static RtResultVoid invoke_ptr_i4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, float)>(method_pointer)(params[0].i32, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i4,r8)
+static RtResultVoid invoke_ptr_i4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int32_t, double)>(method_pointer)(params[0].i32, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i8)
+static RtResultVoid invoke_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int64_t)>(method_pointer)(params[0].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i8,i4)
+static RtResultVoid invoke_ptr_i8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int64_t, int32_t)>(method_pointer)(params[0].i64, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i8,i8)
+static RtResultVoid invoke_ptr_i8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int64_t, int64_t)>(method_pointer)(params[0].i64, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i8,ptr)
+static RtResultVoid invoke_ptr_i8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int64_t, void*)>(method_pointer)(params[0].i64, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i8,r4)
+static RtResultVoid invoke_ptr_i8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int64_t, float)>(method_pointer)(params[0].i64, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(i8,r8)
+static RtResultVoid invoke_ptr_i8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(int64_t, double)>(method_pointer)(params[0].i64, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr)
+static RtResultVoid invoke_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*)>(method_pointer)(params[0].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4)
+static RtResultVoid invoke_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,i4)
+static RtResultVoid invoke_ptr_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                         const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,i4,i4)
+static RtResultVoid invoke_ptr_ptr_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,i4,i4,i4)
+static RtResultVoid invoke_ptr_ptr_i4_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, int32_t, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,i4,i4,ptr)
+static RtResultVoid invoke_ptr_ptr_i4_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, int32_t, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,i4,ptr)
+static RtResultVoid invoke_ptr_ptr_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,i4,ptr,i4)
+static RtResultVoid invoke_ptr_ptr_i4_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, int32_t, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,i4,ptr,ptr)
+static RtResultVoid invoke_ptr_ptr_i4_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, int32_t, void*, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,ptr)
+static RtResultVoid invoke_ptr_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,ptr,i4)
+static RtResultVoid invoke_ptr_ptr_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,ptr,i4,i4)
+static RtResultVoid invoke_ptr_ptr_i4_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,ptr,i4,ptr)
+static RtResultVoid invoke_ptr_ptr_i4_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,ptr,ptr)
+static RtResultVoid invoke_ptr_ptr_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, void*, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,ptr,ptr,i4)
+static RtResultVoid invoke_ptr_ptr_i4_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i4,ptr,ptr,ptr)
+static RtResultVoid invoke_ptr_ptr_i4_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int32_t, void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,i8)
+static RtResultVoid invoke_ptr_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, int64_t)>(method_pointer)(params[0].ptr, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr)
+static RtResultVoid invoke_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                       const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,i4)
+static RtResultVoid invoke_ptr_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,i4,i4)
+static RtResultVoid invoke_ptr_ptr_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,i4,i4,i4)
+static RtResultVoid invoke_ptr_ptr_ptr_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, int32_t, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,i4,i4,ptr)
+static RtResultVoid invoke_ptr_ptr_ptr_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, int32_t, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,i4,ptr)
+static RtResultVoid invoke_ptr_ptr_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,i4,ptr,i4)
+static RtResultVoid invoke_ptr_ptr_ptr_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, int32_t, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,i4,ptr,ptr)
+static RtResultVoid invoke_ptr_ptr_ptr_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, int32_t, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,ptr)
+static RtResultVoid invoke_ptr_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,ptr,i4)
+static RtResultVoid invoke_ptr_ptr_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,ptr,i4,i4)
+static RtResultVoid invoke_ptr_ptr_ptr_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i32, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,ptr,i4,ptr)
+static RtResultVoid invoke_ptr_ptr_ptr_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i32, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,ptr,i8)
+static RtResultVoid invoke_ptr_ptr_ptr_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, void*, int64_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,ptr,ptr)
+static RtResultVoid invoke_ptr_ptr_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,ptr,ptr,i4)
+static RtResultVoid invoke_ptr_ptr_ptr_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].ptr, params[4].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,ptr,ptr,ptr,ptr)
+static RtResultVoid invoke_ptr_ptr_ptr_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, void*, void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].ptr, params[4].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,r4)
+static RtResultVoid invoke_ptr_ptr_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, float)>(method_pointer)(params[0].ptr, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(ptr,r8)
+static RtResultVoid invoke_ptr_ptr_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(void*, double)>(method_pointer)(params[0].ptr, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r4)
+static RtResultVoid invoke_ptr_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(float)>(method_pointer)(params[0].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r4,i4)
+static RtResultVoid invoke_ptr_r4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(float, int32_t)>(method_pointer)(params[0].f32, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r4,i8)
+static RtResultVoid invoke_ptr_r4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(float, int64_t)>(method_pointer)(params[0].f32, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r4,ptr)
+static RtResultVoid invoke_ptr_r4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(float, void*)>(method_pointer)(params[0].f32, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r4,r4)
+static RtResultVoid invoke_ptr_r4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(float, float)>(method_pointer)(params[0].f32, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r4,r8)
+static RtResultVoid invoke_ptr_r4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(float, double)>(method_pointer)(params[0].f32, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r8)
+static RtResultVoid invoke_ptr_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(double)>(method_pointer)(params[0].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r8,i4)
+static RtResultVoid invoke_ptr_r8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(double, int32_t)>(method_pointer)(params[0].f64, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r8,i8)
+static RtResultVoid invoke_ptr_r8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(double, int64_t)>(method_pointer)(params[0].f64, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r8,ptr)
+static RtResultVoid invoke_ptr_r8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(double, void*)>(method_pointer)(params[0].f64, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r8,r4)
+static RtResultVoid invoke_ptr_r8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(double, float)>(method_pointer)(params[0].f64, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// ptr(r8,r8)
+static RtResultVoid invoke_ptr_r8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    void* result = reinterpret_cast<void* (*)(double, double)>(method_pointer)(params[0].f64, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4()
+static RtResultVoid invoke_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)()>(method_pointer)();
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i4)
+static RtResultVoid invoke_r4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int32_t)>(method_pointer)(params[0].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i4,i4)
+static RtResultVoid invoke_r4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i4,i8)
+static RtResultVoid invoke_r4_i4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int32_t, int64_t)>(method_pointer)(params[0].i32, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i4,ptr)
+static RtResultVoid invoke_r4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i4,r4)
+static RtResultVoid invoke_r4_i4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int32_t, float)>(method_pointer)(params[0].i32, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i4,r8)
+static RtResultVoid invoke_r4_i4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int32_t, double)>(method_pointer)(params[0].i32, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i8)
+static RtResultVoid invoke_r4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int64_t)>(method_pointer)(params[0].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i8,i4)
+static RtResultVoid invoke_r4_i8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int64_t, int32_t)>(method_pointer)(params[0].i64, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i8,i8)
+static RtResultVoid invoke_r4_i8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int64_t, int64_t)>(method_pointer)(params[0].i64, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i8,ptr)
+static RtResultVoid invoke_r4_i8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int64_t, void*)>(method_pointer)(params[0].i64, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i8,r4)
+static RtResultVoid invoke_r4_i8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int64_t, float)>(method_pointer)(params[0].i64, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(i8,r8)
+static RtResultVoid invoke_r4_i8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(int64_t, double)>(method_pointer)(params[0].i64, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(ptr)
+static RtResultVoid invoke_r4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(void*)>(method_pointer)(params[0].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(ptr,i4)
+static RtResultVoid invoke_r4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(ptr,i8)
+static RtResultVoid invoke_r4_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(void*, int64_t)>(method_pointer)(params[0].ptr, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(ptr,ptr)
+static RtResultVoid invoke_r4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(ptr,r4)
+static RtResultVoid invoke_r4_ptr_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(void*, float)>(method_pointer)(params[0].ptr, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(ptr,r8)
+static RtResultVoid invoke_r4_ptr_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(void*, double)>(method_pointer)(params[0].ptr, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r4)
+static RtResultVoid invoke_r4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(float)>(method_pointer)(params[0].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r4,i4)
+static RtResultVoid invoke_r4_r4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(float, int32_t)>(method_pointer)(params[0].f32, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r4,i8)
+static RtResultVoid invoke_r4_r4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(float, int64_t)>(method_pointer)(params[0].f32, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r4,ptr)
+static RtResultVoid invoke_r4_r4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(float, void*)>(method_pointer)(params[0].f32, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r4,r4)
+static RtResultVoid invoke_r4_r4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(float, float)>(method_pointer)(params[0].f32, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r4,r4,r4)
+static RtResultVoid invoke_r4_r4_r4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                       const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(float, float, float)>(method_pointer)(params[0].f32, params[1].f32, params[2].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r4,r8)
+static RtResultVoid invoke_r4_r4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(float, double)>(method_pointer)(params[0].f32, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r8)
+static RtResultVoid invoke_r4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(double)>(method_pointer)(params[0].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r8,i4)
+static RtResultVoid invoke_r4_r8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(double, int32_t)>(method_pointer)(params[0].f64, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r8,i8)
+static RtResultVoid invoke_r4_r8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(double, int64_t)>(method_pointer)(params[0].f64, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r8,ptr)
+static RtResultVoid invoke_r4_r8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(double, void*)>(method_pointer)(params[0].f64, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r8,r4)
+static RtResultVoid invoke_r4_r8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(double, float)>(method_pointer)(params[0].f64, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r4(r8,r8)
+static RtResultVoid invoke_r4_r8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    float result = reinterpret_cast<float (*)(double, double)>(method_pointer)(params[0].f64, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8()
+static RtResultVoid invoke_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)()>(method_pointer)();
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i4)
+static RtResultVoid invoke_r8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int32_t)>(method_pointer)(params[0].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i4,i4)
+static RtResultVoid invoke_r8_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i4,i8)
+static RtResultVoid invoke_r8_i4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int32_t, int64_t)>(method_pointer)(params[0].i32, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i4,ptr)
+static RtResultVoid invoke_r8_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i4,r4)
+static RtResultVoid invoke_r8_i4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int32_t, float)>(method_pointer)(params[0].i32, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i4,r8)
+static RtResultVoid invoke_r8_i4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int32_t, double)>(method_pointer)(params[0].i32, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i8)
+static RtResultVoid invoke_r8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int64_t)>(method_pointer)(params[0].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i8,i4)
+static RtResultVoid invoke_r8_i8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int64_t, int32_t)>(method_pointer)(params[0].i64, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i8,i8)
+static RtResultVoid invoke_r8_i8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int64_t, int64_t)>(method_pointer)(params[0].i64, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i8,ptr)
+static RtResultVoid invoke_r8_i8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int64_t, void*)>(method_pointer)(params[0].i64, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i8,r4)
+static RtResultVoid invoke_r8_i8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int64_t, float)>(method_pointer)(params[0].i64, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(i8,r8)
+static RtResultVoid invoke_r8_i8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(int64_t, double)>(method_pointer)(params[0].i64, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(ptr)
+static RtResultVoid invoke_r8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                  const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(void*)>(method_pointer)(params[0].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(ptr,i4)
+static RtResultVoid invoke_r8_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(ptr,i8)
+static RtResultVoid invoke_r8_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(void*, int64_t)>(method_pointer)(params[0].ptr, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(ptr,ptr)
+static RtResultVoid invoke_r8_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(ptr,r4)
+static RtResultVoid invoke_r8_ptr_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(void*, float)>(method_pointer)(params[0].ptr, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(ptr,r8)
+static RtResultVoid invoke_r8_ptr_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(void*, double)>(method_pointer)(params[0].ptr, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r4)
+static RtResultVoid invoke_r8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(float)>(method_pointer)(params[0].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r4,i4)
+static RtResultVoid invoke_r8_r4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(float, int32_t)>(method_pointer)(params[0].f32, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r4,i8)
+static RtResultVoid invoke_r8_r4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(float, int64_t)>(method_pointer)(params[0].f32, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r4,ptr)
+static RtResultVoid invoke_r8_r4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(float, void*)>(method_pointer)(params[0].f32, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r4,r4)
+static RtResultVoid invoke_r8_r4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(float, float)>(method_pointer)(params[0].f32, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r4,r8)
+static RtResultVoid invoke_r8_r4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(float, double)>(method_pointer)(params[0].f32, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r8)
+static RtResultVoid invoke_r8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(double)>(method_pointer)(params[0].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r8,i4)
+static RtResultVoid invoke_r8_r8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(double, int32_t)>(method_pointer)(params[0].f64, params[1].i32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r8,i8)
+static RtResultVoid invoke_r8_r8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(double, int64_t)>(method_pointer)(params[0].f64, params[1].i64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r8,ptr)
+static RtResultVoid invoke_r8_r8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(double, void*)>(method_pointer)(params[0].f64, params[1].ptr);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r8,r4)
+static RtResultVoid invoke_r8_r8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(double, float)>(method_pointer)(params[0].f64, params[1].f32);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r8,r8)
+static RtResultVoid invoke_r8_r8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(double, double)>(method_pointer)(params[0].f64, params[1].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// r8(r8,r8,r8)
+static RtResultVoid invoke_r8_r8_r8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                       const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    double result = reinterpret_cast<double (*)(double, double, double)>(method_pointer)(params[0].f64, params[1].f64, params[2].f64);
+    interp::EvalStackOp::set_return(ret, result);
+    RET_VOID_OK();
+}
+
+// v()
+static RtResultVoid invoke_v(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)()>(method_pointer)();
+    RET_VOID_OK();
+}
+
+// v(i4)
+static RtResultVoid invoke_v_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t)>(method_pointer)(params[0].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,i4)
+static RtResultVoid invoke_v_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,i4)
+static RtResultVoid invoke_v_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                      const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,i4,i4)
+static RtResultVoid invoke_v_i4_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                         const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,i4,i4,i4)
+static RtResultVoid invoke_v_i4_i4_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].i32, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,i4,i4,ptr)
+static RtResultVoid invoke_v_i4_i4_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].i32, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,i4,ptr)
+static RtResultVoid invoke_v_i4_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,i4,ptr,i4)
+static RtResultVoid invoke_v_i4_i4_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].ptr, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,i4,ptr,ptr)
+static RtResultVoid invoke_v_i4_i4_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].i32, params[3].ptr, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,ptr)
+static RtResultVoid invoke_v_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                       const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,ptr,i4)
+static RtResultVoid invoke_v_i4_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,ptr,i4,i4)
+static RtResultVoid invoke_v_i4_i4_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, void*, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].i32, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,ptr,i4,ptr)
+static RtResultVoid invoke_v_i4_i4_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, void*, int32_t, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].i32, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,ptr,ptr)
+static RtResultVoid invoke_v_i4_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,ptr,ptr,i4)
+static RtResultVoid invoke_v_i4_i4_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, void*, void*, int32_t)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].ptr, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,i4,ptr,ptr,ptr)
+static RtResultVoid invoke_v_i4_i4_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int32_t, void*, void*, void*)>(method_pointer)(params[0].i32, params[1].i32, params[2].ptr, params[3].ptr, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,i8)
+static RtResultVoid invoke_v_i4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, int64_t)>(method_pointer)(params[0].i32, params[1].i64);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr)
+static RtResultVoid invoke_v_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,i4)
+static RtResultVoid invoke_v_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                       const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,i4,i4)
+static RtResultVoid invoke_v_i4_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,i4,i4,i4)
+static RtResultVoid invoke_v_i4_ptr_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, int32_t, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].i32, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,i4,i4,ptr)
+static RtResultVoid invoke_v_i4_ptr_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, int32_t, int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].i32, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,i4,ptr)
+static RtResultVoid invoke_v_i4_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,i4,ptr,i4)
+static RtResultVoid invoke_v_i4_ptr_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, int32_t, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].ptr, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,i4,ptr,ptr)
+static RtResultVoid invoke_v_i4_ptr_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].i32, params[3].ptr, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,ptr)
+static RtResultVoid invoke_v_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                        const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,ptr,i4)
+static RtResultVoid invoke_v_i4_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,ptr,i4,i4)
+static RtResultVoid invoke_v_i4_ptr_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, void*, int32_t, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].i32, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,ptr,i4,ptr)
+static RtResultVoid invoke_v_i4_ptr_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, void*, int32_t, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].i32, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,ptr,ptr)
+static RtResultVoid invoke_v_i4_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,ptr,ptr,i4)
+static RtResultVoid invoke_v_i4_ptr_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, void*, void*, int32_t)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].ptr, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(i4,ptr,ptr,ptr,ptr)
+static RtResultVoid invoke_v_i4_ptr_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, void*, void*, void*, void*)>(method_pointer)(params[0].i32, params[1].ptr, params[2].ptr, params[3].ptr, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(i4,r4)
+static RtResultVoid invoke_v_i4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, float)>(method_pointer)(params[0].i32, params[1].f32);
+    RET_VOID_OK();
+}
+
+// v(i4,r8)
+static RtResultVoid invoke_v_i4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int32_t, double)>(method_pointer)(params[0].i32, params[1].f64);
+    RET_VOID_OK();
+}
+
+// v(i8)
+static RtResultVoid invoke_v_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int64_t)>(method_pointer)(params[0].i64);
+    RET_VOID_OK();
+}
+
+// v(i8,i4)
+static RtResultVoid invoke_v_i8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int64_t, int32_t)>(method_pointer)(params[0].i64, params[1].i32);
+    RET_VOID_OK();
+}
+
+// v(i8,i8)
+static RtResultVoid invoke_v_i8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int64_t, int64_t)>(method_pointer)(params[0].i64, params[1].i64);
+    RET_VOID_OK();
+}
+
+// v(i8,ptr)
+static RtResultVoid invoke_v_i8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int64_t, void*)>(method_pointer)(params[0].i64, params[1].ptr);
+    RET_VOID_OK();
+}
+
+// v(i8,r4)
+static RtResultVoid invoke_v_i8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int64_t, float)>(method_pointer)(params[0].i64, params[1].f32);
+    RET_VOID_OK();
+}
+
+// v(i8,r8)
+static RtResultVoid invoke_v_i8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(int64_t, double)>(method_pointer)(params[0].i64, params[1].f64);
+    RET_VOID_OK();
+}
+
+// v(ptr)
+static RtResultVoid invoke_v_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*)>(method_pointer)(params[0].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4)
+static RtResultVoid invoke_v_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,i4)
+static RtResultVoid invoke_v_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                       const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,i4,i4)
+static RtResultVoid invoke_v_ptr_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                          const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,i4,i4,i4)
+static RtResultVoid invoke_v_ptr_i4_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, int32_t, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].i32, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,i4,i4,ptr)
+static RtResultVoid invoke_v_ptr_i4_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, int32_t, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].i32, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,i4,ptr)
+static RtResultVoid invoke_v_ptr_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,i4,ptr,i4)
+static RtResultVoid invoke_v_ptr_i4_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, int32_t, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].ptr, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,i4,ptr,ptr)
+static RtResultVoid invoke_v_ptr_i4_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, int32_t, void*, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].i32, params[3].ptr, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,ptr)
+static RtResultVoid invoke_v_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                        const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,ptr,i4)
+static RtResultVoid invoke_v_ptr_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,ptr,i4,i4)
+static RtResultVoid invoke_v_ptr_i4_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].i32, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,ptr,i4,ptr)
+static RtResultVoid invoke_v_ptr_i4_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].i32, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,ptr,ptr)
+static RtResultVoid invoke_v_ptr_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, void*, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,ptr,ptr,i4)
+static RtResultVoid invoke_v_ptr_i4_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].ptr, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,i4,ptr,ptr,ptr)
+static RtResultVoid invoke_v_ptr_i4_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int32_t, void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].i32, params[2].ptr, params[3].ptr, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,i8)
+static RtResultVoid invoke_v_ptr_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, int64_t)>(method_pointer)(params[0].ptr, params[1].i64);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr)
+static RtResultVoid invoke_v_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                     const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,i4)
+static RtResultVoid invoke_v_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                        const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,i4,i4)
+static RtResultVoid invoke_v_ptr_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                           const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,i4,i4,i4)
+static RtResultVoid invoke_v_ptr_ptr_i4_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                              const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, int32_t, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].i32, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,i4,i4,ptr)
+static RtResultVoid invoke_v_ptr_ptr_i4_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, int32_t, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].i32, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,i4,ptr)
+static RtResultVoid invoke_v_ptr_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,i4,ptr,i4)
+static RtResultVoid invoke_v_ptr_ptr_i4_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, int32_t, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].ptr, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,i4,ptr,ptr)
+static RtResultVoid invoke_v_ptr_ptr_i4_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, int32_t, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].i32, params[3].ptr, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,ptr)
+static RtResultVoid invoke_v_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                         const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,ptr,i4)
+static RtResultVoid invoke_v_ptr_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                            const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,ptr,i4,i4)
+static RtResultVoid invoke_v_ptr_ptr_ptr_i4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                               const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, void*, int32_t, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i32, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,ptr,i4,ptr)
+static RtResultVoid invoke_v_ptr_ptr_ptr_i4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, void*, int32_t, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].i32, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,ptr,ptr)
+static RtResultVoid invoke_v_ptr_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                             const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,ptr,ptr,i4)
+static RtResultVoid invoke_v_ptr_ptr_ptr_ptr_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, void*, void*, int32_t)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].ptr, params[4].i32);
+    RET_VOID_OK();
+}
+
+// v(ptr,ptr,ptr,ptr,ptr)
+static RtResultVoid invoke_v_ptr_ptr_ptr_ptr_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, void*, void*, void*, void*)>(method_pointer)(params[0].ptr, params[1].ptr, params[2].ptr, params[3].ptr, params[4].ptr);
+    RET_VOID_OK();
+}
+
+// v(ptr,r4)
+static RtResultVoid invoke_v_ptr_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, float)>(method_pointer)(params[0].ptr, params[1].f32);
+    RET_VOID_OK();
+}
+
+// v(ptr,r8)
+static RtResultVoid invoke_v_ptr_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(void*, double)>(method_pointer)(params[0].ptr, params[1].f64);
+    RET_VOID_OK();
+}
+
+// v(r4)
+static RtResultVoid invoke_v_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(float)>(method_pointer)(params[0].f32);
+    RET_VOID_OK();
+}
+
+// v(r4,i4)
+static RtResultVoid invoke_v_r4_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(float, int32_t)>(method_pointer)(params[0].f32, params[1].i32);
+    RET_VOID_OK();
+}
+
+// v(r4,i8)
+static RtResultVoid invoke_v_r4_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(float, int64_t)>(method_pointer)(params[0].f32, params[1].i64);
+    RET_VOID_OK();
+}
+
+// v(r4,ptr)
+static RtResultVoid invoke_v_r4_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(float, void*)>(method_pointer)(params[0].f32, params[1].ptr);
+    RET_VOID_OK();
+}
+
+// v(r4,r4)
+static RtResultVoid invoke_v_r4_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(float, float)>(method_pointer)(params[0].f32, params[1].f32);
+    RET_VOID_OK();
+}
+
+// v(r4,r8)
+static RtResultVoid invoke_v_r4_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(float, double)>(method_pointer)(params[0].f32, params[1].f64);
+    RET_VOID_OK();
+}
+
+// v(r8)
+static RtResultVoid invoke_v_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(double)>(method_pointer)(params[0].f64);
+    RET_VOID_OK();
+}
+
+// v(r8,i4)
+static RtResultVoid invoke_v_r8_i4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(double, int32_t)>(method_pointer)(params[0].f64, params[1].i32);
+    RET_VOID_OK();
+}
+
+// v(r8,i8)
+static RtResultVoid invoke_v_r8_i8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(double, int64_t)>(method_pointer)(params[0].f64, params[1].i64);
+    RET_VOID_OK();
+}
+
+// v(r8,ptr)
+static RtResultVoid invoke_v_r8_ptr(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(double, void*)>(method_pointer)(params[0].f64, params[1].ptr);
+    RET_VOID_OK();
+}
+
+// v(r8,r4)
+static RtResultVoid invoke_v_r8_r4(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(double, float)>(method_pointer)(params[0].f64, params[1].f32);
+    RET_VOID_OK();
+}
+
+// v(r8,r8)
+static RtResultVoid invoke_v_r8_r8(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
+                                   const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    reinterpret_cast<void (*)(double, double)>(method_pointer)(params[0].f64, params[1].f64);
+    RET_VOID_OK();
+}
+
+//}}PINVOKE_INVOKERS
+
+struct PInvokeSignatureInvoker
+{
+    const char* signature;
+    PInvokeInvoker invoker;
+};
+
+// Sorted by signature.
+static const PInvokeSignatureInvoker s_signature_invokers[] = {
+    //{{PINVOKE_INVOKER_TABLE
+    {"i4()", invoke_i4},
+    {"i4(i4)", invoke_i4_i4},
+    {"i4(i4,i4)", invoke_i4_i4_i4},
+    {"i4(i4,i4,i4)", invoke_i4_i4_i4_i4},
+    {"i4(i4,i4,i4,i4)", invoke_i4_i4_i4_i4_i4},
+    {"i4(i4,i4,i4,i4,i4)", invoke_i4_i4_i4_i4_i4_i4},
+    {"i4(i4,i4,i4,i4,ptr)", invoke_i4_i4_i4_i4_i4_ptr},
+    {"i4(i4,i4,i4,ptr)", invoke_i4_i4_i4_i4_ptr},
+    {"i4(i4,i4,i4,ptr,i4)", invoke_i4_i4_i4_i4_ptr_i4},
+    {"i4(i4,i4,i4,ptr,ptr)", invoke_i4_i4_i4_i4_ptr_ptr},
+    {"i4(i4,i4,ptr)", invoke_i4_i4_i4_ptr},
+    {"i4(i4,i4,ptr,i4)", invoke_i4_i4_i4_ptr_i4},
+    {"i4(i4,i4,ptr,i4,i4)", invoke_i4_i4_i4_ptr_i4_i4},
+    {"i4(i4,i4,ptr,i4,ptr)", invoke_i4_i4_i4_ptr_i4_ptr},
+    {"i4(i4,i4,ptr,ptr)", invoke_i4_i4_i4_ptr_ptr},
+    {"i4(i4,i4,ptr,ptr,i4)", invoke_i4_i4_i4_ptr_ptr_i4},
+    {"i4(i4,i4,ptr,ptr,ptr)", invoke_i4_i4_i4_ptr_ptr_ptr},
+    {"i4(i4,i8)", invoke_i4_i4_i8},
+    {"i4(i4,ptr)", invoke_i4_i4_ptr},
+    {"i4(i4,ptr,i4)", invoke_i4_i4_ptr_i4},
+    {"i4(i4,ptr,i4,i4)", invoke_i4_i4_ptr_i4_i4},
+    {"i4(i4,ptr,i4,i4,i4)", invoke_i4_i4_ptr_i4_i4_i4},
+    {"i4(i4,ptr,i4,i4,ptr)", invoke_i4_i4_ptr_i4_i4_ptr},
+    {"i4(i4,ptr,i4,ptr)", invoke_i4_i4_ptr_i4_ptr},
+    {"i4(i4,ptr,i4,ptr,i4)", invoke_i4_i4_ptr_i4_ptr_i4},
+    {"i4(i4,ptr,i4,ptr,ptr)", invoke_i4_i4_ptr_i4_ptr_ptr},
+    {"i4(i4,ptr,ptr)", invoke_i4_i4_ptr_ptr},
+    {"i4(i4,ptr,ptr,i4)", invoke_i4_i4_ptr_ptr_i4},
+    {"i4(i4,ptr,ptr,i4,i4)", invoke_i4_i4_ptr_ptr_i4_i4},
+    {"i4(i4,ptr,ptr,i4,ptr)", invoke_i4_i4_ptr_ptr_i4_ptr},
+    {"i4(i4,ptr,ptr,ptr)", invoke_i4_i4_ptr_ptr_ptr},
+    {"i4(i4,ptr,ptr,ptr,i4)", invoke_i4_i4_ptr_ptr_ptr_i4},
+    {"i4(i4,ptr,ptr,ptr,ptr)", invoke_i4_i4_ptr_ptr_ptr_ptr},
+    {"i4(i4,r4)", invoke_i4_i4_r4},
+    {"i4(i4,r8)", invoke_i4_i4_r8},
+    {"i4(i8)", invoke_i4_i8},
+    {"i4(i8,i4)", invoke_i4_i8_i4},
+    {"i4(i8,i8)", invoke_i4_i8_i8},
+    {"i4(i8,ptr)", invoke_i4_i8_ptr},
+    {"i4(i8,r4)", invoke_i4_i8_r4},
+    {"i4(i8,r8)", invoke_i4_i8_r8},
+    {"i4(ptr)", invoke_i4_ptr},
+    {"i4(ptr,i4)", invoke_i4_ptr_i4},
+    {"i4(ptr,i4,i4)", invoke_i4_ptr_i4_i4},
+    {"i4(ptr,i4,i4,i4)", invoke_i4_ptr_i4_i4_i4},
+    {"i4(ptr,i4,i4,i4,i4)", invoke_i4_ptr_i4_i4_i4_i4},
+    {"i4(ptr,i4,i4,i4,ptr)", invoke_i4_ptr_i4_i4_i4_ptr},
+    {"i4(ptr,i4,i4,ptr)", invoke_i4_ptr_i4_i4_ptr},
+    {"i4(ptr,i4,i4,ptr,i4)", invoke_i4_ptr_i4_i4_ptr_i4},
+    {"i4(ptr,i4,i4,ptr,ptr)", invoke_i4_ptr_i4_i4_ptr_ptr},
+    {"i4(ptr,i4,ptr)", invoke_i4_ptr_i4_ptr},
+    {"i4(ptr,i4,ptr,i4)", invoke_i4_ptr_i4_ptr_i4},
+    {"i4(ptr,i4,ptr,i4,i4)", invoke_i4_ptr_i4_ptr_i4_i4},
+    {"i4(ptr,i4,ptr,i4,ptr)", invoke_i4_ptr_i4_ptr_i4_ptr},
+    {"i4(ptr,i4,ptr,ptr)", invoke_i4_ptr_i4_ptr_ptr},
+    {"i4(ptr,i4,ptr,ptr,i4)", invoke_i4_ptr_i4_ptr_ptr_i4},
+    {"i4(ptr,i4,ptr,ptr,ptr)", invoke_i4_ptr_i4_ptr_ptr_ptr},
+    {"i4(ptr,i8)", invoke_i4_ptr_i8},
+    {"i4(ptr,i8,ptr,i8)", invoke_i4_ptr_i8_ptr_i8},
+    {"i4(ptr,ptr)", invoke_i4_ptr_ptr},
+    {"i4(ptr,ptr,i4)", invoke_i4_ptr_ptr_i4},
+    {"i4(ptr,ptr,i4,i4)", invoke_i4_ptr_ptr_i4_i4},
+    {"i4(ptr,ptr,i4,i4,i4)", invoke_i4_ptr_ptr_i4_i4_i4},
+    {"i4(ptr,ptr,i4,i4,ptr)", invoke_i4_ptr_ptr_i4_i4_ptr},
+    {"i4(ptr,ptr,i4,ptr)", invoke_i4_ptr_ptr_i4_ptr},
+    {"i4(ptr,ptr,i4,ptr,i4)", invoke_i4_ptr_ptr_i4_ptr_i4},
+    {"i4(ptr,ptr,i4,ptr,ptr)", invoke_i4_ptr_ptr_i4_ptr_ptr},
+    {"i4(ptr,ptr,ptr)", invoke_i4_ptr_ptr_ptr},
+    {"i4(ptr,ptr,ptr,i4)", invoke_i4_ptr_ptr_ptr_i4},
+    {"i4(ptr,ptr,ptr,i4,i4)", invoke_i4_ptr_ptr_ptr_i4_i4},
+    {"i4(ptr,ptr,ptr,i4,ptr)", invoke_i4_ptr_ptr_ptr_i4_ptr},
+    {"i4(ptr,ptr,ptr,i8)", invoke_i4_ptr_ptr_ptr_i8},
+    {"i4(ptr,ptr,ptr,ptr)", invoke_i4_ptr_ptr_ptr_ptr},
+    {"i4(ptr,ptr,ptr,ptr,i4)", invoke_i4_ptr_ptr_ptr_ptr_i4},
+    {"i4(ptr,ptr,ptr,ptr,ptr)", invoke_i4_ptr_ptr_ptr_ptr_ptr},
+    {"i4(ptr,r4)", invoke_i4_ptr_r4},
+    {"i4(ptr,r8)", invoke_i4_ptr_r8},
+    {"i4(r4)", invoke_i4_r4},
+    {"i4(r4,i4)", invoke_i4_r4_i4},
+    {"i4(r4,i8)", invoke_i4_r4_i8},
+    {"i4(r4,ptr)", invoke_i4_r4_ptr},
+    {"i4(r4,r4)", invoke_i4_r4_r4},
+    {"i4(r4,r8)", invoke_i4_r4_r8},
+    {"i4(r8)", invoke_i4_r8},
+    {"i4(r8,i4)", invoke_i4_r8_i4},
+    {"i4(r8,i8)", invoke_i4_r8_i8},
+    {"i4(r8,ptr)", invoke_i4_r8_ptr},
+    {"i4(r8,r4)", invoke_i4_r8_r4},
+    {"i4(r8,r8)", invoke_i4_r8_r8},
+    {"i8()", invoke_i8},
+    {"i8(i4)", invoke_i8_i4},
+    {"i8(i4,i4)", invoke_i8_i4_i4},
+    {"i8(i4,i8)", invoke_i8_i4_i8},
+    {"i8(i4,ptr)", invoke_i8_i4_ptr},
+    {"i8(i4,r4)", invoke_i8_i4_r4},
+    {"i8(i4,r8)", invoke_i8_i4_r8},
+    {"i8(i8)", invoke_i8_i8},
+    {"i8(i8,i4)", invoke_i8_i8_i4},
+    {"i8(i8,i8)", invoke_i8_i8_i8},
+    {"i8(i8,ptr)", invoke_i8_i8_ptr},
+    {"i8(i8,r4)", invoke_i8_i8_r4},
+    {"i8(i8,r8)", invoke_i8_i8_r8},
+    {"i8(ptr)", invoke_i8_ptr},
+    {"i8(ptr,i4)", invoke_i8_ptr_i4},
+    {"i8(ptr,i8)", invoke_i8_ptr_i8},
+    {"i8(ptr,i8,ptr,i8)", invoke_i8_ptr_i8_ptr_i8},
+    {"i8(ptr,ptr)", invoke_i8_ptr_ptr},
+    {"i8(ptr,ptr,ptr,i8)", invoke_i8_ptr_ptr_ptr_i8},
+    {"i8(ptr,r4)", invoke_i8_ptr_r4},
+    {"i8(ptr,r8)", invoke_i8_ptr_r8},
+    {"i8(r4)", invoke_i8_r4},
+    {"i8(r4,i4)", invoke_i8_r4_i4},
+    {"i8(r4,i8)", invoke_i8_r4_i8},
+    {"i8(r4,ptr)", invoke_i8_r4_ptr},
+    {"i8(r4,r4)", invoke_i8_r4_r4},
+    {"i8(r4,r8)", invoke_i8_r4_r8},
+    {"i8(r8)", invoke_i8_r8},
+    {"i8(r8,i4)", invoke_i8_r8_i4},
+    {"i8(r8,i8)", invoke_i8_r8_i8},
+    {"i8(r8,ptr)", invoke_i8_r8_ptr},
+    {"i8(r8,r4)", invoke_i8_r8_r4},
+    {"i8(r8,r8)", invoke_i8_r8_r8},
+    {"ptr()", invoke_ptr},
+    {"ptr(i4)", invoke_ptr_i4},
+    {"ptr(i4,i4)", invoke_ptr_i4_i4},
+    {"ptr(i4,i4,i4)", invoke_ptr_i4_i4_i4},
+    {"ptr(i4,i4,i4,i4)", invoke_ptr_i4_i4_i4_i4},
+    {"ptr(i4,i4,i4,i4,i4)", invoke_ptr_i4_i4_i4_i4_i4},
+    {"ptr(i4,i4,i4,i4,ptr)", invoke_ptr_i4_i4_i4_i4_ptr},
+    {"ptr(i4,i4,i4,ptr)", invoke_ptr_i4_i4_i4_ptr},
+    {"ptr(i4,i4,i4,ptr,i4)", invoke_ptr_i4_i4_i4_ptr_i4},
+    {"ptr(i4,i4,i4,ptr,ptr)", invoke_ptr_i4_i4_i4_ptr_ptr},
+    {"ptr(i4,i4,ptr)", invoke_ptr_i4_i4_ptr},
+    {"ptr(i4,i4,ptr,i4)", invoke_ptr_i4_i4_ptr_i4},
+    {"ptr(i4,i4,ptr,i4,i4)", invoke_ptr_i4_i4_ptr_i4_i4},
+    {"ptr(i4,i4,ptr,i4,ptr)", invoke_ptr_i4_i4_ptr_i4_ptr},
+    {"ptr(i4,i4,ptr,ptr)", invoke_ptr_i4_i4_ptr_ptr},
+    {"ptr(i4,i4,ptr,ptr,i4)", invoke_ptr_i4_i4_ptr_ptr_i4},
+    {"ptr(i4,i4,ptr,ptr,ptr)", invoke_ptr_i4_i4_ptr_ptr_ptr},
+    {"ptr(i4,i8)", invoke_ptr_i4_i8},
+    {"ptr(i4,ptr)", invoke_ptr_i4_ptr},
+    {"ptr(i4,ptr,i4)", invoke_ptr_i4_ptr_i4},
+    {"ptr(i4,ptr,i4,i4)", invoke_ptr_i4_ptr_i4_i4},
+    {"ptr(i4,ptr,i4,i4,i4)", invoke_ptr_i4_ptr_i4_i4_i4},
+    {"ptr(i4,ptr,i4,i4,ptr)", invoke_ptr_i4_ptr_i4_i4_ptr},
+    {"ptr(i4,ptr,i4,ptr)", invoke_ptr_i4_ptr_i4_ptr},
+    {"ptr(i4,ptr,i4,ptr,i4)", invoke_ptr_i4_ptr_i4_ptr_i4},
+    {"ptr(i4,ptr,i4,ptr,ptr)", invoke_ptr_i4_ptr_i4_ptr_ptr},
+    {"ptr(i4,ptr,ptr)", invoke_ptr_i4_ptr_ptr},
+    {"ptr(i4,ptr,ptr,i4)", invoke_ptr_i4_ptr_ptr_i4},
+    {"ptr(i4,ptr,ptr,i4,i4)", invoke_ptr_i4_ptr_ptr_i4_i4},
+    {"ptr(i4,ptr,ptr,i4,ptr)", invoke_ptr_i4_ptr_ptr_i4_ptr},
+    {"ptr(i4,ptr,ptr,ptr)", invoke_ptr_i4_ptr_ptr_ptr},
+    {"ptr(i4,ptr,ptr,ptr,i4)", invoke_ptr_i4_ptr_ptr_ptr_i4},
+    {"ptr(i4,ptr,ptr,ptr,ptr)", invoke_ptr_i4_ptr_ptr_ptr_ptr},
+    {"ptr(i4,r4)", invoke_ptr_i4_r4},
+    {"ptr(i4,r8)", invoke_ptr_i4_r8},
+    {"ptr(i8)", invoke_ptr_i8},
+    {"ptr(i8,i4)", invoke_ptr_i8_i4},
+    {"ptr(i8,i8)", invoke_ptr_i8_i8},
+    {"ptr(i8,ptr)", invoke_ptr_i8_ptr},
+    {"ptr(i8,r4)", invoke_ptr_i8_r4},
+    {"ptr(i8,r8)", invoke_ptr_i8_r8},
+    {"ptr(ptr)", invoke_ptr_ptr},
+    {"ptr(ptr,i4)", invoke_ptr_ptr_i4},
+    {"ptr(ptr,i4,i4)", invoke_ptr_ptr_i4_i4},
+    {"ptr(ptr,i4,i4,i4)", invoke_ptr_ptr_i4_i4_i4},
+    {"ptr(ptr,i4,i4,i4,i4)", invoke_ptr_ptr_i4_i4_i4_i4},
+    {"ptr(ptr,i4,i4,i4,ptr)", invoke_ptr_ptr_i4_i4_i4_ptr},
+    {"ptr(ptr,i4,i4,ptr)", invoke_ptr_ptr_i4_i4_ptr},
+    {"ptr(ptr,i4,i4,ptr,i4)", invoke_ptr_ptr_i4_i4_ptr_i4},
+    {"ptr(ptr,i4,i4,ptr,ptr)", invoke_ptr_ptr_i4_i4_ptr_ptr},
+    {"ptr(ptr,i4,ptr)", invoke_ptr_ptr_i4_ptr},
+    {"ptr(ptr,i4,ptr,i4)", invoke_ptr_ptr_i4_ptr_i4},
+    {"ptr(ptr,i4,ptr,i4,i4)", invoke_ptr_ptr_i4_ptr_i4_i4},
+    {"ptr(ptr,i4,ptr,i4,ptr)", invoke_ptr_ptr_i4_ptr_i4_ptr},
+    {"ptr(ptr,i4,ptr,ptr)", invoke_ptr_ptr_i4_ptr_ptr},
+    {"ptr(ptr,i4,ptr,ptr,i4)", invoke_ptr_ptr_i4_ptr_ptr_i4},
+    {"ptr(ptr,i4,ptr,ptr,ptr)", invoke_ptr_ptr_i4_ptr_ptr_ptr},
+    {"ptr(ptr,i8)", invoke_ptr_ptr_i8},
+    {"ptr(ptr,ptr)", invoke_ptr_ptr_ptr},
+    {"ptr(ptr,ptr,i4)", invoke_ptr_ptr_ptr_i4},
+    {"ptr(ptr,ptr,i4,i4)", invoke_ptr_ptr_ptr_i4_i4},
+    {"ptr(ptr,ptr,i4,i4,i4)", invoke_ptr_ptr_ptr_i4_i4_i4},
+    {"ptr(ptr,ptr,i4,i4,ptr)", invoke_ptr_ptr_ptr_i4_i4_ptr},
+    {"ptr(ptr,ptr,i4,ptr)", invoke_ptr_ptr_ptr_i4_ptr},
+    {"ptr(ptr,ptr,i4,ptr,i4)", invoke_ptr_ptr_ptr_i4_ptr_i4},
+    {"ptr(ptr,ptr,i4,ptr,ptr)", invoke_ptr_ptr_ptr_i4_ptr_ptr},
+    {"ptr(ptr,ptr,ptr)", invoke_ptr_ptr_ptr_ptr},
+    {"ptr(ptr,ptr,ptr,i4)", invoke_ptr_ptr_ptr_ptr_i4},
+    {"ptr(ptr,ptr,ptr,i4,i4)", invoke_ptr_ptr_ptr_ptr_i4_i4},
+    {"ptr(ptr,ptr,ptr,i4,ptr)", invoke_ptr_ptr_ptr_ptr_i4_ptr},
+    {"ptr(ptr,ptr,ptr,i8)", invoke_ptr_ptr_ptr_ptr_i8},
+    {"ptr(ptr,ptr,ptr,ptr)", invoke_ptr_ptr_ptr_ptr_ptr},
+    {"ptr(ptr,ptr,ptr,ptr,i4)", invoke_ptr_ptr_ptr_ptr_ptr_i4},
+    {"ptr(ptr,ptr,ptr,ptr,ptr)", invoke_ptr_ptr_ptr_ptr_ptr_ptr},
+    {"ptr(ptr,r4)", invoke_ptr_ptr_r4},
+    {"ptr(ptr,r8)", invoke_ptr_ptr_r8},
+    {"ptr(r4)", invoke_ptr_r4},
+    {"ptr(r4,i4)", invoke_ptr_r4_i4},
+    {"ptr(r4,i8)", invoke_ptr_r4_i8},
+    {"ptr(r4,ptr)", invoke_ptr_r4_ptr},
+    {"ptr(r4,r4)", invoke_ptr_r4_r4},
+    {"ptr(r4,r8)", invoke_ptr_r4_r8},
+    {"ptr(r8)", invoke_ptr_r8},
+    {"ptr(r8,i4)", invoke_ptr_r8_i4},
+    {"ptr(r8,i8)", invoke_ptr_r8_i8},
+    {"ptr(r8,ptr)", invoke_ptr_r8_ptr},
+    {"ptr(r8,r4)", invoke_ptr_r8_r4},
+    {"ptr(r8,r8)", invoke_ptr_r8_r8},
+    {"r4()", invoke_r4},
+    {"r4(i4)", invoke_r4_i4},
+    {"r4(i4,i4)", invoke_r4_i4_i4},
+    {"r4(i4,i8)", invoke_r4_i4_i8},
+    {"r4(i4,ptr)", invoke_r4_i4_ptr},
+    {"r4(i4,r4)", invoke_r4_i4_r4},
+    {"r4(i4,r8)", invoke_r4_i4_r8},
+    {"r4(i8)", invoke_r4_i8},
+    {"r4(i8,i4)", invoke_r4_i8_i4},
+    {"r4(i8,i8)", invoke_r4_i8_i8},
+    {"r4(i8,ptr)", invoke_r4_i8_ptr},
+    {"r4(i8,r4)", invoke_r4_i8_r4},
+    {"r4(i8,r8)", invoke_r4_i8_r8},
+    {"r4(ptr)", invoke_r4_ptr},
+    {"r4(ptr,i4)", invoke_r4_ptr_i4},
+    {"r4(ptr,i8)", invoke_r4_ptr_i8},
+    {"r4(ptr,ptr)", invoke_r4_ptr_ptr},
+    {"r4(ptr,r4)", invoke_r4_ptr_r4},
+    {"r4(ptr,r8)", invoke_r4_ptr_r8},
+    {"r4(r4)", invoke_r4_r4},
+    {"r4(r4,i4)", invoke_r4_r4_i4},
+    {"r4(r4,i8)", invoke_r4_r4_i8},
+    {"r4(r4,ptr)", invoke_r4_r4_ptr},
+    {"r4(r4,r4)", invoke_r4_r4_r4},
+    {"r4(r4,r4,r4)", invoke_r4_r4_r4_r4},
+    {"r4(r4,r8)", invoke_r4_r4_r8},
+    {"r4(r8)", invoke_r4_r8},
+    {"r4(r8,i4)", invoke_r4_r8_i4},
+    {"r4(r8,i8)", invoke_r4_r8_i8},
+    {"r4(r8,ptr)", invoke_r4_r8_ptr},
+    {"r4(r8,r4)", invoke_r4_r8_r4},
+    {"r4(r8,r8)", invoke_r4_r8_r8},
+    {"r8()", invoke_r8},
+    {"r8(i4)", invoke_r8_i4},
+    {"r8(i4,i4)", invoke_r8_i4_i4},
+    {"r8(i4,i8)", invoke_r8_i4_i8},
+    {"r8(i4,ptr)", invoke_r8_i4_ptr},
+    {"r8(i4,r4)", invoke_r8_i4_r4},
+    {"r8(i4,r8)", invoke_r8_i4_r8},
+    {"r8(i8)", invoke_r8_i8},
+    {"r8(i8,i4)", invoke_r8_i8_i4},
+    {"r8(i8,i8)", invoke_r8_i8_i8},
+    {"r8(i8,ptr)", invoke_r8_i8_ptr},
+    {"r8(i8,r4)", invoke_r8_i8_r4},
+    {"r8(i8,r8)", invoke_r8_i8_r8},
+    {"r8(ptr)", invoke_r8_ptr},
+    {"r8(ptr,i4)", invoke_r8_ptr_i4},
+    {"r8(ptr,i8)", invoke_r8_ptr_i8},
+    {"r8(ptr,ptr)", invoke_r8_ptr_ptr},
+    {"r8(ptr,r4)", invoke_r8_ptr_r4},
+    {"r8(ptr,r8)", invoke_r8_ptr_r8},
+    {"r8(r4)", invoke_r8_r4},
+    {"r8(r4,i4)", invoke_r8_r4_i4},
+    {"r8(r4,i8)", invoke_r8_r4_i8},
+    {"r8(r4,ptr)", invoke_r8_r4_ptr},
+    {"r8(r4,r4)", invoke_r8_r4_r4},
+    {"r8(r4,r8)", invoke_r8_r4_r8},
+    {"r8(r8)", invoke_r8_r8},
+    {"r8(r8,i4)", invoke_r8_r8_i4},
+    {"r8(r8,i8)", invoke_r8_r8_i8},
+    {"r8(r8,ptr)", invoke_r8_r8_ptr},
+    {"r8(r8,r4)", invoke_r8_r8_r4},
+    {"r8(r8,r8)", invoke_r8_r8_r8},
+    {"r8(r8,r8,r8)", invoke_r8_r8_r8_r8},
+    {"v()", invoke_v},
+    {"v(i4)", invoke_v_i4},
+    {"v(i4,i4)", invoke_v_i4_i4},
+    {"v(i4,i4,i4)", invoke_v_i4_i4_i4},
+    {"v(i4,i4,i4,i4)", invoke_v_i4_i4_i4_i4},
+    {"v(i4,i4,i4,i4,i4)", invoke_v_i4_i4_i4_i4_i4},
+    {"v(i4,i4,i4,i4,ptr)", invoke_v_i4_i4_i4_i4_ptr},
+    {"v(i4,i4,i4,ptr)", invoke_v_i4_i4_i4_ptr},
+    {"v(i4,i4,i4,ptr,i4)", invoke_v_i4_i4_i4_ptr_i4},
+    {"v(i4,i4,i4,ptr,ptr)", invoke_v_i4_i4_i4_ptr_ptr},
+    {"v(i4,i4,ptr)", invoke_v_i4_i4_ptr},
+    {"v(i4,i4,ptr,i4)", invoke_v_i4_i4_ptr_i4},
+    {"v(i4,i4,ptr,i4,i4)", invoke_v_i4_i4_ptr_i4_i4},
+    {"v(i4,i4,ptr,i4,ptr)", invoke_v_i4_i4_ptr_i4_ptr},
+    {"v(i4,i4,ptr,ptr)", invoke_v_i4_i4_ptr_ptr},
+    {"v(i4,i4,ptr,ptr,i4)", invoke_v_i4_i4_ptr_ptr_i4},
+    {"v(i4,i4,ptr,ptr,ptr)", invoke_v_i4_i4_ptr_ptr_ptr},
+    {"v(i4,i8)", invoke_v_i4_i8},
+    {"v(i4,ptr)", invoke_v_i4_ptr},
+    {"v(i4,ptr,i4)", invoke_v_i4_ptr_i4},
+    {"v(i4,ptr,i4,i4)", invoke_v_i4_ptr_i4_i4},
+    {"v(i4,ptr,i4,i4,i4)", invoke_v_i4_ptr_i4_i4_i4},
+    {"v(i4,ptr,i4,i4,ptr)", invoke_v_i4_ptr_i4_i4_ptr},
+    {"v(i4,ptr,i4,ptr)", invoke_v_i4_ptr_i4_ptr},
+    {"v(i4,ptr,i4,ptr,i4)", invoke_v_i4_ptr_i4_ptr_i4},
+    {"v(i4,ptr,i4,ptr,ptr)", invoke_v_i4_ptr_i4_ptr_ptr},
+    {"v(i4,ptr,ptr)", invoke_v_i4_ptr_ptr},
+    {"v(i4,ptr,ptr,i4)", invoke_v_i4_ptr_ptr_i4},
+    {"v(i4,ptr,ptr,i4,i4)", invoke_v_i4_ptr_ptr_i4_i4},
+    {"v(i4,ptr,ptr,i4,ptr)", invoke_v_i4_ptr_ptr_i4_ptr},
+    {"v(i4,ptr,ptr,ptr)", invoke_v_i4_ptr_ptr_ptr},
+    {"v(i4,ptr,ptr,ptr,i4)", invoke_v_i4_ptr_ptr_ptr_i4},
+    {"v(i4,ptr,ptr,ptr,ptr)", invoke_v_i4_ptr_ptr_ptr_ptr},
+    {"v(i4,r4)", invoke_v_i4_r4},
+    {"v(i4,r8)", invoke_v_i4_r8},
+    {"v(i8)", invoke_v_i8},
+    {"v(i8,i4)", invoke_v_i8_i4},
+    {"v(i8,i8)", invoke_v_i8_i8},
+    {"v(i8,ptr)", invoke_v_i8_ptr},
+    {"v(i8,r4)", invoke_v_i8_r4},
+    {"v(i8,r8)", invoke_v_i8_r8},
+    {"v(ptr)", invoke_v_ptr},
+    {"v(ptr,i4)", invoke_v_ptr_i4},
+    {"v(ptr,i4,i4)", invoke_v_ptr_i4_i4},
+    {"v(ptr,i4,i4,i4)", invoke_v_ptr_i4_i4_i4},
+    {"v(ptr,i4,i4,i4,i4)", invoke_v_ptr_i4_i4_i4_i4},
+    {"v(ptr,i4,i4,i4,ptr)", invoke_v_ptr_i4_i4_i4_ptr},
+    {"v(ptr,i4,i4,ptr)", invoke_v_ptr_i4_i4_ptr},
+    {"v(ptr,i4,i4,ptr,i4)", invoke_v_ptr_i4_i4_ptr_i4},
+    {"v(ptr,i4,i4,ptr,ptr)", invoke_v_ptr_i4_i4_ptr_ptr},
+    {"v(ptr,i4,ptr)", invoke_v_ptr_i4_ptr},
+    {"v(ptr,i4,ptr,i4)", invoke_v_ptr_i4_ptr_i4},
+    {"v(ptr,i4,ptr,i4,i4)", invoke_v_ptr_i4_ptr_i4_i4},
+    {"v(ptr,i4,ptr,i4,ptr)", invoke_v_ptr_i4_ptr_i4_ptr},
+    {"v(ptr,i4,ptr,ptr)", invoke_v_ptr_i4_ptr_ptr},
+    {"v(ptr,i4,ptr,ptr,i4)", invoke_v_ptr_i4_ptr_ptr_i4},
+    {"v(ptr,i4,ptr,ptr,ptr)", invoke_v_ptr_i4_ptr_ptr_ptr},
+    {"v(ptr,i8)", invoke_v_ptr_i8},
+    {"v(ptr,ptr)", invoke_v_ptr_ptr},
+    {"v(ptr,ptr,i4)", invoke_v_ptr_ptr_i4},
+    {"v(ptr,ptr,i4,i4)", invoke_v_ptr_ptr_i4_i4},
+    {"v(ptr,ptr,i4,i4,i4)", invoke_v_ptr_ptr_i4_i4_i4},
+    {"v(ptr,ptr,i4,i4,ptr)", invoke_v_ptr_ptr_i4_i4_ptr},
+    {"v(ptr,ptr,i4,ptr)", invoke_v_ptr_ptr_i4_ptr},
+    {"v(ptr,ptr,i4,ptr,i4)", invoke_v_ptr_ptr_i4_ptr_i4},
+    {"v(ptr,ptr,i4,ptr,ptr)", invoke_v_ptr_ptr_i4_ptr_ptr},
+    {"v(ptr,ptr,ptr)", invoke_v_ptr_ptr_ptr},
+    {"v(ptr,ptr,ptr,i4)", invoke_v_ptr_ptr_ptr_i4},
+    {"v(ptr,ptr,ptr,i4,i4)", invoke_v_ptr_ptr_ptr_i4_i4},
+    {"v(ptr,ptr,ptr,i4,ptr)", invoke_v_ptr_ptr_ptr_i4_ptr},
+    {"v(ptr,ptr,ptr,ptr)", invoke_v_ptr_ptr_ptr_ptr},
+    {"v(ptr,ptr,ptr,ptr,i4)", invoke_v_ptr_ptr_ptr_ptr_i4},
+    {"v(ptr,ptr,ptr,ptr,ptr)", invoke_v_ptr_ptr_ptr_ptr_ptr},
+    {"v(ptr,r4)", invoke_v_ptr_r4},
+    {"v(ptr,r8)", invoke_v_ptr_r8},
+    {"v(r4)", invoke_v_r4},
+    {"v(r4,i4)", invoke_v_r4_i4},
+    {"v(r4,i8)", invoke_v_r4_i8},
+    {"v(r4,ptr)", invoke_v_r4_ptr},
+    {"v(r4,r4)", invoke_v_r4_r4},
+    {"v(r4,r8)", invoke_v_r4_r8},
+    {"v(r8)", invoke_v_r8},
+    {"v(r8,i4)", invoke_v_r8_i4},
+    {"v(r8,i8)", invoke_v_r8_i8},
+    {"v(r8,ptr)", invoke_v_r8_ptr},
+    {"v(r8,r4)", invoke_v_r8_r4},
+    {"v(r8,r8)", invoke_v_r8_r8},
+
+    //}}PINVOKE_INVOKER_TABLE
+};
+
+PInvokeInvoker PInvokeInvokers::find(const char* signature)
+{
+    const PInvokeSignatureInvoker* begin = s_signature_invokers;
+    const PInvokeSignatureInvoker* end = begin + sizeof(s_signature_invokers) / sizeof(s_signature_invokers[0]);
+    const PInvokeSignatureInvoker* it =
+        std::lower_bound(begin, end, signature, [](const PInvokeSignatureInvoker& entry, const char* s) { return std::strcmp(entry.signature, s) < 0; });
+    return it != end && std::strcmp(it->signature, signature) == 0 ? it->invoker : nullptr;
+}
+
+int32_t PInvokeInvokers::normalize_i4_return(const metadata::RtMethodInfo* method, int32_t value)
+{
+    metadata::RtElementType ele_type = method->return_type->ele_type;
+    if (ele_type == metadata::RtElementType::ValueType)
+    {
+        // Binding already resolved the class, so this does not fail for a bound method.
+        auto ret = Class::get_class_from_typesig(method->return_type);
+        if (ret.is_ok() && Class::is_enum_type(ret.unwrap()))
+        {
+            ele_type = Class::get_enum_element_type(ret.unwrap());
+        }
+    }
+    switch (ele_type)
+    {
+    case metadata::RtElementType::I1:
+        return static_cast<int8_t>(value);
+    case metadata::RtElementType::U1:
+        return static_cast<uint8_t>(value);
+    case metadata::RtElementType::I2:
+        return static_cast<int16_t>(value);
+    case metadata::RtElementType::U2:
+    case metadata::RtElementType::Char:
+        return static_cast<uint16_t>(value);
+    case metadata::RtElementType::Boolean:
+        // bool is marshaled as a 4 byte BOOL.
+        return value != 0;
+    default:
+        return value;
+    }
+}
+
+} // namespace leanclr::vm
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "pinvoke.h"
+
+namespace leanclr::vm
+{
+
+// Invokers calling native functions of a signature class, as generated by src/generator/gen_pinvoke_invokers.py.
+// A signature class names the native type every parameter and the return value reduce to, e.g. "i4(ptr,i4,ptr)"
+// with the classes v, i4, i8, ptr, r4 and r8. The invokers call the function at their method_pointer argument.
+class PInvokeInvokers
+{
+  public:
+    // Gets the invoker of signature, or nullptr if none was generated for it.
+    static PInvokeInvoker find(const char* signature);
+
+    // Narrows a native int return value to the managed return type of method, whose upper bits the callee may leave undefined.
+    // Enums are narrowed to their underlying type.
+    static int32_t normalize_i4_return(const metadata::RtMethodInfo* method, int32_t value);
+};
+
+} // namespace leanclr::vm
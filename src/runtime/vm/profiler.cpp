@@ -0,0 +1,531 @@
+#include "profiler.h"
+
+#include "alloc/general_allocation.h"
+#include "interp/machine_state.h"
+#include "metadata/metadata_cache.h"
+#include "utils/hashmap.h"
+#include "utils/string_builder.h"
+
+#include <cstring>
+#include <string>
+
+#if LEANCLR_ENABLE_THREADS
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#ifdef LEANCLR_PLATFORM_WIN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <signal.h>
+#endif
+#endif
+
+namespace leanclr::vm
+{
+
+#if LEANCLR_ENABLE_THREADS
+
+constexpr uint32_t kMaxSampleFrames = 64;
+constexpr uint32_t kDefaultBufferSamples = 256;
+constexpr int32_t kMaxFrequencyHz = 10000;
+
+static void append_class_name(utils::StringBuilder& sb, const metadata::RtClass* klass)
+{
+    if (klass->declaring_class)
+    {
+        append_class_name(sb, klass->declaring_class);
+        sb.append_char('/');
+    }
+    else if (klass->namespaze && klass->namespaze[0])
+    {
+        sb.append_cstr(klass->namespaze);
+        sb.append_char('.');
+    }
+    sb.append_cstr(klass->name);
+}
+
+static void append_u64(utils::StringBuilder& sb, uint64_t value)
+{
+    char digits[20];
+    size_t count = 0;
+    do
+    {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (count > 0)
+    {
+        sb.append_char(static_cast<uint8_t>(digits[--count]));
+    }
+}
+
+static void append_frame(utils::StringBuilder& sb, const metadata::RtMethodInfo* method, int32_t il_offset, bool include_il_offset)
+{
+    if (!method)
+    {
+        sb.append_cstr("[unknown]");
+        return;
+    }
+    append_class_name(sb, method->parent);
+    sb.append_cstr("::");
+    sb.append_cstr(method->name);
+    if (include_il_offset && il_offset >= 0)
+    {
+        sb.append_cstr("@IL_");
+        if (il_offset > UINT16_MAX)
+        {
+            sb.append_hex(static_cast<uint8_t>(il_offset >> 24));
+            sb.append_hex(static_cast<uint8_t>(il_offset >> 16));
+        }
+        sb.append_hex(static_cast<uint8_t>(il_offset >> 8));
+        sb.append_hex(static_cast<uint8_t>(il_offset));
+    }
+}
+
+namespace
+{
+struct Sample
+{
+    uint32_t frame_count;
+    bool truncated;
+    // Innermost kMaxSampleFrames frames, outermost first.
+    const metadata::RtMethodInfo* methods[kMaxSampleFrames];
+    const uint8_t* ips[kMaxSampleFrames];
+};
+
+// Bounded single-producer single-consumer ring. On POSIX the producer is a signal handler, so pushing
+// neither allocates nor locks.
+class SampleRing
+{
+  public:
+    void init(uint32_t capacity)
+    {
+        _samples = alloc::GeneralAllocation::calloc_any<Sample>(capacity);
+        _mask = capacity - 1;
+        _head.store(0, std::memory_order_relaxed);
+        _tail.store(0, std::memory_order_relaxed);
+    }
+
+    void destroy()
+    {
+        alloc::GeneralAllocation::free(_samples);
+        _samples = nullptr;
+    }
+
+    Sample* begin_push()
+    {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) > _mask)
+        {
+            return nullptr;
+        }
+        return &_samples[head & _mask];
+    }
+
+    void end_push()
+    {
+        _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    const Sample* peek() const
+    {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+        return &_samples[tail & _mask];
+    }
+
+    void pop()
+    {
+        _tail.store(_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+  private:
+    Sample* _samples = nullptr;
+    uint32_t _mask = 0;
+    std::atomic<uint32_t> _head{0};
+    std::atomic<uint32_t> _tail{0};
+};
+
+// A frame as aggregated by the sampler thread: the method and its saved ip. Mapping ip to an IL offset
+// reads the interpreter data of the method, which the runtime thread creates and rewrites, so it waits for
+// write_collapsed_stacks on the runtime thread.
+struct StackFrameKey
+{
+    const metadata::RtMethodInfo* method;
+    const uint8_t* ip;
+};
+
+// A frame as written: the method and the IL offset its ip maps to.
+struct ResolvedFrameKey
+{
+    const metadata::RtMethodInfo* method;
+    int32_t il_offset;
+};
+} // namespace
+
+static SampleRing g_ring;
+static std::atomic<bool> g_sampling{false};
+static std::atomic<uint64_t> g_dropped_samples{0};
+static const interp::MachineState* g_machine_state = nullptr;
+
+static bool g_running = false;
+static std::atomic<bool> g_stop_requested{false};
+static std::thread g_sampler_thread;
+
+// Distinct stacks, encoded as a truncated flag followed by the StackFrameKeys, to sample counts.
+static std::mutex g_stacks_mutex;
+static utils::HashMap<std::string, uint64_t> g_stacks;
+static uint64_t g_sample_count = 0;
+
+#ifdef LEANCLR_PLATFORM_WIN
+static HANDLE g_target_thread = nullptr;
+#else
+static pthread_t g_target_thread;
+static bool g_signal_handler_installed = false;
+#endif
+
+// Runs on the runtime thread inside the SIGPROF handler on POSIX, or while it is suspended on Windows.
+static void capture_sample()
+{
+    Sample* sample = g_ring.begin_push();
+    if (!sample)
+    {
+        g_dropped_samples.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    size_t frame_count = g_machine_state->get_active_frame_count();
+    size_t first = frame_count > kMaxSampleFrames ? frame_count - kMaxSampleFrames : 0;
+    uint32_t count = static_cast<uint32_t>(frame_count - first);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const interp::InterpFrame& frame = *g_machine_state->get_active_frame(first + i);
+        sample->methods[i] = frame.method;
+        sample->ips[i] = frame.ip;
+    }
+    sample->frame_count = count;
+    sample->truncated = first > 0;
+    g_ring.end_push();
+}
+
+// Called from the sampler thread, and from the runtime thread by stop() and purge_unloading_modules().
+// g_stacks_mutex makes the callers take turns as the ring's single consumer.
+static void drain_samples()
+{
+    std::string key;
+    std::lock_guard<std::mutex> lock(g_stacks_mutex);
+    while (const Sample* sample = g_ring.peek())
+    {
+        key.clear();
+        key.push_back(sample->truncated ? 1 : 0);
+        for (uint32_t i = 0; i < sample->frame_count; ++i)
+        {
+            StackFrameKey frame = {sample->methods[i], sample->ips[i]};
+            key.append(reinterpret_cast<const char*>(&frame), sizeof(frame));
+        }
+        g_ring.pop();
+        ++g_stacks[key];
+        ++g_sample_count;
+    }
+}
+
+#ifdef LEANCLR_PLATFORM_WIN
+
+static bool attach_target_thread()
+{
+    return DuplicateHandle(GetCurrentProcess(), GetCurrentThread(), GetCurrentProcess(), &g_target_thread,
+                           THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT | THREAD_QUERY_INFORMATION, FALSE, 0) != FALSE;
+}
+
+static void detach_target_thread()
+{
+    CloseHandle(g_target_thread);
+    g_target_thread = nullptr;
+}
+
+static void request_sample()
+{
+    if (SuspendThread(g_target_thread) == static_cast<DWORD>(-1))
+    {
+        return;
+    }
+    // SuspendThread is asynchronous; fetching the context waits until the thread actually stopped.
+    CONTEXT context = {};
+    context.ContextFlags = CONTEXT_CONTROL;
+    if (GetThreadContext(g_target_thread, &context) && g_sampling.load(std::memory_order_acquire))
+    {
+        capture_sample();
+    }
+    ResumeThread(g_target_thread);
+}
+
+#else
+
+static void on_sigprof(int, siginfo_t*, void*)
+{
+    int saved_errno = errno;
+    if (g_sampling.load(std::memory_order_acquire))
+    {
+        capture_sample();
+    }
+    errno = saved_errno;
+}
+
+static bool attach_target_thread()
+{
+    g_target_thread = pthread_self();
+    if (g_signal_handler_installed)
+    {
+        return true;
+    }
+    // The handler stays installed after stop: a signal still in flight must not hit the default action,
+    // which terminates the process.
+    struct sigaction action = {};
+    action.sa_sigaction = on_sigprof;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    g_signal_handler_installed = sigaction(SIGPROF, &action, nullptr) == 0;
+    return g_signal_handler_installed;
+}
+
+static void detach_target_thread()
+{
+}
+
+static void request_sample()
+{
+    pthread_kill(g_target_thread, SIGPROF);
+}
+
+#endif
+
+static void sampler_main(std::chrono::microseconds period)
+{
+    auto next_tick = std::chrono::steady_clock::now() + period;
+    while (!g_stop_requested.load(std::memory_order_acquire))
+    {
+        std::this_thread::sleep_until(next_tick);
+        next_tick += period;
+        request_sample();
+        // On POSIX the sample just requested is usually picked up on the next tick.
+        drain_samples();
+    }
+}
+
+RtResultVoid Profiler::start(int32_t frequency_hz, int32_t buffer_samples)
+{
+    if (g_running)
+    {
+        RET_ERR(RtErr::InvalidOperation);
+    }
+    if (frequency_hz <= 0 || frequency_hz > kMaxFrequencyHz || buffer_samples < 0)
+    {
+        RET_ERR(RtErr::Argument);
+    }
+    if (!attach_target_thread())
+    {
+        RET_ERR(RtErr::ExecutionEngine);
+    }
+    uint32_t capacity = 1;
+    while (capacity < (buffer_samples > 0 ? static_cast<uint32_t>(buffer_samples) : kDefaultBufferSamples))
+    {
+        capacity <<= 1;
+    }
+    g_ring.init(capacity);
+    g_machine_state = &interp::MachineState::get_global_machine_state();
+    g_stop_requested.store(false, std::memory_order_relaxed);
+    g_sampling.store(true, std::memory_order_release);
+    g_running = true;
+    g_sampler_thread = std::thread(sampler_main, std::chrono::microseconds(1000000 / frequency_hz));
+    RET_VOID_OK();
+}
+
+void Profiler::stop()
+{
+    if (!g_running)
+    {
+        return;
+    }
+    g_stop_requested.store(true, std::memory_order_release);
+    g_sampler_thread.join();
+    g_sampling.store(false, std::memory_order_release);
+    drain_samples();
+    detach_target_thread();
+    g_ring.destroy();
+    g_running = false;
+}
+
+bool Profiler::is_running()
+{
+    return g_running;
+}
+
+void Profiler::purge_unloading_modules()
+{
+    // Samples still in the ring may hold methods of the unloading modules, so aggregate them while those
+    // can still be read. Later samples cannot: no method of the modules is running.
+    if (g_running)
+    {
+        drain_samples();
+    }
+    std::lock_guard<std::mutex> lock(g_stacks_mutex);
+    utils::HashMap<std::string, uint64_t> purged_stacks;
+    for (auto& [key, count] : g_stacks)
+    {
+        std::string purged_key = key;
+        for (size_t offset = 1; offset < purged_key.size(); offset += sizeof(StackFrameKey))
+        {
+            StackFrameKey frame;
+            std::memcpy(&frame, purged_key.data() + offset, sizeof(frame));
+            if (frame.method && metadata::MetadataCache::refers_to_unloading_module(frame.method))
+            {
+                // Counted as an unknown frame from now on, merging stacks that only differed in unloaded code.
+                frame = {nullptr, nullptr};
+                std::memcpy(&purged_key[offset], &frame, sizeof(frame));
+            }
+        }
+        purged_stacks[purged_key] += count;
+    }
+    g_stacks = std::move(purged_stacks);
+}
+
+void Profiler::reset()
+{
+    std::lock_guard<std::mutex> lock(g_stacks_mutex);
+    g_stacks.clear();
+    g_sample_count = 0;
+    g_dropped_samples.store(0, std::memory_order_relaxed);
+}
+
+uint64_t Profiler::get_sample_count()
+{
+    std::lock_guard<std::mutex> lock(g_stacks_mutex);
+    return g_sample_count;
+}
+
+uint64_t Profiler::get_dropped_sample_count()
+{
+    return g_dropped_samples.load(std::memory_order_relaxed);
+}
+
+static int32_t map_il_offset(const StackFrameKey& frame)
+{
+    // Native and intrinsic frames have no codes, and a frame that has not made a call yet has no ip.
+    return frame.method ? interp::InterpDefs::get_il_offset(frame.method->interp_data, frame.ip) : -1;
+}
+
+size_t Profiler::write_collapsed_stacks(char* buffer, size_t buffer_size, bool include_il_offsets)
+{
+    // Stacks sampled at different ips of the same blocks, or of the same methods without IL offsets, merge.
+    utils::HashMap<std::string, uint64_t> resolved_stacks;
+    {
+        std::lock_guard<std::mutex> lock(g_stacks_mutex);
+        std::string resolved_key;
+        for (const auto& [key, count] : g_stacks)
+        {
+            resolved_key.assign(1, key[0]);
+            for (size_t offset = 1; offset < key.size(); offset += sizeof(StackFrameKey))
+            {
+                StackFrameKey frame;
+                std::memcpy(&frame, key.data() + offset, sizeof(frame));
+                ResolvedFrameKey resolved = {frame.method, include_il_offsets ? map_il_offset(frame) : -1};
+                resolved_key.append(reinterpret_cast<const char*>(&resolved.method), sizeof(resolved.method));
+                resolved_key.append(reinterpret_cast<const char*>(&resolved.il_offset), sizeof(resolved.il_offset));
+            }
+            resolved_stacks[resolved_key] += count;
+        }
+    }
+
+    utils::StringBuilder sb;
+    for (const auto& [key, count] : resolved_stacks)
+    {
+        const char* cur = key.data() + 1;
+        const char* end = key.data() + key.size();
+        bool first_frame = true;
+        if (key[0])
+        {
+            sb.append_cstr("[truncated]");
+            first_frame = false;
+        }
+        while (cur < end)
+        {
+            ResolvedFrameKey frame;
+            std::memcpy(&frame.method, cur, sizeof(frame.method));
+            std::memcpy(&frame.il_offset, cur + sizeof(frame.method), sizeof(frame.il_offset));
+            cur += sizeof(frame.method) + sizeof(frame.il_offset);
+            if (!first_frame)
+            {
+                sb.append_char(';');
+            }
+            append_frame(sb, frame.method, frame.il_offset, include_il_offsets);
+            first_frame = false;
+        }
+        if (first_frame)
+        {
+            // Sampled outside of any managed frame.
+            sb.append_cstr("[native]");
+        }
+        sb.append_char(' ');
+        append_u64(sb, count);
+        sb.append_char('\n');
+    }
+    size_t required = sb.length() + 1;
+    if (buffer && required <= buffer_size)
+    {
+        std::memcpy(buffer, sb.as_cstr(), sb.length());
+        buffer[sb.length()] = 0;
+    }
+    return required;
+}
+
+#else
+
+RtResultVoid Profiler::start(int32_t, int32_t)
+{
+    RET_ERR(RtErr::NotImplemented);
+}
+
+void Profiler::stop()
+{
+}
+
+bool Profiler::is_running()
+{
+    return false;
+}
+
+void Profiler::purge_unloading_modules()
+{
+}
+
+void Profiler::reset()
+{
+}
+
+uint64_t Profiler::get_sample_count()
+{
+    return 0;
+}
+
+uint64_t Profiler::get_dropped_sample_count()
+{
+    return 0;
+}
+
+size_t Profiler::write_collapsed_stacks(char* buffer, size_t buffer_size, bool)
+{
+    if (buffer && buffer_size > 0)
+    {
+        buffer[0] = 0;
+    }
+    return 1;
+}
+
+#endif
+
+} // namespace leanclr::vm
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "rt_managed_types.h"
+
+namespace leanclr::vm
+{
+
+// Sampling profiler over the interpreter frame stack.
+//
+// A sampler thread interrupts the runtime thread at a fixed frequency (SIGPROF delivered with pthread_kill
+// on POSIX, SuspendThread on Windows) and copies the active InterpFrames, method and saved ip, into a
+// lock-free single-producer single-consumer ring. The sampler thread drains the ring between ticks into
+// per-stack counts that are printed as collapsed stacks, the input format of flamegraph.pl.
+//
+// Samples keep the raw saved ip; it is mapped to an IL offset only when stacks are written, on the runtime
+// thread, since the interpreter data it is looked up in is not safe to read from the sampler thread.
+// Frames only save ip at call sites, so IL offsets are those of the basic block holding the call, or of
+// the last call made by the innermost frame. Not available in builds without thread support.
+class Profiler
+{
+  public:
+    // Starts sampling the calling thread, which must be the runtime thread. buffer_samples bounds the
+    // samples pending between two drains; samples that do not fit are counted as dropped.
+    static RtResultVoid start(int32_t frequency_hz, int32_t buffer_samples);
+    static void stop();
+    static bool is_running();
+
+    // Discards the samples collected so far.
+    static void reset();
+
+    // Turns the frames of methods of unloading modules into unknown frames, since their names go away with
+    // the modules.
+    static void purge_unloading_modules();
+
+    static uint64_t get_sample_count();
+    static uint64_t get_dropped_sample_count();
+
+    // Writes one "Frame;Frame;... count" line per distinct stack, outermost frame first, and returns the
+    // number of bytes the text takes including the terminating zero. Nothing is written if that is more
+    // than buffer_size. Must be called on the runtime thread.
+    static size_t write_collapsed_stacks(char* buffer, size_t buffer_size, bool include_il_offsets);
+};
+
+} // namespace leanclr::vm
@@ -207,6 +207,15 @@ static RtResult<RtArray*> invoke_new_array(const metadata::RtMethodInfo* method,
         RET_ERR(RtErr::Argument);
     }
 }
+
+// Reflection objects are cached for the lifetime of the runtime, so they are counted apart from the rest of
+// the GC heap.
+static RtResult<RtObject*> new_reflection_object(metadata::RtClass* klass)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, obj, Object::new_object(klass));
+    alloc::MemoryStats::reclassify(alloc::MemoryCategory::GCHeap, alloc::MemoryCategory::Reflection, alloc::GeneralAllocation::get_allocation_size(obj));
+    RET_OK(obj);
+}
 } // namespace
 
 RtResult<RtReflectionType*> Reflection::get_type_reflection_object(const metadata::RtTypeSig* type_sig)
@@ -222,7 +231,7 @@ RtResult<RtReflectionType*> Reflection::get_type_reflection_object(const metadat
     }
 
     auto runtime_type_klass = Class::get_corlib_types().cls_runtimetype;
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, Object::new_object(runtime_type_klass));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, new_reflection_object(runtime_type_klass));
     auto ref_obj = reinterpret_cast<RtReflectionType*>(ref_obj_raw);
 
     s_class_reflection_type_map.emplace(pooled_type_sig, ref_obj);
@@ -246,7 +255,7 @@ RtResult<RtReflectionMethod*> Reflection::get_method_reflection_object(const met
 
     auto corlib_types = Class::get_corlib_types();
     auto runtime_method_klass = Method::is_ctor_or_cctor(method) ? corlib_types.cls_reflection_constructor : corlib_types.cls_reflection_method;
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, Object::new_object(runtime_method_klass));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, new_reflection_object(runtime_method_klass));
     auto ref_obj = reinterpret_cast<RtReflectionMethod*>(ref_obj_raw);
     ref_obj->method = method;
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtReflectionType*, ref_type, get_klass_reflection_object(reflection_at_klass));
@@ -273,7 +282,7 @@ RtResult<RtArray*> Reflection::get_param_objects(const metadata::RtMethodInfo* m
     auto ass = method->parent->image;
     for (size_t i = 0; i < param_count; ++i)
     {
-        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, param_obj_base, Object::new_object(param_info_klass));
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, param_obj_base, new_reflection_object(param_info_klass));
         auto param_info_obj = reinterpret_cast<RtReflectionParameter*>(param_obj_base);
 
         const metadata::RtTypeSig* param_type_sig = method->parameters[i];
@@ -306,7 +315,7 @@ RtResult<RtReflectionField*> Reflection::get_field_reflection_object(const metad
 
     auto corlib_types = Class::get_corlib_types();
     auto runtime_field_klass = corlib_types.cls_reflection_field;
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, Object::new_object(runtime_field_klass));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, new_reflection_object(runtime_field_klass));
     auto ref_obj = reinterpret_cast<RtReflectionField*>(ref_obj_raw);
     ref_obj->field = field;
     ref_obj->klass = reflection_at_klass;
@@ -329,7 +338,7 @@ RtResult<RtReflectionProperty*> Reflection::get_property_reflection_object(const
 
     auto corlib_types = Class::get_corlib_types();
     auto runtime_prop_klass = corlib_types.cls_reflection_property;
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, Object::new_object(runtime_prop_klass));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, new_reflection_object(runtime_prop_klass));
     auto ref_obj = reinterpret_cast<RtReflectionProperty*>(ref_obj_raw);
     ref_obj->property = prop;
     ref_obj->klass = reflection_at_klass;
@@ -348,7 +357,7 @@ RtResult<RtReflectionEventInfo*> Reflection::get_event_reflection_object(metadat
 
     auto corlib_types = Class::get_corlib_types();
     auto runtime_event_klass = corlib_types.cls_reflection_event;
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, Object::new_object(runtime_event_klass));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, new_reflection_object(runtime_event_klass));
     auto ref_obj = reinterpret_cast<RtReflectionEventInfo*>(ref_obj_raw);
     ref_obj->event = event_info;
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtReflectionType*, ref_type, get_klass_reflection_object(reflection_at_klass));
@@ -367,13 +376,53 @@ RtResult<RtReflectionAssembly*> Reflection::get_assembly_reflection_object(metad
 
     auto corlib_types = Class::get_corlib_types();
     auto runtime_assembly_klass = corlib_types.cls_reflection_assembly;
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, Object::new_object(runtime_assembly_klass));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, new_reflection_object(runtime_assembly_klass));
     auto ref_obj = reinterpret_cast<RtReflectionAssembly*>(ref_obj_raw);
     ref_obj->assembly = assembly;
     s_assembly_reflection_map.emplace(assembly, ref_obj);
     RET_OK(ref_obj);
 }
 
+void Reflection::purge_unloading_modules()
+{
+    using metadata::MetadataCache;
+    utils::erase_if(s_class_reflection_type_map, [](const auto& entry) { return MetadataCache::refers_to_unloading_module(entry.first); });
+    utils::erase_if(s_method_reflection_map, [](const auto& entry)
+                    { return MetadataCache::refers_to_unloading_module(entry.first.method) || MetadataCache::refers_to_unloading_module(entry.first.klass); });
+    utils::erase_if(s_method_params_map, [](const auto& entry)
+                    { return MetadataCache::refers_to_unloading_module(entry.first.method) || MetadataCache::refers_to_unloading_module(entry.first.klass); });
+    utils::erase_if(s_field_reflection_map,
+                    [](const auto& entry)
+                    {
+                        return MetadataCache::refers_to_unloading_module(entry.first.field->parent) ||
+                               MetadataCache::refers_to_unloading_module(entry.first.klass);
+                    });
+    utils::erase_if(s_property_reflection_map,
+                    [](const auto& entry)
+                    {
+                        return MetadataCache::refers_to_unloading_module(entry.first.property->parent) ||
+                               MetadataCache::refers_to_unloading_module(entry.first.klass);
+                    });
+    utils::erase_if(s_event_reflection_map,
+                    [](const auto& entry)
+                    {
+                        return MetadataCache::refers_to_unloading_module(entry.first.event_info->parent) ||
+                               MetadataCache::refers_to_unloading_module(entry.first.klass);
+                    });
+    utils::erase_if(s_assembly_reflection_map, [](const auto& entry) { return entry.first->mod->is_unloading(); });
+    utils::erase_if(s_module_reflection_map, [](const auto& entry) { return entry.first->is_unloading(); });
+    utils::erase_if(s_assembly_name_map,
+                    [](const auto& entry)
+                    {
+                        if (!entry.first->mod->is_unloading())
+                        {
+                            return false;
+                        }
+                        alloc::GeneralAllocation::free(entry.second);
+                        return true;
+                    });
+}
+
 RtResult<metadata::RtMonoAssemblyName*> Reflection::get_assembly_name_object(metadata::RtAssembly* ass)
 {
     auto found = s_assembly_name_map.find(ass);
@@ -398,7 +447,7 @@ RtResult<RtReflectionModule*> Reflection::get_module_reflection_object(metadata:
 
     auto corlib_types = Class::get_corlib_types();
     auto runtime_module_klass = corlib_types.cls_reflection_module;
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, Object::new_object(runtime_module_klass));
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, ref_obj_raw, new_reflection_object(runtime_module_klass));
     auto ref_obj = reinterpret_cast<RtReflectionModule*>(ref_obj_raw);
 
     ref_obj->image = mod;
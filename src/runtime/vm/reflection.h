@@ -17,6 +17,8 @@ class Reflection
     static RtResult<RtReflectionAssembly*> get_assembly_reflection_object(metadata::RtAssembly* assembly);
     static RtResult<metadata::RtMonoAssemblyName*> get_assembly_name_object(metadata::RtAssembly* ass);
     static RtResult<RtReflectionModule*> get_module_reflection_object(metadata::RtModuleDef* mod);
+    // Forgets the reflection objects of metadata that refers to an unloading module.
+    static void purge_unloading_modules();
     static RtResult<RtObject*> invoke_method(const metadata::RtMethodInfo* method, RtObject* obj, RtArray* params, RtObject** out_ex);
 };
 } // namespace leanclr::vm
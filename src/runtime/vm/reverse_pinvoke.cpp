@@ -0,0 +1,602 @@
+#include "reverse_pinvoke.h"
+
+#include <type_traits>
+#include <utility>
+
+#include "class.h"
+#include "gchandle.h"
+#include "rt_exception.h"
+#include "runtime.h"
+#include "interp/interp_defs.h"
+#include "metadata/metadata_cache.h"
+#include "utils/hashmap.h"
+
+namespace leanclr::vm
+{
+
+namespace
+{
+#if LEANCLR_ARCH_64BIT && !defined(LEANCLR_PLATFORM_WASM)
+// The 64-bit ABIs (x64 System V and Windows, arm64) pass the first four arguments in registers, integers in
+// full general purpose registers and floats in the low bits of vector registers. Declaring integers as
+// intptr_t and floats as double reads the same registers, so two classes cover every signature. The upper
+// bits are garbage and dropped when converting to the managed type.
+enum NativeClass : size_t
+{
+    Word,
+    Real,
+    NATIVE_CLASS_COUNT,
+};
+
+constexpr size_t INT32_CLASS = Word;
+constexpr size_t INT64_CLASS = Word;
+constexpr size_t POINTER_CLASS = Word;
+constexpr size_t FLOAT_CLASS = Real;
+constexpr size_t DOUBLE_CLASS = Real;
+
+static_assert(LEANCLR_REVERSE_PINVOKE_MAX_PARAMS <= 4, "Widened thunk parameters must all be passed in registers");
+#else
+// 32-bit ABIs lay arguments out by size and wasm checks call signatures exactly, so each type is its own class.
+enum NativeClass : size_t
+{
+    I4,
+    I8,
+    R4,
+    R8,
+    NATIVE_CLASS_COUNT,
+};
+
+constexpr size_t INT32_CLASS = I4;
+constexpr size_t INT64_CLASS = I8;
+constexpr size_t POINTER_CLASS = sizeof(void*) == 8 ? I8 : I4;
+constexpr size_t FLOAT_CLASS = R4;
+constexpr size_t DOUBLE_CLASS = R8;
+#endif
+
+constexpr size_t MAX_PARAMS = LEANCLR_REVERSE_PINVOKE_MAX_PARAMS;
+constexpr size_t THUNKS_PER_SIGNATURE = LEANCLR_REVERSE_PINVOKE_THUNKS_PER_SIGNATURE;
+// Return classes are the native classes shifted by one, void being 0.
+constexpr size_t RETURN_CLASS_COUNT = NATIVE_CLASS_COUNT + 1;
+// Weak, as in System.Runtime.InteropServices.GCHandleType.
+constexpr int32_t WEAK_HANDLE_TYPE = 0;
+
+// Parameter lists are numbered by length, then by their classes read as a base NATIVE_CLASS_COUNT number with
+// the first parameter as the most significant digit.
+constexpr size_t get_param_list_count()
+{
+    size_t total = 0;
+    size_t lists = 1;
+    for (size_t i = 0; i <= MAX_PARAMS; ++i)
+    {
+        total += lists;
+        lists *= NATIVE_CLASS_COUNT;
+    }
+    return total;
+}
+
+constexpr size_t get_list_param_count(size_t list)
+{
+    size_t count = 0;
+    for (size_t lists = 1; list >= lists; lists *= NATIVE_CLASS_COUNT)
+    {
+        list -= lists;
+        ++count;
+    }
+    return count;
+}
+
+constexpr size_t get_list_code(size_t list)
+{
+    for (size_t lists = 1; list >= lists; lists *= NATIVE_CLASS_COUNT)
+    {
+        list -= lists;
+    }
+    return list;
+}
+
+constexpr size_t PARAM_LIST_COUNT = get_param_list_count();
+constexpr size_t SIGNATURE_COUNT = RETURN_CLASS_COUNT * PARAM_LIST_COUNT;
+
+template <size_t Class>
+struct NativeType;
+
+#if LEANCLR_ARCH_64BIT && !defined(LEANCLR_PLATFORM_WASM)
+template <>
+struct NativeType<Word>
+{
+    using type = intptr_t;
+};
+
+template <>
+struct NativeType<Real>
+{
+    using type = double;
+};
+#else
+template <>
+struct NativeType<I4>
+{
+    using type = int32_t;
+};
+
+template <>
+struct NativeType<I8>
+{
+    using type = int64_t;
+};
+
+template <>
+struct NativeType<R4>
+{
+    using type = float;
+};
+
+template <>
+struct NativeType<R8>
+{
+    using type = double;
+};
+#endif
+
+template <size_t ReturnClass>
+struct NativeReturnType
+{
+    using type = typename NativeType<ReturnClass - 1>::type;
+};
+
+template <>
+struct NativeReturnType<0>
+{
+    using type = void;
+};
+
+// Native values travel in stack objects between the thunks and invoke_bound_delegate: integers sign extended
+// to 64 bits and floats in their own member, so a float widened to double keeps its bits in f32.
+template <typename T>
+interp::RtStackObject to_stack_object(T value)
+{
+    interp::RtStackObject obj;
+    obj.value = 0;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        obj.f32 = value;
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        obj.f64 = value;
+    }
+    else
+    {
+        obj.i64 = static_cast<int64_t>(value);
+    }
+    return obj;
+}
+
+template <typename T>
+T from_stack_object(const interp::RtStackObject& obj)
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        return obj.f32;
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        return obj.f64;
+    }
+    else
+    {
+        return static_cast<T>(obj.i64);
+    }
+}
+
+struct ThunkSlot
+{
+    // Weak handle to the bound delegate, nullptr while the thunk is free.
+    void* delegate_handle;
+    // Key of the binding in g_delegate_thunks, still valid after the delegate is collected.
+    const RtDelegate* delegate;
+    const metadata::RtMethodInfo* invoke;
+    // Set when the last strong GCHandle to the delegate was freed. The thunk stays bound, but is taken back
+    // once its pool has no free thunk left.
+    bool retired;
+};
+
+void invoke_bound_delegate(const ThunkSlot& slot, const interp::RtStackObject* native_args, interp::RtStackObject* native_ret);
+
+template <size_t ReturnClass, size_t... ParamClasses>
+struct ThunkPool
+{
+    using ReturnType = typename NativeReturnType<ReturnClass>::type;
+
+    static inline ThunkSlot s_slots[THUNKS_PER_SIGNATURE];
+
+    template <size_t Slot>
+    static ReturnType thunk(typename NativeType<ParamClasses>::type... args)
+    {
+        // The trailing element keeps the array non-empty for parameterless signatures.
+        interp::RtStackObject native_args[] = {to_stack_object(args)..., {}};
+        interp::RtStackObject native_ret;
+        invoke_bound_delegate(s_slots[Slot], native_args, &native_ret);
+        if constexpr (!std::is_void_v<ReturnType>)
+        {
+            return from_stack_object<ReturnType>(native_ret);
+        }
+    }
+
+    template <size_t... Slots>
+    static void* const* get_thunks(std::index_sequence<Slots...>)
+    {
+        static void* const thunks[] = {reinterpret_cast<void*>(&thunk<Slots>)...};
+        return thunks;
+    }
+};
+
+// Peels the digits of Code off into ParamClasses, last parameter first.
+template <size_t ReturnClass, size_t Count, size_t Code, size_t... ParamClasses>
+struct ThunkPoolOf
+{
+    using type = typename ThunkPoolOf<ReturnClass, Count - 1, Code / NATIVE_CLASS_COUNT, Code % NATIVE_CLASS_COUNT, ParamClasses...>::type;
+};
+
+template <size_t ReturnClass, size_t Code, size_t... ParamClasses>
+struct ThunkPoolOf<ReturnClass, 0, Code, ParamClasses...>
+{
+    using type = ThunkPool<ReturnClass, ParamClasses...>;
+};
+
+struct ThunkPoolInfo
+{
+    ThunkSlot* slots;
+    void* const* thunks;
+};
+
+template <size_t Signature>
+ThunkPoolInfo make_thunk_pool_info()
+{
+    constexpr size_t list = Signature % PARAM_LIST_COUNT;
+    using Pool = typename ThunkPoolOf<Signature / PARAM_LIST_COUNT, get_list_param_count(list), get_list_code(list)>::type;
+    return {Pool::s_slots, Pool::get_thunks(std::make_index_sequence<THUNKS_PER_SIGNATURE>())};
+}
+
+template <size_t... Signatures>
+const ThunkPoolInfo* make_thunk_pools(std::index_sequence<Signatures...>)
+{
+    static const ThunkPoolInfo pools[] = {make_thunk_pool_info<Signatures>()...};
+    return pools;
+}
+
+const ThunkPoolInfo& get_thunk_pool(size_t signature)
+{
+    static const ThunkPoolInfo* pools = make_thunk_pools(std::make_index_sequence<SIGNATURE_COUNT>());
+    return pools[signature];
+}
+
+utils::HashMap<const RtDelegate*, void*> g_delegate_thunks;
+utils::HashMap<void*, ThunkSlot*> g_thunk_slots;
+
+bool is_boolean(const metadata::RtTypeSig* type_sig)
+{
+    return type_sig->ele_type == metadata::RtElementType::Boolean && !type_sig->is_by_ref();
+}
+
+RtResult<size_t> get_native_class(metadata::RtArgOrLocOrFieldReduceType reduce_type, const metadata::RtTypeSig* type_sig)
+{
+    // Blittable by-ref parameters are passed as plain pointers.
+    if (type_sig->is_by_ref())
+    {
+        RET_OK(POINTER_CLASS);
+    }
+    switch (reduce_type)
+    {
+    case metadata::RtArgOrLocOrFieldReduceType::I1:
+    case metadata::RtArgOrLocOrFieldReduceType::U1:
+    case metadata::RtArgOrLocOrFieldReduceType::I2:
+    case metadata::RtArgOrLocOrFieldReduceType::U2:
+    case metadata::RtArgOrLocOrFieldReduceType::I4:
+        RET_OK(INT32_CLASS);
+    case metadata::RtArgOrLocOrFieldReduceType::I8:
+        RET_OK(INT64_CLASS);
+    case metadata::RtArgOrLocOrFieldReduceType::I:
+        RET_OK(POINTER_CLASS);
+    case metadata::RtArgOrLocOrFieldReduceType::R4:
+        RET_OK(FLOAT_CLASS);
+    case metadata::RtArgOrLocOrFieldReduceType::R8:
+        RET_OK(DOUBLE_CLASS);
+    default:
+        // References need marshaling and structs by value have ABI specific layouts.
+        RET_ERR(RtErr::NotSupported);
+    }
+}
+
+RtResult<size_t> get_signature(const metadata::RtMethodInfo* invoke)
+{
+    size_t param_count = invoke->parameter_count;
+    if (param_count > MAX_PARAMS)
+    {
+        RET_ERR(RtErr::NotSupported);
+    }
+    size_t return_class = 0;
+    if (!invoke->return_type->is_void())
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(interp::ReduceTypeAndSize, ret_type,
+                                                interp::InterpDefs::get_reduce_type_and_size_by_typesig(invoke->return_type));
+        if (invoke->return_type->is_by_ref())
+        {
+            RET_ERR(RtErr::NotSupported);
+        }
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(size_t, native_class, get_native_class(ret_type.reduce_type, invoke->return_type));
+        return_class = native_class + 1;
+    }
+    size_t list = 0;
+    size_t lists = 1;
+    size_t code = 0;
+    for (size_t i = 0; i < param_count; ++i)
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(size_t, native_class, get_native_class(invoke->arg_descs[i].reduce_type, invoke->parameters[i]));
+        code = code * NATIVE_CLASS_COUNT + native_class;
+        list += lists;
+        lists *= NATIVE_CLASS_COUNT;
+    }
+    RET_OK(return_class * PARAM_LIST_COUNT + list + code);
+}
+
+interp::RtStackObject to_managed(metadata::RtArgOrLocOrFieldReduceType reduce_type, const metadata::RtTypeSig* type_sig,
+                                 const interp::RtStackObject& native)
+{
+    interp::RtStackObject managed;
+    managed.value = 0;
+    switch (reduce_type)
+    {
+    case metadata::RtArgOrLocOrFieldReduceType::I1:
+        managed.i32 = native.i8;
+        break;
+    case metadata::RtArgOrLocOrFieldReduceType::U1:
+        // bool is marshaled as a 4 byte BOOL.
+        managed.i32 = is_boolean(type_sig) ? native.i32 != 0 : native.u8;
+        break;
+    case metadata::RtArgOrLocOrFieldReduceType::I2:
+        managed.i32 = native.i16;
+        break;
+    case metadata::RtArgOrLocOrFieldReduceType::U2:
+        managed.i32 = native.u16;
+        break;
+    case metadata::RtArgOrLocOrFieldReduceType::I4:
+        managed.i32 = native.i32;
+        break;
+    case metadata::RtArgOrLocOrFieldReduceType::R4:
+        managed.f32 = native.f32;
+        break;
+    default:
+        managed.i64 = native.i64;
+        break;
+    }
+    return managed;
+}
+
+interp::RtStackObject to_native(metadata::RtArgOrLocOrFieldReduceType reduce_type, const metadata::RtTypeSig* type_sig,
+                                const interp::RtStackObject& managed)
+{
+    interp::RtStackObject native;
+    native.value = 0;
+    switch (reduce_type)
+    {
+    case metadata::RtArgOrLocOrFieldReduceType::I1:
+        native.i64 = managed.i8;
+        break;
+    case metadata::RtArgOrLocOrFieldReduceType::U1:
+        native.i64 = is_boolean(type_sig) ? managed.u8 != 0 : managed.u8;
+        break;
+    case metadata::RtArgOrLocOrFieldReduceType::I2:
+        native.i64 = managed.i16;
+        break;
+    case metadata::RtArgOrLocOrFieldReduceType::U2:
+        native.i64 = managed.u16;
+        break;
+    case metadata::RtArgOrLocOrFieldReduceType::I4:
+        native.i64 = managed.i32;
+        break;
+    case metadata::RtArgOrLocOrFieldReduceType::R4:
+        native.f32 = managed.f32;
+        break;
+    case metadata::RtArgOrLocOrFieldReduceType::I:
+        native.i64 = reinterpret_cast<intptr_t>(managed.ptr);
+        break;
+    default:
+        native = managed;
+        break;
+    }
+    return native;
+}
+
+void invoke_bound_delegate(const ThunkSlot& slot, const interp::RtStackObject* native_args, interp::RtStackObject* native_ret)
+{
+    native_ret->value = 0;
+    const metadata::RtMethodInfo* invoke = slot.invoke;
+    interp::RtStackObject args[MAX_PARAMS + 1];
+    args[0].obj = slot.delegate_handle ? GCHandle::get_target(slot.delegate_handle) : nullptr;
+    for (size_t i = 0; i < invoke->parameter_count; ++i)
+    {
+        args[i + 1] = to_managed(invoke->arg_descs[i].reduce_type, invoke->parameters[i], native_args[i]);
+    }
+    interp::RtStackObject ret;
+    ret.value = 0;
+    auto result = Runtime::invoke_stackobject_arguments_with_run_cctor(invoke, args, &ret);
+    if (result.is_err())
+    {
+        // Exceptions cannot unwind through the native caller.
+        RtException* ex = Exception::raise_error_as_exception(result.unwrap_err(), nullptr, nullptr);
+        Exception::get_and_clear_current_exception();
+        Exception::report_unhandled_exception(ex);
+        return;
+    }
+    if (!invoke->return_type->is_void())
+    {
+        auto ret_type = interp::InterpDefs::get_reduce_type_and_size_by_typesig(invoke->return_type);
+        *native_ret = to_native(ret_type.unwrap().reduce_type, invoke->return_type, ret);
+    }
+}
+
+void release_slot(ThunkSlot* slot)
+{
+    GCHandle::free_handle(slot->delegate_handle);
+    g_delegate_thunks.erase(slot->delegate);
+    *slot = {};
+}
+
+RtDelegate* get_bound_delegate(const ThunkSlot& slot)
+{
+    return slot.delegate_handle ? reinterpret_cast<RtDelegate*>(GCHandle::get_target(slot.delegate_handle)) : nullptr;
+}
+
+bool is_single_cast(const RtDelegate* delegate)
+{
+    return !Class::is_multicastdelegate_subclass(delegate->klass) || !reinterpret_cast<const RtMulticastDelegate*>(delegate)->deles;
+}
+
+// Native callers cannot tell apart delegates of one class calling the same method on the same target, so
+// those share a thunk. Delegates recreated for every native call then take a single thunk.
+bool is_same_callee(const RtDelegate* a, const RtDelegate* b)
+{
+    return a->klass == b->klass && a->method == b->method && a->target == b->target && is_single_cast(a) && is_single_cast(b);
+}
+
+ThunkSlot* find_same_callee_slot(const ThunkPoolInfo& pool, const RtDelegate* delegate)
+{
+    for (size_t i = 0; i < THUNKS_PER_SIGNATURE; ++i)
+    {
+        RtDelegate* bound = get_bound_delegate(pool.slots[i]);
+        if (bound && is_same_callee(bound, delegate))
+        {
+            return &pool.slots[i];
+        }
+    }
+    return nullptr;
+}
+
+ThunkSlot* find_free_slot(const ThunkPoolInfo& pool)
+{
+    for (size_t i = 0; i < THUNKS_PER_SIGNATURE; ++i)
+    {
+        if (!pool.slots[i].delegate_handle)
+        {
+            return &pool.slots[i];
+        }
+    }
+    // Take back the thunks of collected delegates, then those of retired ones.
+    ThunkSlot* free_slot = nullptr;
+    for (size_t i = 0; i < THUNKS_PER_SIGNATURE; ++i)
+    {
+        ThunkSlot* slot = &pool.slots[i];
+        if (!GCHandle::get_target(slot->delegate_handle))
+        {
+            release_slot(slot);
+            free_slot = slot;
+        }
+    }
+    for (size_t i = 0; i < THUNKS_PER_SIGNATURE && !free_slot; ++i)
+    {
+        ThunkSlot* slot = &pool.slots[i];
+        if (slot->retired)
+        {
+            release_slot(slot);
+            free_slot = slot;
+        }
+    }
+    return free_slot;
+}
+} // namespace
+
+RtResult<void*> ReversePInvoke::get_function_pointer(RtDelegate* delegate)
+{
+    if (!delegate)
+    {
+        RET_ERR(RtErr::ArgumentNull);
+    }
+    auto it = g_delegate_thunks.find(delegate);
+    if (it != g_delegate_thunks.end())
+    {
+        ThunkSlot* slot = g_thunk_slots[it->second];
+        RtDelegate* bound = get_bound_delegate(*slot);
+        if (bound == delegate || (bound && is_same_callee(bound, delegate)))
+        {
+            slot->retired = false;
+            RET_OK(it->second);
+        }
+        // A new delegate at the address of a collected one, or one whose shared thunk was taken back.
+        if (slot->delegate == delegate)
+        {
+            release_slot(slot);
+        }
+        else
+        {
+            g_delegate_thunks.erase(it);
+        }
+    }
+
+    const metadata::RtMethodInfo* invoke = Class::get_method_for_name(delegate->klass, "Invoke", false);
+    if (!invoke)
+    {
+        RET_ERR(RtErr::MissingMethod);
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(size_t, signature, get_signature(invoke));
+    const ThunkPoolInfo& pool = get_thunk_pool(signature);
+    ThunkSlot* slot = find_same_callee_slot(pool, delegate);
+    if (slot)
+    {
+        slot->retired = false;
+        void* thunk = pool.thunks[slot - pool.slots];
+        g_delegate_thunks[delegate] = thunk;
+        RET_OK(thunk);
+    }
+    slot = find_free_slot(pool);
+    if (!slot)
+    {
+        RET_ERR(RtErr::OutOfMemory);
+    }
+    slot->delegate_handle = GCHandle::get_target_handle(delegate, nullptr, WEAK_HANDLE_TYPE);
+    slot->delegate = delegate;
+    slot->invoke = invoke;
+    void* thunk = pool.thunks[slot - pool.slots];
+    g_delegate_thunks[delegate] = thunk;
+    g_thunk_slots[thunk] = slot;
+    RET_OK(thunk);
+}
+
+void ReversePInvoke::retire_delegate(const RtDelegate* delegate)
+{
+    auto it = g_delegate_thunks.find(delegate);
+    if (it != g_delegate_thunks.end())
+    {
+        g_thunk_slots[it->second]->retired = true;
+    }
+}
+
+RtDelegate* ReversePInvoke::get_delegate(void* ptr)
+{
+    auto it = g_thunk_slots.find(ptr);
+    if (it == g_thunk_slots.end() || !it->second->delegate_handle)
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<RtDelegate*>(GCHandle::get_target(it->second->delegate_handle));
+}
+
+void ReversePInvoke::purge_unloading_modules()
+{
+    for (auto& entry : g_thunk_slots)
+    {
+        ThunkSlot* slot = entry.second;
+        if (!slot->delegate_handle)
+        {
+            continue;
+        }
+        RtDelegate* delegate = reinterpret_cast<RtDelegate*>(GCHandle::get_target(slot->delegate_handle));
+        if (metadata::MetadataCache::refers_to_unloading_module(slot->invoke) ||
+            (delegate && delegate->method && metadata::MetadataCache::refers_to_unloading_module(delegate->method)))
+        {
+            release_slot(slot);
+        }
+    }
+}
+
+} // namespace leanclr::vm
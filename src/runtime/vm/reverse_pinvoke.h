@@ -0,0 +1,33 @@
+#pragma once
+
+#include "rt_managed_types.h"
+
+namespace leanclr::vm
+{
+
+// Native entry points for delegates handed to native code, as returned by Marshal.GetFunctionPointerForDelegate.
+// Since the interpreter cannot emit code, the entry points are precompiled thunks, grouped in pools by the
+// native classes of their parameters and return value. A thunk packs its native arguments into stack objects
+// and calls the Invoke method of the delegate bound to it.
+class ReversePInvoke
+{
+  public:
+    // Gets the thunk calling delegate, binding a free one on first use. Delegates calling the same method on
+    // the same target share their thunk. The thunk stays bound as long as the delegate is alive and not
+    // retired. Delegates taking or returning references or structs by value, or taking more parameters than
+    // the thunks have, are not supported.
+    static RtResult<void*> get_function_pointer(RtDelegate* delegate);
+
+    // Marks the thunk of delegate, if any, as no longer called by native code. Called when a strong GCHandle to
+    // the delegate is freed, the way native callbacks are kept alive. The thunk keeps working until its pool
+    // runs out of free thunks.
+    static void retire_delegate(const RtDelegate* delegate);
+
+    // Gets the delegate bound to the thunk at ptr, or nullptr if ptr is not a bound thunk.
+    static RtDelegate* get_delegate(void* ptr);
+
+    // Unbinds the thunks of delegates whose class or target method belongs to an unloading module.
+    static void purge_unloading_modules();
+};
+
+} // namespace leanclr::vm
@@ -309,7 +309,7 @@ RtResult<int32_t> Array::get_global_index_from_indices(const RtArray* arr, RtArr
             const ArrayBounds* bound = &bounds[i];
             int32_t index_relate_to_lower = idx - bound->lower_bound;
 
-            if (index_relate_to_lower >= bound->length)
+            if (index_relate_to_lower < 0 || index_relate_to_lower >= bound->length)
             {
                 RET_ERR(core::RtErr::IndexOutOfRange);
             }
@@ -348,7 +348,7 @@ RtResult<int32_t> Array::get_mdarray_global_index_from_indices2(const RtArray* a
         const ArrayBounds* bound = &bounds[i];
         int32_t index_relate_to_lower = idx - bound->lower_bound;
 
-        if (index_relate_to_lower >= bound->length)
+        if (index_relate_to_lower < 0 || index_relate_to_lower >= bound->length)
         {
             RET_ERR(core::RtErr::IndexOutOfRange);
         }
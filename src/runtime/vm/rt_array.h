@@ -71,6 +71,27 @@ class Array
     static RtResult<int32_t> get_global_index_from_indices(const RtArray* arr, RtArray* indices);
     static RtResult<int32_t> get_mdarray_global_index_from_indices2(const RtArray* arr, const interp::RtStackObject* indices);
 
+    // Row-major index of arr[indices[0], ..., indices[Rank - 1]] for an array of rank Rank, or -1 if an index lies
+    // outside its dimension. The lower bound is folded into a single unsigned range check per dimension.
+    template <size_t Rank>
+    static int32_t get_mdarray_global_index(const RtArray* arr, const interp::RtStackObject* indices)
+    {
+        assert(arr && arr->bounds);
+        const ArrayBounds* bounds = arr->bounds;
+        uint32_t index = 0;
+        for (size_t i = 0; i < Rank; ++i)
+        {
+            uint32_t relative = static_cast<uint32_t>(indices[i].i32) - static_cast<uint32_t>(bounds[i].lower_bound);
+            uint32_t length = static_cast<uint32_t>(bounds[i].length);
+            if (relative >= length)
+            {
+                return -1;
+            }
+            index = index * length + relative;
+        }
+        return static_cast<int32_t>(index);
+    }
+
     // Method invoker implementations
     static RtResultVoid szarray_new_invoker(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
                                             const interp::RtStackObject* params, interp::RtStackObject* ret);
@@ -1,14 +1,17 @@
 
 #include "rt_string.h"
 #include "gc/garbage_collector.h"
+#include "alloc/general_allocation.h"
 #include "class.h"
 #include "field.h"
-#include "utf8/utf8.h"
+#include "metadata/module_def.h"
 #include <vector>
 #include <string>
 #include <cstring>
-#include "utils/hashset.h"
+#include "utils/hashmap.h"
 #include "utils/hash_util.h"
+#include "utils/string_kernels.h"
+#include "utils/utf8_transcoder.h"
 
 namespace leanclr::vm
 {
@@ -41,7 +44,10 @@ struct RtStringEqual
 };
 } // namespace
 
-static utils::HashSet<RtString*, RtStringHash, RtStringEqual> g_internTable;
+// Interned instances to the number of collectible modules that interned them, or PINNED_INTERN_REFS once code
+// that is never unloaded did.
+constexpr uint32_t PINNED_INTERN_REFS = UINT32_MAX;
+static utils::HashMap<RtString*, uint32_t, RtStringHash, RtStringEqual> g_internTable;
 
 // Removed key builder; Hash/Eq operate directly on RtString contents
 
@@ -118,37 +124,16 @@ RtString* String::create_string_from_utf16chars(const uint16_t* str, int32_t len
 
 RtString* String::create_string_from_utf8chars(const char* str, int32_t length)
 {
-    // First, convert UTF-8 to UTF-16 and count characters
-    utils::Vector<uint16_t> utf16_buffer;
-    utf16_buffer.reserve(static_cast<size_t>(length)); // Reserve space (UTF-16 could be shorter or longer)
-
-    const char* start = str;
-    const char* end = str + static_cast<size_t>(length);
-
-    while (start < end)
-    {
-        uint32_t codepoint = utf8::unchecked::next(start);
-        utf8::unchecked::append16(codepoint, std::back_inserter(utf16_buffer));
-    }
-
-    return create_string_from_utf16chars(utf16_buffer.data(), static_cast<int32_t>(utf16_buffer.size()));
+    // Measure first so the string is allocated once at its exact length and decoded in place.
+    size_t utf16_length = utils::Utf8Transcoder::get_utf16_length(str, static_cast<size_t>(length));
+    RtString* newString = fast_allocate_string(static_cast<int32_t>(utf16_length));
+    utils::Utf8Transcoder::utf8_to_utf16(str, static_cast<size_t>(length), &newString->first_char, utf16_length);
+    return newString;
 }
 
 int32_t String::get_hash_code(RtString* str)
 {
-    int32_t hash = 5381;
-    const Utf16Char* char_data_ptr = &str->first_char;
-    const int32_t* int32_data_ptr = reinterpret_cast<const int32_t*>(char_data_ptr);
-    assert((size_t)int32_data_ptr % 4 == 0);
-    for (int32_t i = 0, n = str->length / 2; i < n; ++i)
-    {
-        hash = ((hash << 5) + hash) + int32_data_ptr[i];
-    }
-    if (str->length % 2 != 0)
-    {
-        hash = ((hash << 5) + hash) + static_cast<int32_t>(char_data_ptr[str->length - 1]);
-    }
-    return hash;
+    return utils::StringKernels::hash_code(&str->first_char, static_cast<size_t>(str->length));
 }
 
 RtString* String::fast_allocate_string(int32_t length)
@@ -162,15 +147,40 @@ RtString* String::fast_allocate_string(int32_t length)
     return newString;
 }
 
-RtString* String::intern_string(RtString* s)
+RtString* String::intern_string(RtString* s, metadata::RtModuleDef* mod)
 {
     if (s == nullptr)
         return s;
     auto it = g_internTable.find(s);
-    if (it != g_internTable.end())
-        return *it;
-    g_internTable.emplace(s);
-    return s;
+    if (it == g_internTable.end())
+    {
+        it = g_internTable.emplace(s, 0).first;
+        alloc::MemoryStats::reclassify(alloc::MemoryCategory::GCHeap, alloc::MemoryCategory::InternedStrings, alloc::GeneralAllocation::get_allocation_size(s));
+    }
+    if (mod == nullptr || !mod->is_collectible())
+    {
+        it->second = PINNED_INTERN_REFS;
+    }
+    else if (it->second != PINNED_INTERN_REFS && mod->add_interned_string(it->first))
+    {
+        ++it->second;
+    }
+    return it->first;
+}
+
+void String::release_interned_strings(metadata::RtModuleDef* mod)
+{
+    for (RtString* s : mod->get_interned_strings())
+    {
+        auto it = g_internTable.find(s);
+        assert(it != g_internTable.end() && it->first == s);
+        if (it->second == PINNED_INTERN_REFS || --it->second > 0)
+        {
+            continue;
+        }
+        g_internTable.erase(it);
+        alloc::MemoryStats::reclassify(alloc::MemoryCategory::InternedStrings, alloc::MemoryCategory::GCHeap, alloc::GeneralAllocation::get_allocation_size(s));
+    }
 }
 
 bool String::is_interned_string(RtString* s)
@@ -64,7 +64,12 @@ class String
 
     // Runtime helpers mirrored from Rust vm::string
     static RtString* fast_allocate_string(int32_t length); // Declaration retained
-    static RtString* intern_string(RtString* s);
+    // Interns s on behalf of the code of mod. Entries interned by a collectible module are counted per module and
+    // only leave the table once every module that interned them is unloaded; a null or non-collectible mod
+    // keeps the entry for the lifetime of the runtime.
+    static RtString* intern_string(RtString* s, metadata::RtModuleDef* mod);
     static bool is_interned_string(RtString* s);
+    // Releases the entries interned by mod, which is being unloaded.
+    static void release_interned_strings(metadata::RtModuleDef* mod);
 };
 } // namespace leanclr::vm
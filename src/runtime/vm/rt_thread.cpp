@@ -4,6 +4,11 @@
 #include "rt_managed_types.h"
 #include "alloc/general_allocation.h"
 
+#if LEANCLR_ENABLE_THREADS
+#include <chrono>
+#include <thread>
+#endif
+
 namespace leanclr::vm
 {
 static RtThread* g_current_thread = nullptr;
@@ -100,13 +105,25 @@ RtResultVoid Thread::free_internal_thread(vm::RtInternalThread* this_thread)
 
 void Thread::sleep(int32_t milliseconds)
 {
+#if LEANCLR_ENABLE_THREADS
+    if (milliseconds > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+    }
+#else
     // No-op for wasm
+#endif
 }
 
 bool Thread::yield_internal()
 {
+#if LEANCLR_ENABLE_THREADS
+    std::this_thread::yield();
+    return true;
+#else
     // No-op for wasm
     return false;
+#endif
 }
 
 void Thread::set_state(RtInternalThread* thread, RtThreadState state)
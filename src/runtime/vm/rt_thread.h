@@ -33,7 +33,7 @@ class Thread
     static RtResultVoid construct_internal_thread(RtThread* thread);
     static RtResultVoid free_internal_thread(vm::RtInternalThread* this_thread);
 
-    // Sleep for milliseconds (no-op on wasm)
+    // Sleep for milliseconds (no-op on wasm); does not dispatch managed work, see TimerScheduler::sleep
     static void sleep(int32_t milliseconds);
 
     // Yield thread (returns false on wasm)
@@ -17,6 +17,8 @@
 #include "object.h"
 #include "environment.h"
 #include "settings.h"
+#include "profiler.h"
+#include "thread_pool.h"
 
 #include "metadata/metadata_cache.h"
 #include "metadata/module_def.h"
@@ -391,6 +393,8 @@ RtResultVoid Runtime::initialize()
 void Runtime::shutdown()
 {
     // todo: implement shutdown logic
+    Profiler::stop();
+    ThreadPool::shutdown();
 }
 
 RtResultVoid Runtime::run_class_static_constructor(metadata::RtClass* klass)
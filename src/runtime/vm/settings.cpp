@@ -10,8 +10,13 @@ static InternalFunctionInitializer g_internal_functions_initializer = nullptr;
 static int32_t g_cmd_argc = 0;
 static const char** g_cmd_argv = nullptr;
 
-static size_t g_default_eval_stack_object_count = 1024 * 128;
-static size_t g_default_frame_stack_size = 1024 * 2;
+static size_t g_default_eval_stack_object_count = 1024 * 1024;
+static size_t g_default_frame_stack_size = 1024 * 64;
+static size_t g_eval_stack_segment_object_count = 1024 * 16;
+static size_t g_frame_stack_segment_size = 256;
+static bool g_machine_stack_shrink_enabled = false;
+static bool g_generic_sharing_enabled = true;
+static int32_t g_thread_pool_worker_count = 0;
 
 static DebuggerLogFunc g_debugger_log_function = default_debugger_log_function;
 
@@ -50,6 +55,26 @@ void Settings::set_assembly_loader(AssemblyLoaderFunc loader)
     g_assembly_loader = loader;
 }
 
+void Settings::set_generic_sharing_enabled(bool enabled)
+{
+    g_generic_sharing_enabled = enabled;
+}
+
+bool Settings::is_generic_sharing_enabled()
+{
+    return g_generic_sharing_enabled;
+}
+
+void Settings::set_thread_pool_worker_count(int32_t count)
+{
+    g_thread_pool_worker_count = count;
+}
+
+int32_t Settings::get_thread_pool_worker_count()
+{
+    return g_thread_pool_worker_count;
+}
+
 void Settings::set_internal_functions_initializer(InternalFunctionInitializer initializer)
 {
     g_internal_functions_initializer = initializer;
@@ -112,4 +137,34 @@ void Settings::set_default_frame_stack_size(size_t size)
     g_default_frame_stack_size = size;
 }
 
+size_t Settings::get_eval_stack_segment_object_count()
+{
+    return g_eval_stack_segment_object_count;
+}
+
+void Settings::set_eval_stack_segment_object_count(size_t count)
+{
+    g_eval_stack_segment_object_count = count;
+}
+
+size_t Settings::get_frame_stack_segment_size()
+{
+    return g_frame_stack_segment_size;
+}
+
+void Settings::set_frame_stack_segment_size(size_t size)
+{
+    g_frame_stack_segment_size = size;
+}
+
+void Settings::set_machine_stack_shrink_enabled(bool enabled)
+{
+    g_machine_stack_shrink_enabled = enabled;
+}
+
+bool Settings::is_machine_stack_shrink_enabled()
+{
+    return g_machine_stack_shrink_enabled;
+}
+
 } // namespace leanclr::vm
@@ -21,11 +21,36 @@ class Settings
     static void set_command_line_arguments(int32_t argc, const char** argv);
     static void get_command_line_arguments(int32_t& argc, const char**& argv);
 
+    // Limits of the interpreter eval stack, in stack objects, and frame stack, in frames. Overflowing
+    // them raises StackOverflowException. Both stacks grow in segments as deep as they get, so the limits
+    // cost no memory until used. Only take effect before the runtime initializes.
     static size_t get_default_eval_stack_object_count();
     static void set_default_eval_stack_object_count(size_t count);
     static size_t get_default_frame_stack_size();
     static void set_default_frame_stack_size(size_t size);
 
+    // Sizes of the segments the stacks grow by. Frames needing a larger eval stack get a segment of their
+    // size, and the frame segment size is rounded up to a power of two.
+    static size_t get_eval_stack_segment_object_count();
+    static void set_eval_stack_segment_object_count(size_t count);
+    static size_t get_frame_stack_segment_size();
+    static void set_frame_stack_segment_size(size_t size);
+
+    // When enabled, stack segments more than one past the top are freed as frames return, so that memory
+    // follows the current depth rather than the deepest one reached. Disabled by default.
+    static void set_machine_stack_shrink_enabled(bool enabled);
+    static bool is_machine_stack_shrink_enabled();
+
+    // When enabled, instantiations of a generic method over reference types only share the interpreter
+    // code transformed for the System.Object instantiation. Enabled by default.
+    static void set_generic_sharing_enabled(bool enabled);
+    static bool is_generic_sharing_enabled();
+
+    // Number of native worker threads of the thread pool. 0, the default, uses one worker per hardware
+    // thread besides the runtime thread. Only takes effect before the pool first starts.
+    static void set_thread_pool_worker_count(int32_t count);
+    static int32_t get_thread_pool_worker_count();
+
     static void set_internal_functions_initializer(InternalFunctionInitializer initializer);
     static InternalFunctionInitializer get_internal_functions_initializer();
 
@@ -79,6 +79,7 @@ RtResultVoid fn_pinvoke_invoker(metadata::RtManagedMethodPointer method_pointer,
     RET_ERR(core::RtErr::NotImplemented);
 }
 
+#if !LEANCLR_ENABLE_DYNAMIC_PINVOKE
 // Not implemented PInvoke invoker
 RtResultVoid fn_not_implemented_pinvoke_invoker(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
                                                 const interp::RtStackObject* params, interp::RtStackObject* ret)
@@ -90,6 +91,7 @@ RtResultVoid fn_not_implemented_pinvoke_invoker(metadata::RtManagedMethodPointer
 #endif
     RET_ERR(core::RtErr::NotImplemented);
 }
+#endif
 
 // Not implemented runtime impl invoker
 RtResultVoid fn_not_implemented_runtime_impl_invoker(metadata::RtManagedMethodPointer method_pointer, const metadata::RtMethodInfo* method,
@@ -257,7 +259,11 @@ RtResult<InvokeTypeAndMethod> Shim::get_invoker(const metadata::RtMethodInfo* me
             }
             else
             {
+#if LEANCLR_ENABLE_DYNAMIC_PINVOKE
+                RET_OK(InvokeTypeAndMethod(RtInvokerType::DynamicPInvoke, PInvokes::dynamic_pinvoke_invoker));
+#else
                 RET_OK(InvokeTypeAndMethod(RtInvokerType::PInvoke, fn_not_implemented_pinvoke_invoker));
+#endif
             }
         }
 
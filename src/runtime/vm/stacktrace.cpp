@@ -30,12 +30,10 @@ RtResultVoid StackTrace::setup_trace_ips(RtException* ex)
         RET_VOID_OK();
     }
     auto& ms = interp::MachineState::get_global_machine_state();
-    auto frames = ms.get_active_frames();
-
     utils::Vector<const interp::InterpFrame*> trace_frames;
-    for (size_t i = 0; i < frames.size(); ++i)
+    for (size_t i = 0, frame_count = ms.get_active_frame_count(); i < frame_count; ++i)
     {
-        const interp::InterpFrame* frame = &frames[i];
+        const interp::InterpFrame* frame = ms.get_active_frame(i);
         if (is_frame_should_be_counted_to_stacktrace(frame))
         {
             trace_frames.push_back(frame);
@@ -62,15 +60,14 @@ RtResult<bool> StackTrace::get_frame_info(int32_t skip, bool need_file_info, RtR
                                           RtString** file_name, int32_t* line_number, int32_t* column_number)
 {
     auto& ms = interp::MachineState::get_global_machine_state();
-    auto frames = ms.get_active_frames();
-    size_t frame_count = frames.size();
+    size_t frame_count = ms.get_active_frame_count();
     skip -= 1; // Skip method from StackFrame
     if (skip >= static_cast<int32_t>(frame_count))
     {
         RET_OK(false);
     }
 
-    const interp::InterpFrame* frame = &frames[frame_count - 1 - skip];
+    const interp::InterpFrame* frame = ms.get_active_frame(frame_count - 1 - skip);
     UNWRAP_OR_RET_ERR_ON_FAIL(*method, Reflection::get_method_reflection_object(frame->method, frame->method->parent));
 
     *il_offset = -1;
@@ -0,0 +1,603 @@
+#include "thread_pool.h"
+
+#include "class.h"
+#include "monitor.h"
+#include "runtime.h"
+#include "settings.h"
+#include "alloc/general_allocation.h"
+#include "metadata/module_def.h"
+#include "utils/rt_vector.h"
+
+#include <algorithm>
+
+#if LEANCLR_ENABLE_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace leanclr::vm
+{
+
+#if LEANCLR_ENABLE_THREADS
+
+namespace
+{
+struct WorkItem
+{
+    ThreadPoolWorkFunc func;
+    void* arg;
+};
+
+// Chase-Lev work-stealing deque, after "Correct and Efficient Work-Stealing for Weak Memory Models"
+// (Le et al., PPoPP 2013). Only the owning worker calls push and take; any thread may call steal.
+class WorkStealingDeque
+{
+  public:
+    WorkStealingDeque() : _top(0), _bottom(0), _buffer(create_buffer(kInitialCapacity))
+    {
+    }
+
+    ~WorkStealingDeque()
+    {
+        alloc::GeneralAllocation::free(_buffer.load(std::memory_order_relaxed));
+        for (Buffer* retired : _retired_buffers)
+        {
+            alloc::GeneralAllocation::free(retired);
+        }
+    }
+
+    void push(const WorkItem& item)
+    {
+        int64_t b = _bottom.load(std::memory_order_relaxed);
+        int64_t t = _top.load(std::memory_order_acquire);
+        Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+        if (b - t > buffer->mask)
+        {
+            buffer = grow(buffer, t, b);
+        }
+        buffer->store(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        _bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    bool take(WorkItem& item)
+    {
+        int64_t b = _bottom.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+        _bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = _top.load(std::memory_order_relaxed);
+        if (t > b)
+        {
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        item = buffer->load(b);
+        if (t == b)
+        {
+            // Last item: race the thieves for it.
+            bool won = _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    bool steal(WorkItem& item)
+    {
+        int64_t t = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = _bottom.load(std::memory_order_acquire);
+        if (t >= b)
+        {
+            return false;
+        }
+        Buffer* buffer = _buffer.load(std::memory_order_acquire);
+        item = buffer->load(t);
+        // A torn read of the slot only happens when the owner wrapped around past t, in which case
+        // top has moved on and the exchange fails.
+        return _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+  private:
+    static constexpr int64_t kInitialCapacity = 64;
+
+    struct Slot
+    {
+        std::atomic<ThreadPoolWorkFunc> func;
+        std::atomic<void*> arg;
+    };
+
+    struct Buffer
+    {
+        int64_t mask;
+        Slot slots[1];
+
+        void store(int64_t index, const WorkItem& item)
+        {
+            Slot& slot = slots[index & mask];
+            slot.func.store(item.func, std::memory_order_relaxed);
+            slot.arg.store(item.arg, std::memory_order_relaxed);
+        }
+
+        WorkItem load(int64_t index) const
+        {
+            const Slot& slot = slots[index & mask];
+            return WorkItem{slot.func.load(std::memory_order_relaxed), slot.arg.load(std::memory_order_relaxed)};
+        }
+    };
+
+    static Buffer* create_buffer(int64_t capacity)
+    {
+        size_t size = sizeof(Buffer) + sizeof(Slot) * static_cast<size_t>(capacity - 1);
+        Buffer* buffer = static_cast<Buffer*>(alloc::GeneralAllocation::malloc_zeroed(size));
+        buffer->mask = capacity - 1;
+        return buffer;
+    }
+
+    Buffer* grow(Buffer* old_buffer, int64_t top, int64_t bottom)
+    {
+        Buffer* buffer = create_buffer((old_buffer->mask + 1) * 2);
+        for (int64_t i = top; i < bottom; ++i)
+        {
+            buffer->store(i, old_buffer->load(i));
+        }
+        _buffer.store(buffer, std::memory_order_release);
+        // Thieves may still be reading the old buffer, so it lives until the deque is destroyed.
+        _retired_buffers.push_back(old_buffer);
+        return buffer;
+    }
+
+    alignas(64) std::atomic<int64_t> _top;
+    alignas(64) std::atomic<int64_t> _bottom;
+    std::atomic<Buffer*> _buffer;
+    utils::Vector<Buffer*> _retired_buffers;
+};
+
+struct Worker
+{
+    WorkStealingDeque deque;
+    std::thread thread;
+    uint32_t steal_seed;
+};
+
+constexpr int32_t kSpinRoundsBeforeParking = 64;
+
+utils::Vector<Worker*> g_workers;
+// Guards starting and stopping the workers, so that the pool can be started again after a shutdown.
+std::mutex g_start_mutex;
+std::atomic<bool> g_started{false};
+std::atomic<bool> g_stopping{false};
+
+// Work queued from threads outside the pool.
+std::mutex g_injection_mutex;
+utils::Vector<WorkItem> g_injection_queue;
+size_t g_injection_head = 0;
+
+// Items queued and not yet taken, and workers parked waiting for them.
+std::atomic<int64_t> g_pending_items{0};
+std::atomic<int32_t> g_parked_workers{0};
+std::mutex g_park_mutex;
+std::condition_variable g_park_cv;
+
+thread_local Worker* t_current_worker = nullptr;
+
+bool pop_injected(WorkItem& item)
+{
+    std::lock_guard<std::mutex> lock(g_injection_mutex);
+    if (g_injection_head == g_injection_queue.size())
+    {
+        return false;
+    }
+    item = g_injection_queue[g_injection_head++];
+    if (g_injection_head == g_injection_queue.size())
+    {
+        g_injection_queue.clear();
+        g_injection_head = 0;
+    }
+    return true;
+}
+
+bool steal_from_others(Worker* self, WorkItem& item)
+{
+    size_t count = g_workers.size();
+    if (count == 0)
+    {
+        return false;
+    }
+    // xorshift to spread thieves over the victims
+    uint32_t seed = self ? self->steal_seed : static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&item));
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    if (self)
+    {
+        self->steal_seed = seed;
+    }
+    size_t start = seed % count;
+    for (size_t i = 0; i < count; ++i)
+    {
+        Worker* victim = g_workers[(start + i) % count];
+        if (victim != self && victim->deque.steal(item))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool find_work(Worker* self, WorkItem& item)
+{
+    if ((self && self->deque.take(item)) || pop_injected(item) || steal_from_others(self, item))
+    {
+        g_pending_items.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void wake_parked_worker()
+{
+    if (g_parked_workers.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> lock(g_park_mutex);
+        g_park_cv.notify_one();
+    }
+}
+
+void park()
+{
+    std::unique_lock<std::mutex> lock(g_park_mutex);
+    g_parked_workers.fetch_add(1, std::memory_order_seq_cst);
+    // Pairs with the increment of g_pending_items in queue_work: either the producer sees this worker
+    // parked and notifies it, or this worker sees the pending item and does not wait.
+    g_park_cv.wait(lock, [] { return g_pending_items.load(std::memory_order_seq_cst) > 0 || g_stopping.load(std::memory_order_relaxed); });
+    g_parked_workers.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void worker_main(Worker* self)
+{
+    t_current_worker = self;
+    int32_t idle_rounds = 0;
+    while (!g_stopping.load(std::memory_order_relaxed))
+    {
+        WorkItem item;
+        if (find_work(self, item))
+        {
+            idle_rounds = 0;
+            item.func(item.arg);
+            continue;
+        }
+        if (++idle_rounds < kSpinRoundsBeforeParking)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        idle_rounds = 0;
+        park();
+    }
+    t_current_worker = nullptr;
+}
+
+int32_t compute_worker_count()
+{
+    int32_t count = Settings::get_thread_pool_worker_count();
+    if (count <= 0)
+    {
+        count = static_cast<int32_t>(std::thread::hardware_concurrency()) - 1;
+    }
+    return count > 0 ? count : 1;
+}
+
+void start_workers()
+{
+    int32_t count = compute_worker_count();
+    g_workers.reserve(static_cast<size_t>(count));
+    for (int32_t i = 0; i < count; ++i)
+    {
+        Worker* worker = alloc::GeneralAllocation::new_any<Worker>();
+        worker->steal_seed = 0x9E3779B9u * static_cast<uint32_t>(i + 1);
+        g_workers.push_back(worker);
+    }
+    // Workers index g_workers when stealing, so it must be complete before any of them runs.
+    for (Worker* worker : g_workers)
+    {
+        worker->thread = std::thread(worker_main, worker);
+    }
+    g_started.store(true, std::memory_order_release);
+}
+
+void ensure_started()
+{
+    if (!g_started.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(g_start_mutex);
+        if (!g_started.load(std::memory_order_relaxed))
+        {
+            start_workers();
+        }
+    }
+}
+} // namespace
+
+void ThreadPool::queue_work(ThreadPoolWorkFunc func, void* arg)
+{
+    ensure_started();
+    WorkItem item{func, arg};
+    g_pending_items.fetch_add(1, std::memory_order_seq_cst);
+    if (t_current_worker)
+    {
+        t_current_worker->deque.push(item);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(g_injection_mutex);
+        g_injection_queue.push_back(item);
+    }
+    wake_parked_worker();
+}
+
+namespace
+{
+struct ParallelForState
+{
+    ThreadPoolForFunc func;
+    void* ctx;
+    int64_t end;
+    int64_t chunk_size;
+    std::atomic<int64_t> next;
+    std::atomic<int32_t> running_helpers;
+};
+
+void run_parallel_for_chunks(ParallelForState* state)
+{
+    for (;;)
+    {
+        int64_t begin = state->next.fetch_add(state->chunk_size, std::memory_order_relaxed);
+        if (begin >= state->end)
+        {
+            return;
+        }
+        int64_t end = std::min(begin + state->chunk_size, state->end);
+        for (int64_t i = begin; i < end; ++i)
+        {
+            state->func(state->ctx, i);
+        }
+    }
+}
+
+void parallel_for_helper(void* arg)
+{
+    ParallelForState* state = static_cast<ParallelForState*>(arg);
+    run_parallel_for_chunks(state);
+    state->running_helpers.fetch_sub(1, std::memory_order_release);
+}
+} // namespace
+
+void ThreadPool::parallel_for(int64_t begin, int64_t end, ThreadPoolForFunc func, void* ctx)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+    int32_t helper_count = get_worker_count();
+    int64_t count = end - begin;
+    ParallelForState state;
+    state.func = func;
+    state.ctx = ctx;
+    state.end = end;
+    // Several chunks per participant so that uneven iterations still balance out.
+    state.chunk_size = std::max<int64_t>(1, count / ((helper_count + 1) * 4));
+    state.next.store(begin, std::memory_order_relaxed);
+    helper_count = static_cast<int32_t>(std::min<int64_t>(helper_count, (count + state.chunk_size - 1) / state.chunk_size - 1));
+    state.running_helpers.store(helper_count, std::memory_order_relaxed);
+    for (int32_t i = 0; i < helper_count; ++i)
+    {
+        queue_work(parallel_for_helper, &state);
+    }
+    run_parallel_for_chunks(&state);
+    // Helpers that have not started yet still hold a pointer to state; run other work while waiting.
+    while (state.running_helpers.load(std::memory_order_acquire) > 0)
+    {
+        WorkItem item;
+        if (find_work(t_current_worker, item))
+        {
+            item.func(item.arg);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+int32_t ThreadPool::get_worker_count()
+{
+    ensure_started();
+    return static_cast<int32_t>(g_workers.size());
+}
+
+void ThreadPool::shutdown()
+{
+    std::lock_guard<std::mutex> start_lock(g_start_mutex);
+    if (!g_started.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_park_mutex);
+        g_stopping.store(true, std::memory_order_relaxed);
+        g_park_cv.notify_all();
+    }
+    for (Worker* worker : g_workers)
+    {
+        worker->thread.join();
+        alloc::GeneralAllocation::delete_any(worker);
+    }
+    g_workers.clear();
+    g_injection_queue.clear();
+    g_injection_head = 0;
+    g_pending_items.store(0, std::memory_order_relaxed);
+    // The next queue_work starts a fresh set of workers instead of queueing work nobody runs.
+    g_stopping.store(false, std::memory_order_relaxed);
+    g_started.store(false, std::memory_order_release);
+}
+
+static int32_t get_hardware_thread_count()
+{
+    int32_t count = static_cast<int32_t>(std::thread::hardware_concurrency());
+    return count > 0 ? count : 1;
+}
+
+#else
+
+void ThreadPool::queue_work(ThreadPoolWorkFunc func, void* arg)
+{
+    func(arg);
+}
+
+void ThreadPool::parallel_for(int64_t begin, int64_t end, ThreadPoolForFunc func, void* ctx)
+{
+    for (int64_t i = begin; i < end; ++i)
+    {
+        func(ctx, i);
+    }
+}
+
+int32_t ThreadPool::get_worker_count()
+{
+    return 0;
+}
+
+void ThreadPool::shutdown()
+{
+}
+
+static int32_t get_hardware_thread_count()
+{
+    return 1;
+}
+
+#endif
+
+// Managed work items. The corlib keeps its own work queue and asks the VM for a worker thread whenever
+// it has items; each request is answered by one call to _ThreadPoolWaitCallback.PerformWaitCallback,
+// which dispatches queued items until the queue is empty or its quantum expires.
+
+constexpr int32_t kMaxManagedDispatchDepth = 8;
+constexpr int32_t kManagedMaxWorkerThreads = 1023;
+constexpr int32_t kManagedMaxCompletionPortThreads = 1000;
+
+static int32_t g_managed_pending_requests = 0;
+static int32_t g_managed_dispatch_depth = 0;
+static int32_t g_managed_busy_workers = 0;
+static int32_t g_managed_min_worker_threads = 0;
+static int32_t g_managed_min_completion_port_threads = 0;
+static int32_t g_managed_max_worker_threads = kManagedMaxWorkerThreads;
+static int32_t g_managed_max_completion_port_threads = kManagedMaxCompletionPortThreads;
+static const metadata::RtMethodInfo* g_perform_wait_callback_method = nullptr;
+
+static RtResult<const metadata::RtMethodInfo*> get_perform_wait_callback_method()
+{
+    if (!g_perform_wait_callback_method)
+    {
+        metadata::RtModuleDef* corlib = metadata::RtModuleDef::get_corlib_module();
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, klass, corlib->get_class_by_name("System.Threading._ThreadPoolWaitCallback", false, true));
+        const metadata::RtMethodInfo* method = Class::get_method_for_name(klass, "PerformWaitCallback", false);
+        if (!method)
+        {
+            RET_ERR(RtErr::MissingMethod);
+        }
+        g_perform_wait_callback_method = method;
+    }
+    RET_OK(g_perform_wait_callback_method);
+}
+
+void ThreadPool::request_managed_worker()
+{
+    ++g_managed_pending_requests;
+}
+
+bool ThreadPool::has_managed_work_requests()
+{
+    return g_managed_pending_requests > 0;
+}
+
+RtResultVoid ThreadPool::run_managed_work_items()
+{
+    // Blocking calls made by a work item dispatch again, which runs the items it may be waiting for.
+    // The depth bound keeps a chain of such waits from exhausting the native stack. Items run as if on
+    // another thread, which could not enter the monitors held here, so none run while any is held;
+    // Monitor.Wait releases the monitor it waits on.
+    if (g_managed_pending_requests == 0 || g_managed_dispatch_depth >= kMaxManagedDispatchDepth || Monitor::get_held_count() > 0)
+    {
+        RET_VOID_OK();
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, method, get_perform_wait_callback_method());
+    ++g_managed_dispatch_depth;
+    while (g_managed_pending_requests > 0)
+    {
+        --g_managed_pending_requests;
+        auto ret = Runtime::invoke_with_run_cctor(method, nullptr, nullptr);
+        if (ret.is_err())
+        {
+            --g_managed_dispatch_depth;
+            RET_ERR(ret.unwrap_err());
+        }
+    }
+    --g_managed_dispatch_depth;
+    RET_VOID_OK();
+}
+
+void ThreadPool::get_managed_min_threads(int32_t& worker_threads, int32_t& completion_port_threads)
+{
+    worker_threads = g_managed_min_worker_threads > 0 ? g_managed_min_worker_threads : get_hardware_thread_count();
+    completion_port_threads = g_managed_min_completion_port_threads > 0 ? g_managed_min_completion_port_threads : get_hardware_thread_count();
+}
+
+void ThreadPool::get_managed_max_threads(int32_t& worker_threads, int32_t& completion_port_threads)
+{
+    worker_threads = g_managed_max_worker_threads;
+    completion_port_threads = g_managed_max_completion_port_threads;
+}
+
+void ThreadPool::get_managed_available_threads(int32_t& worker_threads, int32_t& completion_port_threads)
+{
+    worker_threads = g_managed_max_worker_threads - g_managed_busy_workers;
+    completion_port_threads = g_managed_max_completion_port_threads;
+}
+
+bool ThreadPool::set_managed_min_threads(int32_t worker_threads, int32_t completion_port_threads)
+{
+    if (worker_threads <= 0 || completion_port_threads <= 0 || worker_threads > g_managed_max_worker_threads ||
+        completion_port_threads > g_managed_max_completion_port_threads)
+    {
+        return false;
+    }
+    g_managed_min_worker_threads = worker_threads;
+    g_managed_min_completion_port_threads = completion_port_threads;
+    return true;
+}
+
+bool ThreadPool::set_managed_max_threads(int32_t worker_threads, int32_t completion_port_threads)
+{
+    int32_t min_worker_threads;
+    int32_t min_completion_port_threads;
+    get_managed_min_threads(min_worker_threads, min_completion_port_threads);
+    if (worker_threads < min_worker_threads || completion_port_threads < min_completion_port_threads)
+    {
+        return false;
+    }
+    g_managed_max_worker_threads = worker_threads;
+    g_managed_max_completion_port_threads = completion_port_threads;
+    return true;
+}
+
+void ThreadPool::report_managed_thread_status(bool is_working)
+{
+    g_managed_busy_workers += is_working ? 1 : -1;
+}
+
+} // namespace leanclr::vm
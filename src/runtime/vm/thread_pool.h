@@ -0,0 +1,47 @@
+#pragma once
+
+#include "rt_managed_types.h"
+
+namespace leanclr::vm
+{
+
+typedef void (*ThreadPoolWorkFunc)(void* arg);
+typedef void (*ThreadPoolForFunc)(void* ctx, int64_t index);
+
+// Native work-stealing thread pool. Every worker owns a Chase-Lev deque it pushes to and pops from at
+// the bottom while idle workers steal from the top; work queued from outside the pool goes through a
+// global injection queue. Workers that find nothing to do park until new work arrives.
+//
+// The interpreter and the GC are not thread-safe, so native workers only ever run native callbacks.
+// Managed work items queued through System.Threading.ThreadPool are dispatched on the runtime thread by
+// run_managed_work_items(), which the runtime calls whenever managed code blocks or yields outside of
+// any monitor.
+class ThreadPool
+{
+  public:
+    // Queues func(arg) on the pool. Without thread support the work runs inline.
+    static void queue_work(ThreadPoolWorkFunc func, void* arg);
+
+    // Runs func(ctx, i) for every i in [begin, end) on the pool and returns once all calls finished.
+    // The calling thread takes part in the loop.
+    static void parallel_for(int64_t begin, int64_t end, ThreadPoolForFunc func, void* ctx);
+
+    static int32_t get_worker_count();
+
+    // Stops and joins the workers. Work still queued is dropped; work queued afterwards starts new workers.
+    static void shutdown();
+
+    // Managed ThreadPool bookkeeping.
+    static void request_managed_worker();
+    static bool has_managed_work_requests();
+    static RtResultVoid run_managed_work_items();
+
+    static void get_managed_min_threads(int32_t& worker_threads, int32_t& completion_port_threads);
+    static void get_managed_max_threads(int32_t& worker_threads, int32_t& completion_port_threads);
+    static void get_managed_available_threads(int32_t& worker_threads, int32_t& completion_port_threads);
+    static bool set_managed_min_threads(int32_t worker_threads, int32_t completion_port_threads);
+    static bool set_managed_max_threads(int32_t worker_threads, int32_t completion_port_threads);
+    static void report_managed_thread_status(bool is_working);
+};
+
+} // namespace leanclr::vm
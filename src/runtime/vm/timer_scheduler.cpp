@@ -0,0 +1,333 @@
+#include "timer_scheduler.h"
+
+#include "class.h"
+#include "field.h"
+#include "gchandle.h"
+#include "monitor.h"
+#include "rt_thread.h"
+#include "runtime.h"
+#include "thread_pool.h"
+#include "timer_wheel.h"
+#include "alloc/general_allocation.h"
+#include "metadata/metadata_cache.h"
+#include "platform/rt_time.h"
+#include "utils/hashmap.h"
+#include "utils/rt_vector.h"
+
+#include <algorithm>
+
+#if !LEANCLR_ENABLE_THREADS && defined(__EMSCRIPTEN__)
+#include <emscripten.h>
+#endif
+
+namespace leanclr::vm
+{
+
+constexpr int64_t kTicksPerMillisecond = 10000;
+constexpr int32_t kNormalGCHandle = 2;
+
+struct ManagedTimer
+{
+    TimerWheelNode node;
+    void* handle;
+};
+
+struct TimerFields
+{
+    const metadata::RtFieldInfo* callback;
+    const metadata::RtFieldInfo* state;
+    const metadata::RtFieldInfo* period_ms;
+};
+
+static TimerWheel g_wheel;
+static utils::HashMap<RtObject*, ManagedTimer*> g_managed_timers;
+static TimerFields g_timer_fields;
+
+static RtResultVoid init_timer_fields(metadata::RtClass* timer_klass)
+{
+    if (g_timer_fields.callback)
+    {
+        RET_VOID_OK();
+    }
+    const metadata::RtFieldInfo* callback = Class::get_field_for_name(timer_klass, "callback", false);
+    const metadata::RtFieldInfo* state = Class::get_field_for_name(timer_klass, "state", false);
+    const metadata::RtFieldInfo* period_ms = Class::get_field_for_name(timer_klass, "period_ms", false);
+    if (!callback || !state || !period_ms)
+    {
+        RET_ERR(RtErr::MissingField);
+    }
+    g_timer_fields = {callback, state, period_ms};
+    RET_VOID_OK();
+}
+
+template <typename T>
+static T get_timer_field(RtObject* timer, const metadata::RtFieldInfo* field)
+{
+    return *reinterpret_cast<T*>(reinterpret_cast<uint8_t*>(timer) + Field::get_field_offset_includes_object_header_for_reference_type(field));
+}
+
+static void free_managed_timer(RtObject* timer, ManagedTimer* record)
+{
+    g_wheel.cancel(&record->node);
+    GCHandle::free_handle(record->handle);
+    g_managed_timers.erase(timer);
+    alloc::GeneralAllocation::free(record);
+}
+
+int64_t TimerScheduler::get_now_ms()
+{
+    return os::Time::get_ticks_100nanos() / kTicksPerMillisecond;
+}
+
+static void schedule(TimerWheelNode* node, int64_t due_ms)
+{
+    if (g_wheel.get_count() == 0)
+    {
+        g_wheel.reset(TimerScheduler::get_now_ms());
+    }
+    g_wheel.schedule(node, due_ms);
+}
+
+RtResultVoid TimerScheduler::change_managed_timer(RtObject* timer, int64_t next_run)
+{
+    if (!timer)
+    {
+        RET_ERR(RtErr::ArgumentNull);
+    }
+    if (next_run == INT64_MAX)
+    {
+        remove_managed_timer(timer);
+        RET_VOID_OK();
+    }
+    RET_ERR_ON_FAIL(init_timer_fields(timer->klass));
+
+    ManagedTimer* record;
+    auto it = g_managed_timers.find(timer);
+    if (it != g_managed_timers.end())
+    {
+        record = it->second;
+    }
+    else
+    {
+        record = alloc::GeneralAllocation::malloc_any_zeroed<ManagedTimer>();
+        // Pending timers are only referenced from here, e.g. the one behind Task.Delay.
+        record->handle = GCHandle::get_target_handle(timer, nullptr, kNormalGCHandle);
+        g_managed_timers.insert({timer, record});
+    }
+    // Round up so that a timer never fires before its due time.
+    schedule(&record->node, (next_run + kTicksPerMillisecond - 1) / kTicksPerMillisecond);
+    RET_VOID_OK();
+}
+
+void TimerScheduler::remove_managed_timer(RtObject* timer)
+{
+    auto it = g_managed_timers.find(timer);
+    if (it != g_managed_timers.end())
+    {
+        free_managed_timer(timer, it->second);
+    }
+}
+
+static bool refers_to_unloading_module(RtObject* timer)
+{
+    RtDelegate* callback = get_timer_field<RtDelegate*>(timer, g_timer_fields.callback);
+    RtObject* state = get_timer_field<RtObject*>(timer, g_timer_fields.state);
+    if (callback && (metadata::MetadataCache::refers_to_unloading_module(callback->method) ||
+                     (callback->target && metadata::MetadataCache::refers_to_unloading_module(callback->target->klass))))
+    {
+        return true;
+    }
+    return state && metadata::MetadataCache::refers_to_unloading_module(state->klass);
+}
+
+void TimerScheduler::purge_unloading_modules()
+{
+    utils::Vector<RtObject*> purged_timers;
+    for (const auto& [timer, record] : g_managed_timers)
+    {
+        if (refers_to_unloading_module(timer))
+        {
+            purged_timers.push_back(timer);
+        }
+    }
+    for (RtObject* timer : purged_timers)
+    {
+        remove_managed_timer(timer);
+    }
+}
+
+static RtResultVoid fire_managed_timer(RtObject* timer, int64_t now_ms)
+{
+    auto it = g_managed_timers.find(timer);
+    if (it == g_managed_timers.end())
+    {
+        // Disposed by a callback fired earlier in the same batch.
+        RET_VOID_OK();
+    }
+    ManagedTimer* record = it->second;
+    if (record->node.scheduled)
+    {
+        // Changed by an earlier callback.
+        RET_VOID_OK();
+    }
+
+    RtObject* callback = get_timer_field<RtObject*>(timer, g_timer_fields.callback);
+    RtObject* state = get_timer_field<RtObject*>(timer, g_timer_fields.state);
+    int64_t period_ms = get_timer_field<int64_t>(timer, g_timer_fields.period_ms);
+    // Same policy as Timer.Scheduler: reschedule periodic timers before running the callback, which may
+    // still change or dispose of them.
+    if (period_ms > 0)
+    {
+        schedule(&record->node, now_ms + period_ms);
+    }
+    else
+    {
+        free_managed_timer(timer, record);
+    }
+    if (!callback)
+    {
+        RET_VOID_OK();
+    }
+    const metadata::RtMethodInfo* invoke = Class::get_method_for_name(callback->klass, "Invoke", false);
+    if (!invoke)
+    {
+        RET_ERR(RtErr::MissingMethod);
+    }
+    const void* params[] = {state};
+    RET_ERR_ON_FAIL(Runtime::invoke_with_run_cctor(invoke, callback, params));
+    RET_VOID_OK();
+}
+
+static RtResult<size_t> fire_due_timers(int64_t now_ms)
+{
+    // Callbacks would run inside the critical sections of the monitors held; they fire once those are left.
+    if (Monitor::get_held_count() > 0)
+    {
+        RET_OK((size_t)0);
+    }
+    TimerWheelNode* expired = g_wheel.advance(now_ms);
+    if (!expired)
+    {
+        RET_OK((size_t)0);
+    }
+    // Callbacks can change or dispose of any timer, so detach the batch from the wheel's nodes first.
+    utils::Vector<RtObject*> timers;
+    for (TimerWheelNode* node = expired; node; node = node->next)
+    {
+        ManagedTimer* record = reinterpret_cast<ManagedTimer*>(node);
+        timers.push_back(GCHandle::get_target(record->handle));
+    }
+    for (RtObject* timer : timers)
+    {
+        RET_ERR_ON_FAIL(fire_managed_timer(timer, now_ms));
+    }
+    RET_OK(timers.size());
+}
+
+RtResultVoid TimerScheduler::run_timers(int64_t now_ms)
+{
+    RET_ERR_ON_FAIL(fire_due_timers(now_ms));
+    // Continuations of Task.Delay and the like are queued as work items by the timer callbacks.
+    return ThreadPool::run_managed_work_items();
+}
+
+int64_t TimerScheduler::get_next_due_ms()
+{
+    int64_t next = g_wheel.get_next_event_tick();
+    return next == TimerWheel::kNoTimer ? -1 : next;
+}
+
+// Whether the runtime thread can block until a timer is due. Single-threaded wasm can only yield to the
+// browser event loop through Asyncify; without it Thread::sleep returns at once and waiting would spin
+// on the clock, so sleeps return to the host instead, which pumps run_timers from its event loop.
+static bool can_block()
+{
+#if LEANCLR_ENABLE_THREADS
+    return true;
+#elif defined(__EMSCRIPTEN__)
+    return emscripten_has_asyncify() != 0;
+#else
+    return false;
+#endif
+}
+
+static void sleep_until(int64_t now_ms, int64_t wake_ms)
+{
+    int32_t milliseconds = static_cast<int32_t>(std::min<int64_t>(wake_ms - now_ms, INT32_MAX));
+#if !LEANCLR_ENABLE_THREADS && defined(__EMSCRIPTEN__)
+    emscripten_sleep(static_cast<unsigned int>(milliseconds));
+#else
+    Thread::sleep(milliseconds);
+#endif
+}
+
+RtResultVoid TimerScheduler::sleep(int32_t milliseconds)
+{
+    if (Monitor::get_held_count() > 0)
+    {
+        // Nothing is dispatched while monitors are held, so this only blocks, like a sleep on another thread
+        // holding them.
+        if (milliseconds > 0 && can_block())
+        {
+            int64_t now = get_now_ms();
+            sleep_until(now, now + milliseconds);
+        }
+        RET_VOID_OK();
+    }
+    int64_t deadline = milliseconds < 0 ? INT64_MAX : get_now_ms() + milliseconds;
+    for (;;)
+    {
+        RET_ERR_ON_FAIL(ThreadPool::run_managed_work_items());
+        int64_t now = get_now_ms();
+        RET_ERR_ON_FAIL(fire_due_timers(now));
+        if (now >= deadline)
+        {
+            RET_VOID_OK();
+        }
+        int64_t wake = std::min(deadline, g_wheel.get_next_event_tick());
+        if (wake == INT64_MAX)
+        {
+            // An infinite sleep with nothing pending could never end.
+            RET_VOID_OK();
+        }
+        // Work queued by the timers that just fired runs on the next iteration without sleeping.
+        if (!ThreadPool::has_managed_work_requests())
+        {
+            if (!can_block())
+            {
+                RET_VOID_OK();
+            }
+            sleep_until(now, wake);
+        }
+    }
+}
+
+RtResultVoid TimerScheduler::wait_for_progress(int32_t timeout_ms)
+{
+    if (Monitor::get_held_count() > 0)
+    {
+        // Nothing that could make progress is dispatched while monitors are held.
+        RET_VOID_OK();
+    }
+    int64_t now = get_now_ms();
+    int64_t deadline = timeout_ms < 0 ? INT64_MAX : now + timeout_ms;
+    for (;;)
+    {
+        bool has_work = ThreadPool::has_managed_work_requests();
+        RET_ERR_ON_FAIL(ThreadPool::run_managed_work_items());
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(size_t, fired, fire_due_timers(now));
+        if (has_work || fired > 0 || now >= deadline)
+        {
+            RET_VOID_OK();
+        }
+        int64_t wake = std::min(deadline, g_wheel.get_next_event_tick());
+        if (wake == INT64_MAX || !can_block())
+        {
+            RET_VOID_OK();
+        }
+        sleep_until(now, wake);
+        now = get_now_ms();
+    }
+}
+
+} // namespace leanclr::vm
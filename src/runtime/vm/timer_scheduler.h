@@ -0,0 +1,47 @@
+#pragma once
+
+#include "rt_managed_types.h"
+
+namespace leanclr::vm
+{
+
+// Drives System.Threading.Timer, and through it Task.Delay and friends, from a TimerWheel.
+//
+// Managed callbacks can only run on the runtime thread, so there is no timer thread: the wheel is
+// advanced whenever that thread blocks in Thread.Sleep or Monitor.Wait, sleeping no longer than until
+// the next timer is due, and by embedders that pump it through run_timers, e.g. once per frame or from
+// a host event loop in single-threaded and wasm builds.
+class TimerScheduler
+{
+  public:
+    // Current time of the clock timers are scheduled against, in milliseconds. Matches
+    // System.Threading.Timer::GetTimeMonotonic.
+    static int64_t get_now_ms();
+
+    // Backs Timer.Scheduler: next_run is the due time in 100ns ticks, Int64.MaxValue to stop the timer.
+    static RtResultVoid change_managed_timer(RtObject* timer, int64_t next_run);
+    static void remove_managed_timer(RtObject* timer);
+
+    // Cancels the timers whose callback or state belongs to an unloading module.
+    static void purge_unloading_modules();
+
+    // Fires, on the calling thread, every timer due at or before now_ms, then runs the managed work items
+    // they queued.
+    static RtResultVoid run_timers(int64_t now_ms);
+
+    // Time at which run_timers next has something to do, or -1 when no timer is pending.
+    static int64_t get_next_due_ms();
+
+    // Blocks for milliseconds (-1 for as long as timers are pending) while dispatching queued managed
+    // work items and timers as they come due. Single-threaded wasm builds block with emscripten_sleep when
+    // built with Asyncify, and otherwise return once nothing is due, leaving later timers to the host.
+    // While the runtime thread holds a monitor, only blocks.
+    static RtResultVoid sleep(int32_t milliseconds);
+
+    // Blocks for at most timeout_ms (-1 for no limit), returning as soon as a work item or a timer ran.
+    // Returns without blocking where sleep would, and while the runtime thread holds a monitor, since
+    // work items and timers are not dispatched then.
+    static RtResultVoid wait_for_progress(int32_t timeout_ms);
+};
+
+} // namespace leanclr::vm
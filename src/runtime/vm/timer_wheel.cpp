@@ -0,0 +1,223 @@
+#include "timer_wheel.h"
+
+#include <cstring>
+
+namespace leanclr::vm
+{
+
+constexpr int64_t kSlotMask = TimerWheel::kSlotCount - 1;
+// Ticks covered by the whole wheel; anything further out is parked in the top level.
+constexpr int64_t kWheelSpan = 1LL << (TimerWheel::kSlotBits * TimerWheel::kLevelCount);
+
+static int32_t level_shift(int32_t level)
+{
+    return TimerWheel::kSlotBits * level;
+}
+
+static int32_t count_trailing_zeros(uint64_t x)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<int32_t>(index);
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+static uint64_t rotate_right(uint64_t x, int32_t n)
+{
+    return n == 0 ? x : (x >> n) | (x << (64 - n));
+}
+
+TimerWheel::TimerWheel() : _current(0), _count(0)
+{
+    std::memset(_slots, 0, sizeof(_slots));
+    std::memset(_occupied, 0, sizeof(_occupied));
+}
+
+void TimerWheel::reset(int64_t now)
+{
+    assert(_count == 0);
+    _current = now;
+}
+
+void TimerWheel::schedule(TimerWheelNode* node, int64_t due)
+{
+    if (node->scheduled)
+    {
+        cancel(node);
+    }
+    node->due = due;
+    node->scheduled = true;
+    insert(node);
+    ++_count;
+}
+
+void TimerWheel::insert(TimerWheelNode* node)
+{
+    int64_t due = node->due < _current ? _current : node->due;
+    int64_t delta = due - _current;
+    int32_t level = 0;
+    while (level < kLevelCount - 1 && delta >= (1LL << level_shift(level + 1)))
+    {
+        ++level;
+    }
+    if (delta >= kWheelSpan)
+    {
+        due = _current + kWheelSpan - 1;
+    }
+    int32_t slot = static_cast<int32_t>((due >> level_shift(level)) & kSlotMask);
+
+    TimerWheelNode*& head = _slots[level][slot];
+    node->level = static_cast<uint8_t>(level);
+    node->slot = static_cast<uint8_t>(slot);
+    node->prev = nullptr;
+    node->next = head;
+    if (head)
+    {
+        head->prev = node;
+    }
+    head = node;
+    _occupied[level] |= 1ULL << slot;
+}
+
+void TimerWheel::cancel(TimerWheelNode* node)
+{
+    if (!node->scheduled)
+    {
+        return;
+    }
+    if (node->prev)
+    {
+        node->prev->next = node->next;
+    }
+    else
+    {
+        _slots[node->level][node->slot] = node->next;
+        if (!node->next)
+        {
+            _occupied[node->level] &= ~(1ULL << node->slot);
+        }
+    }
+    if (node->next)
+    {
+        node->next->prev = node->prev;
+    }
+    node->prev = node->next = nullptr;
+    node->scheduled = false;
+    --_count;
+}
+
+void TimerWheel::cascade(int32_t level, int32_t slot)
+{
+    TimerWheelNode* node = _slots[level][slot];
+    _slots[level][slot] = nullptr;
+    _occupied[level] &= ~(1ULL << slot);
+    while (node)
+    {
+        TimerWheelNode* next = node->next;
+        insert(node);
+        node = next;
+    }
+}
+
+void TimerWheel::process_tick(TimerWheelNode*& expired_head, TimerWheelNode*& expired_tail)
+{
+    if ((_current & kSlotMask) == 0)
+    {
+        for (int32_t level = 1; level < kLevelCount; ++level)
+        {
+            int32_t slot = static_cast<int32_t>((_current >> level_shift(level)) & kSlotMask);
+            cascade(level, slot);
+            if (slot != 0)
+            {
+                break;
+            }
+        }
+    }
+
+    int32_t slot = static_cast<int32_t>(_current & kSlotMask);
+    TimerWheelNode* node = _slots[0][slot];
+    _slots[0][slot] = nullptr;
+    _occupied[0] &= ~(1ULL << slot);
+    while (node)
+    {
+        TimerWheelNode* next = node->next;
+        node->prev = expired_tail;
+        node->next = nullptr;
+        node->scheduled = false;
+        if (expired_tail)
+        {
+            expired_tail->next = node;
+        }
+        else
+        {
+            expired_head = node;
+        }
+        expired_tail = node;
+        --_count;
+        node = next;
+    }
+}
+
+TimerWheelNode* TimerWheel::advance(int64_t now)
+{
+    TimerWheelNode* expired_head = nullptr;
+    TimerWheelNode* expired_tail = nullptr;
+    while (_current <= now)
+    {
+        // Jump straight to the next tick that expires or cascades something.
+        int64_t next = get_next_event_tick();
+        if (next > now)
+        {
+            _current = now + 1;
+            break;
+        }
+        _current = next;
+        process_tick(expired_head, expired_tail);
+        ++_current;
+    }
+    return expired_head;
+}
+
+int64_t TimerWheel::get_next_event_tick() const
+{
+    if (_count == 0)
+    {
+        return kNoTimer;
+    }
+    int64_t next = kNoTimer;
+    for (int32_t level = 0; level < kLevelCount; ++level)
+    {
+        uint64_t occupied = _occupied[level];
+        if (!occupied)
+        {
+            continue;
+        }
+        int32_t shift = level_shift(level);
+        int64_t position = _current >> shift;
+        int32_t index = static_cast<int32_t>(position & kSlotMask);
+        int64_t tick;
+        if (level == 0)
+        {
+            // Level 0 slots hold the ticks of the current rotation, starting with the current one.
+            tick = _current + count_trailing_zeros(rotate_right(occupied, index));
+        }
+        else
+        {
+            // Upper slots are cascaded when the wheel reaches their start. Past that point the current slot
+            // was cascaded already, so it comes around a full rotation later.
+            int32_t first = (_current & ((1LL << shift) - 1)) == 0 ? 0 : 1;
+            int32_t distance = count_trailing_zeros(rotate_right(occupied, (index + first) & static_cast<int32_t>(kSlotMask))) + first;
+            tick = (position + distance) << shift;
+        }
+        if (tick < next)
+        {
+            next = tick;
+        }
+    }
+    return next;
+}
+
+} // namespace leanclr::vm
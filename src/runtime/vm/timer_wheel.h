@@ -0,0 +1,65 @@
+#pragma once
+
+#include "rt_base.h"
+
+namespace leanclr::vm
+{
+
+// Intrusive list node of a TimerWheel entry. Embed it in the timer record and recover the record from the
+// expired nodes returned by TimerWheel::advance.
+struct TimerWheelNode
+{
+    TimerWheelNode* prev;
+    TimerWheelNode* next;
+    int64_t due;
+    uint8_t level;
+    uint8_t slot;
+    bool scheduled;
+};
+
+// Hierarchical timing wheel with millisecond ticks. Level L has 64 slots of 64^L ticks each, so scheduling
+// and cancelling are O(1) regardless of the number of pending timers; entries of the upper levels are
+// cascaded down as the wheel turns. Timers further out than the top level covers park in its last slot
+// and are re-examined each time it comes around. Not thread-safe.
+class TimerWheel
+{
+  public:
+    static constexpr int32_t kSlotBits = 6;
+    static constexpr int32_t kSlotCount = 1 << kSlotBits;
+    static constexpr int32_t kLevelCount = 6;
+    static constexpr int64_t kNoTimer = INT64_MAX;
+
+    TimerWheel();
+
+    // Sets the tick the wheel starts from. Only valid while the wheel is empty.
+    void reset(int64_t now);
+
+    // Schedules node to expire at due. Ticks already in the past expire on the next advance.
+    void schedule(TimerWheelNode* node, int64_t due);
+    void cancel(TimerWheelNode* node);
+
+    // Processes every tick up to and including now and returns the nodes that expired, linked through
+    // next in expiry order. Expired nodes are no longer scheduled.
+    TimerWheelNode* advance(int64_t now);
+
+    // Earliest tick at which advance has work to do, which is a lower bound of the next expiry, or
+    // kNoTimer when the wheel is empty.
+    int64_t get_next_event_tick() const;
+
+    size_t get_count() const
+    {
+        return _count;
+    }
+
+  private:
+    void insert(TimerWheelNode* node);
+    void cascade(int32_t level, int32_t slot);
+    void process_tick(TimerWheelNode*& expired_head, TimerWheelNode*& expired_tail);
+
+    TimerWheelNode* _slots[kLevelCount][kSlotCount];
+    uint64_t _occupied[kLevelCount];
+    int64_t _current;
+    size_t _count;
+};
+
+} // namespace leanclr::vm
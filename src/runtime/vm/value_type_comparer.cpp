@@ -0,0 +1,344 @@
+#include "value_type_comparer.h"
+
+#include <cstring>
+
+#include "class.h"
+#include "field.h"
+#include "method.h"
+#include "object.h"
+#include "rt_array.h"
+#include "rt_string.h"
+#include "metadata/metadata_cache.h"
+#include "alloc/mem_pool.h"
+#include "utils/hashmap.h"
+#include "utils/rt_vector.h"
+
+namespace leanclr::vm
+{
+
+static utils::HashMap<const metadata::RtClass*, const ValueTypeCompareLayout*> g_layouts;
+
+static RtResult<bool> overrides_equality(metadata::RtClass* klass)
+{
+    RET_ERR_ON_FAIL(Class::initialize_methods(klass));
+    for (uint16_t i = 0; i < klass->method_count; ++i)
+    {
+        const metadata::RtMethodInfo* method = klass->methods[i];
+        if (!Method::is_virtual(method))
+            continue;
+        if ((method->parameter_count == 1 && std::strcmp(method->name, "Equals") == 0) ||
+            (method->parameter_count == 0 && std::strcmp(method->name, "GetHashCode") == 0))
+        {
+            RET_OK(true);
+        }
+    }
+    RET_OK(false);
+}
+
+static void add_run(utils::Vector<ValueTypeCompareRun>& runs, const ValueTypeCompareRun& run)
+{
+    if (run.kind == ValueTypeCompareKind::Bits && !runs.empty())
+    {
+        ValueTypeCompareRun& last = runs[runs.size() - 1];
+        if (last.kind == ValueTypeCompareKind::Bits && last.offset + last.size == run.offset)
+        {
+            last.size += run.size;
+            return;
+        }
+    }
+    runs.push_back(run);
+}
+
+static RtResultVoid build_runs(metadata::RtClass* klass, uint32_t base_offset, utils::Vector<ValueTypeCompareRun>& runs)
+{
+    RET_ERR_ON_FAIL(Class::initialize_fields(klass));
+    for (uint16_t i = 0; i < klass->field_count; ++i)
+    {
+        const metadata::RtFieldInfo* field = &klass->fields[i];
+        if (!Field::is_instance(field))
+            continue;
+
+        uint32_t offset = base_offset + static_cast<uint32_t>(Field::get_field_offset_excludes_object_header_for_all_type(field));
+        switch (field->type_sig->ele_type)
+        {
+        case metadata::RtElementType::Boolean:
+        case metadata::RtElementType::I1:
+        case metadata::RtElementType::U1:
+            add_run(runs, {ValueTypeCompareKind::Bits, offset, 1, nullptr});
+            break;
+        case metadata::RtElementType::I2:
+        case metadata::RtElementType::Char:
+        case metadata::RtElementType::U2:
+            add_run(runs, {ValueTypeCompareKind::Bits, offset, 2, nullptr});
+            break;
+        case metadata::RtElementType::I4:
+        case metadata::RtElementType::U4:
+            add_run(runs, {ValueTypeCompareKind::Bits, offset, 4, nullptr});
+            break;
+        case metadata::RtElementType::I8:
+        case metadata::RtElementType::U8:
+            add_run(runs, {ValueTypeCompareKind::Bits, offset, 8, nullptr});
+            break;
+        case metadata::RtElementType::I:
+        case metadata::RtElementType::U:
+        case metadata::RtElementType::Ptr:
+        case metadata::RtElementType::FnPtr:
+            add_run(runs, {ValueTypeCompareKind::Bits, offset, sizeof(void*), nullptr});
+            break;
+        case metadata::RtElementType::R4:
+            add_run(runs, {ValueTypeCompareKind::R4, offset, sizeof(float), nullptr});
+            break;
+        case metadata::RtElementType::R8:
+            add_run(runs, {ValueTypeCompareKind::R8, offset, sizeof(double), nullptr});
+            break;
+        case metadata::RtElementType::String:
+            add_run(runs, {ValueTypeCompareKind::String, offset, sizeof(void*), nullptr});
+            break;
+        case metadata::RtElementType::Object:
+        case metadata::RtElementType::Array:
+        case metadata::RtElementType::SZArray:
+            add_run(runs, {ValueTypeCompareKind::Reference, offset, sizeof(void*), nullptr});
+            break;
+        default:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, field_klass, Class::get_class_from_typesig(field->type_sig));
+            if (!Class::is_value_type(field_klass))
+            {
+                add_run(runs, {ValueTypeCompareKind::Reference, offset, sizeof(void*), nullptr});
+            }
+            else if (Class::is_enum_type(field_klass))
+            {
+                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(size_t, size, Field::get_field_size(field));
+                add_run(runs, {ValueTypeCompareKind::Bits, offset, static_cast<uint32_t>(size), nullptr});
+            }
+            else
+            {
+                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, overridden, overrides_equality(field_klass));
+                if (overridden)
+                {
+                    add_run(runs, {ValueTypeCompareKind::BoxedValueType, offset, Class::get_instance_size_without_object_header(field_klass), field_klass});
+                }
+                else
+                {
+                    // The default equality of the field compares its own fields the same way.
+                    RET_ERR_ON_FAIL(build_runs(field_klass, offset, runs));
+                }
+            }
+            break;
+        }
+        }
+    }
+    RET_VOID_OK();
+}
+
+RtResult<const ValueTypeCompareLayout*> ValueTypeComparer::get_layout(metadata::RtClass* klass)
+{
+    auto it = g_layouts.find(klass);
+    if (it != g_layouts.end())
+    {
+        RET_OK(it->second);
+    }
+
+    utils::Vector<ValueTypeCompareRun> runs;
+    RET_ERR_ON_FAIL(build_runs(klass, 0, runs));
+
+    alloc::MemPool& pool =
+        metadata::MetadataCache::get_owner_mem_pool(metadata::MetadataCache::get_collectible_owner(klass->by_val), alloc::MemoryCategory::Metadata);
+    ValueTypeCompareRun* pooled_runs = pool.calloc_any<ValueTypeCompareRun>(runs.size());
+    if (!runs.empty())
+    {
+        std::memcpy(pooled_runs, runs.data(), runs.size() * sizeof(ValueTypeCompareRun));
+    }
+    ValueTypeCompareLayout* layout = pool.malloc_any_zeroed<ValueTypeCompareLayout>();
+    layout->runs = pooled_runs;
+    layout->run_count = static_cast<uint32_t>(runs.size());
+    layout->bitwise_equatable = runs.size() == 1 && runs[0].kind == ValueTypeCompareKind::Bits && runs[0].offset == 0 &&
+                                runs[0].size == Class::get_instance_size_without_object_header(klass);
+
+    g_layouts.insert({klass, layout});
+    RET_OK(layout);
+}
+
+static bool string_equals(RtString* str1, RtString* str2)
+{
+    if (str1 == str2)
+        return true;
+    if (str1 == nullptr || str2 == nullptr)
+        return false;
+    int32_t length = String::get_length(str1);
+    return length == String::get_length(str2) &&
+           std::memcmp(String::get_chars_ptr(str1), String::get_chars_ptr(str2), length * sizeof(Utf16Char)) == 0;
+}
+
+template <typename T>
+static T read_at(const uint8_t* data, uint32_t offset)
+{
+    T value;
+    std::memcpy(&value, data + offset, sizeof(T));
+    return value;
+}
+
+// Fills an object array with the pairs (or, for hashing, the single objects) of the deferred runs.
+static RtResult<RtArray*> new_deferred_array(const ValueTypeCompareLayout* layout, const uint8_t* data1, const uint8_t* data2, int32_t count)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtArray*, arr, Array::new_array_from_ele_klass(Class::get_corlib_types().cls_object, count));
+    RtObject** arr_data = Array::get_array_data_start_as<RtObject*>(arr);
+    int32_t index = 0;
+    for (uint32_t i = 0; i < layout->run_count; ++i)
+    {
+        const ValueTypeCompareRun& run = layout->runs[i];
+        if (run.kind == ValueTypeCompareKind::Reference)
+        {
+            RtObject* obj1 = read_at<RtObject*>(data1, run.offset);
+            if (data2)
+            {
+                RtObject* obj2 = read_at<RtObject*>(data2, run.offset);
+                if (obj1 != obj2)
+                {
+                    arr_data[index++] = obj1;
+                    arr_data[index++] = obj2;
+                }
+            }
+            else if (obj1)
+            {
+                arr_data[index++] = obj1;
+            }
+        }
+        else if (run.kind == ValueTypeCompareKind::BoxedValueType)
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, boxed1, Object::box_object(run.klass, data1 + run.offset));
+            arr_data[index++] = boxed1;
+            if (data2)
+            {
+                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, boxed2, Object::box_object(run.klass, data2 + run.offset));
+                arr_data[index++] = boxed2;
+            }
+        }
+    }
+    assert(index == count);
+    RET_OK(arr);
+}
+
+RtResult<bool> ValueTypeComparer::equals(metadata::RtClass* klass, const void* data1, const void* data2, RtArray** uncompared_field_objs)
+{
+    *uncompared_field_objs = nullptr;
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const ValueTypeCompareLayout*, layout, get_layout(klass));
+    const uint8_t* bytes1 = static_cast<const uint8_t*>(data1);
+    const uint8_t* bytes2 = static_cast<const uint8_t*>(data2);
+    if (layout->bitwise_equatable)
+    {
+        RET_OK(std::memcmp(bytes1, bytes2, layout->runs[0].size) == 0);
+    }
+
+    int32_t deferred_count = 0;
+    for (uint32_t i = 0; i < layout->run_count; ++i)
+    {
+        const ValueTypeCompareRun& run = layout->runs[i];
+        switch (run.kind)
+        {
+        case ValueTypeCompareKind::Bits:
+            if (std::memcmp(bytes1 + run.offset, bytes2 + run.offset, run.size) != 0)
+                RET_OK(false);
+            break;
+        case ValueTypeCompareKind::R4:
+            if (read_at<float>(bytes1, run.offset) != read_at<float>(bytes2, run.offset))
+                RET_OK(false);
+            break;
+        case ValueTypeCompareKind::R8:
+            if (read_at<double>(bytes1, run.offset) != read_at<double>(bytes2, run.offset))
+                RET_OK(false);
+            break;
+        case ValueTypeCompareKind::String:
+            if (!string_equals(read_at<RtString*>(bytes1, run.offset), read_at<RtString*>(bytes2, run.offset)))
+                RET_OK(false);
+            break;
+        case ValueTypeCompareKind::Reference:
+            if (read_at<RtObject*>(bytes1, run.offset) != read_at<RtObject*>(bytes2, run.offset))
+                deferred_count += 2;
+            break;
+        case ValueTypeCompareKind::BoxedValueType:
+            deferred_count += 2;
+            break;
+        }
+    }
+    if (deferred_count == 0)
+    {
+        RET_OK(true);
+    }
+    UNWRAP_OR_RET_ERR_ON_FAIL(*uncompared_field_objs, new_deferred_array(layout, bytes1, bytes2, deferred_count));
+    RET_OK(false);
+}
+
+static int32_t hash_bits(int32_t hash, const uint8_t* data, uint32_t size)
+{
+    uint32_t i = 0;
+    for (; i + sizeof(int32_t) <= size; i += sizeof(int32_t))
+    {
+        hash = hash * 31 + read_at<int32_t>(data, i);
+    }
+    for (; i < size; ++i)
+    {
+        hash = hash * 31 + data[i];
+    }
+    return hash;
+}
+
+RtResult<int32_t> ValueTypeComparer::get_hash_code(metadata::RtClass* klass, const void* data, RtArray** uncomputed_field_objs)
+{
+    *uncomputed_field_objs = nullptr;
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const ValueTypeCompareLayout*, layout, get_layout(klass));
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    int32_t hash = static_cast<int32_t>(reinterpret_cast<uintptr_t>(klass));
+    int32_t deferred_count = 0;
+    for (uint32_t i = 0; i < layout->run_count; ++i)
+    {
+        const ValueTypeCompareRun& run = layout->runs[i];
+        switch (run.kind)
+        {
+        case ValueTypeCompareKind::Bits:
+            hash = hash_bits(hash, bytes + run.offset, run.size);
+            break;
+        case ValueTypeCompareKind::R4:
+        {
+            // 0.0 and -0.0 are equal, so they must hash the same.
+            float value = read_at<float>(bytes, run.offset);
+            hash = hash * 31 + (value == 0.0f ? 0 : read_at<int32_t>(bytes, run.offset));
+            break;
+        }
+        case ValueTypeCompareKind::R8:
+        {
+            double value = read_at<double>(bytes, run.offset);
+            hash = hash * 31 + (value == 0.0 ? 0 : read_at<int32_t>(bytes, run.offset) ^ read_at<int32_t>(bytes, run.offset + 4));
+            break;
+        }
+        case ValueTypeCompareKind::String:
+        {
+            RtString* str = read_at<RtString*>(bytes, run.offset);
+            hash = hash * 31 + (str ? String::get_hash_code(str) : 0);
+            break;
+        }
+        case ValueTypeCompareKind::Reference:
+            if (read_at<RtObject*>(bytes, run.offset))
+                ++deferred_count;
+            else
+                hash = hash * 31;
+            break;
+        case ValueTypeCompareKind::BoxedValueType:
+            ++deferred_count;
+            break;
+        }
+    }
+    if (deferred_count > 0)
+    {
+        UNWRAP_OR_RET_ERR_ON_FAIL(*uncomputed_field_objs, new_deferred_array(layout, bytes, nullptr, deferred_count));
+    }
+    RET_OK(hash);
+}
+
+void ValueTypeComparer::purge_unloading_modules()
+{
+    utils::erase_if(g_layouts, [](const auto& entry) { return metadata::MetadataCache::refers_to_unloading_module(entry.first); });
+}
+
+} // namespace leanclr::vm
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "rt_managed_types.h"
+
+namespace leanclr::vm
+{
+
+enum class ValueTypeCompareKind : uint8_t
+{
+    // Compared byte for byte and hashed by content.
+    Bits,
+    R4,
+    R8,
+    String,
+    // Left to managed code: reference fields, and value type fields overriding Equals or GetHashCode.
+    Reference,
+    BoxedValueType,
+};
+
+struct ValueTypeCompareRun
+{
+    ValueTypeCompareKind kind;
+    // Offset from the start of the value data, excluding any object header.
+    uint32_t offset;
+    uint32_t size;
+    // Field class of BoxedValueType runs.
+    metadata::RtClass* klass;
+};
+
+// Fields of a value type as compared by the default ValueType.Equals and GetHashCode. Adjacent blittable
+// fields are merged into a single Bits run, and value type fields not overriding equality are flattened in.
+struct ValueTypeCompareLayout
+{
+    const ValueTypeCompareRun* runs;
+    uint32_t run_count;
+    // The whole value is one Bits run, so equality is a single memcmp.
+    bool bitwise_equatable;
+};
+
+class ValueTypeComparer
+{
+  public:
+    // Gets the layout of klass, building it on first use.
+    static RtResult<const ValueTypeCompareLayout*> get_layout(metadata::RtClass* klass);
+
+    // Compares the values of klass at data1 and data2 without allocating, unless some runs are left to managed
+    // code. Those are then returned as pairs in uncompared_field_objs, which is nullptr otherwise.
+    static RtResult<bool> equals(metadata::RtClass* klass, const void* data1, const void* data2, RtArray** uncompared_field_objs);
+
+    // Hashes the value of klass at data. Runs left to managed code are returned in uncomputed_field_objs, which
+    // is nullptr if there are none.
+    static RtResult<int32_t> get_hash_code(metadata::RtClass* klass, const void* data, RtArray** uncomputed_field_objs);
+
+    // Drops the layouts of the classes that refer to an unloading module.
+    static void purge_unloading_modules();
+};
+
+} // namespace leanclr::vm
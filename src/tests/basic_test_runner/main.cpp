@@ -1,16 +1,21 @@
 
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <vector>
 #include <filesystem>
+#include <string>
 
 #include "alloc/general_allocation.h"
 #include "metadata/pe_image_reader.h"
 #include "alloc/mem_pool.h"
 #include "metadata/module_def.h"
+#include "metadata/metadata_snapshot.h"
 #include "vm/assembly.h"
+#include "vm/assembly_load_context.h"
 #include "vm/settings.h"
 #include "vm/runtime.h"
 #include "vm/class.h"
@@ -310,7 +315,116 @@ RtResultVoid run_tests(metadata::RtModuleDef* mod)
     RET_VOID_OK();
 }
 
-int main()
+static void append_class_name(std::string& out, const metadata::RtClass* klass)
+{
+    if (klass->declaring_class)
+    {
+        append_class_name(out, klass->declaring_class);
+        out += '/';
+    }
+    else if (*klass->namespaze)
+    {
+        out += klass->namespaze;
+        out += '.';
+    }
+    out += klass->name;
+}
+
+// One line per type of the module, with what the snapshot restores: nested classes and field offsets.
+static RtResult<std::vector<std::string>> describe_class_layouts(metadata::RtModuleDef* mod)
+{
+    std::vector<std::string> layouts;
+    for (uint32_t rid = 1; rid <= mod->get_class_count(); rid++)
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, klass, mod->get_class_by_type_def_rid(rid));
+        RET_ERR_ON_FAIL(vm::Class::initialize_all(klass));
+        std::string layout;
+        append_class_name(layout, klass);
+        layout += " size=" + std::to_string(klass->instance_size_without_header) + " nested=[";
+        for (uint16_t i = 0; i < klass->nested_class_count; i++)
+        {
+            layout += std::string(i ? "," : "") + klass->nested_classes[i]->name;
+        }
+        layout += "] fields=[";
+        for (uint16_t i = 0; i < klass->field_count; i++)
+        {
+            const metadata::RtFieldInfo& field = klass->fields[i];
+            layout += std::string(i ? "," : "") + field.name + "@" + std::to_string(field.offset);
+        }
+        layout += "]";
+        layouts.push_back(layout);
+    }
+    RET_OK(layouts);
+}
+
+static RtResult<std::vector<std::string>> load_and_describe(const char* assembly_name, bool expect_snapshot)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(utils::Span<byte>, data, assembly_file_loader(assembly_name));
+    vm::RtAssemblyLoadContext* context = vm::AssemblyLoadContext::create_collectible();
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtAssembly*, ass, vm::AssemblyLoadContext::load_from_data(context, data));
+    if (ass->mod->is_loaded_from_snapshot() != expect_snapshot)
+    {
+        std::cout << "  " << assembly_name << (expect_snapshot ? " was not" : " was") << " loaded from the snapshot" << std::endl;
+        RET_ERR(RtErr::ExecutionEngine);
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(std::vector<std::string>, layouts, describe_class_layouts(ass->mod));
+    if (!expect_snapshot)
+    {
+        std::vector<uint8_t> snapshot(metadata::MetadataSnapshot::write(nullptr, 0));
+        metadata::MetadataSnapshot::write(snapshot.data(), snapshot.size());
+        RET_ERR_ON_FAIL(metadata::MetadataSnapshot::set(snapshot.data(), snapshot.size()));
+    }
+    RET_ERR_ON_FAIL(vm::AssemblyLoadContext::unload(context));
+    RET_OK(layouts);
+}
+
+// Loads the assembly cold into a collectible context and snapshots its tables, unloads it, then loads it again
+// from the snapshot and compares the nested classes and field offsets of every type.
+static RtResultVoid run_metadata_snapshot_tests(const char* assembly_name)
+{
+    std::cout << "Running metadata snapshot tests on: " << assembly_name << std::endl;
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(std::vector<std::string>, cold, load_and_describe(assembly_name, false));
+    auto restored_ret = load_and_describe(assembly_name, true);
+    metadata::MetadataSnapshot::clear();
+    if (restored_ret.is_err())
+    {
+        RET_ERR(restored_ret.unwrap_err());
+    }
+    const std::vector<std::string>& restored = restored_ret.unwrap();
+    bool ok = cold.size() == restored.size();
+    for (size_t i = 0; ok && i < cold.size(); i++)
+    {
+        if (cold[i] != restored[i])
+        {
+            std::cout << "  cold:     " << cold[i] << std::endl;
+            std::cout << "  restored: " << restored[i] << std::endl;
+            ok = false;
+        }
+    }
+    // Explicit field offsets and class sizes come from the restored tables.
+    const std::string expected = "CorlibTests.MetadataSnapshotTypes/Overlapped size=32 nested=[] fields=[wide@0,low@0,high@4,tail@16]";
+    if (std::find(cold.begin(), cold.end(), expected) == cold.end())
+    {
+        std::cout << "  missing: " << expected << std::endl;
+        ok = false;
+    }
+    if (!ok)
+    {
+        RET_ERR(RtErr::ExecutionEngine);
+    }
+    RET_VOID_OK();
+}
+
+// Segment sizes small enough that the managed tests cross eval and frame stack segment boundaries all the
+// time, with the shrink policy on so that segments are also freed and allocated again.
+static void use_tiny_stack_segments()
+{
+    vm::Settings::set_eval_stack_segment_object_count(64);
+    vm::Settings::set_frame_stack_segment_size(4);
+    vm::Settings::set_machine_stack_shrink_enabled(true);
+}
+
+int main(int argc, char** argv)
 {
 #ifdef _WIN32
     // 设置 Windows 控制台为 UTF-8 编码
@@ -321,11 +435,19 @@ int main()
     std::cout << "Startup test successful!" << std::endl;
 
     setup_default_lib_dirs();
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--tiny-stack-segments") == 0)
+        {
+            use_tiny_stack_segments();
+            std::cout << "Using tiny stack segments." << std::endl;
+        }
+    }
     vm::Settings::set_assembly_loader(assembly_file_loader);
-    const char* argv[] = {
+    const char* managed_argv[] = {
         "leanclr",
     };
-    vm::Settings::set_command_line_arguments(sizeof(argv) / sizeof(const char*), argv);
+    vm::Settings::set_command_line_arguments(sizeof(managed_argv) / sizeof(const char*), managed_argv);
     auto result = vm::Runtime::initialize();
     if (result.is_err())
     {
@@ -434,6 +556,16 @@ int main()
         }
     }
 
+    {
+        // Run before CorlibTests is loaded into the default context, which would take its name.
+        auto ret = run_metadata_snapshot_tests("CorlibTests");
+        if (ret.is_err())
+        {
+            std::cout << "Failed to run metadata snapshot tests, error: " << static_cast<int>(ret.unwrap_err()) << std::endl;
+            return -1;
+        }
+    }
+
     metadata::RtAssembly* corelibTests = nullptr;
     {
         auto ret1 = vm::Assembly::load_by_name("CorlibTests");
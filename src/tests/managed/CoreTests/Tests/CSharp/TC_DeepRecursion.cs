@@ -0,0 +1,245 @@
+﻿using System;
+using System.Reflection;
+
+namespace Tests.CSharp
+{
+    // Recursion deep enough to grow the interpreter eval stack past a segment of 16K stack objects and the
+    // frame stack past a segment of 256 frames. With --tiny-stack-segments nearly every call crosses a
+    // segment boundary, and segments are freed and allocated again as the recursion unwinds and repeats.
+    internal class TC_DeepRecursion : GeneralTestCaseBase
+    {
+        struct Big
+        {
+            public long A, B, C, D, E, F, G, H;
+        }
+
+        // Larger than a tiny eval stack segment, so that a frame holding it gets a segment of its own size.
+        struct Huge
+        {
+            public Big P0, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15;
+        }
+
+        struct Mixed
+        {
+            public byte Tag;
+            public double Sum;
+            public Big Body;
+            public object Ref;
+        }
+
+        static long Checksum(Big b)
+        {
+            return b.A + 3 * b.B + 5 * b.C + 7 * b.D + 11 * b.E + 13 * b.F + 17 * b.G + 19 * b.H;
+        }
+
+        static Big Step(Big b, int depth)
+        {
+            b.A += depth;
+            b.B ^= depth;
+            b.C -= depth;
+            b.D += 2 * depth;
+            b.E = b.E * 3 + 1;
+            b.F += b.A;
+            b.G -= b.B;
+            b.H += 1;
+            return b;
+        }
+
+        // The struct is passed down and the result returned up through every level, so that arguments are
+        // copied into new segments and return values copied back across them.
+        static Big PassBig(Big b, int depth)
+        {
+            if (depth == 0)
+            {
+                return b;
+            }
+            Big r = PassBig(Step(b, depth), depth - 1);
+            r.H += depth;
+            return r;
+        }
+
+        static Big PassBigIterative(Big b, int depth)
+        {
+            long added = 0;
+            for (int i = depth; i > 0; i--)
+            {
+                b = Step(b, i);
+                added += i;
+            }
+            b.H += added;
+            return b;
+        }
+
+        static Mixed PassMixed(byte tag, Big body, long count, double sum, object r, int depth)
+        {
+            if (depth == 0)
+            {
+                return new Mixed { Tag = tag, Sum = sum + count, Body = body, Ref = r };
+            }
+            Mixed m = PassMixed((byte)(tag + 1), Step(body, depth), count + depth, sum + 0.5, r, depth - 1);
+            m.Sum += 1;
+            return m;
+        }
+
+        static int Depth(int n)
+        {
+            return n == 0 ? 0 : Depth(n - 1) + 1;
+        }
+
+        static long SumHuge(Huge h, int depth)
+        {
+            if (depth == 0)
+            {
+                return Checksum(h.P0) + Checksum(h.P15);
+            }
+            h.P0.A += 1;
+            h.P15.H += 2;
+            // Alternate large and small frames, so that a large frame often starts at the end of a segment.
+            return depth % 2 == 0 ? SumHuge(h, depth - 1) : SumHugeSmallFrame(h.P0, h.P15, depth - 1);
+        }
+
+        static long SumHugeSmallFrame(Big first, Big last, int depth)
+        {
+            Huge h = default(Huge);
+            h.P0 = first;
+            h.P15 = last;
+            return SumHuge(h, depth);
+        }
+
+        static long Runaway(long n)
+        {
+            return Runaway(n + 1) + 1;
+        }
+
+        static long RunawayHuge(Huge h, long n)
+        {
+            h.P7.D = n;
+            return RunawayHuge(h, n + 1) + h.P7.D;
+        }
+
+        static Big NewBig()
+        {
+            return new Big { A = 1, B = 2, C = 3, D = 4, E = 5, F = 6, G = 7, H = 8 };
+        }
+
+        [UnitTest]
+        public void struct_args_and_returns_across_segments()
+        {
+            foreach (int depth in new[] { 1, 7, 64, 300, 3000 })
+            {
+                Big expected = PassBigIterative(NewBig(), depth);
+                Big actual = PassBig(NewBig(), depth);
+                Assert.Equal(Checksum(expected), Checksum(actual));
+                Assert.Equal(expected.A, actual.A);
+                Assert.Equal(expected.H, actual.H);
+            }
+        }
+
+        [UnitTest]
+        public void mixed_args_and_returns_across_segments()
+        {
+            object marker = new object();
+            const int depth = 2000;
+            Mixed m = PassMixed(0, NewBig(), 0, 0, marker, depth);
+            Assert.Equal(depth & 0xFF, (int)m.Tag);
+            Assert.Equal(depth * 0.5 + (long)depth * (depth + 1) / 2 + depth, m.Sum);
+            Assert.Equal(Checksum(PassBigIterative(NewBig(), depth)) - 19L * depth * (depth + 1) / 2, Checksum(m.Body));
+            Assert.True(ReferenceEquals(marker, m.Ref));
+        }
+
+        [UnitTest]
+        public void recursion_past_many_segments()
+        {
+            // Well past 256 frames and 16K eval stack objects.
+            Assert.Equal(20000, Depth(20000));
+            Assert.Equal(255, Depth(255));
+            Assert.Equal(257, Depth(257));
+        }
+
+        [UnitTest]
+        public void repeated_recursion_reuses_segments()
+        {
+            // With the shrink policy on, each unwind frees segments the next descent allocates again.
+            for (int i = 0; i < 8; i++)
+            {
+                int depth = i % 2 == 0 ? 5000 : 40;
+                Assert.Equal(depth, Depth(depth));
+                Big expected = PassBigIterative(NewBig(), depth);
+                Assert.Equal(Checksum(expected), Checksum(PassBig(NewBig(), depth)));
+            }
+        }
+
+        [UnitTest]
+        public void large_frames_across_segments()
+        {
+            Huge h = default(Huge);
+            h.P0 = NewBig();
+            h.P15 = NewBig();
+            long baseline = Checksum(NewBig()) * 2;
+            foreach (int depth in new[] { 1, 2, 33, 500 })
+            {
+                // Every level adds 1 to P0.A and 2 to P15.H, weighted by 1 and 19 in the checksum.
+                Assert.Equal(baseline + depth + 38L * depth, SumHuge(h, depth));
+            }
+        }
+
+        static object InvokeDepth(int n)
+        {
+            return n == 0 ? 0 : (int)s_invokeDepth.Invoke(null, new object[] { n - 1 }) + 1;
+        }
+
+        static readonly MethodInfo s_invokeDepth = typeof(TC_DeepRecursion).GetMethod("InvokeDepthThroughNative", BindingFlags.NonPublic | BindingFlags.Static);
+
+        static int InvokeDepthThroughNative(int n)
+        {
+            // Every fourth level enters the interpreter from native code, the others call each other directly.
+            if (n == 0)
+            {
+                return 0;
+            }
+            return n % 4 == 0 ? (int)InvokeDepth(n) : InvokeDepthThroughNative(n - 1) + 1;
+        }
+
+        [UnitTest]
+        public void recursion_entered_from_native_across_segments()
+        {
+            Assert.Equal(600, InvokeDepthThroughNative(600));
+        }
+
+        // The runtime raises a catchable StackOverflowException when a stack limit is reached.
+
+        [UnitTest]
+        public void frame_stack_overflow_is_catchable()
+        {
+            try
+            {
+                Runaway(0);
+                Assert.Fail();
+            }
+            catch (StackOverflowException)
+            {
+            }
+            Assert.Equal(3000, Depth(3000));
+        }
+
+        [UnitTest]
+        public void eval_stack_overflow_is_catchable()
+        {
+            // Frames this large exhaust the eval stack before the frame stack. The frame that did not fit is
+            // popped again before unwinding, so the stacks are usable afterwards.
+            for (int i = 0; i < 2; i++)
+            {
+                try
+                {
+                    RunawayHuge(default(Huge), 0);
+                    Assert.Fail();
+                }
+                catch (StackOverflowException)
+                {
+                }
+                Big expected = PassBigIterative(NewBig(), 3000);
+                Assert.Equal(Checksum(expected), Checksum(PassBig(NewBig(), 3000)));
+            }
+        }
+    }
+}
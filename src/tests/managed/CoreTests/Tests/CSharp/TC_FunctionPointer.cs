@@ -1,69 +1,171 @@
-﻿//using AOT;
-//using test;
-//using System;
-//using System.Collections.Generic;
-//using System.Linq;
-//using System.Reflection;
-//using System.Runtime.InteropServices;
-//using System.Text;
-//using System.Threading.Tasks;
-
-
-//namespace Tests.CSharp
-//{
-//    internal class TC_FunctionPointer : GeneralTestCaseBase
-//    {
-//#if UNITY_2021_1_OR_NEWER
-//        public unsafe static int UnsafeFunc(int* x)
-//        {
-//            return *x + 1;
-//        }
-
-//        public unsafe static int UnsafeFuncPointer(delegate*<int*, int> func)
-//        {
-//            var i = 1;
-
-//            return func(&i);
-//        }
-//#endif
-
-
-//        [UnitTest]
-//        public unsafe void CallDef()
-//        {
-//#if UNITY_2021_1_OR_NEWER
-//            Assert.Equal(2, UnsafeFuncPointer(&UnsafeFunc));
-//#endif
-//        }
-
-//        [UnitTest]
-//        public unsafe void CallRef()
-//        {
-//#if UNITY_2021_1_OR_NEWER
-//            Assert.Equal(2, AOTDefs.FunctionPointer.UnsafeFuncPointer(&UnsafeFunc));
-//#endif
-//        }
-
-//        [UnmanagedFunctionPointer(CallingConvention.Winapi)]
-//        public delegate int MyAddFunc(int x);
-
-//        [MonoPInvokeCallback(typeof(MyAddFunc))]
-//        public static int MyAdd(int x)
-//        {
-//            return x + 1;
-//        }
-
-//        [UnitTest]
-//        public unsafe void CallNative()
-//        {
-//#if UNITY_2021_1_OR_NEWER
-
-//            MethodInfo method = GetType().GetMethod("MyAdd");
-//            Delegate del = Delegate.CreateDelegate(typeof(MyAddFunc), method);
-//            IntPtr funcPointer = Marshal.GetFunctionPointerForDelegate(del);
-
-//            Assert.Equal(2, ((delegate*<int, int>)funcPointer)(1));
-//#endif
-//        }
-//    }
-//}
+﻿using System;
+using System.IO;
+using System.Reflection;
+using System.Runtime.InteropServices;
+
+
+namespace Tests.CSharp
+{
+    internal class TC_FunctionPointer : GeneralTestCaseBase
+    {
+#if UNITY_2021_1_OR_NEWER
+        public unsafe static int UnsafeFunc(int* x)
+        {
+            return *x + 1;
+        }
+
+        public unsafe static int UnsafeFuncPointer(delegate*<int*, int> func)
+        {
+            var i = 1;
+
+            return func(&i);
+        }
+#endif
+
+
+        [UnitTest]
+        public unsafe void CallDef()
+        {
+#if UNITY_2021_1_OR_NEWER
+            Assert.Equal(2, UnsafeFuncPointer(&UnsafeFunc));
+#endif
+        }
+
+        [UnitTest]
+        public unsafe void CallRef()
+        {
+#if UNITY_2021_1_OR_NEWER
+            Assert.Equal(2, AOTDefs.FunctionPointer.UnsafeFuncPointer(&UnsafeFunc));
+#endif
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Winapi)]
+        public delegate int MyAddFunc(int x);
+
+        public static int MyAdd(int x)
+        {
+            return x + 1;
+        }
+
+        [UnitTest]
+        public unsafe void CallNative()
+        {
+            MethodInfo method = GetType().GetMethod("MyAdd");
+            Delegate del = Delegate.CreateDelegate(typeof(MyAddFunc), method);
+            IntPtr funcPointer = Marshal.GetFunctionPointerForDelegate(del);
+            Assert.True(funcPointer != default(IntPtr));
+
+            MyAddFunc func = (MyAddFunc)Marshal.GetDelegateForFunctionPointer(funcPointer, typeof(MyAddFunc));
+            Assert.Equal(2, func(1));
+#if UNITY_2021_1_OR_NEWER
+            Assert.Equal(2, ((delegate* unmanaged[Stdcall]<int, int>)funcPointer)(1));
+#endif
+        }
+
+        // The C runtime calls the comparers through their thunks, so these tests cover the native to managed path.
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate int CompareFunc(IntPtr a, IntPtr b);
+
+        [DllImport("__Internal", EntryPoint = "qsort", CallingConvention = CallingConvention.Cdecl)]
+        private static extern void LibcQsort(IntPtr values, IntPtr count, IntPtr size, IntPtr compare);
+
+        [DllImport("msvcrt", EntryPoint = "qsort", CallingConvention = CallingConvention.Cdecl)]
+        private static extern void MsvcrtQsort(IntPtr values, IntPtr count, IntPtr size, IntPtr compare);
+
+        private class Comparer
+        {
+            private readonly int _direction;
+            public int calls;
+
+            public Comparer(int direction)
+            {
+                _direction = direction;
+            }
+
+            public int Compare(IntPtr a, IntPtr b)
+            {
+                ++calls;
+                return Marshal.ReadInt32(a).CompareTo(Marshal.ReadInt32(b)) * _direction;
+            }
+        }
+
+        private static int CompareAscending(IntPtr a, IntPtr b)
+        {
+            return Marshal.ReadInt32(a).CompareTo(Marshal.ReadInt32(b));
+        }
+
+        private static unsafe int[] Sort(IntPtr compare)
+        {
+            int[] values = { 5, 3, 9, 1, 7 };
+            fixed (int* p = values)
+            {
+                if (Path.DirectorySeparatorChar == '\\')
+                {
+                    MsvcrtQsort((IntPtr)p, (IntPtr)values.Length, (IntPtr)sizeof(int), compare);
+                }
+                else
+                {
+                    LibcQsort((IntPtr)p, (IntPtr)values.Length, (IntPtr)sizeof(int), compare);
+                }
+            }
+            return values;
+        }
+
+        private static void AssertSorted(int[] values, int direction)
+        {
+            for (int i = 1; i < values.Length; i++)
+            {
+                Assert.True(values[i - 1].CompareTo(values[i]) * direction < 0);
+            }
+        }
+
+        [UnitTest]
+        public void CallFromNative()
+        {
+            var comparer = new Comparer(-1);
+            CompareFunc compare = comparer.Compare;
+            AssertSorted(Sort(Marshal.GetFunctionPointerForDelegate(compare)), -1);
+            Assert.True(comparer.calls > 0);
+        }
+
+        // More delegates of one signature than a thunk pool holds, which is 8 by default.
+        private const int ManyDelegates = 40;
+
+        [UnitTest]
+        public void ManyDelegatesOfSameMethod()
+        {
+            var delegates = new CompareFunc[ManyDelegates];
+            var pointers = new IntPtr[ManyDelegates];
+            for (int i = 0; i < ManyDelegates; i++)
+            {
+                delegates[i] = new CompareFunc(CompareAscending);
+                pointers[i] = Marshal.GetFunctionPointerForDelegate(delegates[i]);
+            }
+            for (int i = 0; i < ManyDelegates; i++)
+            {
+                AssertSorted(Sort(pointers[i]), 1);
+            }
+            GC.KeepAlive(delegates);
+        }
+
+        [UnitTest]
+        public void ManyDelegatesWithHandles()
+        {
+            for (int i = 0; i < ManyDelegates; i++)
+            {
+                var comparer = new Comparer(i % 2 == 0 ? 1 : -1);
+                CompareFunc compare = comparer.Compare;
+                GCHandle handle = GCHandle.Alloc(compare);
+                try
+                {
+                    AssertSorted(Sort(Marshal.GetFunctionPointerForDelegate(compare)), i % 2 == 0 ? 1 : -1);
+                    Assert.True(comparer.calls > 0);
+                }
+                finally
+                {
+                    handle.Free();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,100 @@
+﻿using System;
+
+namespace System.Numerics
+{
+    // Same namespace, names and layout as the corlib vector types, with different semantics. Calls to them
+    // must not be lowered to the vector instructions, which only the assemblies shipping the real types get.
+    internal struct Vector2
+    {
+        public float X, Y;
+
+        public Vector2(float x, float y)
+        {
+            X = x;
+            Y = y;
+        }
+
+        public static Vector2 operator +(Vector2 a, Vector2 b)
+        {
+            return new Vector2(a.X * b.X, a.Y * b.Y);
+        }
+
+        public static Vector2 operator *(Vector2 a, float s)
+        {
+            return new Vector2(a.X + s, a.Y + s);
+        }
+
+        public static float Dot(Vector2 a, Vector2 b)
+        {
+            return a.X - b.X;
+        }
+
+        public float Length()
+        {
+            return X + Y;
+        }
+    }
+
+    internal struct Vector4
+    {
+        public float X, Y, Z, W;
+
+        public Vector4(float x, float y, float z, float w)
+        {
+            X = x;
+            Y = y;
+            Z = z;
+            W = w;
+        }
+
+        public static Vector4 operator -(Vector4 a)
+        {
+            return new Vector4(a.W, a.Z, a.Y, a.X);
+        }
+
+        public static Vector4 Lerp(Vector4 a, Vector4 b, float t)
+        {
+            return new Vector4(t, t, t, t);
+        }
+    }
+}
+
+namespace Tests.CSharp
+{
+    internal class TC_UserNumericsVector : GeneralTestCaseBase
+    {
+        [UnitTest]
+        public void user_vector2_operators_are_not_lowered()
+        {
+            var a = new System.Numerics.Vector2(2f, 3f);
+            var b = new System.Numerics.Vector2(4f, 5f);
+            var sum = a + b;
+            Assert.Equal(8f, sum.X);
+            Assert.Equal(15f, sum.Y);
+            var scaled = a * 10f;
+            Assert.Equal(12f, scaled.X);
+            Assert.Equal(13f, scaled.Y);
+        }
+
+        [UnitTest]
+        public void user_vector2_methods_are_not_lowered()
+        {
+            var a = new System.Numerics.Vector2(2f, 3f);
+            var b = new System.Numerics.Vector2(4f, 5f);
+            Assert.Equal(-2f, System.Numerics.Vector2.Dot(a, b));
+            Assert.Equal(5f, a.Length());
+        }
+
+        [UnitTest]
+        public void user_vector4_methods_are_not_lowered()
+        {
+            var a = new System.Numerics.Vector4(1f, 2f, 3f, 4f);
+            var negated = -a;
+            Assert.Equal(4f, negated.X);
+            Assert.Equal(1f, negated.W);
+            var lerped = System.Numerics.Vector4.Lerp(a, negated, 0.25f);
+            Assert.Equal(0.25f, lerped.X);
+            Assert.Equal(0.25f, lerped.W);
+        }
+    }
+}
@@ -0,0 +1,210 @@
+﻿
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+using Test;
+
+namespace Tests.Instruments.Arrays
+{
+    internal class TC_MdArray_i : GeneralTestCaseBase
+    {
+
+        [UnitTest]
+        public void ld_1()
+        {
+            var arr = new IntPtr[2, 3] { { (IntPtr)1, (IntPtr)2, (IntPtr)3 }, { (IntPtr)11, (IntPtr)12, (IntPtr)13 } };
+            var x = arr[1, 1];
+            Assert.Equal(12L, (long)x);
+            arr[1, 1] = (IntPtr)22;
+            var x2 = arr[1, 1];
+            Assert.Equal(22L, (long)x2);
+            Assert.Equal(1L, (long)arr[0, 0]);
+            Assert.Equal(2L, (long)arr[0, 1]);
+            Assert.Equal(3L, (long)arr[0, 2]);
+            Assert.Equal(11L, (long)arr[1, 0]);
+            Assert.Equal(13L, (long)arr[1, 2]);
+        }
+
+        [UnitTest]
+        public void extend_on_load()
+        {
+            var arr = new IntPtr[2, 3];
+            arr[0, 1] = (IntPtr)(-1);
+            arr[1, 2] = (IntPtr)int.MaxValue;
+            long lo = (long)arr[0, 1];
+            long hi = (long)arr[1, 2];
+            Assert.Equal(-1L, lo);
+            Assert.Equal((long)int.MaxValue, hi);
+            var arr3 = new IntPtr[2, 3, 4];
+            arr3[1, 2, 3] = (IntPtr)(-1);
+            arr3[0, 1, 2] = (IntPtr)int.MaxValue;
+            long lo3 = (long)arr3[1, 2, 3];
+            long hi3 = (long)arr3[0, 1, 2];
+            Assert.Equal(-1L, lo3);
+            Assert.Equal((long)int.MaxValue, hi3);
+        }
+
+        [UnitTest]
+        public void rank3()
+        {
+            var arr = new IntPtr[2, 3, 4];
+            for (int i = 0; i < 2; i++)
+                for (int j = 0; j < 3; j++)
+                    for (int k = 0; k < 4; k++)
+                        arr[i, j, k] = (IntPtr)(i * 100 + j * 10 + k);
+            Assert.Equal(0L, (long)arr[0, 0, 0]);
+            Assert.Equal(23L, (long)arr[0, 2, 3]);
+            Assert.Equal(112L, (long)arr[1, 1, 2]);
+            Assert.Equal(123L, (long)arr[1, 2, 3]);
+        }
+
+        [UnitTest]
+        public void address()
+        {
+            var arr = new IntPtr[2, 3];
+            ref IntPtr x = ref arr[1, 2];
+            x = (IntPtr)(-1);
+            Assert.Equal(-1L, (long)arr[1, 2]);
+            var arr3 = new IntPtr[2, 2, 2];
+            ref IntPtr y = ref arr3[1, 0, 1];
+            y = (IntPtr)int.MaxValue;
+            Assert.Equal((long)int.MaxValue, (long)arr3[1, 0, 1]);
+        }
+
+        [UnitTest]
+        public void lower_bounds()
+        {
+            var arr = (IntPtr[,])Array.CreateInstance(typeof(IntPtr), new int[] { 2, 3 }, new int[] { -1, 5 });
+            arr[-1, 5] = (IntPtr)(-1);
+            arr[0, 7] = (IntPtr)int.MaxValue;
+            Assert.Equal(-1L, (long)arr[-1, 5]);
+            Assert.Equal((long)int.MaxValue, (long)arr[0, 7]);
+            Assert.Equal(0L, (long)arr[0, 6]);
+            ref IntPtr x = ref arr[-1, 6];
+            x = (IntPtr)int.MaxValue;
+            Assert.Equal((long)int.MaxValue, (long)arr[-1, 6]);
+            Assert.True(ThrowsOutOfRange(arr, -2, 5));
+            Assert.True(ThrowsOutOfRange(arr, 1, 5));
+            Assert.True(ThrowsOutOfRange(arr, -1, 4));
+            Assert.True(ThrowsOutOfRange(arr, 0, 8));
+            Assert.True(ThrowsOutOfRange(arr, 0, 0));
+
+            var arr3 = (IntPtr[,,])Array.CreateInstance(typeof(IntPtr), new int[] { 2, 2, 3 }, new int[] { 1, -2, 10 });
+            arr3[2, -1, 12] = (IntPtr)int.MaxValue;
+            Assert.Equal((long)int.MaxValue, (long)arr3[2, -1, 12]);
+            Assert.Equal(0L, (long)arr3[1, -2, 10]);
+            Assert.True(ThrowsOutOfRange(arr3, 0, -2, 10));
+            Assert.True(ThrowsOutOfRange(arr3, 3, -2, 10));
+            Assert.True(ThrowsOutOfRange(arr3, 1, -3, 10));
+            Assert.True(ThrowsOutOfRange(arr3, 1, 0, 10));
+            Assert.True(ThrowsOutOfRange(arr3, 1, -2, 9));
+            Assert.True(ThrowsOutOfRange(arr3, 1, -2, 13));
+        }
+
+        [UnitTest]
+        public void out_of_range_per_dimension()
+        {
+            var arr = new IntPtr[2, 3];
+            Assert.True(ThrowsOutOfRange(arr, -1, 0));
+            Assert.True(ThrowsOutOfRange(arr, 2, 0));
+            Assert.True(ThrowsOutOfRange(arr, 0, -1));
+            Assert.True(ThrowsOutOfRange(arr, 0, 3));
+            Assert.True(ThrowsOutOfRange(arr, int.MinValue, 0));
+            Assert.True(ThrowsOutOfRange(arr, 0, int.MaxValue));
+            var arr3 = new IntPtr[2, 3, 4];
+            Assert.True(ThrowsOutOfRange(arr3, -1, 0, 0));
+            Assert.True(ThrowsOutOfRange(arr3, 2, 0, 0));
+            Assert.True(ThrowsOutOfRange(arr3, 0, -1, 0));
+            Assert.True(ThrowsOutOfRange(arr3, 0, 3, 0));
+            Assert.True(ThrowsOutOfRange(arr3, 0, 0, -1));
+            Assert.True(ThrowsOutOfRange(arr3, 0, 0, 4));
+        }
+
+        [UnitTest]
+        public void null_array()
+        {
+            IntPtr[,] arr = null;
+            try
+            {
+                var s = arr[0, 0];
+                Assert.Fail();
+            }
+            catch (NullReferenceException)
+            {
+            }
+            IntPtr[,,] arr3 = null;
+            try
+            {
+                arr3[0, 0, 0] = (IntPtr)int.MaxValue;
+                Assert.Fail();
+            }
+            catch (NullReferenceException)
+            {
+            }
+        }
+
+        // Checks that get, set and address of the element all throw.
+        private static bool ThrowsOutOfRange(IntPtr[,] arr, int i, int j)
+        {
+            int thrown = 0;
+            try
+            {
+                var s = arr[i, j];
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            try
+            {
+                arr[i, j] = (IntPtr)int.MaxValue;
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            try
+            {
+                ref IntPtr x = ref arr[i, j];
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            return thrown == 3;
+        }
+
+        private static bool ThrowsOutOfRange(IntPtr[,,] arr, int i, int j, int k)
+        {
+            int thrown = 0;
+            try
+            {
+                var s = arr[i, j, k];
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            try
+            {
+                arr[i, j, k] = (IntPtr)int.MaxValue;
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            try
+            {
+                ref IntPtr x = ref arr[i, j, k];
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            return thrown == 3;
+        }
+    }
+}
@@ -28,6 +28,83 @@ namespace Tests.Instruments.Arrays
             Assert.Equal(13, arr[1, 2]);
         }
 
+        [UnitTest]
+        public void rank3()
+        {
+            var arr = new int[2, 3, 4];
+            for (int i = 0; i < 2; i++)
+                for (int j = 0; j < 3; j++)
+                    for (int k = 0; k < 4; k++)
+                        arr[i, j, k] = i * 100 + j * 10 + k;
+            Assert.Equal(0, arr[0, 0, 0]);
+            Assert.Equal(23, arr[0, 2, 3]);
+            Assert.Equal(112, arr[1, 1, 2]);
+            Assert.Equal(123, arr[1, 2, 3]);
+        }
+
+        [UnitTest]
+        public void address()
+        {
+            var arr = new int[2, 3];
+            ref int x = ref arr[1, 2];
+            x = 7;
+            Assert.Equal(7, arr[1, 2]);
+            var arr3 = new int[2, 2, 2];
+            ref int y = ref arr3[1, 0, 1];
+            y = 9;
+            Assert.Equal(9, arr3[1, 0, 1]);
+        }
+
+        [UnitTest]
+        public void lower_bounds()
+        {
+            var arr = (int[,])Array.CreateInstance(typeof(int), new int[] { 2, 3 }, new int[] { -1, 5 });
+            arr[-1, 5] = 1;
+            arr[0, 7] = 2;
+            Assert.Equal(1, arr[-1, 5]);
+            Assert.Equal(2, arr[0, 7]);
+            Assert.Equal(0, arr[0, 6]);
+            try
+            {
+                var s = arr[0, 4];
+                Assert.Fail();
+            }
+            catch (IndexOutOfRangeException)
+            {
+            }
+        }
+
+        [UnitTest]
+        public void out_of_range()
+        {
+            var arr = new int[2, 3];
+            try
+            {
+                var s = arr[1, -1];
+                Assert.Fail();
+            }
+            catch (IndexOutOfRangeException)
+            {
+            }
+            try
+            {
+                arr[2, 0] = 1;
+                Assert.Fail();
+            }
+            catch (IndexOutOfRangeException)
+            {
+            }
+            var arr3 = new int[2, 2, 2];
+            try
+            {
+                var s = arr3[0, 2, 0];
+                Assert.Fail();
+            }
+            catch (IndexOutOfRangeException)
+            {
+            }
+        }
+
         //[UnitTest]
         //public void OutOfRange_lower()
         //{
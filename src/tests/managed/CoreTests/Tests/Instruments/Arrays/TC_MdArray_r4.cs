@@ -0,0 +1,37 @@
+﻿
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+using Test;
+
+namespace Tests.Instruments.Arrays
+{
+    internal class TC_MdArray_r4 : GeneralTestCaseBase
+    {
+
+        [UnitTest]
+        public void ld_1()
+        {
+            var arr = new float[2, 3] { { 1.5f, 2, 3 }, { 11, 12.25f, 13 } };
+            Assert.Equal(12.25f, arr[1, 1]);
+            arr[1, 1] = -22.5f;
+            Assert.Equal(-22.5f, arr[1, 1]);
+            Assert.Equal(1.5f, arr[0, 0]);
+            Assert.Equal(13f, arr[1, 2]);
+        }
+
+        [UnitTest]
+        public void rank3()
+        {
+            var arr = new float[2, 2, 3];
+            arr[1, 1, 2] = 0.5f;
+            arr[0, 1, 0] = -4f;
+            Assert.Equal(0.5f, arr[1, 1, 2]);
+            Assert.Equal(-4f, arr[0, 1, 0]);
+            Assert.Equal(0f, arr[1, 0, 2]);
+        }
+    }
+}
@@ -0,0 +1,37 @@
+﻿
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+using Test;
+
+namespace Tests.Instruments.Arrays
+{
+    internal class TC_MdArray_r8 : GeneralTestCaseBase
+    {
+
+        [UnitTest]
+        public void ld_1()
+        {
+            var arr = new double[2, 3] { { 1.5, 2, 3 }, { 11, 12.25, 13 } };
+            Assert.Equal(12.25, arr[1, 1]);
+            arr[1, 1] = -22.5;
+            Assert.Equal(-22.5, arr[1, 1]);
+            Assert.Equal(1.5, arr[0, 0]);
+            Assert.Equal(13, arr[1, 2]);
+        }
+
+        [UnitTest]
+        public void rank3()
+        {
+            var arr = new double[2, 2, 3];
+            arr[1, 1, 2] = 0.5;
+            arr[0, 1, 0] = -4;
+            Assert.Equal(0.5, arr[1, 1, 2]);
+            Assert.Equal(-4, arr[0, 1, 0]);
+            Assert.Equal(0, arr[1, 0, 2]);
+        }
+    }
+}
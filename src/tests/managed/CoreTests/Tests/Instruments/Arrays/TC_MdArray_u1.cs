@@ -28,6 +28,185 @@ namespace Tests.Instruments.Arrays
             Assert.Equal(13, arr[1, 2]);
         }
 
+        [UnitTest]
+        public void extend_on_load()
+        {
+            var arr = new byte[2, 3];
+            arr[0, 1] = byte.MaxValue;
+            arr[1, 2] = (byte)0x80;
+            int lo = arr[0, 1];
+            int hi = arr[1, 2];
+            Assert.Equal(255, lo);
+            Assert.Equal(128, hi);
+            var arr3 = new byte[2, 3, 4];
+            arr3[1, 2, 3] = byte.MaxValue;
+            arr3[0, 1, 2] = (byte)0x80;
+            int lo3 = arr3[1, 2, 3];
+            int hi3 = arr3[0, 1, 2];
+            Assert.Equal(255, lo3);
+            Assert.Equal(128, hi3);
+        }
+
+        [UnitTest]
+        public void rank3()
+        {
+            var arr = new byte[2, 3, 4];
+            for (int i = 0; i < 2; i++)
+                for (int j = 0; j < 3; j++)
+                    for (int k = 0; k < 4; k++)
+                        arr[i, j, k] = (byte)(i * 100 + j * 10 + k);
+            Assert.Equal(0, arr[0, 0, 0]);
+            Assert.Equal(23, arr[0, 2, 3]);
+            Assert.Equal(112, arr[1, 1, 2]);
+            Assert.Equal(123, arr[1, 2, 3]);
+        }
+
+        [UnitTest]
+        public void address()
+        {
+            var arr = new byte[2, 3];
+            ref byte x = ref arr[1, 2];
+            x = byte.MaxValue;
+            Assert.Equal(255, arr[1, 2]);
+            var arr3 = new byte[2, 2, 2];
+            ref byte y = ref arr3[1, 0, 1];
+            y = (byte)0x80;
+            Assert.Equal(128, arr3[1, 0, 1]);
+        }
+
+        [UnitTest]
+        public void lower_bounds()
+        {
+            var arr = (byte[,])Array.CreateInstance(typeof(byte), new int[] { 2, 3 }, new int[] { -1, 5 });
+            arr[-1, 5] = byte.MaxValue;
+            arr[0, 7] = (byte)0x80;
+            Assert.Equal(255, arr[-1, 5]);
+            Assert.Equal(128, arr[0, 7]);
+            Assert.Equal(0, arr[0, 6]);
+            ref byte x = ref arr[-1, 6];
+            x = (byte)0x80;
+            Assert.Equal(128, arr[-1, 6]);
+            Assert.True(ThrowsOutOfRange(arr, -2, 5));
+            Assert.True(ThrowsOutOfRange(arr, 1, 5));
+            Assert.True(ThrowsOutOfRange(arr, -1, 4));
+            Assert.True(ThrowsOutOfRange(arr, 0, 8));
+            Assert.True(ThrowsOutOfRange(arr, 0, 0));
+
+            var arr3 = (byte[,,])Array.CreateInstance(typeof(byte), new int[] { 2, 2, 3 }, new int[] { 1, -2, 10 });
+            arr3[2, -1, 12] = (byte)0x80;
+            Assert.Equal(128, arr3[2, -1, 12]);
+            Assert.Equal(0, arr3[1, -2, 10]);
+            Assert.True(ThrowsOutOfRange(arr3, 0, -2, 10));
+            Assert.True(ThrowsOutOfRange(arr3, 3, -2, 10));
+            Assert.True(ThrowsOutOfRange(arr3, 1, -3, 10));
+            Assert.True(ThrowsOutOfRange(arr3, 1, 0, 10));
+            Assert.True(ThrowsOutOfRange(arr3, 1, -2, 9));
+            Assert.True(ThrowsOutOfRange(arr3, 1, -2, 13));
+        }
+
+        [UnitTest]
+        public void out_of_range_per_dimension()
+        {
+            var arr = new byte[2, 3];
+            Assert.True(ThrowsOutOfRange(arr, -1, 0));
+            Assert.True(ThrowsOutOfRange(arr, 2, 0));
+            Assert.True(ThrowsOutOfRange(arr, 0, -1));
+            Assert.True(ThrowsOutOfRange(arr, 0, 3));
+            Assert.True(ThrowsOutOfRange(arr, int.MinValue, 0));
+            Assert.True(ThrowsOutOfRange(arr, 0, int.MaxValue));
+            var arr3 = new byte[2, 3, 4];
+            Assert.True(ThrowsOutOfRange(arr3, -1, 0, 0));
+            Assert.True(ThrowsOutOfRange(arr3, 2, 0, 0));
+            Assert.True(ThrowsOutOfRange(arr3, 0, -1, 0));
+            Assert.True(ThrowsOutOfRange(arr3, 0, 3, 0));
+            Assert.True(ThrowsOutOfRange(arr3, 0, 0, -1));
+            Assert.True(ThrowsOutOfRange(arr3, 0, 0, 4));
+        }
+
+        [UnitTest]
+        public void null_array()
+        {
+            byte[,] arr = null;
+            try
+            {
+                var s = arr[0, 0];
+                Assert.Fail();
+            }
+            catch (NullReferenceException)
+            {
+            }
+            byte[,,] arr3 = null;
+            try
+            {
+                arr3[0, 0, 0] = (byte)0x80;
+                Assert.Fail();
+            }
+            catch (NullReferenceException)
+            {
+            }
+        }
+
+        // Checks that get, set and address of the element all throw.
+        private static bool ThrowsOutOfRange(byte[,] arr, int i, int j)
+        {
+            int thrown = 0;
+            try
+            {
+                var s = arr[i, j];
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            try
+            {
+                arr[i, j] = (byte)0x80;
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            try
+            {
+                ref byte x = ref arr[i, j];
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            return thrown == 3;
+        }
+
+        private static bool ThrowsOutOfRange(byte[,,] arr, int i, int j, int k)
+        {
+            int thrown = 0;
+            try
+            {
+                var s = arr[i, j, k];
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            try
+            {
+                arr[i, j, k] = (byte)0x80;
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            try
+            {
+                ref byte x = ref arr[i, j, k];
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown++;
+            }
+            return thrown == 3;
+        }
+
         //[UnitTest]
         //public void OutOfRange_lower()
         //{
@@ -0,0 +1,130 @@
+﻿
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+using Test;
+
+namespace Tests.Instruments.Arrays
+{
+    // Loops whose bounds checks the transformer may drop, and variations on them that must keep their checks.
+    internal class TC_bounds_check_elimination : GeneralTestCaseBase
+    {
+        private static int[] Iota(int length)
+        {
+            var arr = new int[length];
+            for (int i = 0; i < arr.Length; i++)
+            {
+                arr[i] = i + 1;
+            }
+            return arr;
+        }
+
+        [UnitTest]
+        public void canonical_loop()
+        {
+            var arr = Iota(10);
+            int sum = 0;
+            for (int i = 0; i < arr.Length; i++)
+            {
+                sum += arr[i];
+            }
+            Assert.Equal(55, sum);
+            Assert.Equal(1, arr[0]);
+            Assert.Equal(10, arr[9]);
+        }
+
+        [UnitTest]
+        public void reassigned_in_loop()
+        {
+            var arr = new int[10];
+            var shorter = new int[3];
+            int last = -1;
+            try
+            {
+                for (int i = 0; i < arr.Length; i++)
+                {
+                    if (i == 5)
+                    {
+                        arr = shorter;
+                    }
+                    arr[i] = i;
+                    last = i;
+                }
+                Assert.Fail();
+            }
+            catch (IndexOutOfRangeException)
+            {
+            }
+            Assert.Equal(4, last);
+        }
+
+        [UnitTest]
+        public void decrementing_index()
+        {
+            var arr = Iota(10);
+            int sum = 0;
+            int first = 0;
+            for (int i = arr.Length - 1; i >= 0; i--)
+            {
+                sum += arr[i];
+                first = arr[i];
+            }
+            Assert.Equal(55, sum);
+            Assert.Equal(1, first);
+            try
+            {
+                for (int i = arr.Length; i >= 0; i--)
+                {
+                    sum += arr[i];
+                }
+                Assert.Fail();
+            }
+            catch (IndexOutOfRangeException)
+            {
+            }
+        }
+
+        private static int GetOrDefault(int[] arr, int index)
+        {
+            if ((uint)index < (uint)arr.Length)
+            {
+                return arr[index];
+            }
+            return -1;
+        }
+
+        [UnitTest]
+        public void unsigned_guard()
+        {
+            var arr = Iota(4);
+            Assert.Equal(1, GetOrDefault(arr, 0));
+            Assert.Equal(4, GetOrDefault(arr, 3));
+            Assert.Equal(-1, GetOrDefault(arr, 4));
+            Assert.Equal(-1, GetOrDefault(arr, -1));
+            Assert.Equal(-1, GetOrDefault(arr, int.MinValue));
+            Assert.Equal(-1, GetOrDefault(new int[0], 0));
+        }
+
+        [UnitTest]
+        public void negative_start()
+        {
+            var arr = Iota(10);
+            int sum = 0;
+            try
+            {
+                for (int i = -1; i < arr.Length; i++)
+                {
+                    sum += arr[i];
+                }
+                Assert.Fail();
+            }
+            catch (IndexOutOfRangeException)
+            {
+            }
+            Assert.Equal(0, sum);
+        }
+    }
+}
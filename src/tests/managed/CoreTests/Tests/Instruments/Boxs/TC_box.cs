@@ -70,5 +70,113 @@ namespace Tests.Instruments.Boxs
             var y = Box(x);
             Assert.True(ReferenceEquals(x, y));
         }
+
+        // The generic helpers below compile to box T followed by unbox.any, brtrue, isinst or a null
+        // compare, which the transformer folds when T is a value type.
+        private static bool IsNull<T>(T value)
+        {
+            return value == null;
+        }
+
+        private static bool IsNotNullBranch<T>(T value)
+        {
+            if (value != null)
+            {
+                return true;
+            }
+            return false;
+        }
+
+        private static bool IsComparable<T>(T value)
+        {
+            if (value is IComparable)
+            {
+                return true;
+            }
+            return false;
+        }
+
+        private static bool IsComparableValue<T>(T value)
+        {
+            return value is IComparable;
+        }
+
+        private interface IFoldShape
+        {
+            int Sides();
+        }
+
+        // Only referenced by fold_isinst_interface, so the box/isinst fold sees it before anything initializes it.
+        private struct FoldSquare : IFoldShape
+        {
+            public int Sides() { return 4; }
+        }
+
+        private struct FoldPoint
+        {
+            public int x;
+        }
+
+        private static bool IsShape<T>(T value)
+        {
+            if (value is IFoldShape)
+            {
+                return true;
+            }
+            return false;
+        }
+
+        private static bool IsShapeValue<T>(T value)
+        {
+            return value is IFoldShape;
+        }
+
+        private static T RoundTrip<T>(T value)
+        {
+            return (T)(object)value;
+        }
+
+        [UnitTest]
+        public void fold_null_check()
+        {
+            Assert.False(IsNull(5));
+            Assert.False(IsNull(new ValueTypeSize1 { x1 = 1 }));
+            Assert.True(IsNull<string>(null));
+            Assert.True(IsNull<int?>(null));
+            Assert.False(IsNull<int?>(3));
+            Assert.True(IsNotNullBranch(5));
+            Assert.True(IsNotNullBranch(AOT_Enum_byte.A));
+            Assert.False(IsNotNullBranch<int?>(null));
+            Assert.False(IsNotNullBranch<object>(null));
+        }
+
+        [UnitTest]
+        public void fold_isinst()
+        {
+            Assert.True(IsComparable(5));
+            Assert.True(IsComparableValue(2.0));
+            Assert.False(IsComparable(new ValueTypeSize1 { x1 = 1 }));
+            Assert.False(IsComparableValue(new ValueTypeSize1 { x1 = 1 }));
+            Assert.True(IsComparable("a"));
+            Assert.False(IsComparable<object>(null));
+        }
+
+        [UnitTest]
+        public void fold_isinst_interface()
+        {
+            Assert.True(IsShape(new FoldSquare()));
+            Assert.True(IsShapeValue(new FoldSquare()));
+            Assert.False(IsShape(new FoldPoint { x = 1 }));
+            Assert.False(IsShapeValue(new FoldPoint { x = 1 }));
+        }
+
+        [UnitTest]
+        public void fold_unbox_any()
+        {
+            Assert.Equal(7, RoundTrip(7));
+            Assert.Equal(3, RoundTrip<int?>(3).Value);
+            Assert.False(RoundTrip<int?>(null).HasValue);
+            Assert.Equal(9L, RoundTrip(new ValueTypeSize16 { x1 = 9 }).x1);
+        }
     }
 }
@@ -387,5 +387,59 @@ namespace Tests.Instruments.Exceptions
         {
             Assert.Equal(3, Rethrow_Return3());
         }
+
+        private static void ThrowByKind(int kind)
+        {
+            if (kind == 0)
+            {
+                throw new ArgumentException();
+            }
+            if (kind == 1)
+            {
+                throw new InvalidOperationException();
+            }
+            throw new NotSupportedException();
+        }
+
+        public static int CatchByKind(int kind)
+        {
+            int a = 0;
+            try
+            {
+                try
+                {
+                    a += 1;
+                    ThrowByKind(kind);
+                }
+                catch (ArgumentException)
+                {
+                    a += 10;
+                }
+                catch (InvalidOperationException)
+                {
+                    a += 100;
+                }
+                finally
+                {
+                    a += 1000;
+                }
+            }
+            catch (Exception)
+            {
+                a += 10000;
+            }
+            return a;
+        }
+
+        [UnitTest]
+        public void same_throw_site_different_classes()
+        {
+            for (int i = 0; i < 3; i++)
+            {
+                Assert.Equal(1011, CatchByKind(0));
+                Assert.Equal(1101, CatchByKind(1));
+                Assert.Equal(11001, CatchByKind(2));
+            }
+        }
     }
 }
@@ -287,5 +287,47 @@ namespace Tests.Instruments.Fields
             Assert.Equal(AOT_Enum_byte.A, InterpTypeStaticFields2.e1);
             InterpTypeStaticFields2.s16 = new ValueTypeSize16 { x1 = 8 };
         }
+
+        class StaticCounter
+        {
+            public static int count;
+            public static short small;
+            public static long total;
+            public static ValueTypeSize16 block;
+            public static int seenInCctor;
+
+            static StaticCounter()
+            {
+                // Accesses while the cctor runs must not be rewritten to the pre-initialized form.
+                for (int i = 0; i < 3; i++)
+                {
+                    count++;
+                }
+                seenInCctor = count;
+            }
+
+            public static void Bump(ref int value)
+            {
+                value += 2;
+            }
+        }
+
+        [UnitTest]
+        public void repeated_access_after_cctor()
+        {
+            for (int i = 0; i < 100; i++)
+            {
+                StaticCounter.count++;
+                StaticCounter.small += 2;
+                StaticCounter.total += StaticCounter.count;
+                StaticCounter.Bump(ref StaticCounter.count);
+                StaticCounter.block = new ValueTypeSize16 { x1 = i };
+            }
+            Assert.Equal(3, StaticCounter.seenInCctor);
+            Assert.Equal(303, StaticCounter.count);
+            Assert.Equal(200, StaticCounter.small);
+            Assert.Equal(99, StaticCounter.block.x1);
+            Assert.Equal(15250L, StaticCounter.total);
+        }
     }
 }
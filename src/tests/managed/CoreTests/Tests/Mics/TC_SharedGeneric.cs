@@ -0,0 +1,140 @@
+﻿
+using test;
+using System;
+using System.Collections.Generic;
+
+namespace Tests.Mics
+{
+    // Instantiations over reference types share the interpreter code of the System.Object instantiation;
+    // everything that depends on T must still resolve to the instantiation's own types and statics.
+    public class TC_SharedGeneric : GeneralTestCaseBase
+    {
+        class Animal
+        {
+        }
+
+        class Dog : Animal
+        {
+        }
+
+        class Holder<T> where T : class
+        {
+            public static int s_count;
+            public T value;
+
+            public Holder(T value)
+            {
+                this.value = value;
+                s_count++;
+            }
+
+            public T[] ToArray(int length)
+            {
+                T[] arr = new T[length];
+                for (int i = 0; i < arr.Length; i++)
+                {
+                    arr[i] = value;
+                }
+                return arr;
+            }
+
+            public Type GetArgType()
+            {
+                return typeof(T);
+            }
+
+            public bool Accepts(object o)
+            {
+                return o is T;
+            }
+
+            public T Cast(object o)
+            {
+                return (T)o;
+            }
+
+            public bool IsSameAsObject()
+            {
+                return typeof(T) == typeof(object);
+            }
+
+            public Type CatchAs(Exception e)
+            {
+                try
+                {
+                    throw e;
+                }
+                catch (ArgumentException)
+                {
+                    return typeof(T);
+                }
+            }
+        }
+
+        static List<T> MakeList<T>(T a, T b)
+        {
+            return new List<T> { a, b };
+        }
+
+        [UnitTest]
+        public void static_fields_per_instantiation()
+        {
+            new Holder<string>("a");
+            new Holder<string>("b");
+            new Holder<object>(1);
+            new Holder<Animal>(new Dog());
+            Assert.Equal(2, Holder<string>.s_count);
+            Assert.Equal(1, Holder<object>.s_count);
+            Assert.Equal(1, Holder<Animal>.s_count);
+            Assert.Equal(0, Holder<Dog>.s_count);
+        }
+
+        [UnitTest]
+        public void newarr_and_ldtoken()
+        {
+            string[] strs = new Holder<string>("x").ToArray(3);
+            Assert.Equal(3, strs.Length);
+            Assert.Equal("x", strs[2]);
+            Assert.Equal(typeof(string[]), strs.GetType());
+            Assert.Equal(typeof(Animal[]), new Holder<Animal>(new Dog()).ToArray(1).GetType());
+            Assert.Equal(typeof(string), new Holder<string>("x").GetArgType());
+            Assert.Equal(typeof(Animal), new Holder<Animal>(null).GetArgType());
+            Assert.True(new Holder<object>(null).IsSameAsObject());
+            Assert.False(new Holder<string>(null).IsSameAsObject());
+        }
+
+        [UnitTest]
+        public void casts()
+        {
+            var animals = new Holder<Animal>(null);
+            Assert.True(animals.Accepts(new Dog()));
+            Assert.False(animals.Accepts("dog"));
+            Assert.True(new Holder<string>(null).Accepts("dog"));
+            Assert.False(new Holder<Dog>(null).Accepts(new Animal()));
+            Assert.True(new Holder<object>(null).Accepts(new Animal()));
+            Assert.Equal("s", new Holder<string>(null).Cast("s"));
+            try
+            {
+                new Holder<Dog>(null).Cast(new Animal());
+                Assert.Fail();
+            }
+            catch (InvalidCastException)
+            {
+            }
+        }
+
+        [UnitTest]
+        public void exception_clause_and_generic_method()
+        {
+            Assert.Equal(typeof(Dog), new Holder<Dog>(null).CatchAs(new ArgumentException()));
+            Assert.Equal(typeof(string), new Holder<string>(null).CatchAs(new ArgumentNullException()));
+            List<string> strs = MakeList("a", "b");
+            List<Animal> animals = MakeList<Animal>(new Dog(), new Animal());
+            Assert.Equal("b", strs[1]);
+            Assert.Equal(typeof(List<string>), strs.GetType());
+            Assert.Equal(typeof(List<Animal>), animals.GetType());
+            Assert.True(animals.Contains(animals[0]));
+            Assert.Equal(1, strs.IndexOf("b"));
+        }
+    }
+}
@@ -31,5 +31,42 @@ namespace CorlibTests.InternalCall
             double a = Math.Sin(Math.PI / 2);
             Assert.Equal(1.0, a);
         }
+
+        [UnitTest]
+        public void AbsOverflow()
+        {
+            int a = int.MinValue;
+            try
+            {
+                Math.Abs(a);
+                Assert.Fail();
+            }
+            catch (OverflowException)
+            {
+            }
+        }
+
+        [UnitTest]
+        public void MinMax()
+        {
+            Assert.Equal(-3, Math.Min(-3, 7));
+            Assert.Equal(7, Math.Max(-3, 7));
+            Assert.Equal(3000000000u, Math.Max(3000000000u, 5u));
+            Assert.Equal(-1L, Math.Min(-1L, long.MaxValue));
+            Assert.Equal(2.5, Math.Max(2.5, -1.0));
+            Assert.True(double.IsNaN(Math.Min(double.NaN, 1.0)));
+            Assert.True(double.IsNaN(Math.Max(1.0, double.NaN)));
+        }
+
+        [UnitTest]
+        public void Rounding()
+        {
+            Assert.Equal(2.0, Math.Sqrt(4.0));
+            Assert.Equal(-3.0, Math.Floor(-2.5));
+            Assert.Equal(-2.0, Math.Ceiling(-2.5));
+            Assert.Equal(2.0, Math.Round(2.5));
+            Assert.Equal(4.0, Math.Round(3.5));
+            Assert.Equal(-2.0, Math.Round(-2.5));
+        }
     }
 }
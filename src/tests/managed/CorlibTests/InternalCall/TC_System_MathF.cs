@@ -23,5 +23,15 @@ namespace CorlibTests.InternalCall
             float a = System.MathF.Sin(MathF.PI / 2);
             Assert.Equal(1.0, a);
         }
+
+        [UnitTest]
+        public void SqrtMinMax()
+        {
+            Assert.Equal(3.0f, MathF.Sqrt(9.0f));
+            Assert.Equal(-1.5f, Math.Min(-1.5f, 2.0f));
+            Assert.Equal(2.0f, Math.Max(-1.5f, 2.0f));
+            Assert.True(float.IsNaN(Math.Max(float.NaN, 2.0f)));
+            Assert.Equal(2.0f, MathF.Round(2.5f));
+        }
     }
 }
@@ -1,12 +1,126 @@
 ﻿using System;
-using System.Collections.Generic;
-using System.Linq;
-using System.Text;
+using System.Threading;
 using System.Threading.Tasks;
 
 namespace CorlibTests.InternalCall
 {
-    internal class TC_System_Threading_ThreadPool
+    internal class TC_System_Threading_ThreadPool : GeneralTestCaseBase
     {
+        [UnitTest]
+        public void GetMinMaxThreads()
+        {
+            ThreadPool.GetMinThreads(out int minWorkers, out int minIo);
+            ThreadPool.GetMaxThreads(out int maxWorkers, out int maxIo);
+            Assert.True(minWorkers > 0);
+            Assert.True(minIo > 0);
+            Assert.True(maxWorkers >= minWorkers);
+            Assert.True(maxIo >= minIo);
+        }
+
+        [UnitTest]
+        public void SetMinThreads_AboveMax_Fails()
+        {
+            ThreadPool.GetMaxThreads(out int maxWorkers, out int maxIo);
+            Assert.False(ThreadPool.SetMinThreads(maxWorkers + 1, maxIo));
+        }
+
+        [UnitTest]
+        public void QueueUserWorkItem_RunsBeforeWaitReturns()
+        {
+            var done = new ManualResetEventSlim(false);
+            int value = 0;
+            Assert.True(ThreadPool.QueueUserWorkItem(_ =>
+            {
+                value = 42;
+                done.Set();
+            }));
+            Assert.True(done.Wait(1000));
+            Assert.Equal(42, value);
+        }
+
+        [UnitTest]
+        public void TaskRun_Result()
+        {
+            Task<int> task = Task.Run(() => 6 * 7);
+            Assert.Equal(42, task.Result);
+        }
+
+        [UnitTest]
+        public void MonitorWait_RunsItemsThatTakeTheWaitedMonitor()
+        {
+            var gate = new object();
+            bool signalled = false;
+            lock (gate)
+            {
+                Assert.True(ThreadPool.QueueUserWorkItem(_ =>
+                {
+                    lock (gate)
+                    {
+                        signalled = true;
+                        Monitor.Pulse(gate);
+                    }
+                }));
+                // The monitor is released while waiting, so the item can enter it.
+                for (int i = 0; i < 100 && !signalled; i++)
+                {
+                    Monitor.Wait(gate, 10);
+                }
+                Assert.True(signalled);
+            }
+        }
+
+        [UnitTest]
+        public void MonitorWait_DoesNotRunItemsInsideOtherHeldMonitors()
+        {
+            var outer = new object();
+            var gate = new object();
+            var done = new ManualResetEventSlim(false);
+            bool ran = false;
+            bool ranInsideOuter = false;
+            lock (outer)
+            {
+                lock (gate)
+                {
+                    Assert.True(ThreadPool.QueueUserWorkItem(_ =>
+                    {
+                        lock (outer)
+                        {
+                            ran = true;
+                        }
+                        done.Set();
+                    }));
+                    Monitor.Wait(gate, 50);
+                    ranInsideOuter = ran;
+                }
+            }
+            Assert.False(ranInsideOuter);
+            Assert.True(done.Wait(1000));
+            Assert.True(ran);
+        }
+
+        [UnitTest]
+        public void Sleep_DoesNotRunItemsInsideHeldMonitors()
+        {
+            var gate = new object();
+            var done = new ManualResetEventSlim(false);
+            bool ran = false;
+            bool ranInsideGate = false;
+            lock (gate)
+            {
+                Assert.True(ThreadPool.QueueUserWorkItem(_ =>
+                {
+                    lock (gate)
+                    {
+                        ran = true;
+                    }
+                    done.Set();
+                }));
+                Thread.Sleep(20);
+                ranInsideGate = ran;
+            }
+            Assert.False(ranInsideGate);
+            Assert.True(done.Wait(1000));
+            Assert.True(ran);
+        }
     }
 }
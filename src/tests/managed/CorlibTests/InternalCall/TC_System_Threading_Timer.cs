@@ -0,0 +1,66 @@
+﻿using System;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CorlibTests.InternalCall
+{
+    internal class TC_System_Threading_Timer : GeneralTestCaseBase
+    {
+        [UnitTest]
+        public void OneShot_FiresOnceAfterDueTime()
+        {
+            int count = 0;
+            var sw = Stopwatch.StartNew();
+            using (var timer = new Timer(_ => count++, null, 20, Timeout.Infinite))
+            {
+                Thread.Sleep(100);
+            }
+            Assert.Equal(1, count);
+            Assert.True(sw.ElapsedMilliseconds >= 20);
+        }
+
+        [UnitTest]
+        public void Periodic_FiresRepeatedly()
+        {
+            int count = 0;
+            using (var timer = new Timer(_ => count++, null, 0, 10))
+            {
+                Thread.Sleep(100);
+            }
+            Assert.True(count >= 3);
+        }
+
+        [UnitTest]
+        public void Dispose_CancelsPendingTimer()
+        {
+            int count = 0;
+            var timer = new Timer(_ => count++, null, 20, Timeout.Infinite);
+            timer.Dispose();
+            Thread.Sleep(50);
+            Assert.Equal(0, count);
+        }
+
+        [UnitTest]
+        public void Change_Reschedules()
+        {
+            int count = 0;
+            using (var timer = new Timer(_ => count++, null, Timeout.Infinite, Timeout.Infinite))
+            {
+                Thread.Sleep(20);
+                Assert.Equal(0, count);
+                timer.Change(10, Timeout.Infinite);
+                Thread.Sleep(50);
+            }
+            Assert.Equal(1, count);
+        }
+
+        [UnitTest]
+        public void TaskDelay_Completes()
+        {
+            var sw = Stopwatch.StartNew();
+            Assert.True(Task.Delay(30).Wait(1000));
+            Assert.True(sw.ElapsedMilliseconds >= 30);
+        }
+    }
+}
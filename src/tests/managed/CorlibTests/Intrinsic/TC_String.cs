@@ -26,5 +26,81 @@ namespace Tests.Intrinsic
                 Assert.Equal('a', *ptr);
             }
         }
+
+        [UnitTest]
+        public void EqualsOrdinal()
+        {
+            var a = "the quick brown fox jumps over the lazy dog";
+            var b = new string(a.ToCharArray());
+            Assert.True(a.Equals(b));
+            Assert.True(string.Equals(a, b));
+            Assert.True(a == b);
+            Assert.False(a != b);
+            Assert.False(a == b + "!");
+            Assert.False(a.Equals((string)null));
+            Assert.True(string.Equals((string)null, (string)null));
+            Assert.False(string.Equals(a, null));
+            Assert.False(a == "the quick brown fox jumps over the lazy doG");
+        }
+
+        [UnitTest]
+        public void CompareOrdinal()
+        {
+            Assert.Equal(0, string.CompareOrdinal("abcdefghijklmnopq", "abcdefghijklmnopq"));
+            Assert.True(string.CompareOrdinal("abcdefghijklmnopq", "abcdefghijklmnopr") < 0);
+            Assert.True(string.CompareOrdinal("abcdefghijklmnopr", "abcdefghijklmnopq") > 0);
+            Assert.True(string.CompareOrdinal("abc", "abcd") < 0);
+            Assert.True(string.CompareOrdinal(null, "a") < 0);
+            Assert.True(string.CompareOrdinal("a", null) > 0);
+        }
+
+        [UnitTest]
+        public void IndexOfChar()
+        {
+            var s = "0123456789abcdefghijklmnopqrstuvwxyz";
+            Assert.Equal(0, s.IndexOf('0'));
+            Assert.Equal(35, s.IndexOf('z'));
+            Assert.Equal(-1, s.IndexOf('Z'));
+            Assert.Equal(20, s.IndexOf('k', 5));
+            Assert.Equal(-1, s.IndexOf('k', 5, 10));
+            Assert.Equal(-1, s.IndexOf('a', 36));
+            try
+            {
+                s.IndexOf('a', 37);
+                Assert.Fail();
+            }
+            catch (ArgumentOutOfRangeException)
+            {
+            }
+        }
+
+        [UnitTest]
+        public void IndexOfAny()
+        {
+            var s = "0123456789abcdefghijklmnopqrstuvwxyz";
+            Assert.Equal(10, s.IndexOfAny(new char[] { 'x', 'a', 'Q' }));
+            Assert.Equal(33, s.IndexOfAny(new char[] { 'x', 'a', 'Q' }, 11));
+            Assert.Equal(-1, s.IndexOfAny(new char[] { 'x', 'a', 'Q' }, 11, 10));
+            Assert.Equal(-1, s.IndexOfAny(new char[0]));
+        }
+
+        [UnitTest]
+        public void IndexOfString()
+        {
+            var s = "abcabcabdabcabcabdabcabcabdxyz";
+            Assert.Equal(6, s.IndexOf("abd", StringComparison.Ordinal));
+            Assert.Equal(24, s.LastIndexOf("abd", StringComparison.Ordinal));
+            Assert.Equal(27, s.IndexOf("xyz", StringComparison.Ordinal));
+            Assert.Equal(-1, s.IndexOf("xyzw", StringComparison.Ordinal));
+        }
+
+        [UnitTest]
+        public void HashCodeStable()
+        {
+            var a = "hash code of a fairly long string, long enough for the vector loop";
+            var b = new string(a.ToCharArray());
+            Assert.Equal(a.GetHashCode(), b.GetHashCode());
+            Assert.NotEqual(a.GetHashCode(), (a + "!").GetHashCode());
+        }
     }
 }
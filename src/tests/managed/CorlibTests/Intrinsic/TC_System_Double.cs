@@ -0,0 +1,144 @@
+using System;
+using System.Globalization;
+
+namespace Tests.Intrinsic
+{
+    // Double.ToString() and Single.ToString() are formatted natively as "G15" and "G7" in the invariant
+    // culture. The other ToString overloads and TryFormat are left to the corlib's managed formatter.
+    internal class TC_System_Double : GeneralTestCaseBase
+    {
+        static readonly double[] s_doubles =
+        {
+            0.1, 1.0 / 3, 2.0 / 3, 0.1 + 0.2, 123.456, -1.5, 100, 0.5, Math.PI, Math.E, 1e14, 1e15, 1e16, 123456789012345,
+            1234567890123456, 0.0001, 0.00001, 0.000123, 0.0000123, 1e-10, 2.5e300, double.MaxValue, double.MinValue,
+            double.Epsilon, 2.2250738585072014E-308, 1e-310, -4.2e-320,
+        };
+
+        static readonly float[] s_singles =
+        {
+            0.1f, 1f / 3, -2.5f, (float)Math.PI, 1e6f, 1e7f, 1234567f, 12345678f, 16777216f, 0.0001f, 1e-5f,
+            float.MaxValue, float.MinValue, float.Epsilon, 1.17549435E-38f, 1e-40f,
+        };
+
+        [UnitTest]
+        public void DoubleShortestDigits()
+        {
+            // Digits that read back as the value are not padded up to 15.
+            Assert.Equal("0.1", 0.1.ToString());
+            Assert.Equal("0.3", (0.1 + 0.2).ToString());
+            Assert.Equal("123.456", 123.456.ToString());
+            Assert.Equal("-1.5", (-1.5).ToString());
+            Assert.Equal("100", 100.0.ToString());
+            Assert.Equal("0.333333333333333", (1.0 / 3).ToString());
+            Assert.Equal("0.666666666666667", (2.0 / 3).ToString());
+            Assert.Equal("3.14159265358979", Math.PI.ToString());
+        }
+
+        [UnitTest]
+        public void DoubleRoundTrip()
+        {
+            double[] values = { 0.1, 123.456, -1.5, 1e-10, 2.5e300, 123456789012345, 0.000123, 1.0000000000001 };
+            foreach (double value in values)
+            {
+                Assert.Equal(value, double.Parse(value.ToString(), CultureInfo.InvariantCulture));
+            }
+        }
+
+        [UnitTest]
+        public void DoubleZeros()
+        {
+            Assert.Equal("0", 0.0.ToString());
+            Assert.Equal("0", (-0.0).ToString());
+            Assert.Equal("0", (1.0 / double.NegativeInfinity).ToString());
+        }
+
+        [UnitTest]
+        public void DoubleNaNAndInfinities()
+        {
+            Assert.Equal("NaN", double.NaN.ToString());
+            Assert.Equal("NaN", (0.0 / 0.0).ToString());
+            Assert.Equal("Infinity", double.PositiveInfinity.ToString());
+            Assert.Equal("-Infinity", double.NegativeInfinity.ToString());
+        }
+
+        [UnitTest]
+        public void DoubleExtremesAndSubnormals()
+        {
+            Assert.Equal("1.79769313486232E+308", double.MaxValue.ToString());
+            Assert.Equal("-1.79769313486232E+308", double.MinValue.ToString());
+            Assert.Equal("2.2250738585072E-308", 2.2250738585072014E-308.ToString());
+            Assert.Equal("4.94065645841247E-324", double.Epsilon.ToString());
+            Assert.Equal("9.99999999999997E-311", 1e-310.ToString());
+        }
+
+        [UnitTest]
+        public void DoubleExponentSwitch()
+        {
+            // Exponent form once the integer part needs more than 15 digits, or below 1E-04.
+            Assert.Equal("100000000000000", 1e14.ToString());
+            Assert.Equal("123456789012345", 123456789012345.0.ToString());
+            Assert.Equal("999999999999999", 999999999999999.0.ToString());
+            Assert.Equal("1E+15", 1e15.ToString());
+            Assert.Equal("1.23456789012346E+15", 1234567890123456.0.ToString());
+            Assert.Equal("0.0001", 0.0001.ToString());
+            Assert.Equal("0.000123", 0.000123.ToString());
+            Assert.Equal("1E-05", 0.00001.ToString());
+            Assert.Equal("1.23E-05", 0.0000123.ToString());
+            Assert.Equal("2.5E+300", 2.5e300.ToString());
+        }
+
+        [UnitTest]
+        public void DoubleMatchesManagedFormatter()
+        {
+            foreach (double value in s_doubles)
+            {
+                Assert.Equal(value.ToString("G15", CultureInfo.InvariantCulture), value.ToString());
+            }
+        }
+
+        [UnitTest]
+        public void SingleShortestDigits()
+        {
+            Assert.Equal("0.1", 0.1f.ToString());
+            Assert.Equal("0.3333333", (1f / 3).ToString());
+            Assert.Equal("-2.5", (-2.5f).ToString());
+            Assert.Equal("3.141593", ((float)Math.PI).ToString());
+            Assert.Equal(0.1f, float.Parse(0.1f.ToString(), CultureInfo.InvariantCulture));
+        }
+
+        [UnitTest]
+        public void SingleSpecialValues()
+        {
+            Assert.Equal("0", 0f.ToString());
+            Assert.Equal("0", (-0f).ToString());
+            Assert.Equal("NaN", float.NaN.ToString());
+            Assert.Equal("Infinity", float.PositiveInfinity.ToString());
+            Assert.Equal("-Infinity", float.NegativeInfinity.ToString());
+            Assert.Equal("3.402823E+38", float.MaxValue.ToString());
+            Assert.Equal("-3.402823E+38", float.MinValue.ToString());
+            Assert.Equal("1.401298E-45", float.Epsilon.ToString());
+            Assert.Equal("9.999946E-41", 1e-40f.ToString());
+        }
+
+        [UnitTest]
+        public void SingleExponentSwitch()
+        {
+            Assert.Equal("1000000", 1e6f.ToString());
+            Assert.Equal("1234567", 1234567f.ToString());
+            Assert.Equal("1E+07", 1e7f.ToString());
+            Assert.Equal("1.234568E+07", 12345678f.ToString());
+            Assert.Equal("1.677722E+07", 16777216f.ToString());
+            Assert.Equal("0.0001", 0.0001f.ToString());
+            Assert.Equal("1E-05", 1e-5f.ToString());
+        }
+
+        [UnitTest]
+        public void SingleMatchesManagedFormatter()
+        {
+            foreach (float value in s_singles)
+            {
+                Assert.Equal(value.ToString("G7", CultureInfo.InvariantCulture), value.ToString());
+            }
+        }
+    }
+}
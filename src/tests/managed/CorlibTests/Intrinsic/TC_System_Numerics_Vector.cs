@@ -0,0 +1,136 @@
+using System;
+using System.Numerics;
+
+namespace Tests.Intrinsic
+{
+    internal class TC_System_Numerics_Vector : GeneralTestCaseBase
+    {
+        [UnitTest]
+        public void Vector2Arithmetic()
+        {
+            var a = new Vector2(1f, 2f);
+            var b = new Vector2(3f, 5f);
+            var sum = a + b;
+            Assert.Equal(4f, sum.X);
+            Assert.Equal(7f, sum.Y);
+            var diff = b - a;
+            Assert.Equal(2f, diff.X);
+            Assert.Equal(3f, diff.Y);
+            var scaled = a * 2f;
+            Assert.Equal(2f, scaled.X);
+            Assert.Equal(4f, scaled.Y);
+            var scaled2 = 3f * a;
+            Assert.Equal(3f, scaled2.X);
+            Assert.Equal(6f, scaled2.Y);
+            var neg = -a;
+            Assert.Equal(-1f, neg.X);
+            Assert.Equal(-2f, neg.Y);
+            Assert.Equal(13f, Vector2.Dot(a, b));
+        }
+
+        [UnitTest]
+        public void Vector3Arithmetic()
+        {
+            var a = new Vector3(1f, 2f, 3f);
+            var b = new Vector3(4f, 6f, 8f);
+            var product = a * b;
+            Assert.Equal(4f, product.X);
+            Assert.Equal(12f, product.Y);
+            Assert.Equal(24f, product.Z);
+            var quotient = b / 2f;
+            Assert.Equal(2f, quotient.X);
+            Assert.Equal(3f, quotient.Y);
+            Assert.Equal(4f, quotient.Z);
+            Assert.Equal(40f, Vector3.Dot(a, b));
+            Assert.Equal(14f, a.LengthSquared());
+            Assert.Equal(50f, Vector3.DistanceSquared(a, b));
+        }
+
+        [UnitTest]
+        public void Vector3Cross()
+        {
+            var c = Vector3.Cross(new Vector3(1f, 0f, 0f), new Vector3(0f, 1f, 0f));
+            Assert.Equal(0f, c.X);
+            Assert.Equal(0f, c.Y);
+            Assert.Equal(1f, c.Z);
+            var d = Vector3.Cross(new Vector3(1f, 2f, 3f), new Vector3(4f, 5f, 6f));
+            Assert.Equal(-3f, d.X);
+            Assert.Equal(6f, d.Y);
+            Assert.Equal(-3f, d.Z);
+        }
+
+        [UnitTest]
+        public void Vector3DoesNotTouchNeighbours()
+        {
+            var values = new Vector3[] { new Vector3(1f, 1f, 1f), new Vector3(9f, 9f, 9f) };
+            values[0] = values[0] + new Vector3(1f, 2f, 3f);
+            Assert.Equal(2f, values[0].X);
+            Assert.Equal(4f, values[0].Z);
+            Assert.Equal(9f, values[1].X);
+        }
+
+        [UnitTest]
+        public void Vector4MinMaxClampLerp()
+        {
+            var a = new Vector4(1f, 8f, -3f, 4f);
+            var b = new Vector4(2f, 5f, -7f, 4f);
+            var min = Vector4.Min(a, b);
+            Assert.Equal(1f, min.X);
+            Assert.Equal(5f, min.Y);
+            Assert.Equal(-7f, min.Z);
+            var max = Vector4.Max(a, b);
+            Assert.Equal(2f, max.X);
+            Assert.Equal(8f, max.Y);
+            Assert.Equal(-3f, max.Z);
+            var abs = Vector4.Abs(a);
+            Assert.Equal(3f, abs.Z);
+            var clamped = Vector4.Clamp(a, new Vector4(0f), new Vector4(5f));
+            Assert.Equal(1f, clamped.X);
+            Assert.Equal(5f, clamped.Y);
+            Assert.Equal(0f, clamped.Z);
+            var lerp = Vector4.Lerp(new Vector4(0f), new Vector4(10f), 0.5f);
+            Assert.Equal(5f, lerp.W);
+        }
+
+        [UnitTest]
+        public void LengthAndNormalize()
+        {
+            var v = new Vector3(3f, 0f, 4f);
+            Assert.Equal(5f, v.Length());
+            var n = Vector3.Normalize(v);
+            Assert.True(Math.Abs(n.X - 0.6f) < 1e-6f);
+            Assert.True(Math.Abs(n.Z - 0.8f) < 1e-6f);
+            Assert.Equal(5f, Vector2.Distance(new Vector2(0f, 0f), new Vector2(3f, 4f)));
+            var s = Vector4.SquareRoot(new Vector4(4f, 9f, 16f, 25f));
+            Assert.Equal(2f, s.X);
+            Assert.Equal(5f, s.W);
+        }
+
+        [UnitTest]
+        public void GenericVector()
+        {
+            if (Vector<int>.Count != 4)
+            {
+                return;
+            }
+            var a = new Vector<int>(new int[] { 1, 2, 3, 4 });
+            var b = new Vector<int>(new int[] { 10, 20, 30, 40 });
+            var sum = a + b;
+            Assert.Equal(11, sum[0]);
+            Assert.Equal(44, sum[3]);
+            var product = a * b;
+            Assert.Equal(90, product[2]);
+            var masked = b & new Vector<int>(0xF);
+            Assert.Equal(10, masked[0]);
+            Assert.Equal(4, masked[1]);
+        }
+
+        [UnitTest]
+        public void ScalarAndVectorMultiplyAgree()
+        {
+            var a = new Vector4(1.5f, -2f, 3.25f, 4f);
+            Assert.True(a + a == a * 2f);
+            Assert.True(a * new Vector4(0.5f) == a / 2f);
+        }
+    }
+}
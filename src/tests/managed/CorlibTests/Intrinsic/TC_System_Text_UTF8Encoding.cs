@@ -0,0 +1,79 @@
+﻿using System;
+using System.Text;
+
+namespace Tests.Intrinsic
+{
+    internal class TC_System_Text_UTF8Encoding : GeneralTestCaseBase
+    {
+        [UnitTest]
+        public void RoundTripAscii()
+        {
+            var s = "The quick brown fox jumps over the lazy dog, 0123456789";
+            byte[] bytes = Encoding.UTF8.GetBytes(s);
+            Assert.Equal(s.Length, bytes.Length);
+            Assert.Equal(s.Length, Encoding.UTF8.GetByteCount(s));
+            Assert.Equal((byte)'T', bytes[0]);
+            Assert.Equal(s, Encoding.UTF8.GetString(bytes));
+        }
+
+        [UnitTest]
+        public void RoundTripMultiByte()
+        {
+            var s = "ascii \u00e9\u00e8 \u4e2d\u6587 \ud83d\ude00 end";
+            byte[] bytes = Encoding.UTF8.GetBytes(s);
+            Assert.Equal(6 + 4 + 1 + 6 + 1 + 4 + 4, bytes.Length);
+            Assert.Equal(s.Length, Encoding.UTF8.GetCharCount(bytes));
+            Assert.Equal(s, Encoding.UTF8.GetString(bytes));
+            Assert.Equal(s, Encoding.UTF8.GetString(bytes, 0, bytes.Length));
+            Assert.Equal("\u00e9", Encoding.UTF8.GetString(bytes, 6, 2));
+        }
+
+        [UnitTest]
+        public void ReplacesIllFormedInput()
+        {
+            byte[] bytes = { (byte)'a', 0x80, (byte)'b', 0xE0, 0x80, 0xF0, 0x9F, 0x98 };
+            Assert.Equal("a\ufffdb\ufffd\ufffd\ufffd", Encoding.UTF8.GetString(bytes));
+            byte[] encoded = Encoding.UTF8.GetBytes("a\ud800");
+            Assert.Equal(4, encoded.Length);
+            Assert.Equal(0xEF, encoded[1]);
+            Assert.Equal(0xBF, encoded[2]);
+            Assert.Equal(0xBD, encoded[3]);
+        }
+
+        [UnitTest]
+        public void GetStringChecksArguments()
+        {
+            try
+            {
+                Encoding.UTF8.GetString(null);
+                Assert.Fail();
+            }
+            catch (ArgumentNullException)
+            {
+            }
+            try
+            {
+                Encoding.UTF8.GetString(new byte[4], 2, 3);
+                Assert.Fail();
+            }
+            catch (ArgumentOutOfRangeException)
+            {
+            }
+            Assert.Equal("", Encoding.UTF8.GetString(new byte[4], 4, 0));
+        }
+
+        [UnitTest]
+        public void GetBytesIntoBuffer()
+        {
+            var chars = "h\u00e9llo".ToCharArray();
+            var buffer = new byte[16];
+            int written = Encoding.UTF8.GetBytes(chars, 0, chars.Length, buffer, 2);
+            Assert.Equal(6, written);
+            Assert.Equal(0xC3, buffer[3]);
+            Assert.Equal(0xA9, buffer[4]);
+            var decoded = new char[8];
+            Assert.Equal(5, Encoding.UTF8.GetChars(buffer, 2, written, decoded, 1));
+            Assert.Equal('\u00e9', decoded[2]);
+        }
+    }
+}
@@ -0,0 +1,34 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace CorlibTests
+{
+    // Loaded by the metadata snapshot test of basic_test_runner, which compares the nested classes and the
+    // field offsets restored from a snapshot with a cold load.
+    internal class MetadataSnapshotTypes
+    {
+        [StructLayout(LayoutKind.Explicit, Size = 32)]
+        public struct Overlapped
+        {
+            [FieldOffset(0)]
+            public long wide;
+            [FieldOffset(0)]
+            public int low;
+            [FieldOffset(4)]
+            public int high;
+            [FieldOffset(16)]
+            public double tail;
+        }
+
+        public class Inner
+        {
+            public class Innermost
+            {
+                public Overlapped value;
+            }
+        }
+
+        public int count;
+        public Overlapped overlapped;
+    }
+}
@@ -0,0 +1,108 @@
+﻿using System;
+using System.IO;
+using System.Runtime.InteropServices;
+
+namespace CorlibTests.PInvoke
+{
+    internal class TC_DynamicPInvoke : GeneralTestCaseBase
+    {
+        private enum ByteEnum : byte
+        {
+        }
+
+        private enum ShortEnum : short
+        {
+        }
+
+        // Neither import has a registered binding, so both go through dlopen/LoadLibrary. Only the one for the
+        // running platform is ever called, and binding happens on the first call.
+        [DllImport("__Internal", EntryPoint = "abs", CallingConvention = CallingConvention.Cdecl)]
+        private static extern int LibcAbs(int value);
+
+        [DllImport("msvcrt", EntryPoint = "abs", CallingConvention = CallingConvention.Cdecl)]
+        private static extern int MsvcrtAbs(int value);
+
+        // The declared return types are narrower than the int abs returns, so only the low bits are kept.
+        [DllImport("__Internal", EntryPoint = "abs", CallingConvention = CallingConvention.Cdecl)]
+        private static extern ByteEnum LibcAbsAsByteEnum(int value);
+
+        [DllImport("__Internal", EntryPoint = "abs", CallingConvention = CallingConvention.Cdecl)]
+        private static extern ShortEnum LibcAbsAsShortEnum(int value);
+
+        [DllImport("__Internal", EntryPoint = "close", CallingConvention = CallingConvention.Cdecl, SetLastError = true)]
+        private static extern int LibcClose(int fd);
+
+        // An Ansi char needs a code page conversion, which dynamic binding does not do.
+        [DllImport("__Internal", EntryPoint = "toupper", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private static extern char AnsiToUpper(char c);
+
+        [DllImport("__Internal", EntryPoint = "towupper", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Unicode)]
+        private static extern char UnicodeToUpper(char c);
+
+        private static bool IsWindows
+        {
+            get { return Path.DirectorySeparatorChar == '\\'; }
+        }
+
+        private static int Abs(int value)
+        {
+            return IsWindows ? MsvcrtAbs(value) : LibcAbs(value);
+        }
+
+        [UnitTest]
+        public void call_c_runtime_abs()
+        {
+            Assert.Equal(5, Abs(-5));
+            Assert.Equal(7, Abs(7));
+            Assert.Equal(0, Abs(0));
+            Assert.Equal(int.MaxValue, Abs(-int.MaxValue));
+        }
+
+        [UnitTest]
+        public void narrow_enum_return()
+        {
+            if (IsWindows)
+            {
+                return;
+            }
+            Assert.Equal(0xFE, (int)LibcAbsAsByteEnum(-0x1FE));
+            Assert.Equal(-0x8000, (int)LibcAbsAsShortEnum(-0x18000));
+            Assert.Equal(0x7FFF, (int)LibcAbsAsShortEnum(0x17FFF));
+        }
+
+        [UnitTest]
+        public void set_last_error()
+        {
+            if (IsWindows)
+            {
+                return;
+            }
+            const int EBADF = 9;
+            Assert.Equal(-1, LibcClose(-1));
+            Assert.Equal(EBADF, Marshal.GetLastWin32Error());
+        }
+
+        [UnitTest]
+        public void reject_ansi_char()
+        {
+            try
+            {
+                AnsiToUpper('a');
+                Assert.Fail();
+            }
+            catch (NotSupportedException)
+            {
+            }
+        }
+
+        [UnitTest]
+        public void pass_unicode_char()
+        {
+            if (IsWindows)
+            {
+                return;
+            }
+            Assert.Equal('A', UnicodeToUpper('a'));
+        }
+    }
+}
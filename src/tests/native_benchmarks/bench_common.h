@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace leanclr::bench
+{
+
+// A benchmark group validates its kernels against a reference and prints timings.
+// Returns false when validation fails.
+using BenchmarkGroupFunction = bool (*)();
+
+struct BenchmarkGroup
+{
+    const char* name;
+    BenchmarkGroupFunction run;
+};
+
+inline void keep_alive(int64_t value)
+{
+    static volatile int64_t s_sink;
+    s_sink = s_sink + value;
+}
+
+// Average nanoseconds per call of op over at least `min_iterations` calls.
+template <typename Op>
+double measure_ns_per_op(Op&& op, size_t min_iterations)
+{
+    int64_t acc = 0;
+    for (size_t i = 0; i < min_iterations / 16 + 1; ++i)
+    {
+        acc += op();
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < min_iterations; ++i)
+    {
+        acc += op();
+    }
+    auto end = std::chrono::steady_clock::now();
+    keep_alive(acc);
+    return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(min_iterations);
+}
+
+inline void report(const char* kernel, size_t length, double kernel_ns, double reference_ns)
+{
+    std::printf("  %-22s len=%-6zu kernel %10.2f ns  reference %10.2f ns  x%.2f\n", kernel, length, kernel_ns, reference_ns,
+                kernel_ns > 0 ? reference_ns / kernel_ns : 0.0);
+}
+
+bool run_string_kernels();
+bool run_float_format();
+bool run_utf8_transcoder();
+bool run_metadata_layout();
+bool run_metadata_snapshot();
+bool run_profiler();
+
+} // namespace leanclr::bench
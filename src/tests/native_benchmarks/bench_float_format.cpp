@@ -0,0 +1,148 @@
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "bench_common.h"
+#include "utils/float_format.h"
+
+using leanclr::utils::FloatFormat;
+
+namespace leanclr::bench
+{
+
+namespace
+{
+// The digit generation RuntimeImports._ecvt_s used before: printf in scientific notation, then split.
+int32_t ref_ecvt(double value, int32_t precision, char* digits, int32_t* decimal_point)
+{
+    char text[64];
+    std::snprintf(text, sizeof(text), "%.*e", precision - 1, std::fabs(value));
+    int32_t count = 0;
+    const char* p = text;
+    for (; *p != 'e'; ++p)
+    {
+        if (*p != '.')
+            digits[count++] = *p;
+    }
+    digits[count] = 0;
+    *decimal_point = std::atoi(p + 1) + 1;
+    return count;
+}
+
+std::vector<double> make_values(size_t count, uint64_t seed)
+{
+    std::vector<double> values;
+    while (values.size() < count)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        double value;
+        std::memcpy(&value, &seed, sizeof(value));
+        if (std::isfinite(value) && value != 0)
+            values.push_back(value);
+    }
+    return values;
+}
+
+bool validate()
+{
+    std::vector<double> values = make_values(200000, 1);
+    // Values with few digits take the shortest digits path.
+    for (int32_t i = 1; i < 20000; ++i)
+    {
+        values.push_back(i / 64.0);
+        values.push_back(i * 0.1);
+    }
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        int32_t precision = 1 + static_cast<int32_t>(i % 17);
+        char digits[32];
+        char ref_digits[32];
+        int32_t decimal_point;
+        int32_t ref_decimal_point;
+        bool negative;
+        if (!FloatFormat::ecvt(values[i], precision, digits, sizeof(digits), &decimal_point, &negative))
+            return false;
+        ref_ecvt(values[i], precision, ref_digits, &ref_decimal_point);
+        if (std::strcmp(digits, ref_digits) != 0 || decimal_point != ref_decimal_point || negative != (values[i] < 0))
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+bool run_float_format()
+{
+    if (!validate())
+        return false;
+
+    struct Case
+    {
+        const char* name;
+        std::vector<double> values;
+    };
+    std::vector<double> short_values;
+    for (int32_t i = 0; i < 1024; ++i)
+    {
+        short_values.push_back(i * 0.25 + 0.1);
+    }
+    Case cases[] = {{"random", make_values(1024, 7)}, {"short", short_values}};
+    for (const Case& c : cases)
+    {
+        const std::vector<double>& values = c.values;
+        size_t index = 0;
+        std::printf(" %s values\n", c.name);
+        report("ecvt_15", 15,
+               measure_ns_per_op(
+                   [&] {
+                       char digits[32];
+                       int32_t decimal_point;
+                       bool negative;
+                       FloatFormat::ecvt(values[index++ & 1023], 15, digits, sizeof(digits), &decimal_point, &negative);
+                       return static_cast<int64_t>(digits[0] + decimal_point);
+                   },
+                   1 << 20),
+               measure_ns_per_op(
+                   [&] {
+                       char digits[32];
+                       int32_t decimal_point;
+                       ref_ecvt(values[index++ & 1023], 15, digits, &decimal_point);
+                       return static_cast<int64_t>(digits[0] + decimal_point);
+                   },
+                   1 << 20));
+        report("ecvt_17", 17,
+               measure_ns_per_op(
+                   [&] {
+                       char digits[32];
+                       int32_t decimal_point;
+                       bool negative;
+                       FloatFormat::ecvt(values[index++ & 1023], 17, digits, sizeof(digits), &decimal_point, &negative);
+                       return static_cast<int64_t>(digits[0] + decimal_point);
+                   },
+                   1 << 20),
+               measure_ns_per_op(
+                   [&] {
+                       char digits[32];
+                       int32_t decimal_point;
+                       ref_ecvt(values[index++ & 1023], 17, digits, &decimal_point);
+                       return static_cast<int64_t>(digits[0] + decimal_point);
+                   },
+                   1 << 20));
+        report("format_general_15", 15,
+               measure_ns_per_op(
+                   [&] {
+                       char text[FloatFormat::MAX_GENERAL_LENGTH];
+                       return static_cast<int64_t>(FloatFormat::format_general(values[index++ & 1023], 15, text));
+                   },
+                   1 << 20),
+               measure_ns_per_op(
+                   [&] {
+                       char text[64];
+                       return static_cast<int64_t>(std::snprintf(text, sizeof(text), "%.15G", values[index++ & 1023]));
+                   },
+                   1 << 20));
+    }
+    return true;
+}
+
+} // namespace leanclr::bench
@@ -0,0 +1,253 @@
+#include <cstring>
+#include <set>
+#include <vector>
+
+#include "alloc/mem_pool.h"
+#include "bench_common.h"
+#include "metadata/rt_metadata.h"
+
+using leanclr::alloc::MemPool;
+using leanclr::metadata::RtClass;
+using leanclr::metadata::RtMethodInfo;
+using leanclr::metadata::RtVirtualInvokeData;
+
+namespace leanclr::bench
+{
+
+namespace
+{
+// Field order of RtMethodInfo and RtClass before the hot/cold split, kept as the reference.
+struct LegacyClass;
+
+struct LegacyMethodInfo
+{
+    LegacyClass* parent;
+    const char* name;
+    const void* generic_container;
+    const void* generic_method;
+    const void* return_type;
+    const void** parameters;
+    const void* arg_descs;
+    metadata::RtManagedMethodPointer method_ptr;
+    metadata::RtInvokeMethodPointer invoke_method_ptr;
+    metadata::RtInvokeMethodPointer virtual_invoke_method_ptr;
+    const interp::RtInterpMethodInfo* interp_data;
+    uint32_t token;
+    uint16_t parameter_count;
+    uint16_t flags;
+    uint16_t iflags;
+    uint16_t slot;
+    uint16_t total_arg_stack_object_size;
+    uint16_t ret_stack_object_size;
+    metadata::RtInvokerType invoker_type;
+};
+
+struct LegacyVirtualInvokeData
+{
+    const LegacyMethodInfo* method;
+    const LegacyMethodInfo* method_impl;
+};
+
+struct LegacyClass
+{
+    void* image;
+    LegacyClass* parent;
+    const char* namespaze;
+    const char* name;
+    const void* by_val;
+    const void* by_ref;
+    LegacyClass* element_class;
+    LegacyClass* cast_class;
+    LegacyClass** super_types;
+    LegacyClass** interfaces;
+    LegacyClass* declaring_class;
+    LegacyClass** nested_classes;
+    const void* generic_container;
+    const void* fields;
+    const LegacyMethodInfo** methods;
+    const void* events;
+    const void* properties;
+    const LegacyVirtualInvokeData* vtable;
+    const void* interface_vtable_offsets;
+    uint8_t* static_fields_data;
+    uint32_t token;
+    uint32_t instance_size_without_header;
+    uint32_t static_size;
+    uint32_t flags;
+    uint32_t extra_flags;
+    uint32_t init_flags;
+    uint16_t nested_class_count;
+    uint16_t interface_count;
+    uint16_t interface_vtable_offset_count;
+    uint16_t field_count;
+    uint16_t method_count;
+    uint16_t property_count;
+    uint16_t event_count;
+    uint16_t vtable_count;
+    uint8_t hierarchy_depth;
+    uint8_t alignment;
+};
+
+constexpr size_t CLASS_COUNT = 16384;
+constexpr size_t VIRTUAL_METHOD_COUNT = 8;
+constexpr size_t MAX_DEPTH = 6;
+constexpr size_t OP_COUNT = 1 << 16;
+
+struct Op
+{
+    uint32_t klass;
+    uint32_t slot;
+    uint32_t cast_target;
+};
+
+// Classes laid out the way a module loads them: each class followed by its methods, names and tables in the
+// same pool, with parents picked among earlier classes.
+template <typename Class, typename Method, typename VirtualInvokeData>
+struct Universe
+{
+    MemPool pool;
+    std::vector<Class*> classes;
+
+    explicit Universe(uint32_t seed)
+    {
+        for (size_t i = 0; i < CLASS_COUNT; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            Class* klass = pool.malloc_any_zeroed<Class>();
+            Class* parent = i == 0 ? nullptr : classes[(seed >> 8) % i];
+            if (parent && parent->hierarchy_depth + 1u >= MAX_DEPTH)
+            {
+                parent = parent->parent;
+            }
+            klass->parent = parent;
+            klass->hierarchy_depth = parent ? static_cast<uint8_t>(parent->hierarchy_depth + 1) : 0;
+            klass->super_types = pool.calloc_any<Class*>(klass->hierarchy_depth + 1u);
+            if (parent)
+            {
+                std::memcpy(klass->super_types, parent->super_types, sizeof(Class*) * klass->hierarchy_depth);
+            }
+            klass->super_types[klass->hierarchy_depth] = klass;
+            klass->cast_class = klass;
+            klass->name = reinterpret_cast<const char*>(pool.malloc_zeroed(32));
+            klass->instance_size_without_header = static_cast<uint32_t>(8 * (1 + seed % 16));
+            klass->init_flags = 1;
+            klass->extra_flags = seed & 0xFF;
+
+            klass->methods = pool.calloc_any<const Method*>(VIRTUAL_METHOD_COUNT);
+            VirtualInvokeData* vtable = pool.calloc_any<VirtualInvokeData>(VIRTUAL_METHOD_COUNT);
+            for (size_t slot = 0; slot < VIRTUAL_METHOD_COUNT; ++slot)
+            {
+                Method* method = pool.malloc_any_zeroed<Method>();
+                method->parent = klass;
+                method->name = reinterpret_cast<const char*>(pool.malloc_zeroed(24));
+                method->slot = static_cast<uint16_t>(slot);
+                method->total_arg_stack_object_size = static_cast<uint16_t>(1 + slot);
+                method->ret_stack_object_size = static_cast<uint16_t>(slot & 1);
+                method->method_ptr = reinterpret_cast<metadata::RtManagedMethodPointer>(static_cast<uintptr_t>(0x1000 + i * 16 + slot));
+                klass->methods[slot] = method;
+                // Half of the slots are overrides, the others inherit the parent implementation.
+                vtable[slot].method = method;
+                vtable[slot].method_impl = parent && (seed >> (slot + 4)) % 2 == 0 ? parent->vtable[slot].method_impl : method;
+            }
+            klass->vtable = vtable;
+            klass->vtable_count = static_cast<uint16_t>(VIRTUAL_METHOD_COUNT);
+            classes.push_back(klass);
+        }
+    }
+};
+
+using NewUniverse = Universe<RtClass, RtMethodInfo, RtVirtualInvokeData>;
+using LegacyUniverse = Universe<LegacyClass, LegacyMethodInfo, LegacyVirtualInvokeData>;
+
+// What a virtual call, an isinst on a class and a newobj read of the metadata.
+template <typename Class, typename Method>
+int64_t dispatch(const Class* klass, const Method* virtual_method, const Class* cast_target)
+{
+    const Method* impl = klass->vtable[virtual_method->slot].method_impl;
+    int64_t result = impl->total_arg_stack_object_size + impl->ret_stack_object_size + static_cast<int64_t>(impl->invoker_type) +
+                     static_cast<int64_t>(reinterpret_cast<uintptr_t>(impl->method_ptr) & 0xFF) + (impl->interp_data != nullptr);
+    result += cast_target->hierarchy_depth <= klass->hierarchy_depth && klass->super_types[cast_target->hierarchy_depth] == cast_target;
+    result += klass->instance_size_without_header + (klass->init_flags & 1) + (klass->extra_flags & 2) + (klass->flags & 4);
+    return result;
+}
+
+template <typename Class, typename Method>
+size_t count_lines(const Class* klass, const Method* virtual_method, const Class* cast_target)
+{
+    const Method* impl = klass->vtable[virtual_method->slot].method_impl;
+    std::set<uintptr_t> lines;
+    auto touch = [&](const void* field) { lines.insert(reinterpret_cast<uintptr_t>(field) / metadata::RT_CACHE_LINE_SIZE); };
+    touch(&virtual_method->slot);
+    touch(&klass->vtable);
+    touch(&impl->total_arg_stack_object_size);
+    touch(&impl->ret_stack_object_size);
+    touch(&impl->invoker_type);
+    touch(&impl->method_ptr);
+    touch(&impl->interp_data);
+    touch(&cast_target->hierarchy_depth);
+    touch(&klass->hierarchy_depth);
+    touch(&klass->super_types);
+    touch(&klass->instance_size_without_header);
+    touch(&klass->init_flags);
+    touch(&klass->extra_flags);
+    touch(&klass->flags);
+    return lines.size();
+}
+
+std::vector<Op> make_ops(uint32_t seed)
+{
+    std::vector<Op> ops(OP_COUNT);
+    for (Op& op : ops)
+    {
+        seed = seed * 1103515245u + 12345u;
+        op.klass = (seed >> 4) % CLASS_COUNT;
+        seed = seed * 1103515245u + 12345u;
+        op.slot = (seed >> 4) % VIRTUAL_METHOD_COUNT;
+        seed = seed * 1103515245u + 12345u;
+        op.cast_target = (seed >> 4) % CLASS_COUNT;
+    }
+    return ops;
+}
+
+template <typename U>
+int64_t run_op(const U& universe, const Op& op)
+{
+    auto* klass = universe.classes[op.klass];
+    return dispatch(klass, klass->methods[op.slot], universe.classes[op.cast_target]);
+}
+
+template <typename U>
+double average_lines(const U& universe, const std::vector<Op>& ops)
+{
+    size_t total = 0;
+    for (const Op& op : ops)
+    {
+        auto* klass = universe.classes[op.klass];
+        total += count_lines(klass, klass->methods[op.slot], universe.classes[op.cast_target]);
+    }
+    return static_cast<double>(total) / static_cast<double>(ops.size());
+}
+} // namespace
+
+bool run_metadata_layout()
+{
+    NewUniverse current(11);
+    LegacyUniverse legacy(11);
+    std::vector<Op> ops = make_ops(3);
+    for (const Op& op : ops)
+    {
+        if (run_op(current, op) != run_op(legacy, op))
+            return false;
+    }
+
+    std::printf("  metadata cache lines per dispatch: split %.2f, legacy %.2f\n", average_lines(current, ops), average_lines(legacy, ops));
+    size_t next = 0;
+    size_t legacy_next = 0;
+    size_t iterations = 4 * OP_COUNT;
+    report("dispatch", CLASS_COUNT,
+           measure_ns_per_op([&] { return run_op(current, ops[next++ % OP_COUNT]); }, iterations),
+           measure_ns_per_op([&] { return run_op(legacy, ops[legacy_next++ % OP_COUNT]); }, iterations));
+    return true;
+}
+
+} // namespace leanclr::bench
@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "alloc/general_allocation.h"
+#include "alloc/mem_pool.h"
+#include "bench_common.h"
+#include "metadata/metadata_snapshot.h"
+#include "metadata/module_def.h"
+#include "metadata/pe_image_reader.h"
+
+using leanclr::alloc::GeneralAllocation;
+using leanclr::alloc::MemPool;
+using leanclr::metadata::ClassLayoutData;
+using leanclr::metadata::CliImage;
+using leanclr::metadata::MetadataSnapshot;
+using leanclr::metadata::PeImageReader;
+using leanclr::metadata::RtAssembly;
+using leanclr::metadata::RtModuleDef;
+using leanclr::metadata::RtToken;
+using leanclr::metadata::TableType;
+
+namespace leanclr::bench
+{
+
+namespace
+{
+constexpr size_t LOAD_ITERATIONS = 40;
+constexpr size_t LOAD_ROUNDS = 8;
+
+// An image parsed into its own pool, and optionally the module RtModuleDef::load set up over it.
+struct LoadedImage
+{
+    MemPool* pool = nullptr;
+    CliImage* image = nullptr;
+    RtAssembly* ass = nullptr;
+    RtModuleDef* mod = nullptr;
+
+    ~LoadedImage()
+    {
+        if (mod)
+            GeneralAllocation::delete_any(mod);
+        if (ass)
+            GeneralAllocation::free(ass);
+        if (pool)
+            GeneralAllocation::delete_any(pool);
+    }
+};
+
+bool parse_image(std::vector<uint8_t>& data, LoadedImage& loaded)
+{
+    loaded.pool = GeneralAllocation::new_any<MemPool>(alloc::MemoryCategory::Metadata);
+    PeImageReader reader(data.data(), data.size());
+    auto image_ret = reader.ReadCliImage(*loaded.pool);
+    if (image_ret.is_err())
+        return false;
+    loaded.image = image_ret.unwrap();
+    return loaded.image->load_streams().is_ok() && loaded.image->load_tables(*loaded.pool).is_ok();
+}
+
+bool load_module(std::vector<uint8_t>& data, LoadedImage& loaded)
+{
+    if (!parse_image(data, loaded))
+        return false;
+    loaded.ass = GeneralAllocation::malloc_any_zeroed<RtAssembly>();
+    loaded.mod = GeneralAllocation::new_any<RtModuleDef>(loaded.ass, *loaded.image, *loaded.pool);
+    loaded.ass->mod = loaded.mod;
+    return loaded.mod->load().is_ok();
+}
+
+bool read_file(const char* path, std::vector<uint8_t>& data)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+    data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !data.empty();
+}
+
+// Snapshot of the tables of a module loaded from data. The module is registered only while it is written.
+bool write_snapshot(std::vector<uint8_t>& data, std::vector<uint8_t>& snapshot)
+{
+    LoadedImage loaded;
+    if (!load_module(data, loaded))
+        return false;
+    // Collectible so that it can be unregistered again.
+    loaded.mod->set_collectible();
+    RtModuleDef::register_module_def(loaded.mod);
+    snapshot.resize(MetadataSnapshot::write(nullptr, 0));
+    MetadataSnapshot::write(snapshot.data(), snapshot.size());
+    RtModuleDef::unregister_module_def(loaded.mod);
+    return true;
+}
+
+// The restored tables must answer every lookup RtModuleDef::load serves the way the built ones do.
+bool same_tables(RtModuleDef& built, RtModuleDef& restored)
+{
+    const CliImage& image = built.get_cli_image();
+    uint32_t type_def_count = image.get_table_row_num(TableType::TypeDef);
+    for (uint32_t rid = 1; rid <= type_def_count; ++rid)
+    {
+        auto token = RtToken::encode(TableType::TypeDef, rid);
+        if (built.get_enclosing_type_def_rid(token) != restored.get_enclosing_type_def_rid(token))
+            return false;
+        std::optional<ClassLayoutData> built_layout = built.get_class_layout_data(token);
+        std::optional<ClassLayoutData> restored_layout = restored.get_class_layout_data(token);
+        if (built_layout.has_value() != restored_layout.has_value() ||
+            (built_layout && (built_layout->packing != restored_layout->packing || built_layout->size != restored_layout->size)))
+            return false;
+        if (built.get_enclosing_type_def_rid(token))
+            continue;
+        // Nested types are not in the full name map.
+        auto row = image.read_type_def(rid).value();
+        const char* name = built.get_string(row.type_name).unwrap();
+        const char* namespaze = built.get_string(row.type_namespace).unwrap();
+        auto built_gid = built.get_type_def_gid_by_name2(namespaze, name, false);
+        auto restored_gid = restored.get_type_def_gid_by_name2(namespaze, name, false);
+        if (built_gid.is_err() || restored_gid.is_err() || (built_gid.unwrap() == 0) != (restored_gid.unwrap() == 0))
+            return false;
+    }
+    uint32_t field_count = image.get_table_row_num(TableType::Field);
+    for (uint32_t rid = 1; rid <= field_count; ++rid)
+    {
+        auto token = RtToken::encode(TableType::Field, rid);
+        if (built.get_field_offset(token) != restored.get_field_offset(token))
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+// Times RtModuleDef::load of a corlib with its lookup tables built from the metadata tables, as on a cold
+// start, against restoring them from a MetadataSnapshot. The image is read from LEANCLR_BENCH_CORLIB.
+bool run_metadata_snapshot()
+{
+    const char* path = std::getenv("LEANCLR_BENCH_CORLIB");
+    std::vector<uint8_t> data;
+    if (!path || !read_file(path, data))
+    {
+        std::printf("  skipped: set LEANCLR_BENCH_CORLIB to the path of a corlib image\n");
+        return true;
+    }
+
+    std::vector<uint8_t> snapshot;
+    if (!write_snapshot(data, snapshot))
+    {
+        std::printf("  failed to load %s\n", path);
+        return false;
+    }
+
+    LoadedImage built;
+    if (!load_module(data, built) || built.mod->is_loaded_from_snapshot())
+        return false;
+    if (MetadataSnapshot::set(snapshot.data(), snapshot.size()).is_err())
+        return false;
+    bool valid;
+    {
+        LoadedImage restored;
+        valid = load_module(data, restored) && restored.mod->is_loaded_from_snapshot() && same_tables(*built.mod, *restored.mod);
+    }
+    MetadataSnapshot::clear();
+    if (!valid)
+        return false;
+
+    auto load = [&] {
+        LoadedImage loaded;
+        return load_module(data, loaded) ? 1 : 0;
+    };
+    double parse_ns = measure_ns_per_op(
+        [&] {
+            LoadedImage loaded;
+            return parse_image(data, loaded) ? 1 : 0;
+        },
+        LOAD_ITERATIONS);
+    // Alternate the two and keep the fastest round of each, since a load takes long enough to be disturbed by
+    // anything else running.
+    double cold_ns = 0;
+    double restore_ns = 0;
+    for (size_t round = 0; round < LOAD_ROUNDS; ++round)
+    {
+        double ns = measure_ns_per_op(load, LOAD_ITERATIONS);
+        cold_ns = round == 0 ? ns : std::min(cold_ns, ns);
+        MetadataSnapshot::set(snapshot.data(), snapshot.size());
+        ns = measure_ns_per_op(load, LOAD_ITERATIONS);
+        restore_ns = round == 0 ? ns : std::min(restore_ns, ns);
+        MetadataSnapshot::clear();
+    }
+
+    uint32_t type_def_count = built.image->get_table_row_num(TableType::TypeDef);
+    std::printf("  %s: %zu bytes, %u types, snapshot %zu bytes, image parse %.3f ms\n", path, data.size(), type_def_count, snapshot.size(),
+                parse_ns / 1e6);
+    report("load from snapshot", type_def_count, restore_ns, cold_ns);
+    return true;
+}
+
+} // namespace leanclr::bench
@@ -0,0 +1,278 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#endif
+
+#include "bench_common.h"
+#include "interp/machine_state.h"
+#include "metadata/rt_metadata.h"
+#include "vm/profiler.h"
+
+using leanclr::interp::InterpFrame;
+using leanclr::interp::MachineState;
+using leanclr::metadata::RtClass;
+using leanclr::metadata::RtMethodInfo;
+using leanclr::vm::Profiler;
+
+namespace leanclr::bench
+{
+
+namespace
+{
+constexpr int32_t SAMPLE_FREQUENCY_HZ = 2000;
+constexpr auto SAMPLING_DURATION = std::chrono::milliseconds(300);
+// The overhead target is under 1% at this frequency.
+constexpr int32_t OVERHEAD_FREQUENCY_HZ = 1000;
+constexpr size_t OVERHEAD_ROUNDS = 10;
+constexpr size_t OVERHEAD_ITERATIONS = 1 << 22;
+constexpr uint32_t SAMPLE_COST_FRAMES = 64;
+constexpr int32_t SAMPLE_COST_SIGNALS = 4096;
+
+RtClass s_class;
+RtMethodInfo s_outer;
+RtMethodInfo s_middle;
+RtMethodInfo s_inner;
+RtMethodInfo s_other;
+RtMethodInfo s_leaf;
+
+void init_methods()
+{
+    s_class.namespaze = "Bench";
+    s_class.name = "Sampled";
+    RtMethodInfo* methods[] = {&s_outer, &s_middle, &s_inner, &s_other, &s_leaf};
+    const char* names[] = {"Outer", "Middle", "Inner", "Other", "Leaf"};
+    for (size_t i = 0; i < 5; ++i)
+    {
+        methods[i]->parent = &s_class;
+        methods[i]->name = names[i];
+    }
+}
+
+bool push(MachineState& ms, const RtMethodInfo* method)
+{
+    auto ret = ms.alloc_frame_stack();
+    if (ret.is_err())
+        return false;
+    ret.unwrap()->method = method;
+    return true;
+}
+
+// Alternates Outer;Middle;Inner with Outer;Other;Leaf, so that every frame slot is reused by another method.
+// A sample must never pair a method with the stale caller or callee of the other stack.
+int64_t churn(MachineState& ms)
+{
+    ms.set_frame_stack_top(0);
+    bool ok = push(ms, &s_outer) && push(ms, &s_middle) && push(ms, &s_inner);
+    ms.set_frame_stack_top(1);
+    ok = ok && push(ms, &s_other) && push(ms, &s_leaf);
+    ms.set_frame_stack_top(0);
+    return ok ? 1 : 0;
+}
+
+// CPU time of the calling thread, which includes the signal handler taking samples on it but not the time
+// other processes run on its core.
+double thread_cpu_ns()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user);
+    auto to_ns = [](const FILETIME& t) { return (static_cast<double>(t.dwHighDateTime) * 4294967296.0 + t.dwLowDateTime) * 100.0; };
+    return to_ns(kernel) + to_ns(user);
+#else
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) * 1e9 + static_cast<double>(ts.tv_nsec);
+#endif
+}
+
+double churn_cpu_ns_per_op(MachineState& ms)
+{
+    int64_t acc = 0;
+    double start = thread_cpu_ns();
+    for (size_t i = 0; i < OVERHEAD_ITERATIONS; ++i)
+    {
+        acc += churn(ms);
+    }
+    double end = thread_cpu_ns();
+    keep_alive(acc);
+    return (end - start) / static_cast<double>(OVERHEAD_ITERATIONS);
+}
+
+// Fastest of several rounds of the churn with and without sampling at OVERHEAD_FREQUENCY_HZ, in CPU time of
+// the sampled thread and alternated so that both see the same machine load. Returns false if the profiler
+// is not available.
+bool measure_overhead(MachineState& ms, double& unsampled_ns, double& sampled_ns)
+{
+    for (size_t round = 0; round < OVERHEAD_ROUNDS; ++round)
+    {
+        double ns = churn_cpu_ns_per_op(ms);
+        unsampled_ns = round == 0 ? ns : std::min(unsampled_ns, ns);
+        if (Profiler::start(OVERHEAD_FREQUENCY_HZ, 0).is_err())
+            return false;
+        ns = churn_cpu_ns_per_op(ms);
+        Profiler::stop();
+        sampled_ns = round == 0 ? ns : std::min(sampled_ns, ns);
+    }
+    Profiler::reset();
+    return true;
+}
+
+#ifndef _WIN32
+// Wall time of one sample on the sampled thread, delivering SIGPROF and copying the frames in the handler,
+// with as many frames as a sample holds. The sampler thread aggregates samples on another core.
+double measure_sample_cost_ns(MachineState& ms)
+{
+    ms.set_frame_stack_top(0);
+    for (uint32_t i = 0; i < SAMPLE_COST_FRAMES; ++i)
+    {
+        if (!push(ms, &s_inner))
+            return -1;
+    }
+    double cost_ns = -1;
+    for (size_t round = 0; round < OVERHEAD_ROUNDS; ++round)
+    {
+        // Room for every signal, so that none takes the cheaper dropped sample path.
+        if (Profiler::start(OVERHEAD_FREQUENCY_HZ, SAMPLE_COST_SIGNALS * 2).is_err())
+            return -1;
+        pthread_t self = pthread_self();
+        auto start = std::chrono::steady_clock::now();
+        for (int32_t i = 0; i < SAMPLE_COST_SIGNALS; ++i)
+        {
+            // Delivered before pthread_kill returns, since the signal is sent to the calling thread.
+            pthread_kill(self, SIGPROF);
+        }
+        auto end = std::chrono::steady_clock::now();
+        Profiler::stop();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / SAMPLE_COST_SIGNALS;
+        cost_ns = round == 0 ? ns : std::min(cost_ns, ns);
+    }
+    ms.set_frame_stack_top(0);
+    Profiler::reset();
+    return cost_ns;
+}
+#endif
+
+bool is_valid_frame(size_t depth, const std::string& frame, const std::string& caller)
+{
+    // A frame sampled between its allocation and its method store reports no method.
+    if (frame == "[unknown]")
+        return true;
+    switch (depth)
+    {
+    case 0:
+        return frame == "Bench.Sampled::Outer";
+    case 1:
+        return frame == "Bench.Sampled::Middle" || frame == "Bench.Sampled::Other";
+    case 2:
+        return (frame == "Bench.Sampled::Inner" && caller == "Bench.Sampled::Middle") ||
+               (frame == "Bench.Sampled::Leaf" && caller == "Bench.Sampled::Other");
+    default:
+        return false;
+    }
+}
+
+bool validate_collapsed_stacks(const std::string& text)
+{
+    size_t line_begin = 0;
+    while (line_begin < text.size())
+    {
+        size_t line_end = text.find('\n', line_begin);
+        if (line_end == std::string::npos)
+            return false;
+        size_t stack_end = text.rfind(' ', line_end);
+        if (stack_end == std::string::npos || stack_end < line_begin)
+            return false;
+        std::string stack = text.substr(line_begin, stack_end - line_begin);
+        if (stack != "[native]")
+        {
+            std::string caller;
+            size_t depth = 0;
+            size_t frame_begin = 0;
+            while (frame_begin <= stack.size())
+            {
+                size_t frame_end = stack.find(';', frame_begin);
+                if (frame_end == std::string::npos)
+                    frame_end = stack.size();
+                std::string frame = stack.substr(frame_begin, frame_end - frame_begin);
+                if (!is_valid_frame(depth, frame, caller))
+                {
+                    std::printf("  unexpected stack: %s\n", stack.c_str());
+                    return false;
+                }
+                caller = frame;
+                ++depth;
+                frame_begin = frame_end + 1;
+            }
+        }
+        line_begin = line_end + 1;
+    }
+    return true;
+}
+} // namespace
+
+bool run_profiler()
+{
+    init_methods();
+    MachineState::initialize();
+    MachineState& ms = MachineState::get_global_machine_state();
+
+    size_t iterations = 1 << 16;
+    double unsampled_ns = measure_ns_per_op([&] { return churn(ms); }, iterations);
+
+    Profiler::reset();
+    if (Profiler::start(SAMPLE_FREQUENCY_HZ, 0).is_err())
+    {
+        // Builds without thread support have no sampler.
+        std::printf("  profiler not available\n");
+        return true;
+    }
+    int64_t pushed = 0;
+    auto deadline = std::chrono::steady_clock::now() + SAMPLING_DURATION;
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        for (int i = 0; i < 1024; ++i)
+        {
+            pushed += churn(ms);
+        }
+    }
+    double sampled_ns = measure_ns_per_op([&] { return churn(ms); }, iterations);
+    Profiler::stop();
+
+    uint64_t samples = Profiler::get_sample_count();
+    std::string text(Profiler::write_collapsed_stacks(nullptr, 0, false), '\0');
+    Profiler::write_collapsed_stacks(text.data(), text.size(), false);
+    text.resize(text.size() - 1);
+    Profiler::reset();
+
+    std::printf("  samples %llu, dropped %llu\n", static_cast<unsigned long long>(samples),
+                static_cast<unsigned long long>(Profiler::get_dropped_sample_count()));
+    if (pushed == 0 || samples == 0 || !validate_collapsed_stacks(text))
+        return false;
+    report("frame churn sampled", 3, sampled_ns, unsampled_ns);
+
+    double overhead_unsampled_ns = 0;
+    double overhead_sampled_ns = 0;
+    if (!measure_overhead(ms, overhead_unsampled_ns, overhead_sampled_ns))
+        return false;
+    // Differences of a fraction of a percent are within the noise of this comparison.
+    report("frame churn at 1 kHz", 3, overhead_sampled_ns, overhead_unsampled_ns);
+#ifndef _WIN32
+    double sample_cost_ns = measure_sample_cost_ns(ms);
+    if (sample_cost_ns < 0)
+        return false;
+    std::printf("  sample cost %.0f ns at %u frames: %.3f%% of the sampled thread at %d Hz (target < 1%%)\n", sample_cost_ns,
+                SAMPLE_COST_FRAMES, sample_cost_ns * OVERHEAD_FREQUENCY_HZ / 1e9 * 100, OVERHEAD_FREQUENCY_HZ);
+#endif
+    return true;
+}
+
+} // namespace leanclr::bench
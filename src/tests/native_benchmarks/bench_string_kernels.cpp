@@ -0,0 +1,136 @@
+#include <cstring>
+#include <vector>
+
+#include "bench_common.h"
+#include "utils/string_kernels.h"
+
+using leanclr::Utf16Char;
+using leanclr::utils::StringKernels;
+
+namespace leanclr::bench
+{
+
+namespace
+{
+size_t ref_mismatch(const Utf16Char* a, const Utf16Char* b, size_t length)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (a[i] != b[i])
+            return i;
+    }
+    return length;
+}
+
+int32_t ref_index_of_char(const Utf16Char* s, size_t length, Utf16Char value)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (s[i] == value)
+            return static_cast<int32_t>(i);
+    }
+    return -1;
+}
+
+int32_t ref_index_of_any(const Utf16Char* s, size_t length, const Utf16Char* any_of, size_t any_of_length)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        for (size_t j = 0; j < any_of_length; ++j)
+        {
+            if (s[i] == any_of[j])
+                return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+int32_t ref_index_of_string(const Utf16Char* s, size_t length, const Utf16Char* value, size_t value_length)
+{
+    if (value_length > length)
+        return -1;
+    for (size_t i = 0; i <= length - value_length; ++i)
+    {
+        if (std::memcmp(s + i, value, value_length * sizeof(Utf16Char)) == 0)
+            return static_cast<int32_t>(i);
+    }
+    return -1;
+}
+
+std::vector<Utf16Char> make_text(size_t length, uint32_t seed)
+{
+    std::vector<Utf16Char> text(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        text[i] = static_cast<Utf16Char>('a' + (seed >> 16) % 16);
+    }
+    return text;
+}
+
+bool validate()
+{
+    const Utf16Char any_of[] = {'x', 'y', 'z', 0x4E2D};
+    for (size_t length = 0; length < 80; ++length)
+    {
+        std::vector<Utf16Char> a = make_text(length, static_cast<uint32_t>(length));
+        if (StringKernels::hash_code(a.data(), length) != StringKernels::hash_code_scalar(a.data(), length))
+            return false;
+        for (size_t pos = 0; pos <= length; ++pos)
+        {
+            std::vector<Utf16Char> b = a;
+            std::vector<Utf16Char> c = a;
+            if (pos < length)
+            {
+                b[pos] = 'A';
+                c[pos] = any_of[pos % 4];
+            }
+            if (StringKernels::mismatch(a.data(), b.data(), length) != ref_mismatch(a.data(), b.data(), length))
+                return false;
+            if (StringKernels::index_of_char(b.data(), length, 'A') != ref_index_of_char(b.data(), length, 'A'))
+                return false;
+            if (StringKernels::index_of_any(c.data(), length, any_of, 4) != ref_index_of_any(c.data(), length, any_of, 4))
+                return false;
+            for (size_t value_length = 1; value_length <= 5 && pos + value_length <= length; ++value_length)
+            {
+                if (StringKernels::index_of_string(a.data(), length, a.data() + pos, value_length) !=
+                    ref_index_of_string(a.data(), length, a.data() + pos, value_length))
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+bool run_string_kernels()
+{
+    if (!validate())
+        return false;
+
+    const size_t lengths[] = {8, 32, 128, 1024, 16384};
+    const Utf16Char any_of[] = {'x', 'y', 'z'};
+    const Utf16Char needle[] = {'a', 'b', 'c', 'x'};
+    for (size_t length : lengths)
+    {
+        std::vector<Utf16Char> a = make_text(length, 7);
+        std::vector<Utf16Char> b = a;
+        const Utf16Char* pa = a.data();
+        const Utf16Char* pb = b.data();
+        size_t iterations = 4 * 1024 * 1024 / length + 16;
+
+        report("hash_code", length, measure_ns_per_op([&] { return StringKernels::hash_code(pa, length); }, iterations),
+               measure_ns_per_op([&] { return StringKernels::hash_code_scalar(pa, length); }, iterations));
+        report("ordinal_equals", length, measure_ns_per_op([&] { return static_cast<int64_t>(StringKernels::mismatch(pa, pb, length)); }, iterations),
+               measure_ns_per_op([&] { return static_cast<int64_t>(ref_mismatch(pa, pb, length)); }, iterations));
+        report("index_of_char", length, measure_ns_per_op([&] { return StringKernels::index_of_char(pa, length, 'x'); }, iterations),
+               measure_ns_per_op([&] { return ref_index_of_char(pa, length, 'x'); }, iterations));
+        report("index_of_any", length, measure_ns_per_op([&] { return StringKernels::index_of_any(pa, length, any_of, 3); }, iterations),
+               measure_ns_per_op([&] { return ref_index_of_any(pa, length, any_of, 3); }, iterations));
+        report("index_of_string", length, measure_ns_per_op([&] { return StringKernels::index_of_string(pa, length, needle, 4); }, iterations),
+               measure_ns_per_op([&] { return ref_index_of_string(pa, length, needle, 4); }, iterations));
+    }
+    return true;
+}
+
+} // namespace leanclr::bench
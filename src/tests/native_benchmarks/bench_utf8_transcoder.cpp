@@ -0,0 +1,147 @@
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+#include "utf8/utf8.h"
+#include "utils/utf8_transcoder.h"
+
+using leanclr::Utf16Char;
+using leanclr::utils::Utf8Transcoder;
+
+namespace leanclr::bench
+{
+
+namespace
+{
+// Text of `length` code points, a `non_ascii_percent` share of which are 2, 3 or 4 byte sequences.
+std::vector<Utf16Char> make_text(size_t length, uint32_t non_ascii_percent, uint32_t seed)
+{
+    std::vector<Utf16Char> text;
+    for (size_t i = 0; i < length; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        uint32_t r = (seed >> 16) % 100;
+        if (r >= non_ascii_percent)
+        {
+            text.push_back(static_cast<Utf16Char>(' ' + r % 90));
+        }
+        else if (r % 3 == 0)
+        {
+            text.push_back(static_cast<Utf16Char>(0xE9));
+        }
+        else if (r % 3 == 1)
+        {
+            text.push_back(static_cast<Utf16Char>(0x4E2D + r));
+        }
+        else
+        {
+            text.push_back(0xD83D);
+            text.push_back(static_cast<Utf16Char>(0xDE00 + r));
+        }
+    }
+    return text;
+}
+
+// The conversions the runtime used before Utf8Transcoder: over-reserved output, no validation.
+size_t ref_utf8_to_utf16(const std::string& utf8, std::vector<Utf16Char>& utf16)
+{
+    utf16.clear();
+    utf16.reserve(utf8.size());
+    utf8::unchecked::utf8to16(utf8.begin(), utf8.end(), std::back_inserter(utf16));
+    return utf16.size();
+}
+
+size_t ref_utf16_to_utf8(const std::vector<Utf16Char>& utf16, std::string& utf8)
+{
+    utf8.resize(utf16.size() * 4 + 1);
+    char* end = utf8::unchecked::utf16to8(utf16.begin(), utf16.end(), &utf8[0]);
+    return static_cast<size_t>(end - utf8.data());
+}
+
+bool round_trips(const std::vector<Utf16Char>& text)
+{
+    bool valid;
+    std::string utf8(Utf8Transcoder::get_utf8_length(text.data(), text.size(), &valid), '\0');
+    if (!valid || Utf8Transcoder::utf16_to_utf8(text.data(), text.size(), &utf8[0], utf8.size()) != utf8.size())
+        return false;
+    std::string expected_utf8;
+    expected_utf8.resize(ref_utf16_to_utf8(text, expected_utf8));
+    if (utf8 != expected_utf8)
+        return false;
+
+    std::vector<Utf16Char> utf16(Utf8Transcoder::get_utf16_length(utf8.data(), utf8.size(), &valid));
+    if (!valid || Utf8Transcoder::utf8_to_utf16(utf8.data(), utf8.size(), utf16.data(), utf16.size()) != utf16.size())
+        return false;
+    return utf16 == text;
+}
+
+bool validate()
+{
+    for (size_t length = 0; length < 80; ++length)
+    {
+        for (uint32_t non_ascii_percent : {0u, 5u, 50u, 100u})
+        {
+            if (!round_trips(make_text(length, non_ascii_percent, static_cast<uint32_t>(length))))
+                return false;
+        }
+    }
+
+    // Each maximal ill-formed subpart becomes one U+FFFD.
+    const std::string ill_formed = "a\x80" "b\xE0\x80" "c\xF0\x9F\x98" "d\xED\xA0\x80";
+    const std::vector<Utf16Char> replaced = {'a', 0xFFFD, 'b', 0xFFFD, 0xFFFD, 'c', 0xFFFD, 'd', 0xFFFD, 0xFFFD, 0xFFFD};
+    bool valid;
+    std::vector<Utf16Char> decoded(Utf8Transcoder::get_utf16_length(ill_formed.data(), ill_formed.size(), &valid));
+    Utf8Transcoder::utf8_to_utf16(ill_formed.data(), ill_formed.size(), decoded.data(), decoded.size());
+    if (valid || decoded != replaced)
+        return false;
+
+    const Utf16Char lone_surrogates[] = {'a', 0xDC00, 0xD800};
+    std::string encoded(Utf8Transcoder::get_utf8_length(lone_surrogates, 3, &valid), '\0');
+    Utf8Transcoder::utf16_to_utf8(lone_surrogates, 3, &encoded[0], encoded.size());
+    return !valid && encoded == "a\xEF\xBF\xBD\xEF\xBF\xBD";
+}
+} // namespace
+
+bool run_utf8_transcoder()
+{
+    if (!validate())
+        return false;
+
+    const size_t lengths[] = {16, 128, 1024, 16384};
+    for (uint32_t non_ascii_percent : {0u, 10u})
+    {
+        std::printf("  non-ASCII %u%%\n", non_ascii_percent);
+        for (size_t length : lengths)
+        {
+            std::vector<Utf16Char> text = make_text(length, non_ascii_percent, 7);
+            std::string utf8;
+            utf8.resize(ref_utf16_to_utf8(text, utf8));
+            std::vector<Utf16Char> utf16_out(text.size());
+            std::vector<Utf16Char> ref_utf16_out;
+            std::string utf8_out(utf8.size(), '\0');
+            std::string ref_utf8_out;
+            size_t iterations = 4 * 1024 * 1024 / length + 16;
+
+            report("utf8_to_utf16", length,
+                   measure_ns_per_op(
+                       [&] {
+                           size_t n = Utf8Transcoder::get_utf16_length(utf8.data(), utf8.size());
+                           return static_cast<int64_t>(n + Utf8Transcoder::utf8_to_utf16(utf8.data(), utf8.size(), utf16_out.data(), n));
+                       },
+                       iterations),
+                   measure_ns_per_op([&] { return static_cast<int64_t>(ref_utf8_to_utf16(utf8, ref_utf16_out)); }, iterations));
+            report("utf16_to_utf8", length,
+                   measure_ns_per_op(
+                       [&] {
+                           size_t n = Utf8Transcoder::get_utf8_length(text.data(), text.size());
+                           return static_cast<int64_t>(n + Utf8Transcoder::utf16_to_utf8(text.data(), text.size(), &utf8_out[0], n));
+                       },
+                       iterations),
+                   measure_ns_per_op([&] { return static_cast<int64_t>(ref_utf16_to_utf8(text, ref_utf8_out)); }, iterations));
+        }
+    }
+    return true;
+}
+
+} // namespace leanclr::bench
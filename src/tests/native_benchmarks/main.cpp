@@ -0,0 +1,39 @@
+#include <cstring>
+
+#include "bench_common.h"
+
+using namespace leanclr::bench;
+
+static const BenchmarkGroup s_groups[] = {
+    {"string_kernels", run_string_kernels},
+    {"float_format", run_float_format},
+    {"utf8_transcoder", run_utf8_transcoder},
+    {"metadata_layout", run_metadata_layout},
+    {"metadata_snapshot", run_metadata_snapshot},
+    {"profiler", run_profiler},
+};
+
+// Usage: native_benchmarks [group...]; runs every group when none is given.
+int main(int argc, char** argv)
+{
+    bool ok = true;
+    for (const BenchmarkGroup& group : s_groups)
+    {
+        bool selected = argc <= 1;
+        for (int i = 1; i < argc && !selected; ++i)
+        {
+            selected = std::strcmp(argv[i], group.name) == 0;
+        }
+        if (!selected)
+        {
+            continue;
+        }
+        std::printf("[%s]\n", group.name);
+        if (!group.run())
+        {
+            std::printf("[%s] FAILED validation\n", group.name);
+            ok = false;
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -16,6 +16,14 @@ if not exist "%RUNNER%" (
 if errorlevel 1 (
     echo Some tests failed.
     endlocal & exit /b %ERRORLEVEL%
+)
+
+rem Again with stack segments small enough that every test crosses segment boundaries.
+%RUNNER% --tiny-stack-segments
+
+if errorlevel 1 (
+    echo Some tests failed with tiny stack segments.
+    endlocal & exit /b %ERRORLEVEL%
 ) else (
     echo All tests passed.
 )
\ No newline at end of file